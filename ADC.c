@@ -16,6 +16,18 @@
 #include "ADC.h"
 #include "ADC_MemMap.h"
 #include "helped_macros.h"
+#include "GPIO.h"
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* port and pin of every analog channel from AN0 to AN12 */
+static const uint8 g_u8channels_port_arr[] = {GPIO_PORTA , GPIO_PORTA , GPIO_PORTA , GPIO_PORTA ,
+        GPIO_PORTA , GPIO_PORTE , GPIO_PORTE , GPIO_PORTE , GPIO_PORTB , GPIO_PORTB , GPIO_PORTB ,
+        GPIO_PORTB , GPIO_PORTB};
+static const uint8 g_u8channels_pin_arr[] = {GPIO_PIN0 , GPIO_PIN1 , GPIO_PIN2 , GPIO_PIN3 ,
+        GPIO_PIN5 , GPIO_PIN0 , GPIO_PIN1 , GPIO_PIN2 , GPIO_PIN2 , GPIO_PIN3 , GPIO_PIN1 ,
+        GPIO_PIN4 , GPIO_PIN0};
 
 /*******************************************************************************
  *                      Functions implementation                               *
@@ -39,67 +51,60 @@ void ADC_Initialization(EnumADC_channels_t a_ADC_channel_t)
     ADC_CONTROL_REG_0 &= 0xC3;
     /* select the ADC channel by control register 0 */
     ADC_CONTROL_REG_0 |= a_ADC_channel_t << 2;
-    /* enable selected channel pins for ADC module and set the direction of this
-     *  pin as input*/
+    /* enable selected channel pins for ADC module */
     ADC_CONTROL_REG_1 &= 0xF0;
     switch(a_ADC_channel_t)
     {
         case ADC_CHANNEL_0:
             ADC_CONTROL_REG_1 |= 0x0E;
-            SET_BIT(GPIO_DIRECTION_PORTA , GPIO_PIN0);
             break;   
         case ADC_CHANNEL_1:
             ADC_CONTROL_REG_1 |= 0x0D;
-            SET_BIT(GPIO_DIRECTION_PORTA , GPIO_PIN1);
             break;
         case ADC_CHANNEL_2:
             ADC_CONTROL_REG_1 |= 0x0C;
-            SET_BIT(GPIO_DIRECTION_PORTA , GPIO_PIN2);             
             break;
         case ADC_CHANNEL_3:
             ADC_CONTROL_REG_1 |= 0x0B;
-            SET_BIT(GPIO_DIRECTION_PORTA , GPIO_PIN3);
             break;
         case ADC_CHANNEL_4:
             ADC_CONTROL_REG_1 |= 0x0A;
-            SET_BIT(GPIO_DIRECTION_PORTA , GPIO_PIN5);
             break;
         case ADC_CHANNEL_5:
             ADC_CONTROL_REG_1 |= 0x09;
-            SET_BIT(GPIO_DIRECTION_PORTE , GPIO_PIN0);
             break;
         case ADC_CHANNEL_6:
             ADC_CONTROL_REG_1 |= 0x08;
-            SET_BIT(GPIO_DIRECTION_PORTE , GPIO_PIN1);
             break;
         case ADC_CHANNEL_7:
             ADC_CONTROL_REG_1 |= 0x07;
-            SET_BIT(GPIO_DIRECTION_PORTE , GPIO_PIN2);
             break;
         case ADC_CHANNEL_8:
             ADC_CONTROL_REG_1 |= 0x06;
-            SET_BIT(GPIO_DIRECTION_PORTB , GPIO_PIN2);
             break;
         case ADC_CHANNEL_9:
             ADC_CONTROL_REG_1 |= 0x05;
-            SET_BIT(GPIO_DIRECTION_PORTB , GPIO_PIN3);
             break;
         case ADC_CHANNEL_10:
             ADC_CONTROL_REG_1 |= 0x04;
-            SET_BIT(GPIO_DIRECTION_PORTB , GPIO_PIN1);
             break;
         case ADC_CHANNEL_11:
             ADC_CONTROL_REG_1 |= 0x03;
-            SET_BIT(GPIO_DIRECTION_PORTB , GPIO_PIN4);
             break;
         case ADC_CHANNEL_12:
             ADC_CONTROL_REG_1 |= 0x02;
-            SET_BIT(GPIO_DIRECTION_PORTB , GPIO_PIN0);
             break;
         default:
             /*Do nothing */
             break;                                                   
     } 
+    /* selected channel enables all channels before it as analog pins, so the
+     * pins of all of them are claimed as inputs */
+    for(uint8 u8channel = ADC_CHANNEL_0 ; u8channel <= a_ADC_channel_t && u8channel <= ADC_CHANNEL_12 ; u8channel++)
+    {
+        GPIO_Claim_pins(g_u8channels_port_arr[u8channel] , 1 << g_u8channels_pin_arr[u8channel] ,
+                        GPIO_OWNER_ADC , GPIO_MODE_ANALOG);
+    }
 }
 
 /*******************************************************************************
@@ -23,7 +23,7 @@
 /*******************************************************************************
  *                              Definitions                                    *
  *******************************************************************************/
-#define ADC_CONTROL_REG_0           *(volatile uint8*)0xFC2
+#define ADC_CONTROL_REG_0           REGISTER_8BIT(0xFC2)
 #define ADC_SELECT_CHANNEL_BIT_3    5u
 #define ADC_SELECT_CHANNEL_BIT_2    4u
 #define ADC_SELECT_CHANNEL_BIT_1    3u
@@ -31,7 +31,7 @@
 #define ADC_START_CONVERSION_BIT    1u
 #define ADC_ENABLE_BIT              0u
 
-#define ADC_CONTROL_REG_1           *(volatile uint8*)0xFC1
+#define ADC_CONTROL_REG_1           REGISTER_8BIT(0xFC1)
 #define ADC_SELECT_LOW_VOLTAGE_REF  5u
 #define ADC_SELECT_HIGH_VOLTAGE_REF 4u
 #define ADC_SELECT_PINS_BIT_3       3u
@@ -39,7 +39,7 @@
 #define ADC_SELECT_PINS_BIT_1       1u
 #define ADC_SELECT_PINS_BIT_0       0u
 
-#define ADC_CONTROL_REG_2           *(volatile uint8*)0xFC0
+#define ADC_CONTROL_REG_2           REGISTER_8BIT(0xFC0)
 #define ADC_SELECT_RESULT_FORMAT    7u
 #define ADC_ACQUISITION_TIME_BIT_2  5u
 #define ADC_ACQUISITION_TIME_BIT_1  4u 
@@ -48,12 +48,12 @@
 #define ADC_SELECT_PRESCALER_BIT_1  1u 
 #define ADC_SELECT_PRESCALER_BIT_0  0u
 
-#define ADC_VALUE_HIGH              *(volatile uint8*)0xFC4
-#define ADC_VALUE_LOW               *(volatile uint8*)0xFC3
+#define ADC_VALUE_HIGH              REGISTER_8BIT(0xFC4)
+#define ADC_VALUE_LOW               REGISTER_8BIT(0xFC3)
 
-#define GPIO_DIRECTION_PORTA        *(volatile uint8*)0xF92
-#define GPIO_DIRECTION_PORTB        *(volatile uint8*)0xF93
-#define GPIO_DIRECTION_PORTE        *(volatile uint8*)0xF96
+#define GPIO_DIRECTION_PORTA        REGISTER_8BIT(0xF92)
+#define GPIO_DIRECTION_PORTB        REGISTER_8BIT(0xF93)
+#define GPIO_DIRECTION_PORTE        REGISTER_8BIT(0xF96)
 
 #define GPIO_PIN0                   0u
 #define GPIO_PIN1                   1u
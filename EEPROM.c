@@ -0,0 +1,145 @@
+/*******************************************************************************
+ *
+ * File:                EEPROM.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of internal data
+ *                      EEPROM memory.
+ *
+ * Revision history:    2/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "EEPROM.h"
+#include "EEPROM_MemMap.h"
+#include "helped_macros.h"
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	EEPROM_Read_byte
+ *
+ * Description: 	read one byte from data EEPROM.
+ *
+ * Inputs:			a_u8address       (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			value of the EEPROM location (uint8)
+ *******************************************************************************/
+uint8 EEPROM_Read_byte(uint8 a_u8address)
+{
+    /* select the location of the byte */
+    EEPROM_ADDRESS_REG = a_u8address;
+    /* point to data EEPROM memory not flash or configuration registers */
+    CLEAR_BIT(EEPROM_CONTROL_REG_1 , EEPROM_FLASH_PROGRAM_SELECT_BIT);
+    CLEAR_BIT(EEPROM_CONTROL_REG_1 , EEPROM_CONFIG_SELECT_BIT);
+    /* start read cycle, data is available in the next instruction cycle */
+    SET_BIT(EEPROM_CONTROL_REG_1 , EEPROM_READ_CONTROL_BIT);
+    return EEPROM_DATA_REG;
+}
+
+/*******************************************************************************
+ * Function Name:	EEPROM_Write_byte
+ *
+ * Description: 	write one byte in data EEPROM and wait until the write
+ *                  cycle finishes.
+ *                  note: the location is written only if its value changes
+ *                        to save EEPROM endurance.
+ *
+ * Inputs:			a_u8address       (uint8)
+ *                  a_u8data          (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void EEPROM_Write_byte(uint8 a_u8address , uint8 a_u8data)
+{
+    /* state of global interrupt before the write sequence */
+    uint8 u8global_interrupt_state = 0;
+    /* don't waste write cycle if the location already has the same value */
+    if(EEPROM_Read_byte(a_u8address) != a_u8data)
+    {
+        /* select the location and the value of the byte */
+        EEPROM_ADDRESS_REG = a_u8address;
+        EEPROM_DATA_REG = a_u8data;
+        /* point to data EEPROM memory not flash or configuration registers */
+        CLEAR_BIT(EEPROM_CONTROL_REG_1 , EEPROM_FLASH_PROGRAM_SELECT_BIT);
+        CLEAR_BIT(EEPROM_CONTROL_REG_1 , EEPROM_CONFIG_SELECT_BIT);
+        /* allow write cycles */
+        SET_BIT(EEPROM_CONTROL_REG_1 , EEPROM_WRITE_ENABLE_BIT);
+        /* the required sequence must not be interrupted so disable global
+         * interrupt and save its state to return it back after the sequence */
+        u8global_interrupt_state = GET_BIT(INTERRUPT_CONTROL_REG_1 , GLOBAL_INTERRUPT_ENABLE_BIT);
+        CLEAR_BIT(INTERRUPT_CONTROL_REG_1 , GLOBAL_INTERRUPT_ENABLE_BIT);
+        /* required sequence depend on data sheet instructions */
+        EEPROM_CONTROL_REG_2 = 0x55;
+        EEPROM_CONTROL_REG_2 = 0xAA;
+        SET_BIT(EEPROM_CONTROL_REG_1 , EEPROM_WRITE_CONTROL_BIT);
+        /* return global interrupt to its previous state */
+        if(u8global_interrupt_state == 1)
+        {
+            SET_BIT(INTERRUPT_CONTROL_REG_1 , GLOBAL_INTERRUPT_ENABLE_BIT);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        /* polling until the write cycle finishes (about 4ms) */
+        while(GET_BIT(EEPROM_CONTROL_REG_1 , EEPROM_WRITE_CONTROL_BIT));
+        /* inhibit write cycles to protect EEPROM from spurious writes */
+        CLEAR_BIT(EEPROM_CONTROL_REG_1 , EEPROM_WRITE_ENABLE_BIT);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	EEPROM_Read_block
+ *
+ * Description: 	read number of successive bytes from data EEPROM.
+ *
+ * Inputs:			a_u8address       (uint8)
+ *                  a_u8size          (uint8)
+ *
+ * Outputs:			a_u8data_ptr      (uint8*) buffer to save the read bytes
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void EEPROM_Read_block(uint8 a_u8address , uint8 * a_u8data_ptr , uint8 a_u8size)
+{
+    for(uint8 u8counter = 0 ; u8counter < a_u8size ; u8counter++)
+    {
+        a_u8data_ptr[u8counter] = EEPROM_Read_byte(a_u8address + u8counter);
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	EEPROM_Write_block
+ *
+ * Description: 	write number of successive bytes in data EEPROM.
+ *
+ * Inputs:			a_u8address       (uint8)
+ *                  a_u8data_ptr      (uint8*) buffer of bytes to be written
+ *                  a_u8size          (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void EEPROM_Write_block(uint8 a_u8address , uint8 * a_u8data_ptr , uint8 a_u8size)
+{
+    for(uint8 u8counter = 0 ; u8counter < a_u8size ; u8counter++)
+    {
+        EEPROM_Write_byte(a_u8address + u8counter , a_u8data_ptr[u8counter]);
+    }
+}
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ *
+ * File:                EEPROM.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes and definitions of
+ *                      internal data EEPROM memory.
+ *
+ * Revision history:    2/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef EEPROM_H
+#define	EEPROM_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* size of data EEPROM in PIC18F4520 in bytes */
+#define EEPROM_SIZE                 256u
+/* value of any erased EEPROM location */
+#define EEPROM_ERASED_VALUE         0xFF
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	EEPROM_Read_byte
+ *
+ * Description: 	read one byte from data EEPROM.
+ *
+ * Inputs:			a_u8address       (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			value of the EEPROM location (uint8)
+ *******************************************************************************/
+extern uint8 EEPROM_Read_byte(uint8 a_u8address);
+
+/*******************************************************************************
+ * Function Name:	EEPROM_Write_byte
+ *
+ * Description: 	write one byte in data EEPROM and wait until the write
+ *                  cycle finishes.
+ *                  note: the location is written only if its value changes
+ *                        to save EEPROM endurance.
+ *
+ * Inputs:			a_u8address       (uint8)
+ *                  a_u8data          (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void EEPROM_Write_byte(uint8 a_u8address , uint8 a_u8data);
+
+/*******************************************************************************
+ * Function Name:	EEPROM_Read_block
+ *
+ * Description: 	read number of successive bytes from data EEPROM.
+ *
+ * Inputs:			a_u8address       (uint8)
+ *                  a_u8size          (uint8)
+ *
+ * Outputs:			a_u8data_ptr      (uint8*) buffer to save the read bytes
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void EEPROM_Read_block(uint8 a_u8address , uint8 * a_u8data_ptr , uint8 a_u8size);
+
+/*******************************************************************************
+ * Function Name:	EEPROM_Write_block
+ *
+ * Description: 	write number of successive bytes in data EEPROM.
+ *
+ * Inputs:			a_u8address       (uint8)
+ *                  a_u8data_ptr      (uint8*) buffer of bytes to be written
+ *                  a_u8size          (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void EEPROM_Write_block(uint8 a_u8address , uint8 * a_u8data_ptr , uint8 a_u8size);
+
+#endif	/* EEPROM_H */
+
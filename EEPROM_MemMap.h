@@ -0,0 +1,44 @@
+/**********************************************************************************
+ *
+ * File:                EEPROM_MemMap.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains registers and bits that control data EEPROM
+ *                      memory.
+ *
+ * Revision history:    2/3/2020
+ *
+ **********************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef EEPROM_MEM_MAP_H
+#define	EEPROM_MEM_MAP_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+#define EEPROM_CONTROL_REG_1                    REGISTER_8BIT(0xFA6)
+#define EEPROM_FLASH_PROGRAM_SELECT_BIT         7u
+#define EEPROM_CONFIG_SELECT_BIT                6u
+#define EEPROM_WRITE_ERROR_FLAG_BIT             3u
+#define EEPROM_WRITE_ENABLE_BIT                 2u
+#define EEPROM_WRITE_CONTROL_BIT                1u
+#define EEPROM_READ_CONTROL_BIT                 0u
+
+#define EEPROM_CONTROL_REG_2                    REGISTER_8BIT(0xFA7)
+
+#define EEPROM_DATA_REG                         REGISTER_8BIT(0xFA8)
+#define EEPROM_ADDRESS_REG                      REGISTER_8BIT(0xFA9)
+
+#define INTERRUPT_CONTROL_REG_1                 REGISTER_8BIT(0xFF2)
+#define GLOBAL_INTERRUPT_ENABLE_BIT             7u
+
+#endif	/* EEPROM_MEM_MAP_H */
+
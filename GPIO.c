@@ -16,6 +16,14 @@
 #include "GPIO_MemMap.h"
 #include "helped_macros.h"
 
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* owner of every pin which claimed it (EnumGPIO_owner_t) */
+static uint8 g_u8pins_owner_arr[GPIO_PORTS_NUMBER][GPIO_PINS_NUMBER];
+/* number of refused claims */
+static uint8 g_u8conflicts_number = 0;
+
 /*******************************************************************************
  *                      Functions implementation                                   *
  *******************************************************************************/
@@ -466,26 +474,144 @@ EnumGPIO_Status_t GPIO_WriteOnPort(uint8 a_u8port , uint8 a_u8value)
     EnumGPIO_Status_t retVal = GPIO_UNCORRECT_SET;
     /* check on inserted Port */
     switch(a_u8port)
+    {
+        /* one write of the value without clearing the port before it */
+        case GPIO_PORTA:
+            GPIO_WRITE_VALUE_PORTA = a_u8value;
+            break;
+        case GPIO_PORTB:
+            GPIO_WRITE_VALUE_PORTB = a_u8value;
+            break;
+        case GPIO_PORTC:
+            GPIO_WRITE_VALUE_PORTC = a_u8value;
+            break;
+        case GPIO_PORTD:
+            GPIO_WRITE_VALUE_PORTD = a_u8value;
+            break;
+        case GPIO_PORTE:
+            GPIO_WRITE_VALUE_PORTE ^= (GPIO_WRITE_VALUE_PORTE ^ a_u8value) & 0x07;
+            break;
+        default:
+            /* inserted port doesn't met the limits on ports in this micro_controller */
+            retVal = GPIO_UNCORRECT_SET;
+            break;
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	GPIO_WriteOnPortMasked
+ *
+ * Description: 	Write value on the masked pins of GPIO port by one write on
+ *                  its latch, the other pins aren't changed even if interrupt
+ *                  changes them during the write.
+ *
+ * Inputs:			a_u8port          (uint8)
+ *                  a_u8pins_mask     (uint8) bit of every written pin
+ *                  a_u8value         (uint8) value of pins at their bits
+ *
+ * Outputs:			NULL
+ *
+ * Return:			Status to check function execution correctly (EnumGPIO_Status_t)
+ *******************************************************************************/
+EnumGPIO_Status_t GPIO_WriteOnPortMasked(uint8 a_u8port , uint8 a_u8pins_mask , uint8 a_u8value)
+{
+    /* return variable that obvious if function executed right or wrong */
+    EnumGPIO_Status_t retVal = GPIO_CORRECT_SET;
+    /* the changed bits are computed then they are toggled by one xor on the
+     * latch, so it's one write and the unmasked bits are xored by zero */
+    switch(a_u8port)
+    {
+        case GPIO_PORTA:
+            GPIO_WRITE_VALUE_PORTA ^= (GPIO_WRITE_VALUE_PORTA ^ a_u8value) & a_u8pins_mask;
+            break;
+        case GPIO_PORTB:
+            GPIO_WRITE_VALUE_PORTB ^= (GPIO_WRITE_VALUE_PORTB ^ a_u8value) & a_u8pins_mask;
+            break;
+        case GPIO_PORTC:
+            GPIO_WRITE_VALUE_PORTC ^= (GPIO_WRITE_VALUE_PORTC ^ a_u8value) & a_u8pins_mask;
+            break;
+        case GPIO_PORTD:
+            GPIO_WRITE_VALUE_PORTD ^= (GPIO_WRITE_VALUE_PORTD ^ a_u8value) & a_u8pins_mask;
+            break;
+        case GPIO_PORTE:
+            GPIO_WRITE_VALUE_PORTE ^= (GPIO_WRITE_VALUE_PORTE ^ a_u8value) & a_u8pins_mask & 0x07;
+            break;
+        default:
+            /* inserted port doesn't met the limits on ports in this micro_controller */
+            retVal = GPIO_UNCORRECT_SET;
+            break;
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	GPIO_SetPins
+ *
+ * Description: 	Write one on the masked pins of GPIO port together.
+ *
+ * Inputs:			a_u8port          (uint8)
+ *                  a_u8pins_mask     (uint8) bit of every pin
+ *
+ * Outputs:			NULL
+ *
+ * Return:			Status to check function execution correctly (EnumGPIO_Status_t)
+ *******************************************************************************/
+EnumGPIO_Status_t GPIO_SetPins(uint8 a_u8port , uint8 a_u8pins_mask)
+{
+    return GPIO_WriteOnPortMasked(a_u8port , a_u8pins_mask , 0xFF);
+}
+
+/*******************************************************************************
+ * Function Name:	GPIO_ClearPins
+ *
+ * Description: 	Write zero on the masked pins of GPIO port together.
+ *
+ * Inputs:			a_u8port          (uint8)
+ *                  a_u8pins_mask     (uint8) bit of every pin
+ *
+ * Outputs:			NULL
+ *
+ * Return:			Status to check function execution correctly (EnumGPIO_Status_t)
+ *******************************************************************************/
+EnumGPIO_Status_t GPIO_ClearPins(uint8 a_u8port , uint8 a_u8pins_mask)
+{
+    return GPIO_WriteOnPortMasked(a_u8port , a_u8pins_mask , 0x00);
+}
+
+/*******************************************************************************
+ * Function Name:	GPIO_TogglePins
+ *
+ * Description: 	Toggle the masked pins of GPIO port together.
+ *
+ * Inputs:			a_u8port          (uint8)
+ *                  a_u8pins_mask     (uint8) bit of every pin
+ *
+ * Outputs:			NULL
+ *
+ * Return:			Status to check function execution correctly (EnumGPIO_Status_t)
+ *******************************************************************************/
+EnumGPIO_Status_t GPIO_TogglePins(uint8 a_u8port , uint8 a_u8pins_mask)
+{
+    /* return variable that obvious if function executed right or wrong */
+    EnumGPIO_Status_t retVal = GPIO_CORRECT_SET;
+    /* check on inserted Port */
+    switch(a_u8port)
     {
         case GPIO_PORTA:
-            GPIO_WRITE_VALUE_PORTA &= 0x00;
-            GPIO_WRITE_VALUE_PORTA |= a_u8value;
+            GPIO_WRITE_VALUE_PORTA ^= a_u8pins_mask;
             break;
         case GPIO_PORTB:
-            GPIO_WRITE_VALUE_PORTB &= 0x00;
-            GPIO_WRITE_VALUE_PORTB |= a_u8value;
+            GPIO_WRITE_VALUE_PORTB ^= a_u8pins_mask;
             break;
         case GPIO_PORTC:
-            GPIO_WRITE_VALUE_PORTC &= 0x00;
-            GPIO_WRITE_VALUE_PORTC |= a_u8value;
+            GPIO_WRITE_VALUE_PORTC ^= a_u8pins_mask;
             break;
         case GPIO_PORTD:
-            GPIO_WRITE_VALUE_PORTD &= 0x00;
-            GPIO_WRITE_VALUE_PORTD |= a_u8value;
+            GPIO_WRITE_VALUE_PORTD ^= a_u8pins_mask;
             break;
         case GPIO_PORTE:
-            GPIO_WRITE_VALUE_PORTE &= 0xF8;
-            GPIO_WRITE_VALUE_PORTE |= (a_u8value & 0x07);
+            GPIO_WRITE_VALUE_PORTE ^= a_u8pins_mask & 0x07;
             break;
         default:
             /* inserted port doesn't met the limits on ports in this micro_controller */
@@ -495,6 +621,70 @@ EnumGPIO_Status_t GPIO_WriteOnPort(uint8 a_u8port , uint8 a_u8value)
     return retVal;
 }
 
+/*******************************************************************************
+ * Function Name:	GPIO_WriteOnGroup
+ *
+ * Description: 	Write on pins group which may span ports, every pin is put on
+ *                  its level of the group (HIGH) or on the inverse level (LOW),
+ *                  the pins of every port are written together.
+ *
+ * Inputs:			a_group_ptr       (const StrGPIO_group_t*)
+ *                  a_u8value         (uint8) HIGH or LOW
+ *
+ * Outputs:			NULL
+ *
+ * Return:			Status to check function execution correctly (EnumGPIO_Status_t)
+ *******************************************************************************/
+EnumGPIO_Status_t GPIO_WriteOnGroup(const StrGPIO_group_t * a_group_ptr , uint8 a_u8value)
+{
+    /* return variable that obvious if function executed right or wrong */
+    EnumGPIO_Status_t retVal = GPIO_CORRECT_SET;
+    uint8 u8level = 0;
+    for(uint8 u8port = GPIO_PORTA ; u8port <= GPIO_PORTE ; u8port++)
+    {
+        u8level = (a_u8value == HIGH) ? a_group_ptr->u8levels_arr[u8port] : ~a_group_ptr->u8levels_arr[u8port];
+        if(a_group_ptr->u8masks_arr[u8port] != 0)
+        {
+            GPIO_WriteOnPortMasked(u8port , a_group_ptr->u8masks_arr[u8port] , u8level);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	GPIO_ToggleGroup
+ *
+ * Description: 	Toggle all pins of pins group, the pins of every port are
+ *                  toggled together.
+ *
+ * Inputs:			a_group_ptr       (const StrGPIO_group_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			Status to check function execution correctly (EnumGPIO_Status_t)
+ *******************************************************************************/
+EnumGPIO_Status_t GPIO_ToggleGroup(const StrGPIO_group_t * a_group_ptr)
+{
+    /* return variable that obvious if function executed right or wrong */
+    EnumGPIO_Status_t retVal = GPIO_CORRECT_SET;
+    for(uint8 u8port = GPIO_PORTA ; u8port <= GPIO_PORTE ; u8port++)
+    {
+        if(a_group_ptr->u8masks_arr[u8port] != 0)
+        {
+            GPIO_TogglePins(u8port , a_group_ptr->u8masks_arr[u8port]);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    return retVal;
+}
+
 /*******************************************************************************
  * Function Name:	GPIO_ReadFromPin
  *
@@ -866,3 +1056,115 @@ void GPIO_Disable_Pull_Up_On_PortB(void)
     SET_BIT(INTERRUPT_CONTROL_REGISTER , ENABLE_PULL_UP_RESISTOR_ON_PORTB_BIT);
 }
 
+/*******************************************************************************
+ * Function Name:	GPIO_Claim_pins
+ *
+ * Description: 	register owner of pins and set their direction by the mode,
+ *                  every driver claims its pins at initialization so two
+ *                  drivers which use the same pin are detected.
+ *                  note: the claim is refused if any pin of it is owned by
+ *                        another owner and the refused claims are counted.
+ *
+ * Inputs:			a_u8port          (uint8)
+ *                  a_u8pins_mask     (uint8) bit of every claimed pin
+ *                  a_owner_t         (EnumGPIO_owner_t)
+ *                  a_mode_t          (EnumGPIO_mode_t)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			Status to check function execution correctly (EnumGPIO_Status_t)
+ *******************************************************************************/
+EnumGPIO_Status_t GPIO_Claim_pins(uint8 a_u8port , uint8 a_u8pins_mask ,
+                                 EnumGPIO_owner_t a_owner_t , EnumGPIO_mode_t a_mode_t)
+{
+    /* return variable that obvious if function executed right or wrong */
+    EnumGPIO_Status_t retVal = GPIO_UNCORRECT_SET;
+    uint8 u8owner = GPIO_OWNER_NONE;
+    if(a_u8port < GPIO_PORTS_NUMBER && a_owner_t != GPIO_OWNER_NONE)
+    {
+        retVal = GPIO_CORRECT_SET;
+        /* all pins should be free or owned by the same owner */
+        for(uint8 u8pin = GPIO_PIN0 ; u8pin <= GPIO_PIN7 ; u8pin++)
+        {
+            u8owner = g_u8pins_owner_arr[a_u8port][u8pin];
+            if(GET_BIT(a_u8pins_mask , u8pin) != 0 && u8owner != GPIO_OWNER_NONE && u8owner != a_owner_t)
+            {
+                retVal = GPIO_UNCORRECT_SET;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        if(retVal == GPIO_CORRECT_SET)
+        {
+            for(uint8 u8pin = GPIO_PIN0 ; u8pin <= GPIO_PIN7 ; u8pin++)
+            {
+                if(GET_BIT(a_u8pins_mask , u8pin) != 0)
+                {
+                    g_u8pins_owner_arr[a_u8port][u8pin] = a_owner_t;
+                    /* analog pin is input pin */
+                    GPIO_SetPinDirection(a_u8port , u8pin , (a_mode_t == GPIO_MODE_OUTPUT) ? OUTPUT : INPUT);
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+        }
+        else
+        {
+            g_u8conflicts_number++;
+        }
+    }
+    else
+    {
+        /* inserted port doesn't met the limits on ports in this micro_controller */
+        retVal = GPIO_UNCORRECT_SET;
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	GPIO_Get_pin_owner
+ *
+ * Description: 	get owner of pin which claimed it.
+ *
+ * Inputs:			a_u8port          (uint8)
+ *                  a_u8pin           (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			owner of pin or GPIO_OWNER_NONE (EnumGPIO_owner_t)
+ *******************************************************************************/
+EnumGPIO_owner_t GPIO_Get_pin_owner(uint8 a_u8port , uint8 a_u8pin)
+{
+    EnumGPIO_owner_t retVal = GPIO_OWNER_NONE;
+    if(a_u8port < GPIO_PORTS_NUMBER && a_u8pin <= GPIO_PIN7)
+    {
+        retVal = (EnumGPIO_owner_t)g_u8pins_owner_arr[a_u8port][a_u8pin];
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	GPIO_Get_conflicts_number
+ *
+ * Description: 	get number of refused claims because their pins are owned
+ *                  by other owners.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			number of conflicts (uint8)
+ *******************************************************************************/
+uint8 GPIO_Get_conflicts_number(void)
+{
+    return g_u8conflicts_number;
+}
+
@@ -38,6 +38,17 @@
 #define GPIO_PIN6                   6u
 #define GPIO_PIN7                   7u
 
+#define GPIO_PORTS_NUMBER           5u
+#define GPIO_PINS_NUMBER            8u
+
+/* mask of pin in one port of pins group, it makes the group constant at
+ * build time as: #define GROUP_MASK(PORT) (GPIO_GROUP_MASK(PORT , LED_PORT , LED_PIN) | ...)
+ *                const StrGPIO_group_t group = {GPIO_GROUP_PORTS(GROUP_MASK) , ...}; */
+#define GPIO_GROUP_MASK(PORT,PIN_PORT,PIN)  (((PORT) == (PIN_PORT)) ? (1u << (PIN)) : 0u)
+#define GPIO_GROUP_PORTS(PORT_MACRO)        {PORT_MACRO(GPIO_PORTA) , PORT_MACRO(GPIO_PORTB) , \
+                                             PORT_MACRO(GPIO_PORTC) , PORT_MACRO(GPIO_PORTD) , \
+                                             PORT_MACRO(GPIO_PORTE)}
+
 /*******************************************************************************
  *                         Types Declaration                                   *
  *******************************************************************************/
@@ -48,6 +59,32 @@ typedef enum {
     GPIO_UNCORRECT_SET
 }EnumGPIO_Status_t;
 
+/************************** EnumGPIO_owner_t ***********************************/
+typedef enum {
+    GPIO_OWNER_NONE,
+    GPIO_OWNER_APPLICATION,
+    GPIO_OWNER_LCD,
+    GPIO_OWNER_KEYPAD,
+    GPIO_OWNER_ADC,
+    GPIO_OWNER_PWM,
+    GPIO_OWNER_HEATER,
+    GPIO_OWNER_BUTTONS,
+    GPIO_OWNER_BUZZER
+}EnumGPIO_owner_t;
+
+/************************** EnumGPIO_mode_t ************************************/
+typedef enum {
+    GPIO_MODE_INPUT,
+    GPIO_MODE_OUTPUT,
+    GPIO_MODE_ANALOG
+}EnumGPIO_mode_t;
+
+/************************** StrGPIO_group_t ************************************/
+typedef struct{
+    uint8 u8masks_arr[GPIO_PORTS_NUMBER];       /* pins of the group in every port */
+    uint8 u8levels_arr[GPIO_PORTS_NUMBER];      /* level of every pin when the group is HIGH */
+}StrGPIO_group_t;
+
 /*******************************************************************************
  *                      Functions Prototypes                                   *
  *******************************************************************************/
@@ -110,6 +147,95 @@ extern EnumGPIO_Status_t GPIO_WriteOnPin(uint8 a_u8port , uint8 a_u8pin , uint8
  *******************************************************************************/
 extern EnumGPIO_Status_t GPIO_WriteOnPort(uint8 a_u8port , uint8 a_u8value);
 
+/*******************************************************************************
+ * Function Name:	GPIO_WriteOnPortMasked
+ *
+ * Description: 	Write value on the masked pins of GPIO port by one write on
+ *                  its latch, the other pins aren't changed even if interrupt
+ *                  changes them during the write.
+ *
+ * Inputs:			a_u8port          (uint8)
+ *                  a_u8pins_mask     (uint8) bit of every written pin
+ *                  a_u8value         (uint8) value of pins at their bits
+ *
+ * Outputs:			NULL
+ *
+ * Return:			Status to check function execution correctly (EnumGPIO_Status_t)
+ *******************************************************************************/
+extern EnumGPIO_Status_t GPIO_WriteOnPortMasked(uint8 a_u8port , uint8 a_u8pins_mask , uint8 a_u8value);
+
+/*******************************************************************************
+ * Function Name:	GPIO_SetPins
+ *
+ * Description: 	Write one on the masked pins of GPIO port together.
+ *
+ * Inputs:			a_u8port          (uint8)
+ *                  a_u8pins_mask     (uint8) bit of every pin
+ *
+ * Outputs:			NULL
+ *
+ * Return:			Status to check function execution correctly (EnumGPIO_Status_t)
+ *******************************************************************************/
+extern EnumGPIO_Status_t GPIO_SetPins(uint8 a_u8port , uint8 a_u8pins_mask);
+
+/*******************************************************************************
+ * Function Name:	GPIO_ClearPins
+ *
+ * Description: 	Write zero on the masked pins of GPIO port together.
+ *
+ * Inputs:			a_u8port          (uint8)
+ *                  a_u8pins_mask     (uint8) bit of every pin
+ *
+ * Outputs:			NULL
+ *
+ * Return:			Status to check function execution correctly (EnumGPIO_Status_t)
+ *******************************************************************************/
+extern EnumGPIO_Status_t GPIO_ClearPins(uint8 a_u8port , uint8 a_u8pins_mask);
+
+/*******************************************************************************
+ * Function Name:	GPIO_TogglePins
+ *
+ * Description: 	Toggle the masked pins of GPIO port together.
+ *
+ * Inputs:			a_u8port          (uint8)
+ *                  a_u8pins_mask     (uint8) bit of every pin
+ *
+ * Outputs:			NULL
+ *
+ * Return:			Status to check function execution correctly (EnumGPIO_Status_t)
+ *******************************************************************************/
+extern EnumGPIO_Status_t GPIO_TogglePins(uint8 a_u8port , uint8 a_u8pins_mask);
+
+/*******************************************************************************
+ * Function Name:	GPIO_WriteOnGroup
+ *
+ * Description: 	Write on pins group which may span ports, every pin is put on
+ *                  its level of the group (HIGH) or on the inverse level (LOW),
+ *                  the pins of every port are written together.
+ *
+ * Inputs:			a_group_ptr       (const StrGPIO_group_t*)
+ *                  a_u8value         (uint8) HIGH or LOW
+ *
+ * Outputs:			NULL
+ *
+ * Return:			Status to check function execution correctly (EnumGPIO_Status_t)
+ *******************************************************************************/
+extern EnumGPIO_Status_t GPIO_WriteOnGroup(const StrGPIO_group_t * a_group_ptr , uint8 a_u8value);
+
+/*******************************************************************************
+ * Function Name:	GPIO_ToggleGroup
+ *
+ * Description: 	Toggle all pins of pins group, the pins of every port are
+ *                  toggled together.
+ *
+ * Inputs:			a_group_ptr       (const StrGPIO_group_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			Status to check function execution correctly (EnumGPIO_Status_t)
+ *******************************************************************************/
+extern EnumGPIO_Status_t GPIO_ToggleGroup(const StrGPIO_group_t * a_group_ptr);
+
 /*******************************************************************************
  * Function Name:	GPIO_ReadFromPin
  *
@@ -217,5 +343,54 @@ extern void GPIO_Enable_Pull_Up_On_PortB(void);
  *******************************************************************************/
 extern void GPIO_Disable_Pull_Up_On_PortB(void);
 
+/*******************************************************************************
+ * Function Name:	GPIO_Claim_pins
+ *
+ * Description: 	register owner of pins and set their direction by the mode,
+ *                  every driver claims its pins at initialization so two
+ *                  drivers which use the same pin are detected.
+ *                  note: the claim is refused if any pin of it is owned by
+ *                        another owner and the refused claims are counted.
+ *
+ * Inputs:			a_u8port          (uint8)
+ *                  a_u8pins_mask     (uint8) bit of every claimed pin
+ *                  a_owner_t         (EnumGPIO_owner_t)
+ *                  a_mode_t          (EnumGPIO_mode_t)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			Status to check function execution correctly (EnumGPIO_Status_t)
+ *******************************************************************************/
+extern EnumGPIO_Status_t GPIO_Claim_pins(uint8 a_u8port , uint8 a_u8pins_mask ,
+                                        EnumGPIO_owner_t a_owner_t , EnumGPIO_mode_t a_mode_t);
+
+/*******************************************************************************
+ * Function Name:	GPIO_Get_pin_owner
+ *
+ * Description: 	get owner of pin which claimed it.
+ *
+ * Inputs:			a_u8port          (uint8)
+ *                  a_u8pin           (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			owner of pin or GPIO_OWNER_NONE (EnumGPIO_owner_t)
+ *******************************************************************************/
+extern EnumGPIO_owner_t GPIO_Get_pin_owner(uint8 a_u8port , uint8 a_u8pin);
+
+/*******************************************************************************
+ * Function Name:	GPIO_Get_conflicts_number
+ *
+ * Description: 	get number of refused claims because their pins are owned
+ *                  by other owners.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			number of conflicts (uint8)
+ *******************************************************************************/
+extern uint8 GPIO_Get_conflicts_number(void);
+
 #endif	/* GPIO_H */
 
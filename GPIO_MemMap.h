@@ -24,27 +24,27 @@
 /*******************************************************************************
  *                              Definitions                                    *
  *******************************************************************************/
-#define GPIO_DIRECTION_PORTA                    *(volatile uint8*)0xF92
-#define GPIO_DIRECTION_PORTB                    *(volatile uint8*)0xF93
-#define GPIO_DIRECTION_PORTC                    *(volatile uint8*)0xF94
-#define GPIO_DIRECTION_PORTD                    *(volatile uint8*)0xF95
-#define GPIO_DIRECTION_PORTE                    *(volatile uint8*)0xF96
-
-#define GPIO_READ_VALUE_PORTA                   *(volatile uint8*)0xF80
-#define GPIO_READ_VALUE_PORTB                   *(volatile uint8*)0xF81
-#define GPIO_READ_VALUE_PORTC                   *(volatile uint8*)0xF82
-#define GPIO_READ_VALUE_PORTD                   *(volatile uint8*)0xF83
-#define GPIO_READ_VALUE_PORTE                   *(volatile uint8*)0xF84
-
-#define GPIO_WRITE_VALUE_PORTA                  *(volatile uint8*)0xF89
-#define GPIO_WRITE_VALUE_PORTB                  *(volatile uint8*)0xF8A
-#define GPIO_WRITE_VALUE_PORTC                  *(volatile uint8*)0xF8B
-#define GPIO_WRITE_VALUE_PORTD                  *(volatile uint8*)0xF8C
-#define GPIO_WRITE_VALUE_PORTE                  *(volatile uint8*)0xF8D
-
-#define ADC_CONTROL_REGISTER_1                  *(volatile uint8*)0xFC1
-#define COMPARATOR_CONTROL_REGISTER             *(volatile uint8*)0xFB4
-#define INTERRUPT_CONTROL_REGISTER              *(volatile uint8*)0xFF1
+#define GPIO_DIRECTION_PORTA                    REGISTER_8BIT(0xF92)
+#define GPIO_DIRECTION_PORTB                    REGISTER_8BIT(0xF93)
+#define GPIO_DIRECTION_PORTC                    REGISTER_8BIT(0xF94)
+#define GPIO_DIRECTION_PORTD                    REGISTER_8BIT(0xF95)
+#define GPIO_DIRECTION_PORTE                    REGISTER_8BIT(0xF96)
+
+#define GPIO_READ_VALUE_PORTA                   REGISTER_8BIT(0xF80)
+#define GPIO_READ_VALUE_PORTB                   REGISTER_8BIT(0xF81)
+#define GPIO_READ_VALUE_PORTC                   REGISTER_8BIT(0xF82)
+#define GPIO_READ_VALUE_PORTD                   REGISTER_8BIT(0xF83)
+#define GPIO_READ_VALUE_PORTE                   REGISTER_8BIT(0xF84)
+
+#define GPIO_WRITE_VALUE_PORTA                  REGISTER_8BIT(0xF89)
+#define GPIO_WRITE_VALUE_PORTB                  REGISTER_8BIT(0xF8A)
+#define GPIO_WRITE_VALUE_PORTC                  REGISTER_8BIT(0xF8B)
+#define GPIO_WRITE_VALUE_PORTD                  REGISTER_8BIT(0xF8C)
+#define GPIO_WRITE_VALUE_PORTE                  REGISTER_8BIT(0xF8D)
+
+#define ADC_CONTROL_REGISTER_1                  REGISTER_8BIT(0xFC1)
+#define COMPARATOR_CONTROL_REGISTER             REGISTER_8BIT(0xFB4)
+#define INTERRUPT_CONTROL_REGISTER              REGISTER_8BIT(0xFF1)
 #define ENABLE_PULL_UP_RESISTOR_ON_PORTB_BIT    7u
 
 #endif	/* GPIO_MEM_MAP_H */
@@ -4,6 +4,8 @@
  * Author:              Ahmed Eldakhly
  * 
  * Comments:            it contains functions implementation of Keypad module.
+ *                      the whole matrix is read every scan to bitmap of keys
+ *                      and the debounced changes of it are the events.
  * 
  * Revision history:    21/2/2020
  * 
@@ -12,16 +14,73 @@
 /*******************************************************************************
  *                             Included libraries
  /******************************************************************************/
-#include "keyPad.h"
+#include "KeyPad.h"
 #include "KeyPad_config.h"
 #include "GPIO.h"
-#define _XTAL_FREQ 8000000
-#include <xc.h>
+#include "helped_macros.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* index of no key in the bitmap */
+#define KEYPAD_NO_INDEX             0xFFu
+/* pins of rows and columns */
+#define KEYPAD_ROWS_MASK            (((1u << N_ROW) - 1u) << START_ROW)
+#define KEYPAD_COLS_MASK            (((1u << N_COL) - 1u) << START_COL)
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* debounced state of keys, bit of key is (row * N_COL + column) */
+static uint16 g_u16keys_bitmap = 0;
+/* last read bitmap and number of scans which read it */
+static uint16 g_u16last_scan_bitmap = 0;
+static uint8 g_u8equal_scans = 0;
+/* flag of the last scan which is ignored because of ghosting */
+static uint8 g_u8ghosting_flag = FALSE;
+/* the last pressed key which is held to make long press and repeat events */
+static uint8 g_u8held_index = KEYPAD_NO_INDEX;
+static uint8 g_u8long_press_flag = FALSE;
+static uint16 g_u16press_time = 0;
+static uint16 g_u16repeat_time = 0;
+/* events queue */
+static StrKeyPad_event_t g_events_arr[KEYPAD_EVENTS_QUEUE_SIZE];
+static uint8 g_u8events_head = 0;
+static uint8 g_u8events_number = 0;
 
 /*******************************************************************************
  *                           Static Functions                                  *
  *******************************************************************************/
 
+/*******************************************************************************
+ * Function Name:	KeyPad_read_matrix
+ *
+ * Description: 	read all keys by putting zero on one row at a time.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u8columns_arr   (uint8*) pressed columns of every row
+ *
+ * Return:			bitmap of pressed keys (uint16)
+ *******************************************************************************/
+static uint16 KeyPad_read_matrix(uint8 * a_u8columns_arr);
+
+/*******************************************************************************
+ * Function Name:	KeyPad_add_event
+ *
+ * Description: 	add event of key to the events queue, the event is
+ *                  dropped if the queue is full.
+ *
+ * Inputs:			a_u8index         (uint8) bit of key in the bitmap
+ *                  a_event_t         (EnumKeyPad_event_t)
+ *                  a_u16time         (uint16)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void KeyPad_add_event(uint8 a_u8index , EnumKeyPad_event_t a_event_t , uint16 a_u16time);
+
 /********************************************************************************
  * Function Name:	KeyPad_4x4_switch
  *
@@ -43,7 +102,7 @@ static uint8 KeyPad_switch(uint8 a_u8row, uint8 a_u8col);
 /********************************************************************************
  * Function Name:	KeyPad_Initialization
  *
- * Description: 	Initialize KeyPad by set directions of Keypad pins 
+ * Description: 	Initialize KeyPad by claiming Keypad pins with their directions
  *
  * Inputs:			NULL
  *
@@ -54,62 +113,287 @@ static uint8 KeyPad_switch(uint8 a_u8row, uint8 a_u8col);
 void KeyPad_Initialization(void)
 {
 	/* set keypad rows pins as output */
-    for(uint8 u8counter = START_ROW ; u8counter <= END_ROW ; u8counter++)
+    GPIO_Claim_pins(KEYPAD_PORT_OUT_ROW , KEYPAD_ROWS_MASK , GPIO_OWNER_KEYPAD , GPIO_MODE_OUTPUT);
+    GPIO_SetPins(KEYPAD_PORT_OUT_ROW , KEYPAD_ROWS_MASK);
+    /* set keypad columns pins as input */
+    GPIO_Claim_pins(KEYPAD_PORT_IN_COL , KEYPAD_COLS_MASK , GPIO_OWNER_KEYPAD , GPIO_MODE_INPUT);
+}
+
+/*******************************************************************************
+ * Function Name:	KeyPad_scan
+ *
+ * Description: 	read all keys of the matrix, accept their new state after
+ *                  KEYPAD_DEBOUNCE_SCANS equal scans and add press, release,
+ *                  long press and repeat events to the events queue.
+ *                  note: scan of ghosting keys (3 keys at corners of rectangle
+ *                        make the fourth key pressed) is ignored.
+ *
+ * Inputs:			a_u16time         (uint16) current system tick
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void KeyPad_scan(uint16 a_u16time)
+{
+    uint8 u8columns_arr[N_ROW];
+    uint8 u8common_columns = 0;
+    uint16 u16bitmap = KeyPad_read_matrix(u8columns_arr);
+    uint16 u16changes = 0;
+    /* two rows with two common columns are four keys which one of them may be
+     * not pressed and read as pressed through the other three keys */
+    g_u8ghosting_flag = FALSE;
+    for(uint8 u8row = 0 ; u8row < N_ROW ; u8row++)
     {
-        GPIO_SetPinDirection(KEYPAD_PORT_OUT_ROW , u8counter , OUTPUT);
-        GPIO_WriteOnPin(KEYPAD_PORT_OUT_ROW , u8counter , HIGH);
+        for(uint8 u8other_row = u8row + 1 ; u8other_row < N_ROW ; u8other_row++)
+        {
+            u8common_columns = u8columns_arr[u8row] & u8columns_arr[u8other_row];
+            if((u8common_columns & (u8common_columns - 1)) != 0)
+            {
+                g_u8ghosting_flag = TRUE;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
     }
-    /* set keypad columns pins as input */
-    for(uint8 u8counter = START_COL ; u8counter <= END_COL ; u8counter++)
+    /* the state is changed after equal scans, ghosting scan restarts the count */
+    if(g_u8ghosting_flag == TRUE)
+    {
+        g_u8equal_scans = 0;
+    }
+    else if(u16bitmap != g_u16last_scan_bitmap)
+    {
+        g_u16last_scan_bitmap = u16bitmap;
+        g_u8equal_scans = 1;
+    }
+    else if(g_u8equal_scans < KEYPAD_DEBOUNCE_SCANS)
+    {
+        g_u8equal_scans++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    if(g_u8equal_scans >= KEYPAD_DEBOUNCE_SCANS && u16bitmap != g_u16keys_bitmap)
+    {
+        u16changes = u16bitmap ^ g_u16keys_bitmap;
+        g_u16keys_bitmap = u16bitmap;
+        for(uint8 u8index = 0 ; u8index < N_ROW * N_COL ; u8index++)
+        {
+            if(GET_BIT(u16changes , u8index) == 0)
+            {
+                /* Do nothing */
+            }
+            else if(GET_BIT(u16bitmap , u8index) != 0)
+            {
+                KeyPad_add_event(u8index , KEYPAD_EVENT_PRESS , a_u16time);
+                /* the last pressed key is the held key */
+                g_u8held_index = u8index;
+                g_u8long_press_flag = FALSE;
+                g_u16press_time = a_u16time;
+            }
+            else
+            {
+                KeyPad_add_event(u8index , KEYPAD_EVENT_RELEASE , a_u16time);
+                if(u8index == g_u8held_index)
+                {
+                    g_u8held_index = KEYPAD_NO_INDEX;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* long press then repeat events while the key is held */
+    if(g_u8held_index == KEYPAD_NO_INDEX)
+    {
+        /* Do nothing */
+    }
+    else if(g_u8long_press_flag == FALSE && (uint16)(a_u16time - g_u16press_time) >= KEYPAD_LONG_PRESS_TICKS)
+    {
+        KeyPad_add_event(g_u8held_index , KEYPAD_EVENT_LONG_PRESS , a_u16time);
+        g_u8long_press_flag = TRUE;
+        g_u16repeat_time = a_u16time;
+    }
+    else if(g_u8long_press_flag == TRUE && (uint16)(a_u16time - g_u16repeat_time) >= KEYPAD_REPEAT_TICKS)
+    {
+        KeyPad_add_event(g_u8held_index , KEYPAD_EVENT_REPEAT , a_u16time);
+        g_u16repeat_time = a_u16time;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	KeyPad_getEvent
+ *
+ * Description: 	get the oldest event from the events queue.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_event_ptr       (StrKeyPad_event_t*)
+ *
+ * Return:			TRUE if event is read, FALSE if the queue is empty (uint8)
+ *******************************************************************************/
+uint8 KeyPad_getEvent(StrKeyPad_event_t * a_event_ptr)
+{
+    uint8 retVal = FALSE;
+    if(g_u8events_number > 0)
     {
-        GPIO_SetPinDirection(KEYPAD_PORT_IN_COL , u8counter , INPUT);
+        *a_event_ptr = g_events_arr[g_u8events_head];
+        g_u8events_head = (g_u8events_head + 1) % KEYPAD_EVENTS_QUEUE_SIZE;
+        g_u8events_number--;
+        retVal = TRUE;
     }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	KeyPad_getKeysBitmap
+ *
+ * Description: 	get state of all keys after debouncing, bit of key is
+ *                  (row * N_COL + column).
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			bitmap of pressed keys (uint16)
+ *******************************************************************************/
+uint16 KeyPad_getKeysBitmap(void)
+{
+    return g_u16keys_bitmap;
+}
+
+/*******************************************************************************
+ * Function Name:	KeyPad_isGhosting
+ *
+ * Description: 	check if the last scan is ignored because of ghosting.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE or FALSE (uint8)
+ *******************************************************************************/
+uint8 KeyPad_isGhosting(void)
+{
+    return g_u8ghosting_flag;
 }
 
 /*******************************************************************************
  * Function Name:	KeyPad_getPressedKey
  *
- * Description: 	Return value of pressed key
+ * Description: 	Return value of pressed key from the next press event, the
+ *                  other events before it are dropped.
  *
  * Inputs:			NULL
  *
  * Outputs:			NULL
  *
- * Return:			uint8       pressed key 
+ * Return:			uint8       pressed key or KEYPAD_NO_KEY
  *******************************************************************************/
 uint8 KeyPad_getPressedKey(void)
 {
 	/*return value*/
-	uint8 ReturnVal=10;
+	uint8 ReturnVal = KEYPAD_NO_KEY;
+    StrKeyPad_event_t event;
+    while(ReturnVal == KEYPAD_NO_KEY && KeyPad_getEvent(&event) == TRUE)
+    {
+        if(event.event_t == KEYPAD_EVENT_PRESS)
+        {
+            ReturnVal = event.u8key;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+	return ReturnVal;
+}
 
-	/*Loop on rows to check if Key is pressed to return its value*/
-	for(uint8 u8rowCounter = START_ROW ; u8rowCounter <= END_ROW ; u8rowCounter++)
-	{
+/*******************************************************************************
+ * Function Name:	KeyPad_read_matrix
+ *
+ * Description: 	read all keys by putting zero on one row at a time.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u8columns_arr   (uint8*) pressed columns of every row
+ *
+ * Return:			bitmap of pressed keys (uint16)
+ *******************************************************************************/
+static uint16 KeyPad_read_matrix(uint8 * a_u8columns_arr)
+{
+    uint16 retVal = 0;
+    uint8 u8row_mask = 1u << START_ROW;
+    for(uint8 u8row = 0 ; u8row < N_ROW ; u8row++)
+    {
+        a_u8columns_arr[u8row] = 0;
         /* put zero on row to check if any key on this row has been pressed */
-		GPIO_WriteOnPin(KEYPAD_PORT_OUT_ROW , u8rowCounter , LOW);
-        
-        /*Loop on columns to check if Key is pressed to return its value*/
-		for(uint8 u8colCounter = START_COL ; u8colCounter <= END_COL ; u8colCounter++)
-		{
-            /* check if the key on this row and this column has been pressed. */
-			if(GPIO_ReadFromPin(KEYPAD_PORT_IN_COL , u8colCounter) == LOW)
-			{
-                /* to avoid de_bouncing */
-                __delay_ms(10);
-                /* make sure the key has been pressed */
-                if(GPIO_ReadFromPin(KEYPAD_PORT_IN_COL , u8colCounter) == LOW)
-                {
-                    /* to avoid many actions for one press*/
-                    while(!(GPIO_ReadFromPin(KEYPAD_PORT_IN_COL , u8colCounter)));
-                    /* return the value assigned to this key */
-                    return KeyPad_switch(u8rowCounter - START_ROW , u8colCounter - START_COL);
-                }
-			}
-		}
+        GPIO_ClearPins(KEYPAD_PORT_OUT_ROW , u8row_mask);
+        for(uint8 u8col = 0 ; u8col < N_COL ; u8col++)
+        {
+            if(GPIO_ReadFromPin(KEYPAD_PORT_IN_COL , START_COL + u8col) == LOW)
+            {
+                SET_BIT(a_u8columns_arr[u8row] , u8col);
+                SET_BIT(retVal , (u8row * N_COL + u8col));
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
         /* put one on row to check another row next iteration */
-        GPIO_WriteOnPin(KEYPAD_PORT_OUT_ROW , u8rowCounter , HIGH);
-	}
-	return ReturnVal;
+        GPIO_SetPins(KEYPAD_PORT_OUT_ROW , u8row_mask);
+        u8row_mask <<= 1;
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	KeyPad_add_event
+ *
+ * Description: 	add event of key to the events queue, the event is
+ *                  dropped if the queue is full.
+ *
+ * Inputs:			a_u8index         (uint8) bit of key in the bitmap
+ *                  a_event_t         (EnumKeyPad_event_t)
+ *                  a_u16time         (uint16)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void KeyPad_add_event(uint8 a_u8index , EnumKeyPad_event_t a_event_t , uint16 a_u16time)
+{
+    StrKeyPad_event_t * event_ptr = NULL_PTR;
+    if(g_u8events_number < KEYPAD_EVENTS_QUEUE_SIZE)
+    {
+        event_ptr = &g_events_arr[(g_u8events_head + g_u8events_number) % KEYPAD_EVENTS_QUEUE_SIZE];
+        event_ptr->u16time = a_u16time;
+        event_ptr->u8key = KeyPad_switch(a_u8index / N_COL , a_u8index % N_COL);
+        event_ptr->event_t = a_event_t;
+        g_u8events_number++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
 }
 
 /********************************************************************************
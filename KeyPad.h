@@ -5,6 +5,8 @@
  * Author:              Ahmed Eldakhly
  * 
  * Comments:            it contains functions prototypes of Keypad module.
+ *                      the matrix is scanned without blocking every system
+ *                      tick and the changes of keys are read as events.
  * 
  * Revision history:    21/2/2020
  * 
@@ -20,6 +22,31 @@
  /******************************************************************************/
 #include "stdtypes.h"
 
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* value of no pressed key, 0 is value of key */
+#define KEYPAD_NO_KEY               0xFFu
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/*************************** EnumKeyPad_event_t ********************************/
+typedef enum{
+            KEYPAD_EVENT_PRESS,
+            KEYPAD_EVENT_RELEASE,
+            KEYPAD_EVENT_LONG_PRESS,
+            KEYPAD_EVENT_REPEAT
+}EnumKeyPad_event_t;
+
+/*************************** StrKeyPad_event_t *********************************/
+typedef struct{
+    uint16 u16time;                     /* tick of the scan which detected the event */
+    uint8  u8key;                       /* value of the key */
+    EnumKeyPad_event_t event_t;
+}StrKeyPad_event_t;
+
 /*******************************************************************************
  *                            Functions Prototype
  /******************************************************************************/
@@ -37,16 +64,75 @@
  *******************************************************************************/
 extern void KeyPad_Initialization(void);
 
+/*******************************************************************************
+ * Function Name:	KeyPad_scan
+ *
+ * Description: 	read all keys of the matrix, accept their new state after
+ *                  KEYPAD_DEBOUNCE_SCANS equal scans and add press, release,
+ *                  long press and repeat events to the events queue.
+ *                  note: scan of ghosting keys (3 keys at corners of rectangle
+ *                        make the fourth key pressed) is ignored.
+ *                  note: it should be called every system tick.
+ *
+ * Inputs:			a_u16time         (uint16) current system tick
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void KeyPad_scan(uint16 a_u16time);
+
+/*******************************************************************************
+ * Function Name:	KeyPad_getEvent
+ *
+ * Description: 	get the oldest event from the events queue.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_event_ptr       (StrKeyPad_event_t*)
+ *
+ * Return:			TRUE if event is read, FALSE if the queue is empty (uint8)
+ *******************************************************************************/
+extern uint8 KeyPad_getEvent(StrKeyPad_event_t * a_event_ptr);
+
+/*******************************************************************************
+ * Function Name:	KeyPad_getKeysBitmap
+ *
+ * Description: 	get state of all keys after debouncing, bit of key is
+ *                  (row * N_COL + column).
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			bitmap of pressed keys (uint16)
+ *******************************************************************************/
+extern uint16 KeyPad_getKeysBitmap(void);
+
+/*******************************************************************************
+ * Function Name:	KeyPad_isGhosting
+ *
+ * Description: 	check if the last scan is ignored because of ghosting.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE or FALSE (uint8)
+ *******************************************************************************/
+extern uint8 KeyPad_isGhosting(void);
+
 /*******************************************************************************
  * Function Name:	KeyPad_getPressedKey
  *
- * Description: 	Return value of pressed key
+ * Description: 	Return value of pressed key from the next press event, the
+ *                  other events before it are dropped.
  *
  * Inputs:			NULL
  *
  * Outputs:			NULL
  *
- * Return:			pressed key (uint8)
+ * Return:			pressed key or KEYPAD_NO_KEY (uint8)
  *******************************************************************************/
 extern uint8 KeyPad_getPressedKey(void);
 
@@ -135,5 +135,16 @@
 #define R4_C4                       '+'
 
 #endif
+
+/* the matrix is scanned every system tick (10ms) */
+/* number of equal scans to accept new state of keys */
+#define KEYPAD_DEBOUNCE_SCANS       2u
+/* ticks of holding key to get long press event (1 second) */
+#define KEYPAD_LONG_PRESS_TICKS     100u
+/* ticks between repeat events after long press event (200 ms) */
+#define KEYPAD_REPEAT_TICKS         20u
+/* max. number of events which are waiting to be read */
+#define KEYPAD_EVENTS_QUEUE_SIZE    8u
+
 #endif	/* KEYPAD_CONFIG_H */
 
@@ -5,6 +5,10 @@
  * Author:              Ahmed Eldakhly
  * 
  * Comments:            it contains functions implementation of LCD module.
+ *                      glyphs of CGRAM are cached with least recently used
+ *                      replacement and pinned glyphs are never replaced.
+ *                      only the data pins are written on the data port so
+ *                      it is shared with the keypad rows.
  * 
  * Revision history:    24/2/2020
  * 
@@ -15,14 +19,75 @@
  *******************************************************************************/
 #include "GPIO.h"
 #include "LCD.h"
+#include "helped_macros.h"
 #define _XTAL_FREQ 8000000
 #include <xc.h>
 
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+#if LCD_TYPE == LCD_16x2_TYPE
+#define LCD_ROWS_NUMBER                 2u
+#elif LCD_TYPE == LCD_16x4_TYPE
+#define LCD_ROWS_NUMBER                 4u
+#endif
+#define LCD_COLUMNS_NUMBER              16u
+/* execution time of the instructions in us, the clear instruction is the
+ * longest one */
+#define LCD_INSTRUCTION_TIME            40u
+#define LCD_CLEAR_TIME                  1600u
+/* pins of the data bus, the other pins of the data port may be used by
+ * other modules (as keypad rows) so only these pins are written */
+#if LCD_MODE == LCD_8BITS_MODE
+#define LCD_DATA_PINS                   0xFFu
+#elif LCD_MODE == LCD_4BITS_MODE
+#define LCD_DATA_PINS                   0xF0u
+#endif
+
 /*******************************************************************************
  *                             Static variables                                *
  *******************************************************************************/
 /* used to make data display line by line automatically */
 static uint8 g_u8position=0;
+/* glyph of every CGRAM slot, NULL_PTR if the slot is empty */
+static const uint8 * g_glyphs_ptr_arr[LCD_GLYPH_SLOTS];
+/* slots from the most recently used to the least recently used one */
+static uint8 g_u8glyphs_order_arr[LCD_GLYPH_SLOTS] = {0 , 1 , 2 , 3 , 4 , 5 , 6 , 7};
+/* bit of every pinned slot */
+static uint8 g_u8pinned_glyphs = 0;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Name:	LCD_WriteData
+ *
+ * Description: 	write data byte in DDRAM or CGRAM without changing the
+ *                  position flag.
+ *
+ * Inputs:			uint8       (data byte)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void LCD_WriteData(uint8 a_u8data);
+
+/********************************************************************************
+ * Function Name:	LCD_UseGlyphSlot
+ *
+ * Description: 	find slot of the glyph or upload it to the least recently
+ *                  used slot which isn't pinned, and make the slot the most
+ *                  recently used one.
+ *
+ * Inputs:			const uint8* a_u8glyph_ptr   rows of the glyph
+ * 
+ * Outputs:			NULL
+ *
+ * Return:			slot of the glyph or LCD_NO_GLYPH_CODE (uint8)
+ *******************************************************************************/
+static uint8 LCD_UseGlyphSlot(const uint8 * a_u8glyph_ptr);
 
 /********************************************************************************
  *                          Functions implementation							*
@@ -41,18 +106,21 @@ static uint8 g_u8position=0;
  *******************************************************************************/
 void LCD_Initialization (void)
 {
-/* check the mode of LCD 8 pins or 4 pins to send the data */
-#if LCD_MODE == LCD_8BITS_MODE
-    GPIO_SetPortDirection(LCD_DATA_PORT , OUTPUT);
-#elif LCD_MODE == LCD_4BITS_MODE
-    GPIO_SetPinDirection(LCD_DATA_PORT , GPIO_PIN4 , OUTPUT);
-    GPIO_SetPinDirection(LCD_DATA_PORT , GPIO_PIN5 , OUTPUT);
-    GPIO_SetPinDirection(LCD_DATA_PORT , GPIO_PIN6 , OUTPUT);
-    GPIO_SetPinDirection(LCD_DATA_PORT , GPIO_PIN7 , OUTPUT);
-#endif
-    GPIO_SetPinDirection(LCD_ORDER_PORT , LCD_RS_PIN , OUTPUT);
-    GPIO_SetPinDirection(LCD_ORDER_PORT , LCD_RW_PIN , OUTPUT);
-    GPIO_SetPinDirection(LCD_ORDER_PORT , LCD_E_PIN , OUTPUT);
+    /* CGRAM of LCD is empty after its power on */
+    for(uint8 u8counter = 0 ; u8counter < LCD_GLYPH_SLOTS ; u8counter++)
+    {
+        g_glyphs_ptr_arr[u8counter] = NULL_PTR;
+        g_u8glyphs_order_arr[u8counter] = u8counter;
+    }
+    g_u8pinned_glyphs = 0;
+    GPIO_Claim_pins(LCD_DATA_PORT , LCD_DATA_PINS , GPIO_OWNER_LCD , GPIO_MODE_OUTPUT);
+    /* load the control levels before the pins become outputs, the E pin
+     * starts HIGH so the LCD doesn't latch a falling edge on the claim */
+    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_RS_PIN , LOW);
+    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_RW_PIN , LOW);
+    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , HIGH);
+    GPIO_Claim_pins(LCD_ORDER_PORT , (1 << LCD_RS_PIN) | (1 << LCD_RW_PIN) | (1 << LCD_E_PIN) ,
+                    GPIO_OWNER_LCD , GPIO_MODE_OUTPUT);
 /* send some commands to initialize LCD */
 #if LCD_MODE == LCD_8BITS_MODE
     LCD_SendCommand(TWO_LINE_LCD_EIGHT_BIT_MODE);
@@ -62,18 +130,18 @@ void LCD_Initialization (void)
     GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_RS_PIN , LOW);
     GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_RW_PIN , LOW);
     GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , HIGH);
-    GPIO_WriteOnPort(LCD_DATA_PORT , TWO_LINE_LCD_FOUR_BIT_MODE);
+    GPIO_WriteOnPortMasked(LCD_DATA_PORT , LCD_DATA_PINS , TWO_LINE_LCD_FOUR_BIT_MODE);
     GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , LOW);
 	__delay_us(5);
     GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , HIGH);
-	__delay_us(10);
+    /* the LCD is busy 37us after the function set of 8 bits interface */
+	__delay_us(LCD_INSTRUCTION_TIME);
     LCD_SendCommand(TWO_LINE_LCD_FOUR_BIT_MODE);
 #endif
     __delay_us(1);
     LCD_SendCommand(DISPLAY_ON_CURSOR_OFF);
     __delay_us(1);
-    LCD_SendCommand(CLEAR_COMMAND);
-    __delay_us(15);
+    LCD_ClearScreen();
     LCD_SendCommand(INCREASE_MEMORY_ADDRESS_NO_SHIFT);
     __delay_us(2);
 }
@@ -95,7 +163,7 @@ void LCD_SendCommand(uint8 a_u8command)
     GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_RS_PIN , LOW);
     GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_RW_PIN , LOW);
     GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , HIGH);
-    GPIO_WriteOnPort(LCD_DATA_PORT , a_u8command);
+    GPIO_WriteOnPortMasked(LCD_DATA_PORT , LCD_DATA_PINS , a_u8command);
     GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , LOW);
 	__delay_us(5);
     GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , HIGH);
@@ -106,7 +174,7 @@ void LCD_SendCommand(uint8 a_u8command)
     GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_RS_PIN , LOW);
     GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_RW_PIN , LOW);
     GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , HIGH);
-    GPIO_WriteOnPort(LCD_DATA_PORT , a_u8command << 4);
+    GPIO_WriteOnPortMasked(LCD_DATA_PORT , LCD_DATA_PINS , a_u8command << 4);
     GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , LOW);
 	__delay_us(5);
     GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , HIGH);
@@ -169,27 +237,7 @@ void LCD_SendDataByte(uint8 a_u8data)
     {
         /* D0 nothing */
     }
-    /* steps to send data byte depend on data sheet instructions */
-    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_RS_PIN , HIGH);
-    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_RW_PIN , LOW);
-    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , HIGH);
-    GPIO_WriteOnPort(LCD_DATA_PORT , a_u8data);
-    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , LOW);
-	__delay_us(5);
-    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , HIGH);
-	__delay_us(10);
-/* send the data byte twice when the LCD on 4BITS mode with
- *  shift the data right with 4 steps in second time */
-#if LCD_MODE == LCD_4BITS_MODE
-    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_RS_PIN , HIGH);
-    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_RW_PIN , LOW);
-    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , HIGH);
-    GPIO_WriteOnPort(LCD_DATA_PORT , a_u8data << 4);
-    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , LOW);
-	__delay_us(5);
-    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , HIGH);
-	__delay_us(10);
-#endif
+    LCD_WriteData(a_u8data);
     /* increment the position flag to check on it to display data line by line */
     g_u8position++;
 }
@@ -273,7 +321,7 @@ void LCD_SetDisplayPosition(uint8 a_u8position_X , uint8 a_u8position_Y)
  * Description: 	display new characters on LCD which isn't exist in LCD CG_ROM.
  *                  note: max characters per call function is 8 characters. 
  *
- * Inputs:			uint8* a_u8arr_ptr        array of elements that form the new characters.
+ * Inputs:			const uint8* a_u8arr_ptr  array of elements that form the new characters.
  *                  uint8  a_u8size           size of array  
  *                  uint8  a_u8position_X     (column position from 0 to 15)
  *                  uint8  a_u8position_Y     (row position from 1 to 2 (or) to 4)
@@ -282,23 +330,101 @@ void LCD_SetDisplayPosition(uint8 a_u8position_X , uint8 a_u8position_Y)
  *
  * Return:			NULL
  *******************************************************************************/
-void LCD_SetUserCharacter(uint8* a_u8arr_ptr , uint8 a_u8size , uint8 a_u8position_X , uint8 a_u8position_Y)
+void LCD_SetUserCharacter(const uint8* a_u8arr_ptr , uint8 a_u8size , uint8 a_u8position_X , uint8 a_u8position_Y)
 {
-    /* access CG_RAM */
-    LCD_SendCommand(LCD_ACCESS_CG_ROM);
-    /* insert the new character by insert the array elements inside LCD CG_RAM */
-    for(uint8 u8counter = 0 ; u8counter < a_u8size ; u8counter++)
-    {
-        LCD_SendDataByte(a_u8arr_ptr[u8counter]);
-    }
-    /* return to LCD DD_RAM to display inserted characters */
-    LCD_SendCommand(LCD_ACCESS_FIRST_ROW_DD_RAM);
+    uint8 u8code = 0;
     /* go to specified Location*/
     LCD_SetDisplayPosition(a_u8position_X , a_u8position_Y);
-    /* display the new characters on LCD */
-    for(uint8 u8counter = 0 ; u8counter < a_u8size / 8 ; u8counter++)
+    /* display the new characters on LCD, they are uploaded to CGRAM if they aren't there */
+    for(uint8 u8counter = 0 ; u8counter < a_u8size / LCD_GLYPH_ROWS ; u8counter++)
+    {
+        u8code = LCD_GetGlyphCode(&a_u8arr_ptr[u8counter * LCD_GLYPH_ROWS]);
+        if(u8code != LCD_NO_GLYPH_CODE)
+        {
+            LCD_SendDataByte(u8code);
+        }
+        else
+        {
+            /* keep the positions of the next characters */
+            LCD_SendDataByte(' ');
+        }
+    }
+}
+
+/********************************************************************************
+ * Function Name:	LCD_GetGlyphCode
+ *
+ * Description: 	get character code of glyph to display it by LCD_SendDataByte,
+ *                  the glyph is uploaded to CGRAM only if it isn't there and
+ *                  it replaces the least recently used glyph which isn't pinned.
+ *                  note: the glyph is known by its address so it should be
+ *                        constant array of LCD_GLYPH_ROWS rows.
+ *                  note: displayed characters of replaced glyph change to
+ *                        the new glyph, glyphs of the screen should be pinned
+ *                        when they are more than the free slots.
+ *
+ * Inputs:			const uint8* a_u8glyph_ptr   rows of the glyph
+ * 
+ * Outputs:			NULL
+ *
+ * Return:			character code 0 to 7 or LCD_NO_GLYPH_CODE (uint8)
+ *******************************************************************************/
+uint8 LCD_GetGlyphCode(const uint8 * a_u8glyph_ptr)
+{
+    /* character code of CGRAM glyph is its slot */
+    return LCD_UseGlyphSlot(a_u8glyph_ptr);
+}
+
+/********************************************************************************
+ * Function Name:	LCD_PinGlyph
+ *
+ * Description: 	get character code of glyph as LCD_GetGlyphCode and keep
+ *                  it in CGRAM until LCD_UnpinGlyph is called.
+ *
+ * Inputs:			const uint8* a_u8glyph_ptr   rows of the glyph
+ * 
+ * Outputs:			NULL
+ *
+ * Return:			character code 0 to 7 or LCD_NO_GLYPH_CODE (uint8)
+ *******************************************************************************/
+uint8 LCD_PinGlyph(const uint8 * a_u8glyph_ptr)
+{
+    uint8 retVal = LCD_UseGlyphSlot(a_u8glyph_ptr);
+    if(retVal != LCD_NO_GLYPH_CODE)
+    {
+        SET_BIT(g_u8pinned_glyphs , retVal);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/********************************************************************************
+ * Function Name:	LCD_UnpinGlyph
+ *
+ * Description: 	allow glyph to be replaced, it stays in CGRAM until another
+ *                  glyph needs its slot.
+ *
+ * Inputs:			const uint8* a_u8glyph_ptr   rows of the glyph
+ * 
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void LCD_UnpinGlyph(const uint8 * a_u8glyph_ptr)
+{
+    for(uint8 u8slot = 0 ; u8slot < LCD_GLYPH_SLOTS ; u8slot++)
     {
-        LCD_SendDataByte(u8counter);
+        if(g_glyphs_ptr_arr[u8slot] == a_u8glyph_ptr)
+        {
+            CLEAR_BIT(g_u8pinned_glyphs , u8slot);
+        }
+        else
+        {
+            /* Do nothing */
+        }
     }
 }
 
@@ -361,7 +487,7 @@ void LCD_DisplaNumber(sint32 a_s32number)
 /********************************************************************************
  * Function Name:	LCD_ClearScreen
  *
- * Description: 	clean LCD screen 
+ * Description: 	clean LCD screen and wait until the LCD finishes it.
  *
  * Inputs:			NULL
  *
@@ -372,6 +498,117 @@ void LCD_DisplaNumber(sint32 a_s32number)
 void LCD_ClearScreen(void)
 {
     LCD_SendCommand(CLEAR_COMMAND);
+    /* the LCD ignores the next transfers while it clears the screen */
+    __delay_us(LCD_CLEAR_TIME);
     /* reset the position flag to start from zero */
     g_u8position = 0;
 }
+
+/********************************************************************************
+ * Function Name:	LCD_WriteData
+ *
+ * Description: 	write data byte in DDRAM or CGRAM without changing the
+ *                  position flag.
+ *
+ * Inputs:			uint8       (data byte)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void LCD_WriteData(uint8 a_u8data)
+{
+    /* steps to send data byte depend on data sheet instructions */
+    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_RS_PIN , HIGH);
+    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_RW_PIN , LOW);
+    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , HIGH);
+    GPIO_WriteOnPortMasked(LCD_DATA_PORT , LCD_DATA_PINS , a_u8data);
+    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , LOW);
+	__delay_us(5);
+    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , HIGH);
+	__delay_us(10);
+/* send the data byte twice when the LCD on 4BITS mode with
+ *  shift the data right with 4 steps in second time */
+#if LCD_MODE == LCD_4BITS_MODE
+    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_RS_PIN , HIGH);
+    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_RW_PIN , LOW);
+    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , HIGH);
+    GPIO_WriteOnPortMasked(LCD_DATA_PORT , LCD_DATA_PINS , a_u8data << 4);
+    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , LOW);
+	__delay_us(5);
+    GPIO_WriteOnPin(LCD_ORDER_PORT , LCD_E_PIN , HIGH);
+	__delay_us(10);
+#endif
+}
+
+/********************************************************************************
+ * Function Name:	LCD_UseGlyphSlot
+ *
+ * Description: 	find slot of the glyph or upload it to the least recently
+ *                  used slot which isn't pinned, and make the slot the most
+ *                  recently used one.
+ *
+ * Inputs:			const uint8* a_u8glyph_ptr   rows of the glyph
+ * 
+ * Outputs:			NULL
+ *
+ * Return:			slot of the glyph or LCD_NO_GLYPH_CODE (uint8)
+ *******************************************************************************/
+static uint8 LCD_UseGlyphSlot(const uint8 * a_u8glyph_ptr)
+{
+    uint8 retVal = LCD_NO_GLYPH_CODE;
+    uint8 u8order = LCD_GLYPH_SLOTS;
+    uint8 u8slot = 0;
+    uint8 u8pinned_flag = 0;
+    /* search the cache from the most recently used slot */
+    for(uint8 u8counter = 0 ; u8counter < LCD_GLYPH_SLOTS && u8order == LCD_GLYPH_SLOTS ; u8counter++)
+    {
+        if(g_glyphs_ptr_arr[g_u8glyphs_order_arr[u8counter]] == a_u8glyph_ptr)
+        {
+            u8order = u8counter;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    /* miss: the least recently used slot which isn't pinned is replaced */
+    for(uint8 u8counter = LCD_GLYPH_SLOTS ; u8counter > 0 && u8order == LCD_GLYPH_SLOTS ; u8counter--)
+    {
+        u8slot = g_u8glyphs_order_arr[u8counter - 1];
+        u8pinned_flag = GET_BIT(g_u8pinned_glyphs , u8slot);
+        if(u8pinned_flag == 0)
+        {
+            u8order = u8counter - 1;
+            g_glyphs_ptr_arr[u8slot] = a_u8glyph_ptr;
+            /* write rows of the glyph in CGRAM then return to the DDRAM
+             * address of the position flag */
+            LCD_SendCommand(LCD_ACCESS_CG_ROM + u8slot * LCD_GLYPH_ROWS);
+            for(uint8 u8row = 0 ; u8row < LCD_GLYPH_ROWS ; u8row++)
+            {
+                LCD_WriteData(a_u8glyph_ptr[u8row]);
+            }
+            LCD_SetDisplayPosition(g_u8position % LCD_COLUMNS_NUMBER ,
+                                   (g_u8position / LCD_COLUMNS_NUMBER) % LCD_ROWS_NUMBER + 1);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    if(u8order != LCD_GLYPH_SLOTS)
+    {
+        /* move the slot to the start of the order */
+        retVal = g_u8glyphs_order_arr[u8order];
+        for(; u8order > 0 ; u8order--)
+        {
+            g_u8glyphs_order_arr[u8order] = g_u8glyphs_order_arr[u8order - 1];
+        }
+        g_u8glyphs_order_arr[0] = retVal;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
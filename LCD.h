@@ -5,6 +5,8 @@
  * Author:              Ahmed Eldakhly
  * 
  * Comments:            it contains functions prototype of LCD module.
+ *                      the 8 characters of CGRAM are cache of glyphs, glyph
+ *                      is uploaded only when it isn't in CGRAM.
  * 
  * Revision history:    24/2/2020
  * 
@@ -42,6 +44,11 @@
 #define LCD_ACCESS_THIRD_ROW_DD_RAM         0x90
 #define LCD_ACCESS_FOURTH_ROW_DD_RAM        0xD0
 #define ASCII_ZERO_NUMBER                   0x30
+/* user characters in CGRAM, every glyph is 8 rows of 5 pixels */
+#define LCD_GLYPH_SLOTS                     8u
+#define LCD_GLYPH_ROWS                      8u
+/* code when glyph can't be loaded because all slots are pinned */
+#define LCD_NO_GLYPH_CODE                   0xFFu
 /*******************************************************************************/       
 
 /********************************************************************************
@@ -117,9 +124,10 @@ extern void LCD_SetDisplayPosition(uint8 a_u8position_X , uint8 a_u8position_Y);
 /********************************************************************************
  * Function Name:	LCD_SetUserCharacter
  *
- * Description: 	display new character on LCD which isn't exist in LCD CG_ROM . 
+ * Description: 	display new character on LCD which isn't exist in LCD CG_ROM .
+ *                  every 8 elements are glyph of LCD_GetGlyphCode.
  *
- * Inputs:			uint8* a_u8arr_ptr        array of elements that form the new characters.
+ * Inputs:			const uint8* a_u8arr_ptr  array of elements that form the new characters.
  *                  uint8  a_u8size           size of array  
  *                  uint8  a_u8position_X     (column position from 0 to 15)
  *                  uint8  a_u8position_Y     (row position from 1 to 2 (or) to 4)
@@ -128,7 +136,55 @@ extern void LCD_SetDisplayPosition(uint8 a_u8position_X , uint8 a_u8position_Y);
  *
  * Return:			NULL
  *******************************************************************************/
-extern void LCD_SetUserCharacter(uint8* a_u8arr_ptr , uint8 a_u8size , uint8 a_u8position_X , uint8 a_u8position_Y);
+extern void LCD_SetUserCharacter(const uint8* a_u8arr_ptr , uint8 a_u8size , uint8 a_u8position_X , uint8 a_u8position_Y);
+
+/********************************************************************************
+ * Function Name:	LCD_GetGlyphCode
+ *
+ * Description: 	get character code of glyph to display it by LCD_SendDataByte,
+ *                  the glyph is uploaded to CGRAM only if it isn't there and
+ *                  it replaces the least recently used glyph which isn't pinned.
+ *                  note: the glyph is known by its address so it should be
+ *                        constant array of LCD_GLYPH_ROWS rows.
+ *                  note: displayed characters of replaced glyph change to
+ *                        the new glyph, glyphs of the screen should be pinned
+ *                        when they are more than the free slots.
+ *
+ * Inputs:			const uint8* a_u8glyph_ptr   rows of the glyph
+ * 
+ * Outputs:			NULL
+ *
+ * Return:			character code 0 to 7 or LCD_NO_GLYPH_CODE (uint8)
+ *******************************************************************************/
+extern uint8 LCD_GetGlyphCode(const uint8 * a_u8glyph_ptr);
+
+/********************************************************************************
+ * Function Name:	LCD_PinGlyph
+ *
+ * Description: 	get character code of glyph as LCD_GetGlyphCode and keep
+ *                  it in CGRAM until LCD_UnpinGlyph is called.
+ *
+ * Inputs:			const uint8* a_u8glyph_ptr   rows of the glyph
+ * 
+ * Outputs:			NULL
+ *
+ * Return:			character code 0 to 7 or LCD_NO_GLYPH_CODE (uint8)
+ *******************************************************************************/
+extern uint8 LCD_PinGlyph(const uint8 * a_u8glyph_ptr);
+
+/********************************************************************************
+ * Function Name:	LCD_UnpinGlyph
+ *
+ * Description: 	allow glyph to be replaced, it stays in CGRAM until another
+ *                  glyph needs its slot.
+ *
+ * Inputs:			const uint8* a_u8glyph_ptr   rows of the glyph
+ * 
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void LCD_UnpinGlyph(const uint8 * a_u8glyph_ptr);
 
 /********************************************************************************
  * Function Name:	LCD_DisplaNumber
@@ -147,7 +203,7 @@ extern void LCD_DisplaNumber(sint32 a_s32number);
 /********************************************************************************
  * Function Name:	LCD_ClearScreen
  *
- * Description: 	clean LCD screen 
+ * Description: 	clean LCD screen and wait until the LCD finishes it.
  *
  * Inputs:			NULL
  *
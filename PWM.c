@@ -16,6 +16,7 @@
 #include "PWM.h"
 #include "PWM_MemMap.h"
 #include "timers.h"
+#include "GPIO.h"
 #include "helped_macros.h"
 
 /*******************************************************************************
@@ -48,18 +49,18 @@ void PWM_Initialization(EnumPWM_channel_t a_PWM_channel_t)
     /* check which PWM channel will use to set the pin that belongs the channel as output pin*/
     if(a_PWM_channel_t == PWM_CHANNEL_1)
     {    
-        CLEAR_BIT(PWM_1_PIN_DIRECTION_REG , 2);
+        GPIO_Claim_pins(GPIO_PORTC , 1 << GPIO_PIN2 , GPIO_OWNER_PWM , GPIO_MODE_OUTPUT);
     }
     else
     {
         /* check which pin used with channel 2 of PWM module (Pin 1 - Port C (or) Pin 3 - Port B) */
         if(CAPTURE_COMPARE_PWM_2_PIN == PINC1)
         {
-            CLEAR_BIT(PWM_1_PIN_DIRECTION_REG , 1);
+            GPIO_Claim_pins(GPIO_PORTC , 1 << GPIO_PIN1 , GPIO_OWNER_PWM , GPIO_MODE_OUTPUT);
         }
         else
         {
-            CLEAR_BIT(PWM_2_PIN_DIRECTION_REG , 3);
+            GPIO_Claim_pins(GPIO_PORTB , 1 << GPIO_PIN3 , GPIO_OWNER_PWM , GPIO_MODE_OUTPUT);
         }
     }
 }
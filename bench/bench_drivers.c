@@ -0,0 +1,298 @@
+/*******************************************************************************
+ *
+ * File:                bench_drivers.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            benchmark firmware which measures instruction cycles
+ *                      of the public functions of the drivers, every case is
+ *                      called between start and stop of timer 3 which counts
+ *                      instruction cycles (Fosc/4 without prescaler) and the
+ *                      cost of calling empty case is subtracted from it.
+ *                      the results are saved in table at fixed RAM address
+ *                      so the simulator dumps them at the end of the run,
+ *                      the cases names are taken from cases table of this
+ *                      file by bench_table.awk in the same order.
+ *
+ * Revision history:    16/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "general_bitConfig.h"
+#include "GPIO.h"
+#include "LCD.h"
+#include "KeyPad.h"
+#include "ADC.h"
+#include "PWM.h"
+#include "timers_MemMap.h"
+#include "interrupt_MemMap.h"
+#include "helped_macros.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* results table in the last RAM bank, the marker is written after the last case */
+#define BENCH_RESULTS_ADDRESS               0x580u
+#define BENCH_MARKER_ADDRESS                0x57Eu
+#define BENCH_DONE_MARKER                   0xBE9Cu
+/* timer 3 runs from instruction clock without prescaler with 16 bit reads */
+#define BENCH_TIMER3_RUN                    0x81u
+#define BENCH_TIMER3_STOP                   0x80u
+/* result of case which takes more than 16 bits of cycles */
+#define BENCH_OVERFLOW                      0xFFFFu
+/* number of cases in g_cases_arr */
+#define BENCH_CASES_NUMBER                  (sizeof(g_cases_arr) / sizeof(g_cases_arr[0]))
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/****************************** StrBench_case_t ********************************/
+typedef struct{
+    void (*setup_ptr)(void);            /* prepares the case out of measurement or NULL_PTR */
+    void (*case_ptr)(void);             /* calls the measured function */
+}StrBench_case_t;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Bench_measure
+ *
+ * Description: 	measure instruction cycles of calling case function.
+ *
+ * Inputs:			a_case_ptr        (void(*)(void))
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles or BENCH_OVERFLOW (uint16)
+ *******************************************************************************/
+static uint16 Bench_measure(void (*a_case_ptr)(void));
+
+/* cases functions call the measured driver function with representative
+ * arguments, their results are kept in volatile variable to be used */
+static void Bench_empty(void);
+static void Bench_GPIO_WriteOnPin(void);
+static void Bench_GPIO_ReadFromPin(void);
+static void Bench_GPIO_WriteOnPort(void);
+static void Bench_GPIO_ReadFromPort(void);
+static void Bench_GPIO_TogglePin(void);
+static void Bench_GPIO_SetPinDirection(void);
+static void Bench_LCD_SendCommand(void);
+static void Bench_LCD_SendDataByte(void);
+static void Bench_LCD_SendDataString(void);
+static void Bench_LCD_SetDisplayPosition(void);
+static void Bench_LCD_DisplaNumber_2_digits(void);
+static void Bench_LCD_DisplaNumber_5_digits(void);
+static void Bench_KeyPad_scan_no_key(void);
+static void Bench_ADC_Start_conversion(void);
+static void Bench_ADC_Read_value(void);
+static void Bench_PWM_DutyCycle(void);
+static void Bench_PWM_Frequency(void);
+/* setup of ADC_Read_value case, it waits for the end of the conversion */
+static void Bench_ADC_convert(void);
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* measured cases, new cases are added at the end to keep the table order */
+static const StrBench_case_t g_cases_arr[] = {
+    {NULL_PTR          , Bench_GPIO_WriteOnPin},
+    {NULL_PTR          , Bench_GPIO_ReadFromPin},
+    {NULL_PTR          , Bench_GPIO_WriteOnPort},
+    {NULL_PTR          , Bench_GPIO_ReadFromPort},
+    {NULL_PTR          , Bench_GPIO_TogglePin},
+    {NULL_PTR          , Bench_GPIO_SetPinDirection},
+    {NULL_PTR          , Bench_LCD_SendCommand},
+    {NULL_PTR          , Bench_LCD_SendDataByte},
+    {NULL_PTR          , Bench_LCD_SendDataString},
+    {NULL_PTR          , Bench_LCD_SetDisplayPosition},
+    {NULL_PTR          , Bench_LCD_DisplaNumber_2_digits},
+    {NULL_PTR          , Bench_LCD_DisplaNumber_5_digits},
+    {NULL_PTR          , Bench_KeyPad_scan_no_key},
+    {NULL_PTR          , Bench_ADC_Start_conversion},
+    {Bench_ADC_convert , Bench_ADC_Read_value},
+    {NULL_PTR          , Bench_PWM_DutyCycle},
+    {NULL_PTR          , Bench_PWM_Frequency}
+};
+/* results which are read by the simulator */
+static volatile uint16 g_u16bench_done __at(BENCH_MARKER_ADDRESS);
+static volatile uint16 g_u16bench_cycles_arr[BENCH_CASES_NUMBER] __at(BENCH_RESULTS_ADDRESS);
+/* keeps return values of measured functions */
+static volatile uint16 g_u16bench_sink = 0;
+static uint8 g_u8bench_text_arr[] = "Temperature";
+
+/* benchmark application */
+void main(void)
+{
+    uint16 u16overhead = 0;
+    uint16 u16cycles = 0;
+    g_u16bench_done = 0;
+    /* drivers are initialized as the application does */
+    GPIO_Disable_ADC_On_Pins(GPIO_PORTA , GPIO_PIN1);
+    GPIO_Disable_Comparator_On_PORTA();
+    GPIO_Enable_Pull_Up_On_PortB();
+    LCD_Initialization();
+    KeyPad_Initialization();
+    PWM_Initialization(PWM_CHANNEL_1);
+    PWM_Frequency(3000);
+    ADC_Initialization(ADC_CHANNEL_0);
+    ADC_Select_acquisition_time(ADC_ACQUISITION_TIME_4);
+    ADC_Select_prescaler(ADC_PRESCALER_16);
+    /* cost of call and timer start and stop without the measured function */
+    u16overhead = Bench_measure(Bench_empty);
+    for(uint8 u8case = 0 ; u8case < BENCH_CASES_NUMBER ; u8case++)
+    {
+        if(g_cases_arr[u8case].setup_ptr != NULL_PTR)
+        {
+            g_cases_arr[u8case].setup_ptr();
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        u16cycles = Bench_measure(g_cases_arr[u8case].case_ptr);
+        g_u16bench_cycles_arr[u8case] = (u16cycles == BENCH_OVERFLOW) ? BENCH_OVERFLOW : u16cycles - u16overhead;
+    }
+    g_u16bench_done = BENCH_DONE_MARKER;
+    while(1)
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Bench_measure
+ *
+ * Description: 	measure instruction cycles of calling case function.
+ *
+ * Inputs:			a_case_ptr        (void(*)(void))
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles or BENCH_OVERFLOW (uint16)
+ *******************************************************************************/
+static uint16 Bench_measure(void (*a_case_ptr)(void))
+{
+    uint16 u16cycles = 0;
+    TIMER_3_CONTROL_REG = BENCH_TIMER3_STOP;
+    /* high byte is written to its buffer and loaded with the low byte */
+    TIMER_3_HIGH_REG = 0;
+    TIMER_3_LOW_REG = 0;
+    CLEAR_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , TIMER3_OVERFLOW_INTERRUPT_FLAG_BIT);
+    TIMER_3_CONTROL_REG = BENCH_TIMER3_RUN;
+    a_case_ptr();
+    TIMER_3_CONTROL_REG = BENCH_TIMER3_STOP;
+    /* reading low byte latches high byte */
+    u16cycles = TIMER_3_LOW_REG;
+    u16cycles |= (uint16)TIMER_3_HIGH_REG << 8;
+    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , TIMER3_OVERFLOW_INTERRUPT_FLAG_BIT))
+    {
+        u16cycles = BENCH_OVERFLOW;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return u16cycles;
+}
+
+static void Bench_empty(void)
+{
+    /* Do nothing */
+}
+
+static void Bench_GPIO_WriteOnPin(void)
+{
+    GPIO_WriteOnPin(GPIO_PORTD , GPIO_PIN0 , HIGH);
+}
+
+static void Bench_GPIO_ReadFromPin(void)
+{
+    g_u16bench_sink = GPIO_ReadFromPin(GPIO_PORTB , GPIO_PIN2);
+}
+
+static void Bench_GPIO_WriteOnPort(void)
+{
+    GPIO_WriteOnPort(GPIO_PORTD , 0x55);
+}
+
+static void Bench_GPIO_ReadFromPort(void)
+{
+    g_u16bench_sink = GPIO_ReadFromPort(GPIO_PORTB);
+}
+
+static void Bench_GPIO_TogglePin(void)
+{
+    GPIO_TogglePin(GPIO_PORTC , GPIO_PIN0);
+}
+
+static void Bench_GPIO_SetPinDirection(void)
+{
+    GPIO_SetPinDirection(GPIO_PORTC , GPIO_PIN0 , OUTPUT);
+}
+
+static void Bench_LCD_SendCommand(void)
+{
+    LCD_SendCommand(DISPLAY_ON_CURSOR_OFF);
+}
+
+static void Bench_LCD_SendDataByte(void)
+{
+    LCD_SendDataByte('A');
+}
+
+static void Bench_LCD_SendDataString(void)
+{
+    LCD_SendDataString(g_u8bench_text_arr);
+}
+
+static void Bench_LCD_SetDisplayPosition(void)
+{
+    LCD_SetDisplayPosition(11 , 1);
+}
+
+static void Bench_LCD_DisplaNumber_2_digits(void)
+{
+    LCD_DisplaNumber(59);
+}
+
+static void Bench_LCD_DisplaNumber_5_digits(void)
+{
+    LCD_DisplaNumber(12345);
+}
+
+static void Bench_KeyPad_scan_no_key(void)
+{
+    KeyPad_scan(0);
+}
+
+static void Bench_ADC_Start_conversion(void)
+{
+    ADC_Start_conversion();
+}
+
+static void Bench_ADC_Read_value(void)
+{
+    g_u16bench_sink = ADC_Read_value();
+}
+
+static void Bench_PWM_DutyCycle(void)
+{
+    PWM_DutyCycle(PWM_CHANNEL_1 , 50);
+}
+
+static void Bench_PWM_Frequency(void)
+{
+    PWM_Frequency(3000);
+}
+
+static void Bench_ADC_convert(void)
+{
+    ADC_Start_conversion();
+    g_u16bench_sink = ADC_Read_value();
+}
@@ -0,0 +1,61 @@
+#
+#  convert RAM dump of gpsim to table of the benchmark results:
+#     awk -v commit=<id> -f bench_table.awk bench_drivers.c gpsim.log
+#  the cases names are taken from cases table of bench_drivers.c in order and
+#  the output is CSV lines "commit,case,cycles", cycles is "overflow" if the
+#  case takes more than 16 bits of cycles.
+#
+
+function hex(a_text ,    u32value , u8counter)
+{
+    u32value = 0
+    for(u8counter = 1 ; u8counter <= length(a_text) ; u8counter++)
+    {
+        u32value = u32value * 16 + index("0123456789abcdef" , tolower(substr(a_text , u8counter , 1))) - 1
+    }
+    return u32value
+}
+
+function word(a_address)
+{
+    return memory[a_address] + memory[a_address + 1] * 256
+}
+
+# cases table lines of the firmware source: {setup , Bench_<case>},
+FNR == NR {
+    if($0 ~ /^ *\{.*, *Bench_[A-Za-z0-9_]+\}/)
+    {
+        name = $0
+        sub(/^.*, *Bench_/ , "" , name)
+        sub(/\}.*$/ , "" , name)
+        names[cases++] = name
+    }
+    next
+}
+
+# RAM dump lines: "<address>: <16 bytes> ..."
+$1 ~ /^[0-9a-fA-F]+:$/ {
+    base = hex(substr($1 , 1 , length($1) - 1))
+    for(field = 2 ; field <= 17 && field <= NF ; field++)
+    {
+        if($field ~ /^[0-9a-fA-F][0-9a-fA-F]$/)
+        {
+            memory[base + field - 2] = hex($field)
+        }
+    }
+}
+
+END {
+    # BENCH_MARKER_ADDRESS, BENCH_DONE_MARKER and BENCH_RESULTS_ADDRESS
+    if(word(hex("57e")) != hex("be9c"))
+    {
+        print "bench_table.awk: benchmark didn't finish or RAM dump is missing" > "/dev/stderr"
+        exit 1
+    }
+    print "commit,case,cycles"
+    for(counter = 0 ; counter < cases ; counter++)
+    {
+        cycles = word(hex("580") + 2 * counter)
+        printf "%s,%s,%s\n" , commit , names[counter] , (cycles == 65535) ? "overflow" : cycles
+    }
+}
@@ -0,0 +1,230 @@
+/*******************************************************************************
+ *
+ * File:                buttons.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of push buttons
+ *                      driver, PORT B interrupt on change saves tick of every
+ *                      edge and Timer1 tick accepts the level after it is
+ *                      stable for BUTTONS_DEBOUNCE_TICKS, so edges aren't
+ *                      missed while the main loop is busy (as LCD writing).
+ *                      the tick samples PORT B too because any read of PORT B
+ *                      (as the keypad columns) ends the mismatch condition
+ *                      and the interrupt of the edge may not come.
+ *
+ * Revision history:    20/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "buttons.h"
+#include "interrupt.h"
+#include "helped_macros.h"
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* current system tick, it's updated by Buttons_tick */
+static volatile uint16 g_u16buttons_time = 0;
+/* levels of buttons pins at the last read of PORT B */
+static volatile uint8 g_u8last_levels = 0;
+/* accepted levels of buttons pins after debouncing */
+static volatile uint8 g_u8stable_levels = 0;
+/* pins which have edges and wait for debounce time */
+static volatile uint8 g_u8pending_pins = 0;
+/* tick of the last edge of every interrupt on change pin (pins 4 to 7) */
+static volatile uint16 g_u16edges_time_arr[4];
+/* events queue, it's written in interrupt and read in the main loop, so the
+ * interrupt changes the tail only and the main loop changes the head only */
+static StrButtons_event_t g_events_arr[BUTTONS_EVENTS_QUEUE_SIZE];
+static volatile uint8 g_u8events_head = 0;
+static volatile uint8 g_u8events_tail = 0;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Buttons_sample_levels
+ *
+ * Description: 	read PORT B and save tick of the edge of every button
+ *                  which its level is changed since the last read.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Buttons_sample_levels(void);
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Buttons_Initialization
+ *
+ * Description: 	set buttons pins as input pins, take their current levels
+ *                  as stable levels and enable interrupt on change of PORT B.
+ *                  note: global and peripheral interrupts are enabled by
+ *                        the application.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Buttons_Initialization(void)
+{
+    GPIO_Claim_pins(GPIO_PORTB , BUTTONS_PINS_MASK , GPIO_OWNER_BUTTONS , GPIO_MODE_INPUT);
+    /* reading the port ends the mismatch condition before enabling the interrupt */
+    g_u8last_levels = GPIO_ReadFromPort(GPIO_PORTB) & BUTTONS_PINS_MASK;
+    g_u8stable_levels = g_u8last_levels;
+    g_u8pending_pins = 0;
+    g_u8events_head = g_u8events_tail;
+    Port_change_set_callback_function(Buttons_port_change_ISR);
+    Port_change_interrupt_enable();
+}
+
+/*******************************************************************************
+ * Function Name:	Buttons_port_change_ISR
+ *
+ * Description: 	read PORT B to end the mismatch condition and save tick of
+ *                  the edge of every changed button.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Buttons_port_change_ISR(void)
+{
+    Buttons_sample_levels();
+}
+
+/*******************************************************************************
+ * Function Name:	Buttons_tick
+ *
+ * Description: 	sample PORT B for the edges which their interrupt is lost,
+ *                  accept the level of button which hasn't edges for
+ *                  BUTTONS_DEBOUNCE_TICKS and add press or release event
+ *                  to the events queue if the level is changed.
+ *                  note: it is called from Timer1 interrupt every tick.
+ *
+ * Inputs:			a_u16time         (uint16) current system tick
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Buttons_tick(uint16 a_u16time)
+{
+    uint8 u8pin = 0;
+    /* pins which their last read level isn't the accepted level */
+    uint8 u8changed_pins = 0;
+    StrButtons_event_t * event_ptr = NULL_PTR;
+    g_u16buttons_time = a_u16time;
+    /* edge which its interrupt is lost is caught here one tick later */
+    Buttons_sample_levels();
+    for(u8pin = GPIO_PIN4 ; g_u8pending_pins != 0 && u8pin <= GPIO_PIN7 ; u8pin++)
+    {
+        if(GET_BIT(g_u8pending_pins , u8pin)
+                && (uint16)(a_u16time - g_u16edges_time_arr[u8pin - GPIO_PIN4]) >= BUTTONS_DEBOUNCE_TICKS)
+        {
+            CLEAR_BIT(g_u8pending_pins , u8pin);
+            /* the pin may bounce back to the accepted level */
+            u8changed_pins = g_u8last_levels ^ g_u8stable_levels;
+            if(GET_BIT(u8changed_pins , u8pin))
+            {
+                g_u8stable_levels ^= (1u << u8pin);
+                /* the event is dropped when the queue is full */
+                if((uint8)(g_u8events_tail - g_u8events_head) < BUTTONS_EVENTS_QUEUE_SIZE)
+                {
+                    event_ptr = &g_events_arr[g_u8events_tail % BUTTONS_EVENTS_QUEUE_SIZE];
+                    event_ptr->u16time = g_u16edges_time_arr[u8pin - GPIO_PIN4];
+                    event_ptr->u8pin = u8pin;
+                    event_ptr->event_t = GET_BIT(g_u8stable_levels , u8pin) ? BUTTONS_EVENT_RELEASE : BUTTONS_EVENT_PRESS;
+                    g_u8events_tail++;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Buttons_getEvent
+ *
+ * Description: 	get the oldest event from the events queue.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_event_ptr       (StrButtons_event_t*)
+ *
+ * Return:			TRUE if event is read, FALSE if the queue is empty (uint8)
+ *******************************************************************************/
+uint8 Buttons_getEvent(StrButtons_event_t * a_event_ptr)
+{
+    uint8 retVal = FALSE;
+    if(g_u8events_head != g_u8events_tail)
+    {
+        *a_event_ptr = g_events_arr[g_u8events_head % BUTTONS_EVENTS_QUEUE_SIZE];
+        g_u8events_head++;
+        retVal = TRUE;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Buttons_sample_levels
+ *
+ * Description: 	read PORT B and save tick of the edge of every button
+ *                  which its level is changed since the last read.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Buttons_sample_levels(void)
+{
+    uint8 u8levels = GPIO_ReadFromPort(GPIO_PORTB) & BUTTONS_PINS_MASK;
+    uint8 u8changed_pins = u8levels ^ g_u8last_levels;
+    uint8 u8pin = 0;
+    g_u8last_levels = u8levels;
+    /* the debounce time of pin starts again from its last edge */
+    for(u8pin = GPIO_PIN4 ; u8pin <= GPIO_PIN7 ; u8pin++)
+    {
+        if(GET_BIT(u8changed_pins , u8pin))
+        {
+            g_u16edges_time_arr[u8pin - GPIO_PIN4] = g_u16buttons_time;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    g_u8pending_pins |= u8changed_pins;
+}
@@ -0,0 +1,110 @@
+/*******************************************************************************
+ *
+ * File:                buttons.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes of push buttons driver.
+ *                      edges of the buttons are caught by PORT B interrupt on
+ *                      change and the new level is accepted by Timer1 tick
+ *                      when it is stable for debounce time, so the buttons
+ *                      are read as events without polling or delay.
+ *
+ * Revision history:    20/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef BUTTONS_H
+#define	BUTTONS_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+#include "GPIO.h"
+#include "buttons_config.h"
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/*************************** EnumButtons_event_t *******************************/
+typedef enum{
+            BUTTONS_EVENT_PRESS,
+            BUTTONS_EVENT_RELEASE
+}EnumButtons_event_t;
+
+/*************************** StrButtons_event_t ********************************/
+typedef struct{
+    uint16 u16time;                     /* tick of the last edge before the stable level */
+    uint8  u8pin;                       /* pin of the button in PORT B */
+    EnumButtons_event_t event_t;
+}StrButtons_event_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Buttons_Initialization
+ *
+ * Description: 	set buttons pins as input pins, take their current levels
+ *                  as stable levels and enable interrupt on change of PORT B.
+ *                  note: global and peripheral interrupts are enabled by
+ *                        the application.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Buttons_Initialization(void);
+
+/*******************************************************************************
+ * Function Name:	Buttons_port_change_ISR
+ *
+ * Description: 	read PORT B to end the mismatch condition and save tick of
+ *                  the edge of every changed button.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Buttons_port_change_ISR(void);
+
+/*******************************************************************************
+ * Function Name:	Buttons_tick
+ *
+ * Description: 	sample PORT B for the edges which their interrupt is lost,
+ *                  accept the level of button which hasn't edges for
+ *                  BUTTONS_DEBOUNCE_TICKS and add press or release event
+ *                  to the events queue if the level is changed.
+ *                  note: it is called from Timer1 interrupt every tick.
+ *
+ * Inputs:			a_u16time         (uint16) current system tick
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Buttons_tick(uint16 a_u16time);
+
+/*******************************************************************************
+ * Function Name:	Buttons_getEvent
+ *
+ * Description: 	get the oldest event from the events queue.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_event_ptr       (StrButtons_event_t*)
+ *
+ * Return:			TRUE if event is read, FALSE if the queue is empty (uint8)
+ *******************************************************************************/
+extern uint8 Buttons_getEvent(StrButtons_event_t * a_event_ptr);
+
+#endif	/* BUTTONS_H */
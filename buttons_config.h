@@ -0,0 +1,30 @@
+/*******************************************************************************
+ *
+ * File:                buttons_config.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains configurations of push buttons driver.
+ *
+ * Revision history:    20/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef BUTTONS_CONFIG_H
+#define	BUTTONS_CONFIG_H
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* buttons are on interrupt on change pins of PORT B (pins 4, 5, 6 and 7),
+ * every button pulls its pin to low when it is pressed */
+#define BUTTONS_PINS_MASK               ((1u << GPIO_PIN4) | (1u << GPIO_PIN5))
+/*-----------------------------------------------------------------------------*/
+/* ticks of Timer1 (10ms) without edges on the pin to accept its new level */
+#define BUTTONS_DEBOUNCE_TICKS          2u
+/* size of the events queue (should be power of 2) */
+#define BUTTONS_EVENTS_QUEUE_SIZE       4u
+
+#endif	/* BUTTONS_CONFIG_H */
@@ -0,0 +1,341 @@
+/*******************************************************************************
+ *
+ * File:                buzzer.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of buzzer tones
+ *                      driver, CCP2 compare toggle mode makes the tone
+ *                      without the CPU and its interrupt only moves the
+ *                      compare value by half period, the melody is played
+ *                      by Buzzer_tick from the system tick interrupt.
+ *                      note: CCP1 is PWM of the fan and uses timer 2, so
+ *                            timer 3 is free as time base of CCP2.
+ *
+ * Revision history:    21/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "buzzer.h"
+#include "interrupt.h"
+#include "timers.h"
+#include "PWM_MemMap.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* CCP2CON mode bits: compare mode which toggles the output on match */
+#define BUZZER_COMPARE_TOGGLE_MODE      0x02u
+/* CCP2CON mode bits: CCP2 is off and the pin follows its latch */
+#define BUZZER_CCP_OFF_MODE             0x00u
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* melody which is requested by the main loop, it's taken by Buzzer_tick */
+static const StrBuzzer_melody_t * volatile g_requested_melody_ptr = NULL_PTR;
+static volatile uint8 g_u8request_flag = FALSE;
+/* running melody and its position, they are used in interrupt only */
+static const StrBuzzer_melody_t * g_melody_ptr = NULL_PTR;
+static uint8 g_u8note_index = 0;
+static uint8 g_u8plays_count = 0;
+static uint16 g_u16note_ticks = 0;
+/* TRUE while melody is running */
+static volatile uint8 g_u8playing_flag = FALSE;
+/* half period of the running tone in counts of timer 3 */
+static volatile uint16 g_u16half_period = 0;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Buzzer_start_note
+ *
+ * Description: 	start tone of note of the running melody and load its
+ *                  duration in ticks.
+ *
+ * Inputs:			a_note_ptr        (const StrBuzzer_note_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Buzzer_start_note(const StrBuzzer_note_t * a_note_ptr);
+
+/*******************************************************************************
+ * Function Name:	Buzzer_silence
+ *
+ * Description: 	turn CCP2 off, so the pin returns to its latch which is
+ *                  the off level of the buzzer.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Buzzer_silence(void);
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Buzzer_Initialization
+ *
+ * Description: 	set buzzer pin as output and turn the buzzer off, select
+ *                  timer 3 as time base of CCP2 and enable CCP2 interrupt.
+ *                  note: global and peripheral interrupts are enabled by
+ *                        the application.
+ *                  note: timer 3 is started by Timebase_Initialization
+ *                        before it.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Buzzer_Initialization(void)
+{
+    GPIO_Claim_pins(BUZZER_CCP_PORT , 1 << BUZZER_CCP_PIN , GPIO_OWNER_BUZZER , GPIO_MODE_OUTPUT);
+    GPIO_WriteOnPin(BUZZER_CCP_PORT , BUZZER_CCP_PIN , BUZZER_OFF_LEVEL);
+    Buzzer_silence();
+    g_melody_ptr = NULL_PTR;
+    g_u8request_flag = FALSE;
+    g_u8playing_flag = FALSE;
+    /* timer 3 runs freely by the time base module, every tone adds its half
+     * period to the compare value */
+    Timer3_used_for_CCP2_module();
+    Capture_Compare_2_set_callback_function(Buzzer_compare_ISR);
+    Capture_Compare_2_interrupt_enable();
+}
+
+/*******************************************************************************
+ * Function Name:	Buzzer_play
+ *
+ * Description: 	play melody from its first note instead of the running
+ *                  melody, it starts at the next system tick.
+ *                  note: the melody should be kept till it finishes.
+ *
+ * Inputs:			a_melody_ptr      (const StrBuzzer_melody_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Buzzer_play(const StrBuzzer_melody_t * a_melody_ptr)
+{
+    /* the pointer isn't written in one instruction, so the interrupt doesn't
+     * take it while the flag is cleared */
+    g_u8request_flag = FALSE;
+    g_requested_melody_ptr = a_melody_ptr;
+    g_u8request_flag = TRUE;
+}
+
+/*******************************************************************************
+ * Function Name:	Buzzer_stop
+ *
+ * Description: 	stop the running melody and turn the buzzer off at the
+ *                  next system tick.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Buzzer_stop(void)
+{
+    Buzzer_play(NULL_PTR);
+}
+
+/*******************************************************************************
+ * Function Name:	Buzzer_isPlaying
+ *
+ * Description: 	check if melody is running (or will start at the next tick).
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE or FALSE (uint8)
+ *******************************************************************************/
+uint8 Buzzer_isPlaying(void)
+{
+    uint8 retVal = g_u8playing_flag;
+    if(g_u8request_flag == TRUE)
+    {
+        retVal = (g_requested_melody_ptr != NULL_PTR) ? TRUE : FALSE;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Buzzer_tick
+ *
+ * Description: 	start the requested melody and move to the next note when
+ *                  duration of the running note finishes.
+ *                  note: it is called from timer interrupt every BUZZER_TICK_TIME.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Buzzer_tick(void)
+{
+    if(g_u8request_flag == TRUE)
+    {
+        g_u8request_flag = FALSE;
+        g_melody_ptr = g_requested_melody_ptr;
+        g_u8note_index = 0;
+        g_u8plays_count = 0;
+        if(g_melody_ptr != NULL_PTR && g_melody_ptr->u8notes_number != 0)
+        {
+            Buzzer_start_note(&g_melody_ptr->notes_ptr[0]);
+        }
+        else
+        {
+            g_melody_ptr = NULL_PTR;
+            Buzzer_silence();
+        }
+    }
+    else if(g_melody_ptr != NULL_PTR)
+    {
+        g_u16note_ticks--;
+        if(g_u16note_ticks == 0)
+        {
+            g_u8note_index++;
+            if(g_u8note_index >= g_melody_ptr->u8notes_number)
+            {
+                g_u8note_index = 0;
+                g_u8plays_count++;
+                if(g_melody_ptr->u8plays_number != BUZZER_REPEAT_FOREVER &&
+                        g_u8plays_count >= g_melody_ptr->u8plays_number)
+                {
+                    g_melody_ptr = NULL_PTR;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            if(g_melody_ptr != NULL_PTR)
+            {
+                Buzzer_start_note(&g_melody_ptr->notes_ptr[g_u8note_index]);
+            }
+            else
+            {
+                Buzzer_silence();
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    g_u8playing_flag = (g_melody_ptr != NULL_PTR) ? TRUE : FALSE;
+}
+
+/*******************************************************************************
+ * Function Name:	Buzzer_compare_ISR
+ *
+ * Description: 	move compare value of CCP2 by half period of the running
+ *                  tone, so the pin is toggled again after it.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Buzzer_compare_ISR(void)
+{
+    uint16 u16compare = 0;
+#if INTERRUPT_LEVELS_NUMBERS == TWO_INTERRUPT_LEVELS && CAPTURE_COMPARE_2_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* Buzzer_tick of the high priority interrupt writes the compare value
+     * of the next note, it can't run between reading and writing it */
+    High_priority_interrupts_disable();
+#endif
+    u16compare = ((uint16)CAPTURE_COMPARE_PWM_2_HIGH_REG << 8) | CAPTURE_COMPARE_PWM_2_LOW_REG;
+    u16compare += g_u16half_period;
+    CAPTURE_COMPARE_PWM_2_LOW_REG = (uint8)u16compare;
+    CAPTURE_COMPARE_PWM_2_HIGH_REG = (uint8)(u16compare >> 8);
+#if INTERRUPT_LEVELS_NUMBERS == TWO_INTERRUPT_LEVELS && CAPTURE_COMPARE_2_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    High_priority_interrupts_enable();
+#endif
+}
+
+/*******************************************************************************
+ * Function Name:	Buzzer_start_note
+ *
+ * Description: 	start tone of note of the running melody and load its
+ *                  duration in ticks.
+ *
+ * Inputs:			a_note_ptr        (const StrBuzzer_note_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Buzzer_start_note(const StrBuzzer_note_t * a_note_ptr)
+{
+    uint16 u16compare = 0;
+    g_u16note_ticks = a_note_ptr->u16duration / BUZZER_TICK_TIME;
+    if(g_u16note_ticks == 0)
+    {
+        g_u16note_ticks = 1;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    if(a_note_ptr->u16frequency == BUZZER_REST)
+    {
+        Buzzer_silence();
+    }
+    else
+    {
+        /* the first toggle is after half period from now */
+        g_u16half_period = (uint16)(BUZZER_TIMER_CLOCK / 2 / a_note_ptr->u16frequency);
+        u16compare = Timer3_read_counter() + g_u16half_period;
+        CAPTURE_COMPARE_PWM_2_LOW_REG = (uint8)u16compare;
+        CAPTURE_COMPARE_PWM_2_HIGH_REG = (uint8)(u16compare >> 8);
+        CAPTURE_COMPARE_PWM_2_CONTROL_REG = BUZZER_COMPARE_TOGGLE_MODE;
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Buzzer_silence
+ *
+ * Description: 	turn CCP2 off, so the pin returns to its latch which is
+ *                  the off level of the buzzer.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Buzzer_silence(void)
+{
+    CAPTURE_COMPARE_PWM_2_CONTROL_REG = BUZZER_CCP_OFF_MODE;
+}
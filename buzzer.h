@@ -0,0 +1,147 @@
+/*******************************************************************************
+ *
+ * File:                buzzer.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes of buzzer tones driver.
+ *                      CCP2 module toggles the buzzer pin by compare matches
+ *                      of timer 3 to make the tone and the notes of melody
+ *                      are played by the system tick, so the main loop only
+ *                      starts or stops the melody.
+ *
+ * Revision history:    21/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef BUZZER_H
+#define	BUZZER_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+#include "GPIO.h"
+#include "buzzer_config.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* frequency of the note which is silence */
+#define BUZZER_REST                     0u
+/* number of plays of melody which is played till Buzzer_stop */
+#define BUZZER_REPEAT_FOREVER           0u
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/*************************** StrBuzzer_note_t **********************************/
+typedef struct{
+    uint16 u16frequency;                /* tone in Hz (from 16 Hz) or BUZZER_REST */
+    uint16 u16duration;                 /* in milliseconds, multiple of BUZZER_TICK_TIME */
+}StrBuzzer_note_t;
+
+/*************************** StrBuzzer_melody_t ********************************/
+typedef struct{
+    const StrBuzzer_note_t * notes_ptr;
+    uint8 u8notes_number;
+    uint8 u8plays_number;               /* number of plays or BUZZER_REPEAT_FOREVER */
+}StrBuzzer_melody_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Buzzer_Initialization
+ *
+ * Description: 	set buzzer pin as output and turn the buzzer off, select
+ *                  timer 3 as time base of CCP2 and enable CCP2 interrupt.
+ *                  note: global and peripheral interrupts are enabled by
+ *                        the application.
+ *                  note: timer 3 is started by Timebase_Initialization
+ *                        before it.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Buzzer_Initialization(void);
+
+/*******************************************************************************
+ * Function Name:	Buzzer_play
+ *
+ * Description: 	play melody from its first note instead of the running
+ *                  melody, it starts at the next system tick.
+ *                  note: the melody should be kept till it finishes.
+ *
+ * Inputs:			a_melody_ptr      (const StrBuzzer_melody_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Buzzer_play(const StrBuzzer_melody_t * a_melody_ptr);
+
+/*******************************************************************************
+ * Function Name:	Buzzer_stop
+ *
+ * Description: 	stop the running melody and turn the buzzer off at the
+ *                  next system tick.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Buzzer_stop(void);
+
+/*******************************************************************************
+ * Function Name:	Buzzer_isPlaying
+ *
+ * Description: 	check if melody is running (or will start at the next tick).
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE or FALSE (uint8)
+ *******************************************************************************/
+extern uint8 Buzzer_isPlaying(void);
+
+/*******************************************************************************
+ * Function Name:	Buzzer_tick
+ *
+ * Description: 	start the requested melody and move to the next note when
+ *                  duration of the running note finishes.
+ *                  note: it is called from timer interrupt every BUZZER_TICK_TIME.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Buzzer_tick(void);
+
+/*******************************************************************************
+ * Function Name:	Buzzer_compare_ISR
+ *
+ * Description: 	move compare value of CCP2 by half period of the running
+ *                  tone, so the pin is toggled again after it.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Buzzer_compare_ISR(void);
+
+#endif	/* BUZZER_H */
@@ -0,0 +1,32 @@
+/*******************************************************************************
+ *
+ * File:                buzzer_config.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains configurations of buzzer tones driver.
+ *
+ * Revision history:    21/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef BUZZER_CONFIG_H
+#define	BUZZER_CONFIG_H
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* output pin of CCP2 module (CCP2MX configuration bit selects RC1) */
+#define BUZZER_CCP_PIN                  GPIO_PIN1
+#define BUZZER_CCP_PORT                 GPIO_PORTC
+/* level of the pin which turns the buzzer off */
+#define BUZZER_OFF_LEVEL                HIGH
+/*-----------------------------------------------------------------------------*/
+/* clock of timer 3 which is the time base of CCP2 (Fosc / 4 without prescaler) */
+#define BUZZER_TIMER_CLOCK              2000000u
+/* period of the timer interrupt that calls Buzzer_tick in milliseconds */
+#define BUZZER_TICK_TIME                10u
+
+#endif	/* BUZZER_CONFIG_H */
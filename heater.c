@@ -0,0 +1,239 @@
+/*******************************************************************************
+ *
+ * File:                heater.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of heater power
+ *                      driver, the power is applied as on time of fixed window
+ *                      (time proportional control) because the heater is
+ *                      switched by relay and can't be driven by fast PWM.
+ *
+ * Revision history:    6/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "heater.h"
+#include "interrupt.h"
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* selected heater power from 0 to 100 % */
+static volatile uint8 g_u8heater_power = 0;
+/* current state of heater pin */
+static volatile uint8 g_u8heater_state = LOW;
+/* position of the current tick inside the window */
+static volatile uint16 g_u16window_tick = 0;
+/* on time of the current window in ticks */
+static volatile uint16 g_u16on_ticks = 0;
+/* ticks since the last switching of heater pin (saturated at 0xFFFF) */
+static volatile uint16 g_u16state_ticks = 0xFFFF;
+/* on time that isn't applied in the previous windows due to min. on and off
+ * times, it's added to the next window to keep the average power correct */
+static volatile sint16 g_s16carry_ticks = 0;
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Heater_Initialization
+ *
+ * Description: 	set heater pin as output and turn the heater off.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Heater_Initialization(void)
+{
+    GPIO_Claim_pins(HEATER_PORT , 1 << HEATER_PIN , GPIO_OWNER_HEATER , GPIO_MODE_OUTPUT);
+    GPIO_WriteOnPin(HEATER_PORT , HEATER_PIN , LOW);
+    g_u8heater_power = 0;
+    g_u8heater_state = LOW;
+}
+
+/*******************************************************************************
+ * Function Name:	Heater_set_power
+ *
+ * Description: 	select heater power as percentage of the on time in every
+ *                  window, new power is applied from the next window.
+ *                  note: zero power turns the heater off after its min. on
+ *                        time as the other powers, Heater_trip turns it off
+ *                        immediately.
+ *
+ * Inputs:			a_u8power         (uint8) power from 0 to 100 %
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Heater_set_power(uint8 a_u8power)
+{
+    if(a_u8power > HEATER_MAX_POWER)
+    {
+        a_u8power = HEATER_MAX_POWER;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* the variables are shared with timer interrupt */
+    Timer1_disable_overflow_interrupt();
+    if(a_u8power == 0)
+    {
+        /* the carried on time isn't applied when the heater is off */
+        g_s16carry_ticks = 0;
+    }
+    else if(g_u8heater_power == 0)
+    {
+        /* start new window when the heater turns on from off state */
+        g_u16window_tick = 0;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    g_u8heater_power = a_u8power;
+    Timer1_enable_overflow_interrupt();
+}
+
+/*******************************************************************************
+ * Function Name:	Heater_trip
+ *
+ * Description: 	turn the heater off immediately and set its power to zero,
+ *                  it is the only path which doesn't wait the min. on time.
+ *                  note: it is used when the heating process is stopped (the
+ *                        door is opened, the process is paused, canceled or
+ *                        finished) so the heater is never on after it.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Heater_trip(void)
+{
+    /* the variables are shared with timer interrupt */
+    Timer1_disable_overflow_interrupt();
+    GPIO_WriteOnPin(HEATER_PORT , HEATER_PIN , LOW);
+    if(g_u8heater_state == HIGH)
+    {
+        g_u8heater_state = LOW;
+        g_u16state_ticks = 0;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    g_s16carry_ticks = 0;
+    g_u8heater_power = 0;
+    Timer1_enable_overflow_interrupt();
+}
+
+/*******************************************************************************
+ * Function Name:	Heater_tick
+ *
+ * Description: 	switch the heater on or off depend on the selected power
+ *                  and the position in the current window without violating
+ *                  min. on and off times.
+ *                  note: it is called from timer interrupt every HEATER_TICK_TIME.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Heater_tick(void)
+{
+    /* on time of the new window including the carried time */
+    sint16 s16on_ticks = 0;
+    /* required state of heater pin in this tick */
+    uint8 u8required_state = LOW;
+    if(g_u16state_ticks != 0xFFFF)
+    {
+        g_u16state_ticks++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    if(g_u8heater_power != 0)
+    {
+        /* calculate on time at the beginning of every window */
+        if(g_u16window_tick == 0)
+        {
+            s16on_ticks = (sint16)((uint16)g_u8heater_power * HEATER_TICKS_PER_PERCENT) + g_s16carry_ticks;
+            if(s16on_ticks < (sint16)HEATER_MIN_ON_TICKS)
+            {
+                /* too short on time, keep the heater off and add it to next window */
+                g_s16carry_ticks = s16on_ticks;
+                g_u16on_ticks = 0;
+            }
+            else if(s16on_ticks > (sint16)(HEATER_WINDOW_TICKS - HEATER_MIN_OFF_TICKS))
+            {
+                /* too short off time, keep the heater on all window and
+                 * subtract the extra on time from next window */
+                g_s16carry_ticks = s16on_ticks - (sint16)HEATER_WINDOW_TICKS;
+                g_u16on_ticks = HEATER_WINDOW_TICKS;
+            }
+            else
+            {
+                g_s16carry_ticks = 0;
+                g_u16on_ticks = (uint16)s16on_ticks;
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        if(g_u16window_tick < g_u16on_ticks)
+        {
+            u8required_state = HIGH;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        g_u16window_tick++;
+        if(g_u16window_tick >= HEATER_WINDOW_TICKS)
+        {
+            g_u16window_tick = 0;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* switch the heater only after min. time of its current state */
+    if(u8required_state != g_u8heater_state)
+    {
+        if((g_u8heater_state == HIGH && g_u16state_ticks >= HEATER_MIN_ON_TICKS) ||
+                (g_u8heater_state == LOW && g_u16state_ticks >= HEATER_MIN_OFF_TICKS))
+        {
+            g_u8heater_state = u8required_state;
+            g_u16state_ticks = 0;
+            GPIO_WriteOnPin(HEATER_PORT , HEATER_PIN , u8required_state);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
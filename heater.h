@@ -0,0 +1,105 @@
+/*******************************************************************************
+ *
+ * File:                heater.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes and definitions of
+ *                      heater power driver that controls heater by time
+ *                      proportional output.
+ *
+ * Revision history:    6/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef HEATER_H
+#define	HEATER_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+#include "GPIO.h"
+#include "heater_config.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+#define HEATER_MAX_POWER                100u
+/* times of heater configuration in ticks */
+#define HEATER_WINDOW_TICKS             (HEATER_WINDOW_TIME / HEATER_TICK_TIME)
+#define HEATER_TICKS_PER_PERCENT        (HEATER_WINDOW_TICKS / HEATER_MAX_POWER)
+#define HEATER_MIN_ON_TICKS             (HEATER_MIN_ON_TIME / HEATER_TICK_TIME)
+#define HEATER_MIN_OFF_TICKS            (HEATER_MIN_OFF_TIME / HEATER_TICK_TIME)
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Heater_Initialization
+ *
+ * Description: 	set heater pin as output and turn the heater off.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Heater_Initialization(void);
+
+/*******************************************************************************
+ * Function Name:	Heater_set_power
+ *
+ * Description: 	select heater power as percentage of the on time in every
+ *                  window, new power is applied from the next window.
+ *                  note: zero power turns the heater off after its min. on
+ *                        time as the other powers, Heater_trip turns it off
+ *                        immediately.
+ *
+ * Inputs:			a_u8power         (uint8) power from 0 to 100 %
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Heater_set_power(uint8 a_u8power);
+
+/*******************************************************************************
+ * Function Name:	Heater_trip
+ *
+ * Description: 	turn the heater off immediately and set its power to zero,
+ *                  it is the only path which doesn't wait the min. on time.
+ *                  note: it is used when the heating process is stopped (the
+ *                        door is opened, the process is paused, canceled or
+ *                        finished) so the heater is never on after it.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Heater_trip(void);
+
+/*******************************************************************************
+ * Function Name:	Heater_tick
+ *
+ * Description: 	switch the heater on or off depend on the selected power
+ *                  and the position in the current window without violating
+ *                  min. on and off times.
+ *                  note: it is called from timer interrupt every HEATER_TICK_TIME.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Heater_tick(void);
+
+#endif	/* HEATER_H */
+
@@ -0,0 +1,34 @@
+/*******************************************************************************
+ *
+ * File:                heater_config.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains configurations of heater power driver.
+ *
+ * Revision history:    6/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef HEATER_CONFIG_H
+#define	HEATER_CONFIG_H
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+#define HEATER_PIN                      GPIO_PIN5
+#define HEATER_PORT                     GPIO_PORTC
+/*-----------------------------------------------------------------------------*/
+/* period of the timer interrupt that calls Heater_tick in milliseconds */
+#define HEATER_TICK_TIME                10u
+/* window of time proportional control, power percentage is the on time
+ * of this window (should be multiple of 100 ticks as 10000ms or 20000ms) */
+#define HEATER_WINDOW_TIME              10000u
+/* min. time that relay/magnetron stays on or off after any switching */
+#define HEATER_MIN_ON_TIME              1000u
+#define HEATER_MIN_OFF_TIME             1000u
+
+#endif	/* HEATER_CONFIG_H */
+
@@ -14,6 +14,7 @@
 /*******************************************************************************
  *                       	Included Libraries                                 *
  *******************************************************************************/           
+#include <xc.h>
 #include "interrupt.h"
 #include "interrupt_MemMap.h"
 #include "helped_macros.h"
@@ -1249,30 +1250,11 @@ void High_Low_voltage_set_callback_function(void(*a_function_ptr)(void))
 }
 #endif
 
-/* check if this interrupt occur in one level for priority or in two levels */
-#if INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL
-
-/*******************************************************************************
- * Function Name:	Global_interrupt_enable
- *
- * Description: 	enable all masked interrupts when their flags equal to 1.
- *
- * Inputs:			NULL
- *
- * Outputs:			NULL
- *
- * Return:			NULL
- *******************************************************************************/
-void Global_interrupt_enable(void)
-{
-    SET_BIT(INTERRUPT_CONTROL_REG_1 , GLOBAL__HIGH_PRIORTY__INTERRUPT_ENABLE_BIT);
-}
-
 /*******************************************************************************
- * Function Name:	Global_interrupt_disable
+ * Function Name:	Wait_for_interrupt
  *
- * Description: 	disable all masked interrupts to prevent any interrupt to 
- *                  occur.
+ * Description: 	stop the CPU in Idle mode until any enabled interrupt
+ *                  occurs, the peripherals and the timers keep running.
  *
  * Inputs:			NULL
  *
@@ -1280,33 +1262,21 @@ void Global_interrupt_enable(void)
  *
  * Return:			NULL
  *******************************************************************************/
-void Global_interrupt_disable(void)
+void Wait_for_interrupt(void)
 {
-    CLEAR_BIT(INTERRUPT_CONTROL_REG_1 , GLOBAL__HIGH_PRIORTY__INTERRUPT_ENABLE_BIT);
+    /* SLEEP instruction enters Idle mode instead of Sleep mode which stops
+     * the timers clock */
+    SET_BIT(OSCILLATOR_CONTROL_REG , IDLE_ENABLE_BIT);
+    SLEEP();
 }
 
-/*******************************************************************************
- * Function Name:	Peripherals_interrupt_enable
- *
- * Description: 	enable all peripherals interrupts when their flags equal to 1 
- *                  and the global interrupt is enabled.
- *
- * Inputs:			NULL
- *
- * Outputs:			NULL
- *
- * Return:			NULL
- *******************************************************************************/
-void Peripherals_interrupt_enable(void)
-{
-    SET_BIT(INTERRUPT_CONTROL_REG_1 , PERIPHERAL__LOW_PRIORTY__INTERRUPT_ENABLE_BIT);
-}
+/* check if this interrupt occur in one level for priority or in two levels */
+#if INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL
 
 /*******************************************************************************
- * Function Name:	Peripherals_interrupt_disable
+ * Function Name:	Global_interrupt_enable
  *
- * Description: 	disable all peripherals interrupts to prevent any peripherals
- *                  interrupt to occur.
+ * Description: 	enable all masked interrupts when their flags equal to 1.
  *
  * Inputs:			NULL
  *
@@ -1314,500 +1284,60 @@ void Peripherals_interrupt_enable(void)
  *
  * Return:			NULL
  *******************************************************************************/
-void Peripherals_interrupt_disable(void)
+void Global_interrupt_enable(void)
 {
-    CLEAR_BIT(INTERRUPT_CONTROL_REG_1 , PERIPHERAL__LOW_PRIORTY__INTERRUPT_ENABLE_BIT);
+    SET_BIT(INTERRUPT_CONTROL_REG_1 , GLOBAL__HIGH_PRIORTY__INTERRUPT_ENABLE_BIT);
 }
 
 /*******************************************************************************
- * Function Name:	ISR
+ * Function Name:	Global_interrupt_disable
  *
- * Description: 	interrupt handler function in this function all interrupt 
- *                  functions will execute when the interrupt flag, global interrupt
- *                  and the peripherals interrupt in some cases are equal 1.
+ * Description: 	disable all masked interrupts to prevent any interrupt to 
+ *                  occur.
  *
  * Inputs:			NULL
  *
  * Outputs:			NULL
- *
- * Return:			NULL
- *******************************************************************************/
-void __interrupt () ISR(void)
-{
-/* check if this interrupt will use in program or not */
-#if TIMER_0_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_CONTROL_REG_1 , TIMER0_OVERFLOW_INTERRUPT_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(timer0_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            timer0_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-        /* clear interrupt flag to finish interrupt execution till a new interrupt */
-        CLEAR_BIT(INTERRUPT_CONTROL_REG_1 , TIMER0_OVERFLOW_INTERRUPT_FLAG_BIT);
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
-
-/* check if this interrupt will use in program or not */    
-#if TIMER_1_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , TIMER1_OVERFLOW_INTERRUPT_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(timer1_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            timer1_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-        /* clear interrupt flag to finish interrupt execution till a new interrupt */
-        CLEAR_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , TIMER1_OVERFLOW_INTERRUPT_FLAG_BIT);
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
-
-/* check if this interrupt will use in program or not */    
-#if TIMER_2_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , TIMER2_TO_PR2_MATCH_INTERRUPT_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(timer2_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            timer2_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-        /* clear interrupt flag to finish interrupt execution till a new interrupt */
-        CLEAR_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , TIMER2_TO_PR2_MATCH_INTERRUPT_FLAG_BIT);
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
-
-/* check if this interrupt will use in program or not */
-#if TIMER_3_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , TIMER3_OVERFLOW_INTERRUPT_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(timer3_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            timer3_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-        /* clear interrupt flag to finish interrupt execution till a new interrupt */
-        CLEAR_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , TIMER3_OVERFLOW_INTERRUPT_FLAG_BIT);
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
-
-/* check if this interrupt will use in program or not */
-#if EXTERNAL_INTERRUPT_0_ == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_CONTROL_REG_1 , EXTERNAL_INTERRUPT_0_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(external_interrupt_0_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            external_interrupt_0_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-        /* clear interrupt flag to finish interrupt execution till a new interrupt */
-        CLEAR_BIT(INTERRUPT_CONTROL_REG_1 , EXTERNAL_INTERRUPT_0_FLAG_BIT);
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
-
-/* check if this interrupt will use in program or not */    
-#if EXTERNAL_INTERRUPT_1_ == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_1_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(external_interrupt_1_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            external_interrupt_1_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-        /* clear interrupt flag to finish interrupt execution till a new interrupt */
-        CLEAR_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_1_FLAG_BIT);
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
-
-/* check if this interrupt will use in program or not */    
-#if EXTERNAL_INTERRUPT_2_ == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_2_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(external_interrupt_2_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            external_interrupt_2_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-        /* clear interrupt flag to finish interrupt execution till a new interrupt */
-        CLEAR_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_2_FLAG_BIT);
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
-
-/* check if this interrupt will use in program or not */    
-#if PORT_CHANGE_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_CONTROL_REG_1 , PORTB_CHANGE_INTERRUPT__FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(port_change_interrupt_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            port_change_interrupt_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-        /* clear interrupt flag to finish interrupt execution till a new interrupt */
-        CLEAR_BIT(INTERRUPT_CONTROL_REG_1 , PORTB_CHANGE_INTERRUPT__FLAG_BIT);
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
-
-/* check if this interrupt will use in program or not */
-#if USART_RECEIVE_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , USART_RECEIVE_INTERRUPT_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(USART_recieve_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            USART_recieve_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
-
-/* check if this interrupt will use in program or not */
-#if USART_TRANSMIT_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , USART_TRANSMIT_INTERRUPT_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(USART_transmit_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            USART_transmit_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
-
-/* check if this interrupt will use in program or not */    
-#if ADC_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , ADC_CONVERTER_INTERRUPT_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(ADC_converter_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            ADC_converter_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-        /* clear interrupt flag to finish interrupt execution till a new interrupt */
-        CLEAR_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , ADC_CONVERTER_INTERRUPT_FLAG_BIT);
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
-    
-/* check if this interrupt will use in program or not */   
-#if SPI_MASTER_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , SPI_MASTER_INTERRUPT_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(spi_master_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            spi_master_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-        /* clear interrupt flag to finish interrupt execution till a new interrupt */
-        CLEAR_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , SPI_MASTER_INTERRUPT_FLAG_BIT);
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
-
-/* check if this interrupt will use in program or not */
-#if PARALLEL_SLAVE_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , PARALLEL_SLAVE_INTERRUPT_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(parallel_slave_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            parallel_slave_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-        /* clear interrupt flag to finish interrupt execution till a new interrupt */
-        CLEAR_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , PARALLEL_SLAVE_INTERRUPT_FLAG_BIT);
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
- 
-/* check if this interrupt will use in program or not */
-#if CAPTURE_COMPARE_1_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , CAPTURE_COMPARE_PWM_1_INTERRUPT_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(capture_compare_1_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            capture_compare_1_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-        /* clear interrupt flag to finish interrupt execution till a new interrupt */
-        CLEAR_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , CAPTURE_COMPARE_PWM_1_INTERRUPT_FLAG_BIT);
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
-
-/* check if this interrupt will use in program or not */    
-#if CAPTURE_COMPARE_2_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , CAPTURE_COMPARE_PWM_2_INTERRUPT_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(capture_compare_2_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            capture_compare_2_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-        /* clear interrupt flag to finish interrupt execution till a new interrupt */
-        CLEAR_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , CAPTURE_COMPARE_PWM_2_INTERRUPT_FLAG_BIT);
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
-
-/* check if this interrupt will use in program or not */    
-#if OSCILLATOR_FAIL_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , OSCILLATOR_FAIL_INTERRUPT_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(oscillator_fail_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            oscillator_fail_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-        /* clear interrupt flag to finish interrupt execution till a new interrupt */
-        CLEAR_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , OSCILLATOR_FAIL_INTERRUPT_FLAG_BIT);
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Global_interrupt_disable(void)
+{
+    CLEAR_BIT(INTERRUPT_CONTROL_REG_1 , GLOBAL__HIGH_PRIORTY__INTERRUPT_ENABLE_BIT);
+}
 
-/* check if this interrupt will use in program or not */
-#if COMPARETOR_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , COMPARATOR_INTERRUPT_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(comarator_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            comarator_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-        /* clear interrupt flag to finish interrupt execution till a new interrupt */
-        CLEAR_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , COMPARATOR_INTERRUPT_FLAG_BIT);
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
+/*******************************************************************************
+ * Function Name:	Peripherals_interrupt_enable
+ *
+ * Description: 	enable all peripherals interrupts when their flags equal to 1 
+ *                  and the global interrupt is enabled.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Peripherals_interrupt_enable(void)
+{
+    SET_BIT(INTERRUPT_CONTROL_REG_1 , PERIPHERAL__LOW_PRIORTY__INTERRUPT_ENABLE_BIT);
+}
 
-/* check if this interrupt will use in program or not */
-#if EEPROM_WRITE_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , EEPROM_WRITE_INTERRUPT_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(EEPROM_write_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            EEPROM_write_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-        /* clear interrupt flag to finish interrupt execution till a new interrupt */
-        CLEAR_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , EEPROM_WRITE_INTERRUPT_FLAG_BIT);
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
- 
-/* check if this interrupt will use in program or not */
-#if BUS_COLLISION_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , BUS_COLLISION_INTERRUPT_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(bus_collision_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            bus_collision_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-        /* clear interrupt flag to finish interrupt execution till a new interrupt */
-        CLEAR_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , BUS_COLLISION_INTERRUPT_FLAG_BIT);
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
- 
-/* check if this interrupt will use in program or not */
-#if HIGH_LOW_VOLTAGE_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , H_L_VOLTAGE_DETECT_INTERRUPT_FLAG_BIT))
-    {
-        /* check if the user set interrupt function by call_back function or not */
-        if(high_low_voltage_callback_ptr != NULL_PTR)
-        {
-            /* call the user interrupt function*/
-            high_low_voltage_callback_ptr();
-        }
-        else
-        {
-            /*Do nothing*/
-        }
-        /*CLEAR_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , H_L_VOLTAGE_DETECT_INTERRUPT_FLAG_BIT);*/
-    }
-    else
-    {
-        /*Do nothing*/
-    }
-#endif
+/*******************************************************************************
+ * Function Name:	Peripherals_interrupt_disable
+ *
+ * Description: 	disable all peripherals interrupts to prevent any peripherals
+ *                  interrupt to occur.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Peripherals_interrupt_disable(void)
+{
+    CLEAR_BIT(INTERRUPT_CONTROL_REG_1 , PERIPHERAL__LOW_PRIORTY__INTERRUPT_ENABLE_BIT);
 }
 #elif INTERRUPT_LEVELS_NUMBERS == TWO_INTERRUPT_LEVELS
 
@@ -1911,6 +1441,8 @@ void Interrupt_in_two_levels_disable(void)
  * Function Name:	Set_interrupts_high_priority
  *
  * Description: 	set the interrupt as high level priority.
+ *                  note: the level should be the one in interrupt_config.h,
+ *                        the interrupt functions are built for it.
  *
  * Inputs:			EnumInterrupt_priority_t (typedef for all interrupt in 
  *                  micro_controller : EnumInterrupt_priority_t) 
@@ -2056,6 +1588,9 @@ void Set_interrupts_high_priority(EnumInterrupt_priority_t a_interrupt_type)
             SET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_2 , H_L_VOLTAGE_DETECT_INTERRUPT_PRIORITY_BIT);
             break;
 #endif
+        default:
+            /*Do nothing*/
+            break;
     }
 }
 
@@ -2063,6 +1598,8 @@ void Set_interrupts_high_priority(EnumInterrupt_priority_t a_interrupt_type)
  * Function Name:	Set_interrupts_low_priority
  *
  * Description: 	set the interrupt as low level priority.
+ *                  note: the level should be the one in interrupt_config.h,
+ *                        the interrupt functions are built for it.
  *
  * Inputs:			EnumInterrupt_priority_t (typedef for all interrupt in 
  *                  micro_controller : EnumInterrupt_priority_t) 
@@ -2208,15 +1745,198 @@ void Set_interrupts_low_priority(EnumInterrupt_priority_t a_interrupt_type)
             CLEAR_BIT(INTERRUPT_PERIPHERAL_PRIORITY_2 , H_L_VOLTAGE_DETECT_INTERRUPT_PRIORITY_BIT);
             break;
 #endif
+        default:
+            /*Do nothing*/
+            break;
     }
 }
 
+/*******************************************************************************
+ * Function Name:	Interrupt_levels_Initialization
+ *
+ * Description: 	enable the two levels of priority and set the level of every
+ *                  used interrupt as selected in interrupt_config.h.
+ *                  note: it should be called before enabling high and low
+ *                        priority interrupts because the interrupt functions
+ *                        check only the flags of their level.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Interrupt_levels_Initialization(void)
+{
+    Interrupt_in_two_levels_enable();
+/* check if this interrupt will use in program or not */
+#if TIMER_0_INTERRUPT == INTERRUPT_USED
+#if TIMER_0_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(TIMER0_INTERRUPT_PRIORITY);
+#else
+    Set_interrupts_low_priority(TIMER0_INTERRUPT_PRIORITY);
+#endif
+#endif
+/* check if this interrupt will use in program or not */
+#if TIMER_1_INTERRUPT == INTERRUPT_USED
+#if TIMER_1_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(TIMER1_INTERRUPT_PRIORITY);
+#else
+    Set_interrupts_low_priority(TIMER1_INTERRUPT_PRIORITY);
+#endif
+#endif
+/* check if this interrupt will use in program or not */
+#if TIMER_2_INTERRUPT == INTERRUPT_USED
+#if TIMER_2_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(TIMER2_INTERRUPT_PRIORITY);
+#else
+    Set_interrupts_low_priority(TIMER2_INTERRUPT_PRIORITY);
+#endif
+#endif
+/* check if this interrupt will use in program or not */
+#if TIMER_3_INTERRUPT == INTERRUPT_USED
+#if TIMER_3_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(TIMER3_INTERRUPT_PRIORITY);
+#else
+    Set_interrupts_low_priority(TIMER3_INTERRUPT_PRIORITY);
+#endif
+#endif
+/* check if this interrupt will use in program or not */
+#if EXTERNAL_INTERRUPT_1_ == INTERRUPT_USED
+#if EXTERNAL_INTERRUPT_1_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(EXTERNAL_INTERRUPT_1_PRIORITY);
+#else
+    Set_interrupts_low_priority(EXTERNAL_INTERRUPT_1_PRIORITY);
+#endif
+#endif
+/* check if this interrupt will use in program or not */
+#if EXTERNAL_INTERRUPT_2_ == INTERRUPT_USED
+#if EXTERNAL_INTERRUPT_2_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(EXTERNAL_INTERRUPT_2_PRIORITY);
+#else
+    Set_interrupts_low_priority(EXTERNAL_INTERRUPT_2_PRIORITY);
+#endif
+#endif
+/* check if this interrupt will use in program or not */
+#if PORT_CHANGE_INTERRUPT == INTERRUPT_USED
+#if PORT_CHANGE_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(PORT_CHANGE_INTERRUPT_PRIORITY);
+#else
+    Set_interrupts_low_priority(PORT_CHANGE_INTERRUPT_PRIORITY);
+#endif
+#endif
+/* check if this interrupt will use in program or not */
+#if USART_RECEIVE_INTERRUPT == INTERRUPT_USED
+#if USART_RECEIVE_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(USART_RECEIVE_INTERRUPT_PRIORITY);
+#else
+    Set_interrupts_low_priority(USART_RECEIVE_INTERRUPT_PRIORITY);
+#endif
+#endif
+/* check if this interrupt will use in program or not */
+#if USART_TRANSMIT_INTERRUPT == INTERRUPT_USED
+#if USART_TRANSMIT_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(USART_TRANSMIT_INTERRUPT_PRIORITY);
+#else
+    Set_interrupts_low_priority(USART_TRANSMIT_INTERRUPT_PRIORITY);
+#endif
+#endif
+/* check if this interrupt will use in program or not */
+#if ADC_INTERRUPT == INTERRUPT_USED
+#if ADC_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(ADC_INTERRUPT_PRIORITY);
+#else
+    Set_interrupts_low_priority(ADC_INTERRUPT_PRIORITY);
+#endif
+#endif
+/* check if this interrupt will use in program or not */
+#if SPI_MASTER_INTERRUPT == INTERRUPT_USED
+#if SPI_MASTER_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(SPI_MASTER_INTERRUPT_PRIORITY);
+#else
+    Set_interrupts_low_priority(SPI_MASTER_INTERRUPT_PRIORITY);
+#endif
+#endif
+/* check if this interrupt will use in program or not */
+#if PARALLEL_SLAVE_INTERRUPT == INTERRUPT_USED
+#if PARALLEL_SLAVE_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(PARALLEL_SLAVE_INTERRUPT_PRIORITY);
+#else
+    Set_interrupts_low_priority(PARALLEL_SLAVE_INTERRUPT_PRIORITY);
+#endif
+#endif
+/* check if this interrupt will use in program or not */
+#if CAPTURE_COMPARE_1_INTERRUPT == INTERRUPT_USED
+#if CAPTURE_COMPARE_1_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(CAPTURE_COMPARE_1_INTERRUPT_PRIORITY);
+#else
+    Set_interrupts_low_priority(CAPTURE_COMPARE_1_INTERRUPT_PRIORITY);
+#endif
+#endif
+/* check if this interrupt will use in program or not */
+#if CAPTURE_COMPARE_2_INTERRUPT == INTERRUPT_USED
+#if CAPTURE_COMPARE_2_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(CAPTURE_COMPARE_2_INTERRUPT_PRIORITY);
+#else
+    Set_interrupts_low_priority(CAPTURE_COMPARE_2_INTERRUPT_PRIORITY);
+#endif
+#endif
+/* check if this interrupt will use in program or not */
+#if COMPARETOR_INTERRUPT == INTERRUPT_USED
+#if COMPARETOR_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(COMPARETOR_INTERRUPT_PRIORITY);
+#else
+    Set_interrupts_low_priority(COMPARETOR_INTERRUPT_PRIORITY);
+#endif
+#endif
+/* check if this interrupt will use in program or not */
+#if OSCILLATOR_FAIL_INTERRUPT == INTERRUPT_USED
+#if OSCILLATOR_FAIL_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(OSCILLATOR_FAIL_INTERRUPT_PRIORITY);
+#else
+    Set_interrupts_low_priority(OSCILLATOR_FAIL_INTERRUPT_PRIORITY);
+#endif
+#endif
+/* check if this interrupt will use in program or not */
+#if BUS_COLLISION_INTERRUPT == INTERRUPT_USED
+#if BUS_COLLISION_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(BUS_COLLISION_INTERRUPT_PRIORITY);
+#else
+    Set_interrupts_low_priority(BUS_COLLISION_INTERRUPT_PRIORITY);
+#endif
+#endif
+/* check if this interrupt will use in program or not */
+#if EEPROM_WRITE_INTERRUPT == INTERRUPT_USED
+#if EEPROM_WRITE_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(EEPROM_WRITE_INTERRUPT_PRIORITY);
+#else
+    Set_interrupts_low_priority(EEPROM_WRITE_INTERRUPT_PRIORITY);
+#endif
+#endif
+/* check if this interrupt will use in program or not */
+#if HIGH_LOW_VOLTAGE_INTERRUPT == INTERRUPT_USED
+#if HIGH_LOW_VOLTAGE_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY
+    Set_interrupts_high_priority(HIGH_LOW_VOLTAGE_INTERRUPT_PRIORITY);
+#else
+    Set_interrupts_low_priority(HIGH_LOW_VOLTAGE_INTERRUPT_PRIORITY);
+#endif
+#endif
+}
+
+#endif
+
 /*******************************************************************************
  * Function Name:	(high priority) ISR
  *
  * Description: 	high priority interrupt handler function in this function all 
  *                  high priority interrupt functions will execute when the 
- *                  interrupt flag and high interrupts are equal 1..
+ *                  interrupt flag and high interrupts are equal 1.
+ *                  the level of every interrupt is selected at build time in
+ *                  interrupt_config.h so only flags of the high level are
+ *                  checked, and the compiler saves the context in the shadow
+ *                  registers and returns by RETFIE FAST.
+ *                  in one interrupt level mode all interrupts go to the high
+ *                  vector so this function checks the flags of all of them.
  *
  * Inputs:			NULL
  *
@@ -2227,14 +1947,11 @@ void Set_interrupts_low_priority(EnumInterrupt_priority_t a_interrupt_type)
 void __interrupt (high_priority) ISR(void)
 {
 /* check if this interrupt will use in program or not */
-#if TIMER_0_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_CONTROL_REG_1 , TIMER0_OVERFLOW_INTERRUPT_FLAG_BIT)
-            && (GET_BIT(INTERRUPT_CONTROL_REG_2 , TIMER0_OVERFLOW_INTERRUPT_PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if TIMER_0_INTERRUPT == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || TIMER_0_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_CONTROL_REG_1 , TIMER0_OVERFLOW_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_CONTROL_REG_1 , TIMER0_OVERFLOW_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(timer0_callback_ptr != NULL_PTR)
@@ -2256,14 +1973,11 @@ void __interrupt (high_priority) ISR(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if TIMER_1_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , TIMER1_OVERFLOW_INTERRUPT_FLAG_BIT)
-            && (GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_1 , TIMER1_OVERFLOW_INTERRUPT_PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if TIMER_1_INTERRUPT == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || TIMER_1_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_1 , TIMER1_OVERFLOW_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , TIMER1_OVERFLOW_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(timer1_callback_ptr != NULL_PTR)
@@ -2285,14 +1999,11 @@ void __interrupt (high_priority) ISR(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if TIMER_2_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , TIMER2_TO_PR2_MATCH_INTERRUPT_FLAG_BIT)
-        && (GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_1 , TIMER2_TO_PR2_MATCH_INTERRUPT_PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if TIMER_2_INTERRUPT == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || TIMER_2_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_1 , TIMER2_TO_PR2_MATCH_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , TIMER2_TO_PR2_MATCH_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(timer2_callback_ptr != NULL_PTR)
@@ -2314,14 +2025,11 @@ void __interrupt (high_priority) ISR(void)
 #endif
 
 /* check if this interrupt will use in program or not */
-#if TIMER_3_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , TIMER3_OVERFLOW_INTERRUPT_FLAG_BIT)
-            && (GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_2 , TIMER3_OVERFLOW_INTERRUPT_PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if TIMER_3_INTERRUPT == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || TIMER_3_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_2 , TIMER3_OVERFLOW_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , TIMER3_OVERFLOW_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(timer3_callback_ptr != NULL_PTR)
@@ -2344,9 +2052,10 @@ void __interrupt (high_priority) ISR(void)
 
 /* check if this interrupt will use in program or not */
 #if EXTERNAL_INTERRUPT_0_ == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       this interrupt can't be in Low level priority. */
-    if(GET_BIT(INTERRUPT_CONTROL_REG_1 , EXTERNAL_INTERRUPT_0_FLAG_BIT))
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled. this interrupt can't be in Low level priority. */
+    if(GET_BIT(INTERRUPT_CONTROL_REG_1 , EXTERNAL_INTERRUPT_0_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_CONTROL_REG_1 , EXTERNAL_INTERRUPT_0_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(external_interrupt_0_callback_ptr != NULL_PTR)
@@ -2368,14 +2077,11 @@ void __interrupt (high_priority) ISR(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if EXTERNAL_INTERRUPT_1_ == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_1_FLAG_BIT)
-            && (GET_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_1_PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if EXTERNAL_INTERRUPT_1_ == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || EXTERNAL_INTERRUPT_1_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_1_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_1_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(external_interrupt_1_callback_ptr != NULL_PTR)
@@ -2397,14 +2103,11 @@ void __interrupt (high_priority) ISR(void)
 #endif
 
 /* check if this interrupt will use in program or not */
-#if EXTERNAL_INTERRUPT_2_ == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_2_FLAG_BIT)
-            && (GET_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_2_PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if EXTERNAL_INTERRUPT_2_ == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || EXTERNAL_INTERRUPT_2_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_2_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_2_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(external_interrupt_2_callback_ptr != NULL_PTR)
@@ -2426,14 +2129,11 @@ void __interrupt (high_priority) ISR(void)
 #endif
 
 /* check if this interrupt will use in program or not */
-#if PORT_CHANGE_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_CONTROL_REG_1 , PORTB_CHANGE_INTERRUPT__FLAG_BIT)
-            && (GET_BIT(INTERRUPT_CONTROL_REG_2 , PORTB_CHANGE_INTERRUPT__PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if PORT_CHANGE_INTERRUPT == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || PORT_CHANGE_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_CONTROL_REG_1 , PORTB_CHANGE_INTERRUPT__ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_CONTROL_REG_1 , PORTB_CHANGE_INTERRUPT__FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(port_change_interrupt_callback_ptr != NULL_PTR)
@@ -2455,14 +2155,11 @@ void __interrupt (high_priority) ISR(void)
 #endif
 
 /* check if this interrupt will use in program or not */
-#if USART_RECEIVE_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , USART_RECEIVE_INTERRUPT_FLAG_BIT)
-            && (GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_1 , USART_RECEIVE_INTERRUPT_PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if USART_RECEIVE_INTERRUPT == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || USART_RECEIVE_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_1 , USART_RECEIVE_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , USART_RECEIVE_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(USART_recieve_callback_ptr != NULL_PTR)
@@ -2482,14 +2179,11 @@ void __interrupt (high_priority) ISR(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if USART_TRANSMIT_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , USART_TRANSMIT_INTERRUPT_FLAG_BIT)
-            && (GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_1 , USART_TRANSMIT_INTERRUPT_PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if USART_TRANSMIT_INTERRUPT == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || USART_TRANSMIT_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_1 , USART_TRANSMIT_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , USART_TRANSMIT_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(USART_transmit_callback_ptr != NULL_PTR)
@@ -2509,14 +2203,11 @@ void __interrupt (high_priority) ISR(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if ADC_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , ADC_CONVERTER_INTERRUPT_FLAG_BIT)
-            && (GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_1 , ADC_CONVERTER_INTERRUPT_PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if ADC_INTERRUPT == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || ADC_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_1 , ADC_CONVERTER_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , ADC_CONVERTER_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(ADC_converter_callback_ptr != NULL_PTR)
@@ -2538,14 +2229,11 @@ void __interrupt (high_priority) ISR(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if SPI_MASTER_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , SPI_MASTER_INTERRUPT_FLAG_BIT)
-            && (GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_1 , SPI_MASTER_INTERRUPT_PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if SPI_MASTER_INTERRUPT == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || SPI_MASTER_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_1 , SPI_MASTER_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , SPI_MASTER_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(spi_master_callback_ptr != NULL_PTR)
@@ -2567,14 +2255,11 @@ void __interrupt (high_priority) ISR(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if PARALLEL_SLAVE_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , PARALLEL_SLAVE_INTERRUPT_FLAG_BIT)
-            && (GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_1 , PARALLEL_SLAVE_INTERRUPT_PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if PARALLEL_SLAVE_INTERRUPT == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || PARALLEL_SLAVE_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_1 , PARALLEL_SLAVE_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , PARALLEL_SLAVE_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(parallel_slave_callback_ptr != NULL_PTR)
@@ -2596,14 +2281,11 @@ void __interrupt (high_priority) ISR(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if CAPTURE_COMPARE_1_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , CAPTURE_COMPARE_PWM_1_INTERRUPT_FLAG_BIT)
-            && (GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_1 , CAPTURE_COMPARE_PWM_1_INTERRUPT_PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if CAPTURE_COMPARE_1_INTERRUPT == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || CAPTURE_COMPARE_1_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_1 , CAPTURE_COMPARE_PWM_1_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , CAPTURE_COMPARE_PWM_1_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(capture_compare_1_callback_ptr != NULL_PTR)
@@ -2625,14 +2307,11 @@ void __interrupt (high_priority) ISR(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if CAPTURE_COMPARE_2_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , CAPTURE_COMPARE_PWM_2_INTERRUPT_FLAG_BIT)
-            && (GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_2 , CAPTURE_COMPARE_PWM_2_INTERRUPT_PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if CAPTURE_COMPARE_2_INTERRUPT == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || CAPTURE_COMPARE_2_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_2 , CAPTURE_COMPARE_PWM_2_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , CAPTURE_COMPARE_PWM_2_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(capture_compare_2_callback_ptr != NULL_PTR)
@@ -2654,14 +2333,11 @@ void __interrupt (high_priority) ISR(void)
 #endif
 
 /* check if this interrupt will use in program or not */
-#if OSCILLATOR_FAIL_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , OSCILLATOR_FAIL_INTERRUPT_FLAG_BIT)
-            && (GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_2 , OSCILLATOR_FAIL_INTERRUPT_PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if OSCILLATOR_FAIL_INTERRUPT == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || OSCILLATOR_FAIL_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_2 , OSCILLATOR_FAIL_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , OSCILLATOR_FAIL_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(oscillator_fail_callback_ptr != NULL_PTR)
@@ -2683,14 +2359,11 @@ void __interrupt (high_priority) ISR(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if COMPARETOR_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , COMPARATOR_INTERRUPT_FLAG_BIT)
-            && (GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_2 , COMPARATOR_INTERRUPT_PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if COMPARETOR_INTERRUPT == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || COMPARETOR_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_2 , COMPARATOR_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , COMPARATOR_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(comarator_callback_ptr != NULL_PTR)
@@ -2712,14 +2385,11 @@ void __interrupt (high_priority) ISR(void)
 #endif
 
 /* check if this interrupt will use in program or not */
-#if EEPROM_WRITE_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , EEPROM_WRITE_INTERRUPT_FLAG_BIT)
-            && (GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_2 , EEPROM_WRITE_INTERRUPT_PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if EEPROM_WRITE_INTERRUPT == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || EEPROM_WRITE_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_2 , EEPROM_WRITE_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , EEPROM_WRITE_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(EEPROM_write_callback_ptr != NULL_PTR)
@@ -2741,14 +2411,11 @@ void __interrupt (high_priority) ISR(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if BUS_COLLISION_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , BUS_COLLISION_INTERRUPT_FLAG_BIT)
-            && (GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_2 , BUS_COLLISION_INTERRUPT_PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if BUS_COLLISION_INTERRUPT == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || BUS_COLLISION_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_2 , BUS_COLLISION_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , BUS_COLLISION_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(bus_collision_callback_ptr != NULL_PTR)
@@ -2770,14 +2437,11 @@ void __interrupt (high_priority) ISR(void)
 #endif
 
 /* check if this interrupt will use in program or not */
-#if HIGH_LOW_VOLTAGE_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in high level priority.
-       and the two levels priority feature enabled because if it is disabled, all interrupts
-     * will be in one level(high level) */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , H_L_VOLTAGE_DETECT_INTERRUPT_FLAG_BIT)
-            && (GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_2 , H_L_VOLTAGE_DETECT_INTERRUPT_PRIORITY_BIT)
-             || (!GET_BIT(RESET_CONTROL_REG1 , INTERRUPT_PRIORITY_ENABLE_BIT))))
+#if HIGH_LOW_VOLTAGE_INTERRUPT == INTERRUPT_USED && (INTERRUPT_LEVELS_NUMBERS == ONE_INTERRUPT_LEVEL || HIGH_LOW_VOLTAGE_INTERRUPT_LEVEL == INTERRUPT_HIGH_PRIORITY)
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_2 , H_L_VOLTAGE_DETECT_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , H_L_VOLTAGE_DETECT_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(high_low_voltage_callback_ptr != NULL_PTR)
@@ -2798,12 +2462,15 @@ void __interrupt (high_priority) ISR(void)
 #endif
 }
 
+#if INTERRUPT_LEVELS_NUMBERS == TWO_INTERRUPT_LEVELS
+
 /*******************************************************************************
  * Function Name:	(low priority) ISR
  *
  * Description: 	low priority interrupt handler function in this function all 
  *                  low priority interrupt functions will execute when the 
  *                  interrupt flag and low interrupts are equal 1.
+ *                  note: it is interrupted by the high priority interrupts.
  *
  * Inputs:			NULL
  *
@@ -2814,11 +2481,11 @@ void __interrupt (high_priority) ISR(void)
 void __interrupt (low_priority)   ISRL(void)
 {
 /* check if this interrupt will use in program or not */
-#if TIMER_0_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(GET_BIT(INTERRUPT_CONTROL_REG_1 , TIMER0_OVERFLOW_INTERRUPT_FLAG_BIT)
-            && (!GET_BIT(INTERRUPT_CONTROL_REG_2 , TIMER0_OVERFLOW_INTERRUPT_PRIORITY_BIT)))
+#if TIMER_0_INTERRUPT == INTERRUPT_USED && TIMER_0_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_CONTROL_REG_1 , TIMER0_OVERFLOW_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_CONTROL_REG_1 , TIMER0_OVERFLOW_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(timer0_callback_ptr != NULL_PTR)
@@ -2840,11 +2507,11 @@ void __interrupt (low_priority)   ISRL(void)
 #endif
 
 /* check if this interrupt will use in program or not */
-#if TIMER_1_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , TIMER1_OVERFLOW_INTERRUPT_FLAG_BIT)
-            && (!GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_1 , TIMER1_OVERFLOW_INTERRUPT_PRIORITY_BIT)))
+#if TIMER_1_INTERRUPT == INTERRUPT_USED && TIMER_1_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_1 , TIMER1_OVERFLOW_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , TIMER1_OVERFLOW_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(timer1_callback_ptr != NULL_PTR)
@@ -2866,11 +2533,11 @@ void __interrupt (low_priority)   ISRL(void)
 #endif
 
 /* check if this interrupt will use in program or not */
-#if TIMER_2_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , TIMER2_TO_PR2_MATCH_INTERRUPT_FLAG_BIT)
-        && (!GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_1 , TIMER2_TO_PR2_MATCH_INTERRUPT_PRIORITY_BIT)))
+#if TIMER_2_INTERRUPT == INTERRUPT_USED && TIMER_2_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_1 , TIMER2_TO_PR2_MATCH_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , TIMER2_TO_PR2_MATCH_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(timer2_callback_ptr != NULL_PTR)
@@ -2892,11 +2559,11 @@ void __interrupt (low_priority)   ISRL(void)
 #endif
 
 /* check if this interrupt will use in program or not */
-#if TIMER_3_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , TIMER3_OVERFLOW_INTERRUPT_FLAG_BIT)
-            && (!GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_2 , TIMER3_OVERFLOW_INTERRUPT_PRIORITY_BIT)))
+#if TIMER_3_INTERRUPT == INTERRUPT_USED && TIMER_3_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_2 , TIMER3_OVERFLOW_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , TIMER3_OVERFLOW_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(timer3_callback_ptr != NULL_PTR)
@@ -2918,11 +2585,11 @@ void __interrupt (low_priority)   ISRL(void)
 #endif
 
 /* check if this interrupt will use in program or not */
-#if EXTERNAL_INTERRUPT_1_ == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(GET_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_1_FLAG_BIT)
-            && (!GET_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_1_PRIORITY_BIT)))
+#if EXTERNAL_INTERRUPT_1_ == INTERRUPT_USED && EXTERNAL_INTERRUPT_1_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_1_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_1_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(external_interrupt_1_callback_ptr != NULL_PTR)
@@ -2944,11 +2611,11 @@ void __interrupt (low_priority)   ISRL(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if EXTERNAL_INTERRUPT_2_ == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(GET_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_2_FLAG_BIT)
-            && (!GET_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_2_PRIORITY_BIT)))
+#if EXTERNAL_INTERRUPT_2_ == INTERRUPT_USED && EXTERNAL_INTERRUPT_2_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_2_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_CONTROL_REG_3 , EXTERNAL_INTERRUPT_2_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(external_interrupt_2_callback_ptr != NULL_PTR)
@@ -2970,11 +2637,11 @@ void __interrupt (low_priority)   ISRL(void)
 #endif
 
 /* check if this interrupt will use in program or not */
-#if PORT_CHANGE_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(GET_BIT(INTERRUPT_CONTROL_REG_1 , PORTB_CHANGE_INTERRUPT__FLAG_BIT)
-            && (!GET_BIT(INTERRUPT_CONTROL_REG_2 , PORTB_CHANGE_INTERRUPT__PRIORITY_BIT)))
+#if PORT_CHANGE_INTERRUPT == INTERRUPT_USED && PORT_CHANGE_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_CONTROL_REG_1 , PORTB_CHANGE_INTERRUPT__ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_CONTROL_REG_1 , PORTB_CHANGE_INTERRUPT__FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(port_change_interrupt_callback_ptr != NULL_PTR)
@@ -2996,11 +2663,11 @@ void __interrupt (low_priority)   ISRL(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if USART_RECEIVE_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , USART_RECEIVE_INTERRUPT_FLAG_BIT)
-            && (!GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_1 , USART_RECEIVE_INTERRUPT_PRIORITY_BIT)))
+#if USART_RECEIVE_INTERRUPT == INTERRUPT_USED && USART_RECEIVE_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_1 , USART_RECEIVE_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , USART_RECEIVE_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(USART_recieve_callback_ptr != NULL_PTR)
@@ -3020,11 +2687,11 @@ void __interrupt (low_priority)   ISRL(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if USART_TRANSMIT_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , USART_TRANSMIT_INTERRUPT_FLAG_BIT)
-            && (!GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_1 , USART_TRANSMIT_INTERRUPT_PRIORITY_BIT)))
+#if USART_TRANSMIT_INTERRUPT == INTERRUPT_USED && USART_TRANSMIT_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_1 , USART_TRANSMIT_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , USART_TRANSMIT_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(USART_transmit_callback_ptr != NULL_PTR)
@@ -3044,11 +2711,11 @@ void __interrupt (low_priority)   ISRL(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if ADC_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , ADC_CONVERTER_INTERRUPT_FLAG_BIT)
-            && (!GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_1 , ADC_CONVERTER_INTERRUPT_PRIORITY_BIT)))
+#if ADC_INTERRUPT == INTERRUPT_USED && ADC_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_1 , ADC_CONVERTER_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , ADC_CONVERTER_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(ADC_converter_callback_ptr != NULL_PTR)
@@ -3070,11 +2737,11 @@ void __interrupt (low_priority)   ISRL(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if SPI_MASTER_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , SPI_MASTER_INTERRUPT_FLAG_BIT)
-            && (!GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_1 , SPI_MASTER_INTERRUPT_PRIORITY_BIT)))
+#if SPI_MASTER_INTERRUPT == INTERRUPT_USED && SPI_MASTER_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_1 , SPI_MASTER_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , SPI_MASTER_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(spi_master_callback_ptr != NULL_PTR)
@@ -3096,11 +2763,11 @@ void __interrupt (low_priority)   ISRL(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if PARALLEL_SLAVE_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , PARALLEL_SLAVE_INTERRUPT_FLAG_BIT)
-            && (!GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_1 , PARALLEL_SLAVE_INTERRUPT_PRIORITY_BIT)))
+#if PARALLEL_SLAVE_INTERRUPT == INTERRUPT_USED && PARALLEL_SLAVE_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_1 , PARALLEL_SLAVE_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , PARALLEL_SLAVE_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(parallel_slave_callback_ptr != NULL_PTR)
@@ -3122,11 +2789,11 @@ void __interrupt (low_priority)   ISRL(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if CAPTURE_COMPARE_1_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , CAPTURE_COMPARE_PWM_1_INTERRUPT_FLAG_BIT)
-            && (!GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_1 , CAPTURE_COMPARE_PWM_1_INTERRUPT_PRIORITY_BIT)))
+#if CAPTURE_COMPARE_1_INTERRUPT == INTERRUPT_USED && CAPTURE_COMPARE_1_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_1 , CAPTURE_COMPARE_PWM_1_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_1 , CAPTURE_COMPARE_PWM_1_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(capture_compare_1_callback_ptr != NULL_PTR)
@@ -3148,11 +2815,11 @@ void __interrupt (low_priority)   ISRL(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if CAPTURE_COMPARE_2_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , CAPTURE_COMPARE_PWM_2_INTERRUPT_FLAG_BIT)
-            && (!GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_2 , CAPTURE_COMPARE_PWM_2_INTERRUPT_PRIORITY_BIT)))
+#if CAPTURE_COMPARE_2_INTERRUPT == INTERRUPT_USED && CAPTURE_COMPARE_2_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_2 , CAPTURE_COMPARE_PWM_2_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , CAPTURE_COMPARE_PWM_2_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(capture_compare_2_callback_ptr != NULL_PTR)
@@ -3174,11 +2841,11 @@ void __interrupt (low_priority)   ISRL(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if OSCILLATOR_FAIL_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , OSCILLATOR_FAIL_INTERRUPT_FLAG_BIT)
-            && (!GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_2 , OSCILLATOR_FAIL_INTERRUPT_PRIORITY_BIT)))
+#if OSCILLATOR_FAIL_INTERRUPT == INTERRUPT_USED && OSCILLATOR_FAIL_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_2 , OSCILLATOR_FAIL_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , OSCILLATOR_FAIL_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(oscillator_fail_callback_ptr != NULL_PTR)
@@ -3200,11 +2867,11 @@ void __interrupt (low_priority)   ISRL(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if COMPARETOR_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , COMPARATOR_INTERRUPT_FLAG_BIT)
-            && (!GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_2 , COMPARATOR_INTERRUPT_PRIORITY_BIT)))
+#if COMPARETOR_INTERRUPT == INTERRUPT_USED && COMPARETOR_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_2 , COMPARATOR_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , COMPARATOR_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(comarator_callback_ptr != NULL_PTR)
@@ -3226,11 +2893,11 @@ void __interrupt (low_priority)   ISRL(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if EEPROM_WRITE_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , EEPROM_WRITE_INTERRUPT_FLAG_BIT)
-            && (!GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_2 , EEPROM_WRITE_INTERRUPT_PRIORITY_BIT)))
+#if EEPROM_WRITE_INTERRUPT == INTERRUPT_USED && EEPROM_WRITE_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_2 , EEPROM_WRITE_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , EEPROM_WRITE_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(EEPROM_write_callback_ptr != NULL_PTR)
@@ -3252,11 +2919,11 @@ void __interrupt (low_priority)   ISRL(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if BUS_COLLISION_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , BUS_COLLISION_INTERRUPT_FLAG_BIT)
-            && (!GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_2 , BUS_COLLISION_INTERRUPT_PRIORITY_BIT)))
+#if BUS_COLLISION_INTERRUPT == INTERRUPT_USED && BUS_COLLISION_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_2 , BUS_COLLISION_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , BUS_COLLISION_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(bus_collision_callback_ptr != NULL_PTR)
@@ -3278,11 +2945,11 @@ void __interrupt (low_priority)   ISRL(void)
 #endif
 
 /* check if this interrupt will use in program or not */    
-#if HIGH_LOW_VOLTAGE_INTERRUPT == INTERRUPT_USED
-    /* check if this interrupt happened and flag is set or not. 
-       and if the interrupt in low level priority. */
-    if(!GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , H_L_VOLTAGE_DETECT_INTERRUPT_FLAG_BIT)
-            && (GET_BIT(INTERRUPT_PERIPHERAL_PRIORITY_2 , H_L_VOLTAGE_DETECT_INTERRUPT_PRIORITY_BIT)))
+#if HIGH_LOW_VOLTAGE_INTERRUPT == INTERRUPT_USED && HIGH_LOW_VOLTAGE_INTERRUPT_LEVEL == INTERRUPT_LOW_PRIORITY
+    /* check if this interrupt is enabled and happened, the flag is set even
+     * if the interrupt is disabled */
+    if(GET_BIT(INTERRUPT_PERIPHERAL_ENABLE_2 , H_L_VOLTAGE_DETECT_INTERRUPT_ENABLE_BIT) &&
+            GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , H_L_VOLTAGE_DETECT_INTERRUPT_FLAG_BIT))
     {
         /* check if the user set interrupt function by call_back function or not */
         if(high_low_voltage_callback_ptr != NULL_PTR)
@@ -199,6 +199,8 @@ extern void Interrupt_in_two_levels_disable(void);
  * Function Name:	Set_interrupts_high_priority
  *
  * Description: 	set the interrupt as high level priority.
+ *                  note: the level should be the one in interrupt_config.h,
+ *                        the interrupt functions are built for it.
  *
  * Inputs:			EnumInterrupt_priority_t (typedef for all interrupt in 
  *                  micro_controller : EnumInterrupt_priority_t) 
@@ -213,6 +215,8 @@ extern void Set_interrupts_high_priority(EnumInterrupt_priority_t a_interrupt_ty
  * Function Name:	Set_interrupts_low_priority
  *
  * Description: 	set the interrupt as low level priority.
+ *                  note: the level should be the one in interrupt_config.h,
+ *                        the interrupt functions are built for it.
  *
  * Inputs:			EnumInterrupt_priority_t (typedef for all interrupt in 
  *                  micro_controller : EnumInterrupt_priority_t) 
@@ -223,8 +227,39 @@ extern void Set_interrupts_high_priority(EnumInterrupt_priority_t a_interrupt_ty
  *******************************************************************************/
 extern void Set_interrupts_low_priority(EnumInterrupt_priority_t a_interrupt_type);
 
+/*******************************************************************************
+ * Function Name:	Interrupt_levels_Initialization
+ *
+ * Description: 	enable the two levels of priority and set the level of every
+ *                  used interrupt as selected in interrupt_config.h.
+ *                  note: it should be called before enabling high and low
+ *                        priority interrupts because the interrupt functions
+ *                        check only the flags of their level.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Interrupt_levels_Initialization(void);
+
 #endif
 
+/*******************************************************************************
+ * Function Name:	Wait_for_interrupt
+ *
+ * Description: 	stop the CPU in Idle mode until any enabled interrupt
+ *                  occurs, the peripherals and the timers keep running.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Wait_for_interrupt(void);
+
 /* check if this interrupt will use in program or not */
 #if TIMER_0_INTERRUPT == INTERRUPT_USED
 
@@ -24,7 +24,7 @@
 /*******************************************************************************
  *                              Definitions                                    *
  *******************************************************************************/
-#define INTERRUPT_CONTROL_REG_1                         *(volatile uint8*)0xFF2
+#define INTERRUPT_CONTROL_REG_1                         REGISTER_8BIT(0xFF2)
 #define GLOBAL__HIGH_PRIORTY__INTERRUPT_ENABLE_BIT      7u  
 #define PERIPHERAL__LOW_PRIORTY__INTERRUPT_ENABLE_BIT   6u  
 #define TIMER0_OVERFLOW_INTERRUPT_ENABLE_BIT            5u  
@@ -34,14 +34,14 @@
 #define EXTERNAL_INTERRUPT_0_FLAG_BIT                   1u  
 #define PORTB_CHANGE_INTERRUPT__FLAG_BIT                0u  
 
-#define INTERRUPT_CONTROL_REG_2                         *(volatile uint8*)0xFF1
+#define INTERRUPT_CONTROL_REG_2                         REGISTER_8BIT(0xFF1)
 #define EXTERNAL_INTERRUPT_0_EDGE_SELECT_BIT            6u  
 #define EXTERNAL_INTERRUPT_1_EDGE_SELECT_BIT            5u  
 #define EXTERNAL_INTERRUPT_2_EDGE_SELECT_BIT            4u  
 #define TIMER0_OVERFLOW_INTERRUPT_PRIORITY_BIT          2u  
 #define PORTB_CHANGE_INTERRUPT__PRIORITY_BIT            0u  
 
-#define INTERRUPT_CONTROL_REG_3                          *(volatile uint8*)0xFF0
+#define INTERRUPT_CONTROL_REG_3                          REGISTER_8BIT(0xFF0)
 #define EXTERNAL_INTERRUPT_2_PRIORITY_BIT               7u  
 #define EXTERNAL_INTERRUPT_1_PRIORITY_BIT               6u  
 #define EXTERNAL_INTERRUPT_2_ENABLE_BIT                 4u  
@@ -49,7 +49,7 @@
 #define EXTERNAL_INTERRUPT_2_FLAG_BIT                   1u  
 #define EXTERNAL_INTERRUPT_1_FLAG_BIT                   0u  
 
-#define RESET_CONTROL_REG1                              *(volatile uint8*)0xFD0
+#define RESET_CONTROL_REG1                              REGISTER_8BIT(0xFD0)
 #define INTERRUPT_PRIORITY_ENABLE_BIT                   7u  
 #define SOFTWARE_BOR_ENABLE_BIT                         6u   
 #define RESET_INSTRUCTION_FLAG_BIT                      4u  
@@ -58,7 +58,10 @@
 #define POWER_ON_RESET_STATUS_BIT                       1u  
 #define BROWN_OUT_RESET_STATUS_BIT                      0u 
 
-#define INTERRUPT_PERIPHERAL_ENABLE_1                   *(volatile uint8*)0xF9D
+#define OSCILLATOR_CONTROL_REG                          REGISTER_8BIT(0xFD3)
+#define IDLE_ENABLE_BIT                                 7u  
+
+#define INTERRUPT_PERIPHERAL_ENABLE_1                   REGISTER_8BIT(0xF9D)
 #define PARALLEL_SLAVE_INTERRUPT_ENABLE_BIT             7u  
 #define ADC_CONVERTER_INTERRUPT_ENABLE_BIT              6u  
 #define USART_RECEIVE_INTERRUPT_ENABLE_BIT              5u  
@@ -68,7 +71,7 @@
 #define TIMER2_TO_PR2_MATCH_INTERRUPT_ENABLE_BIT        1u  
 #define TIMER1_OVERFLOW_INTERRUPT_ENABLE_BIT            0u  
 
-#define INTERRUPT_PERIPHERAL_ENABLE_2                   *(volatile uint8*)0xFA0
+#define INTERRUPT_PERIPHERAL_ENABLE_2                   REGISTER_8BIT(0xFA0)
 #define OSCILLATOR_FAIL_INTERRUPT_ENABLE_BIT            7u  
 #define COMPARATOR_INTERRUPT_ENABLE_BIT                 6u   
 #define EEPROM_WRITE_INTERRUPT_ENABLE_BIT               4u  
@@ -77,7 +80,7 @@
 #define TIMER3_OVERFLOW_INTERRUPT_ENABLE_BIT            1u  
 #define CAPTURE_COMPARE_PWM_2_INTERRUPT_ENABLE_BIT      0u  
 
-#define INTERRUPT_PERIPHERAL_FLAGS_1                    *(volatile uint8*)0xF9E
+#define INTERRUPT_PERIPHERAL_FLAGS_1                    REGISTER_8BIT(0xF9E)
 #define PARALLEL_SLAVE_INTERRUPT_FLAG_BIT               7u  
 #define ADC_CONVERTER_INTERRUPT_FLAG_BIT                6u  
 #define USART_RECEIVE_INTERRUPT_FLAG_BIT                5u  
@@ -87,7 +90,7 @@
 #define TIMER2_TO_PR2_MATCH_INTERRUPT_FLAG_BIT          1u  
 #define TIMER1_OVERFLOW_INTERRUPT_FLAG_BIT              0u  
 
-#define INTERRUPT_PERIPHERAL_FLAGS_2                    *(volatile uint8*)0xFA1
+#define INTERRUPT_PERIPHERAL_FLAGS_2                    REGISTER_8BIT(0xFA1)
 #define OSCILLATOR_FAIL_INTERRUPT_FLAG_BIT              7u  
 #define COMPARATOR_INTERRUPT_FLAG_BIT                   6u 
 #define EEPROM_WRITE_INTERRUPT_FLAG_BIT                 4u  
@@ -96,7 +99,7 @@
 #define TIMER3_OVERFLOW_INTERRUPT_FLAG_BIT              1u  
 #define CAPTURE_COMPARE_PWM_2_INTERRUPT_FLAG_BIT        0u   
 
-#define INTERRUPT_PERIPHERAL_PRIORITY_1                 *(volatile uint8*)0xF9F
+#define INTERRUPT_PERIPHERAL_PRIORITY_1                 REGISTER_8BIT(0xF9F)
 #define PARALLEL_SLAVE_INTERRUPT_PRIORITY_BIT           7u  
 #define ADC_CONVERTER_INTERRUPT_PRIORITY_BIT            6u  
 #define USART_RECEIVE_INTERRUPT_PRIORITY_BIT            5u  
@@ -106,7 +109,7 @@
 #define TIMER2_TO_PR2_MATCH_INTERRUPT_PRIORITY_BIT      1u  
 #define TIMER1_OVERFLOW_INTERRUPT_PRIORITY_BIT          0u 
 
-#define INTERRUPT_PERIPHERAL_PRIORITY_2                 *(volatile uint8*)0xFA2
+#define INTERRUPT_PERIPHERAL_PRIORITY_2                 REGISTER_8BIT(0xFA2)
 #define OSCILLATOR_FAIL_INTERRUPT_PRIORITY_BIT          7u  
 #define COMPARATOR_INTERRUPT_PRIORITY_BIT               6u   
 #define EEPROM_WRITE_INTERRUPT_PRIORITY_BIT             4u  
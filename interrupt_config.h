@@ -6,6 +6,7 @@
  * 
  * Comments:            it contains configuration of interrupts:
  *                          -the interrupt on one or two levels.
+ *                          -level of every interrupt in two levels mode.
  *                          -which interrupts will use to make their functions avaliable.
  * 
  * Revision history:    19/2/2020
@@ -25,29 +26,56 @@
 
 #define INTERRUPT_USED                          0u
 #define INTERRUPT_NON_USED                      1u
+
+#define INTERRUPT_HIGH_PRIORITY                 0u
+#define INTERRUPT_LOW_PRIORITY                  1u
 /*-------------------------------------------------------------------------------*/
-#define INTERRUPT_LEVELS_NUMBERS                ONE_INTERRUPT_LEVEL
+#define INTERRUPT_LEVELS_NUMBERS                TWO_INTERRUPT_LEVELS
 
 #define EXTERNAL_INTERRUPT_0_                   INTERRUPT_NON_USED
 #define EXTERNAL_INTERRUPT_1_                   INTERRUPT_NON_USED
 #define EXTERNAL_INTERRUPT_2_                   INTERRUPT_NON_USED
 #define TIMER_0_INTERRUPT                       INTERRUPT_USED
-#define TIMER_1_INTERRUPT                       INTERRUPT_NON_USED
+#define TIMER_1_INTERRUPT                       INTERRUPT_USED
 #define TIMER_2_INTERRUPT                       INTERRUPT_NON_USED
-#define TIMER_3_INTERRUPT                       INTERRUPT_NON_USED
-#define PORT_CHANGE_INTERRUPT                   INTERRUPT_NON_USED
+#define TIMER_3_INTERRUPT                       INTERRUPT_USED
+#define PORT_CHANGE_INTERRUPT                   INTERRUPT_USED
 #define USART_RECEIVE_INTERRUPT                 INTERRUPT_NON_USED
 #define USART_TRANSMIT_INTERRUPT                INTERRUPT_NON_USED
 #define ADC_INTERRUPT                           INTERRUPT_NON_USED
 #define SPI_MASTER_INTERRUPT                    INTERRUPT_NON_USED
 #define PARALLEL_SLAVE_INTERRUPT                INTERRUPT_NON_USED
 #define CAPTURE_COMPARE_1_INTERRUPT             INTERRUPT_NON_USED
-#define CAPTURE_COMPARE_2_INTERRUPT             INTERRUPT_NON_USED
+#define CAPTURE_COMPARE_2_INTERRUPT             INTERRUPT_USED
 #define COMPARETOR_INTERRUPT                    INTERRUPT_NON_USED
 #define OSCILLATOR_FAIL_INTERRUPT               INTERRUPT_NON_USED
 #define BUS_COLLISION_INTERRUPT                 INTERRUPT_NON_USED
 #define EEPROM_WRITE_INTERRUPT                  INTERRUPT_NON_USED
 #define HIGH_LOW_VOLTAGE_INTERRUPT              INTERRUPT_NON_USED
+/*-------------------------------------------------------------------------------*/
+/* levels of interrupts when INTERRUPT_LEVELS_NUMBERS is TWO_INTERRUPT_LEVELS,
+ * external interrupt 0 is always high priority.
+ * the time base, the heater tick, the countdown and the door and weight
+ * buttons are high priority so they don't wait the user interface ones */
+#define TIMER_0_INTERRUPT_LEVEL                 INTERRUPT_HIGH_PRIORITY
+#define TIMER_1_INTERRUPT_LEVEL                 INTERRUPT_HIGH_PRIORITY
+#define TIMER_2_INTERRUPT_LEVEL                 INTERRUPT_LOW_PRIORITY
+#define TIMER_3_INTERRUPT_LEVEL                 INTERRUPT_HIGH_PRIORITY
+#define EXTERNAL_INTERRUPT_1_LEVEL              INTERRUPT_LOW_PRIORITY
+#define EXTERNAL_INTERRUPT_2_LEVEL              INTERRUPT_LOW_PRIORITY
+#define PORT_CHANGE_INTERRUPT_LEVEL             INTERRUPT_HIGH_PRIORITY
+#define USART_RECEIVE_INTERRUPT_LEVEL           INTERRUPT_LOW_PRIORITY
+#define USART_TRANSMIT_INTERRUPT_LEVEL          INTERRUPT_LOW_PRIORITY
+#define ADC_INTERRUPT_LEVEL                     INTERRUPT_LOW_PRIORITY
+#define SPI_MASTER_INTERRUPT_LEVEL              INTERRUPT_LOW_PRIORITY
+#define PARALLEL_SLAVE_INTERRUPT_LEVEL          INTERRUPT_LOW_PRIORITY
+#define CAPTURE_COMPARE_1_INTERRUPT_LEVEL       INTERRUPT_LOW_PRIORITY
+#define CAPTURE_COMPARE_2_INTERRUPT_LEVEL       INTERRUPT_LOW_PRIORITY
+#define COMPARETOR_INTERRUPT_LEVEL              INTERRUPT_LOW_PRIORITY
+#define OSCILLATOR_FAIL_INTERRUPT_LEVEL         INTERRUPT_HIGH_PRIORITY
+#define BUS_COLLISION_INTERRUPT_LEVEL           INTERRUPT_LOW_PRIORITY
+#define EEPROM_WRITE_INTERRUPT_LEVEL            INTERRUPT_LOW_PRIORITY
+#define HIGH_LOW_VOLTAGE_INTERRUPT_LEVEL        INTERRUPT_HIGH_PRIORITY
 
 #endif	/* INTERRUPT_CONFIG_H */
 
@@ -15,6 +15,56 @@
  *******************************************************************************/
 #include "general_bitConfig.h"
 #include "microwave.h"
+#include "KeyPad.h"
+#include "KeyPad_config.h"
+#include "buttons.h"
+#include "buzzer.h"
+#include "render.h"
+#include "pot.h"
+#include "timebase.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* pins of modules are checked at build time by their configurations and
+ * at initialization by GPIO_Claim_pins */
+#define PINS_OVERLAP(PORT1,FIRST1,LAST1,PORT2,FIRST2,LAST2) \
+        ((PORT1) == (PORT2) && (FIRST1) <= (LAST2) && (FIRST2) <= (LAST1))
+#define PIN_IN_RANGE(PORT1,FIRST1,LAST1,PORT2,PIN2) \
+        PINS_OVERLAP(PORT1 , FIRST1 , LAST1 , PORT2 , PIN2 , PIN2)
+
+#if LCD_MODE == LCD_4BITS_MODE
+#define LCD_FIRST_DATA_PIN          GPIO_PIN4
+#else
+#define LCD_FIRST_DATA_PIN          GPIO_PIN0
+#endif
+
+#if PINS_OVERLAP(KEYPAD_PORT_OUT_ROW , START_ROW , END_ROW , LCD_DATA_PORT , LCD_FIRST_DATA_PIN , GPIO_PIN7)
+#error "keypad rows and LCD data use the same pins"
+#endif
+#if PIN_IN_RANGE(KEYPAD_PORT_OUT_ROW , START_ROW , END_ROW , LCD_ORDER_PORT , LCD_RS_PIN) || \
+    PIN_IN_RANGE(KEYPAD_PORT_OUT_ROW , START_ROW , END_ROW , LCD_ORDER_PORT , LCD_RW_PIN) || \
+    PIN_IN_RANGE(KEYPAD_PORT_OUT_ROW , START_ROW , END_ROW , LCD_ORDER_PORT , LCD_E_PIN)
+#error "keypad rows and LCD control use the same pins"
+#endif
+#if PIN_IN_RANGE(KEYPAD_PORT_IN_COL , START_COL , END_COL , DOOR_SENSOR_PORT , DOOR_SENSOR_PIN) || \
+    PIN_IN_RANGE(KEYPAD_PORT_IN_COL , START_COL , END_COL , WEIGHT_SENSOR_PORT , WEIGHT_SENSOR_PIN) || \
+    PIN_IN_RANGE(KEYPAD_PORT_IN_COL , START_COL , END_COL , LED_PORT , LED_PIN)
+#error "keypad columns and application pins use the same pins"
+#endif
+#if DOOR_SENSOR_PORT != GPIO_PORTB || WEIGHT_SENSOR_PORT != GPIO_PORTB || \
+    ((BUTTONS_PINS_MASK >> DOOR_SENSOR_PIN) & 1u) == 0 || ((BUTTONS_PINS_MASK >> WEIGHT_SENSOR_PIN) & 1u) == 0
+#error "door and weight sensors should be buttons of interrupt on change pins"
+#endif
+#if BUZZER_PORT != BUZZER_CCP_PORT || BUZZER_PIN != BUZZER_CCP_PIN
+#error "buzzer should be on output pin of CCP2"
+#endif
+/* heating screen: time in rows 1 and 2 beside the stage and temperature,
+ * progress bar in row 3 before the power */
+#if RENDER_TIME_ROW != 1u || RENDER_TIME_COLUMN + RENDER_TIME_WIDTH > 13u || \
+    RENDER_BAR_ROW != 3u || RENDER_BAR_COLUMN + RENDER_BAR_CELLS > 9u
+#error "big time or progress bar overlaps the heating screen"
+#endif
 
 /* main application code */
 void main(void) 
@@ -25,22 +75,23 @@ void main(void)
     GPIO_Disable_Comparator_On_PORTA();
     /* enable weak internal Pull up resistors on input pins on PORT B */
     GPIO_Enable_Pull_Up_On_PortB();
-    /* Set Heater pin as output pin */
-    GPIO_SetPinDirection(HEATER_PORT , HEATER_PIN , OUTPUT);
-    /* Set Buzzer pin as output pin */
-    GPIO_SetPinDirection(BUZZER_PORT , BUZZER_PIN , OUTPUT);
-    /* Disable Buzzer */
-    GPIO_WriteOnPin(BUZZER_PORT , BUZZER_PIN , HIGH);
+    /* Set Heater pin as output pin and turn the heater off */
+    Heater_Initialization();
+    /* start timer 3 as free running time base, it is used by the buzzer too */
+    Timebase_Initialization();
+    /* Set Buzzer pin as output pin, its tones are made by CCP2 and timer 3 */
+    Buzzer_Initialization();
     /* Set LED pin as output pin */
-    GPIO_SetPinDirection(LED_PORT , LED_PIN , OUTPUT);
-    /* Disable LED */
-    GPIO_WriteOnPin(LED_PORT , LED_PIN , LOW);
-    /* Set Door sensor pin as input pin */
-    GPIO_SetPinDirection(DOOR_SENSOR_PORT , DOOR_SENSOR_PIN , INPUT);
-    /* Set weight sensor pin as input pin */
-    GPIO_SetPinDirection(WEIGHT_SENSOR_PORT , WEIGHT_SENSOR_PIN , INPUT);
+    GPIO_Claim_pins(LED_PORT , 1 << LED_PIN , GPIO_OWNER_APPLICATION , GPIO_MODE_OUTPUT);
+    /* Disable Buzzer and LED */
+    GPIO_WriteOnGroup(&g_indicators_group , LOW);
+    /* Set door and weight sensors pins as input pins, their press events
+     * are caught by PORT B interrupt on change */
+    Buttons_Initialization();
     /* initialize LCD module */
     LCD_Initialization();
+    /* initialize KeyPad module once, LCD doesn't change directions of its pins */
+    KeyPad_Initialization();
     /* initialize PWM module on Channel 1 "PORT C - PIN 2" to make fan 
      * work to set the user desired temperature for heating operation. */
     PWM_Initialization(PWM_CHANNEL_1);
@@ -54,10 +105,42 @@ void main(void)
     /* Select ADC clock by devision system clock on the selected 
      * number "16" to determine time of conversion on ADC channel 1. */
     ADC_Select_prescaler(ADC_PRESCALER_16);
-    /* initialize Timer 0 module */
+    /* load the learned range of the potentiometer from data EEPROM */
+    Pot_Initialization();
+    /* two modules claimed the same pin, the pins configuration should be fixed */
+    if(GPIO_Get_conflicts_number() != 0)
+    {
+        LCD_SendDataString("Pins conflict");
+        __delay_ms(3000);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* initialize Timer 0 module, it runs from reset so it's stopped till the
+     * heating starts */
     Timer0_Initialization();
+    Timer0_disable();
     /* Set Timer 0 call_back function to run when overflow interrupt occur  */
     Timer0_set_callback_function(TIMER0_ISR);
+    /* initialize Timer 1 module to make system tick every 10ms for heater power */
+    Timer1_Initialization();
+    /* Set Timer 1 call_back function to run when overflow interrupt occur  */
+    Timer1_set_callback_function(TIMER1_ISR);
+    Timer1_write_counter(TIMER1_TICK_PRELOAD);
+    /* enable Timer 1 interrupt, it's peripheral interrupt */
+    Timer1_enable_overflow_interrupt();
+#if INTERRUPT_LEVELS_NUMBERS == TWO_INTERRUPT_LEVELS
+    /* time base, heater tick and buttons interrupts are high priority, the
+     * buzzer is low priority */
+    Interrupt_levels_Initialization();
+    Low_priority_interrupts_enable();
+    High_priority_interrupts_enable();
+#else
+    Peripherals_interrupt_enable();
+    Global_interrupt_enable();
+#endif
+    Timer1_enable();
     /* Display Welcome message when turn device on */
     Welcome_screen_display();
     /* Display home screen or idle state screen */
@@ -65,6 +148,10 @@ void main(void)
     /* loop to make program is worked as long the power is on */
     while(1)
     {
+        /* read keypad every system tick to get its events */
+        Keypad_scan_function();
+        /* toggle door and weight sensors by press events of their buttons */
+        Sensors_events_function();
         /* check on device states to move from state to another depend on user choices */
         switch(g_system_state_var_t)
         {
@@ -73,10 +160,6 @@ void main(void)
             case SYSTEM_IDLE_STATE:
                 /* user selects temperature by potentiometer and Display this temp. on screen. */
                 Set_and_Display_desired_temp();
-                /* user can open the door to put the food and close the door again */
-                Door_sensor_function();
-                /* user can put the food inside microwave or take it out if the door is opened. */
-                Weight_sensor_function();
                 /* user can insert the heating time that he want and 
                  * this time display on screen while the user insert it*/
                 User_insert_time_and_start_heating_function();
@@ -88,18 +171,20 @@ void main(void)
                 Set_and_Display_desired_temp();
                 /* Display the reminding time to finish heating process*/
                 Display_remind_time();
+                /* apply heater power and fan duty of the new stage when the running stage finishes */
+                Heating_stage_update_function();
                 /* check if user canceled the heating process */
                 If_heating_is_canceled_function();
                 /* check if the heating process finished */
                 if (g_u16MicrowaveTime == 0)
                 {
-                    g_system_state_var_t = SYSTEM_END_TIME;
-                    LCD_ClearScreen();
+                    /* stop the heating devices and start the alarm once */
+                    Heating_finished_function();
                 }
                 break;
             /* state after the heating process finished, in this state the system alarm the user*/
             case SYSTEM_END_TIME:
-                /* disable the heating devices and enable alarm */
+                /* blink the finishing message while the buzzer plays the alarm */
                 Heating_process_has_done_function();
                 /* return the system to idle state and reset time array and clear LCD*/
                 Reset_to_idle_state();
@@ -108,6 +193,9 @@ void main(void)
                 /* Do nothing*/
                 break;
         }
+        /* the events come from interrupts so the CPU waits for the next one,
+         * the system tick wakes it every 10ms at least */
+        Wait_for_interrupt();
     }
 }
 
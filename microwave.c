@@ -15,6 +15,13 @@
  *******************************************************************************/
 #include "microwave.h"
 #include "KeyPad.h"
+#include "buttons.h"
+#include "buzzer.h"
+#include "presets.h"
+#include "sequence.h"
+#include "render.h"
+#include "screen.h"
+#include "pot.h"
 #include <xc.h>
 
 /*******************************************************************************
@@ -33,6 +40,24 @@ typedef enum{
             MICROWAVE_HAS_SOMETHING_INSIDE
 }EnumWeight_sensor_t;
 
+/**************************** EnumPreset_menu_t ********************************/
+typedef enum{
+            PRESET_MENU_CLOSED,
+            PRESET_MENU_SELECT,
+            PRESET_MENU_SAVE
+}EnumPreset_menu_t;
+
+/**************************** EnumScreen_field_t *******************************/
+typedef enum{
+            FIELD_NAME,
+            FIELD_TIME,
+            FIELD_TEMPERATURE,
+            FIELD_DOOR,
+            FIELD_INSIDE,
+            FIELD_STAGE,
+            FIELD_POWER
+}EnumScreen_field_t;
+
 /*******************************************************************************
  *                             global variables                                *
  *******************************************************************************/
@@ -40,6 +65,8 @@ typedef enum{
 uint16 g_u16MicrowaveTime = 0;
 /* System state variable that used to make system state machine */
 EnumSystem_states_t g_system_state_var_t = SYSTEM_IDLE_STATE;
+/* pins of LED and Buzzer to turn them on or off together */
+const StrGPIO_group_t g_indicators_group = {GPIO_GROUP_PORTS(INDICATORS_MASK) , GPIO_GROUP_PORTS(INDICATORS_LEVEL)};
 
 /*******************************************************************************
  *                           Static Variables                                  *
@@ -55,11 +82,286 @@ static uint8 g_u8timer_arr[6] = {ASCII_ZERO_NUMBER , ASCII_ZERO_NUMBER , ':' , A
 /* variable is used to determine which time digit is inserted */
 static uint8 g_u8time_digits = 0;
 /* variable used to read pressed key on KeyPad */
-static uint8 g_u8keypad_button_val = 10;
+static uint8 g_u8keypad_button_val = KEYPAD_NO_KEY;
 /* value of user selected temperature of microwave */
 static uint8 g_u8temperature = 0;
 /* variable used to check if user change selected temperature to display new value on LCD*/
 static uint8 g_u8old_temp_reading = 100;
+/* state of preset programs menu which is opened by '*' before inserting any time */
+static EnumPreset_menu_t g_preset_menu_t = PRESET_MENU_CLOSED;
+/* flag to check if the heating process is paused to not consider its continue as a new process */
+static uint8 g_u8heating_paused_flag = FALSE;
+/* system ticks of Timer1 (10ms) which are used as time of keypad events */
+static volatile uint16 g_u16system_ticks = 0;
+/* tick of the last keypad scan */
+static uint16 g_u16keypad_scan_tick = 0;
+/* time and temperature of the last started heating process to be saved as user preset */
+static uint16 g_u16last_cook_time = 0;
+static uint8 g_u8last_cook_temperature = 0;
+/* flag to check if preset program loaded its stages to the sequence engine */
+static uint8 g_u8sequence_loaded_flag = FALSE;
+/* name of the loaded preset program which is displayed instead of "Time:" */
+static uint8 g_u8preset_name_arr[PRESET_NAME_SIZE];
+/* alarm of the finished heating process, three beeps then silence and it
+ * is repeated till the user returns to idle state */
+static const StrBuzzer_note_t g_finish_alarm_notes_arr[] = {
+    {FINISH_ALARM_FREQUENCY , 200} , {BUZZER_REST , 100} ,
+    {FINISH_ALARM_FREQUENCY , 200} , {BUZZER_REST , 100} ,
+    {FINISH_ALARM_FREQUENCY , 200} , {BUZZER_REST , 1200}
+};
+static const StrBuzzer_melody_t g_finish_alarm = {g_finish_alarm_notes_arr ,
+        sizeof(g_finish_alarm_notes_arr) / sizeof(g_finish_alarm_notes_arr[0]) , BUZZER_REPEAT_FOREVER};
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Apply_temperature
+ *
+ * Description: 	update fan duty cycle depend on the selected temperature
+ *                  and display this temperature on LCD.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Apply_temperature(void);
+
+/*******************************************************************************
+ * Function Name:	Apply_fan_duty
+ *
+ * Description: 	update fan duty cycle by the fan duty of the running stage
+ *                  or by the selected temperature if the stage doesn't fix it.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Apply_fan_duty(void);
+
+/*******************************************************************************
+ * Function Name:	Apply_stage_outputs
+ *
+ * Description: 	apply heater power and fan duty of the running stage and
+ *                  display the stage number and its power on LCD.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Apply_stage_outputs(void);
+
+/*******************************************************************************
+ * Function Name:	Preset_menu_function
+ *
+ * Description: 	handle pressed key when preset programs menu is opened to
+ *                  load preset program, save the last heating process as
+ *                  user preset or reset the range of the potentiometer.
+ *
+ * Inputs:			a_u8key           (uint8) value of pressed key
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Preset_menu_function(uint8 a_u8key);
+
+/*******************************************************************************
+ * Function Name:	System_get_ticks
+ *
+ * Description: 	read system ticks of Timer1 (10ms), 16 bits variable is read
+ *                  by two instructions so it's read again until getting the
+ *                  same value without interrupt between them.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			system ticks (uint16)
+ *******************************************************************************/
+static uint16 System_get_ticks(void);
+
+/*******************************************************************************
+ * Function Name:	Stop_heating_devices
+ *
+ * Description: 	turn off the heater, the LED and the fan and stop timer 0
+ *                  of the heating time.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Stop_heating_devices(void);
+
+/*******************************************************************************
+ * Function Name:	Format_name
+ *
+ * Description: 	name of the loaded preset program or "Time:" label, 10 characters.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u8text_ptr      (uint8*) characters of the field
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Format_name(uint8 * a_u8text_ptr);
+
+/*******************************************************************************
+ * Function Name:	Format_time
+ *
+ * Description: 	inserted time "mm:ss" or "__:__" before inserting any digit.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u8text_ptr      (uint8*) characters of the field
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Format_time(uint8 * a_u8text_ptr);
+
+/*******************************************************************************
+ * Function Name:	Format_temperature
+ *
+ * Description: 	selected temperature in celsius, 2 characters.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u8text_ptr      (uint8*) characters of the field
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Format_temperature(uint8 * a_u8text_ptr);
+
+/*******************************************************************************
+ * Function Name:	Format_door
+ *
+ * Description: 	state of the door sensor, 6 characters.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u8text_ptr      (uint8*) characters of the field
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Format_door(uint8 * a_u8text_ptr);
+
+/*******************************************************************************
+ * Function Name:	Format_inside
+ *
+ * Description: 	state of the weight sensor, 6 characters.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u8text_ptr      (uint8*) characters of the field
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Format_inside(uint8 * a_u8text_ptr);
+
+/*******************************************************************************
+ * Function Name:	Format_stage
+ *
+ * Description: 	number of running stage and number of all stages "1/3".
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u8text_ptr      (uint8*) characters of the field
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Format_stage(uint8 * a_u8text_ptr);
+
+/*******************************************************************************
+ * Function Name:	Format_power
+ *
+ * Description: 	heater power of the running stage "100%".
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u8text_ptr      (uint8*) characters of the field
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Format_power(uint8 * a_u8text_ptr);
+
+/*******************************************************************************
+ * Function Name:	Draw_remaining_time
+ *
+ * Description: 	draw the reminding time as big digits and the progress bar
+ *                  of the heating process when it isn't paused.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Draw_remaining_time(void);
+
+/*******************************************************************************
+ *                                 Screens                                     *
+ *******************************************************************************/
+/* welcome message when the microwave starts */
+static const StrScreen_text_t g_welcome_texts_arr[] = {
+    {3 , 1 , "Welcome to"} , {0 , 2 , "----------------"} , {0 , 3 , "SWIFT ACT"} , {7 , 4 , "MicroWave"}
+};
+static const StrScreen_t g_welcome_screen = {g_welcome_texts_arr , 4 , NULL_PTR , 0 , NULL_PTR};
+
+/* idle state: time and temperature insertion and states of the sensors */
+static const StrScreen_text_t g_home_texts_arr[] = {
+    {0 , 2 , "Temperature:"} , {15 , 2 , "c"} , {0 , 3 , "Door_St:"} , {0 , 4 , "Inside_St:"}
+};
+static const StrScreen_field_t g_home_fields_arr[] = {
+    {FIELD_NAME , 0 , 1 , 10 , Format_name} , {FIELD_TIME , 11 , 1 , 5 , Format_time} ,
+    {FIELD_TEMPERATURE , 13 , 2 , 2 , Format_temperature} ,
+    {FIELD_DOOR , 10 , 3 , 6 , Format_door} , {FIELD_INSIDE , 10 , 4 , 6 , Format_inside}
+};
+static const StrScreen_t g_home_screen = {g_home_texts_arr , 4 , g_home_fields_arr , 5 , NULL_PTR};
+
+/* preset programs menu over the time and temperature of the idle state */
+static const StrScreen_text_t g_preset_select_texts_arr[] = {
+    {0 , 2 , "Temperature:"} , {15 , 2 , "c"} , {0 , 3 , "1-9:Prog  0:Pot"} , {0 , 4 , "#:Save  *:Cancel"}
+};
+static const StrScreen_t g_preset_select_screen = {g_preset_select_texts_arr , 4 , g_home_fields_arr , 3 , NULL_PTR};
+static const StrScreen_text_t g_preset_save_texts_arr[] = {
+    {0 , 2 , "Temperature:"} , {15 , 2 , "c"} , {0 , 3 , "Save last to 4-9"} , {0 , 4 , "*:Cancel"}
+};
+static const StrScreen_t g_preset_save_screen = {g_preset_save_texts_arr , 4 , g_home_fields_arr , 3 , NULL_PTR};
+
+/* heating state: big time, progress bar, running stage and temperature */
+static const StrScreen_text_t g_heating_texts_arr[] = {
+    {15 , 2 , "c"} , {9 , 3 , " P:"} , {0 , 4 , "#:Pause ##:Stop"}
+};
+static const StrScreen_field_t g_heating_fields_arr[] = {
+    {FIELD_STAGE , 13 , 1 , 3 , Format_stage} , {FIELD_TEMPERATURE , 13 , 2 , 2 , Format_temperature} ,
+    {FIELD_POWER , 12 , 3 , 4 , Format_power}
+};
+static const StrScreen_t g_heating_screen = {g_heating_texts_arr , 3 , g_heating_fields_arr , 3 , Draw_remaining_time};
+
+/* paused heating process: big time and states of the sensors */
+static const StrScreen_text_t g_paused_texts_arr[] = {
+    {15 , 2 , "c"} , {0 , 3 , "Door_St:"} , {0 , 4 , "Inside_St:"}
+};
+static const StrScreen_field_t g_paused_fields_arr[] = {
+    {FIELD_STAGE , 13 , 1 , 3 , Format_stage} , {FIELD_TEMPERATURE , 13 , 2 , 2 , Format_temperature} ,
+    {FIELD_DOOR , 10 , 3 , 6 , Format_door} , {FIELD_INSIDE , 10 , 4 , 6 , Format_inside}
+};
+static const StrScreen_t g_paused_screen = {g_paused_texts_arr , 3 , g_paused_fields_arr , 4 , Draw_remaining_time};
+
+/* finished heating process, it blinks with the alarm */
+static const StrScreen_text_t g_finished_texts_arr[] = {
+    {0 , 1 , "Timer:"} , {11 , 1 , "00:00"} , {0 , 2 , "Heating finished"} , {0 , 3 , "PRESS '#' to"} , {5 , 4 , "return home"}
+};
+static const StrScreen_t g_finished_screen = {g_finished_texts_arr , 5 , NULL_PTR , 0 , NULL_PTR};
 
 /*******************************************************************************
  *                          Functions Definitions                              *
@@ -69,7 +371,8 @@ static uint8 g_u8old_temp_reading = 100;
  * Function Name:	Display_remind_time
  *
  * Description: 	when heating process occur the reminding time for this
- *                  process displays on LCD by this function.
+ *                  process displays on LCD by this function as big digits
+ *                  with progress bar of the process.
  *
  * Inputs:			NULL
  *
@@ -83,13 +386,35 @@ void Display_remind_time (void)
     if(g_u8heating_finished_flag == 1)
     {
         g_u8heating_finished_flag = 0;
-        /* go to specific position on LCD to display the reminding time*/
-        LCD_SetDisplayPosition(11,1);
-        LCD_SendDataByte((g_u16MicrowaveTime / 600) + ASCII_ZERO_NUMBER);       /* Display second digits of minutes */
-        LCD_SendDataByte(((g_u16MicrowaveTime / 60) % 10) + ASCII_ZERO_NUMBER); /* Display first digits of minutes */
-        LCD_SendDataByte(':');
-        LCD_SendDataByte(((g_u16MicrowaveTime % 60) / 10) + ASCII_ZERO_NUMBER); /* Display second digits of seconds */
-        LCD_SendDataByte(((g_u16MicrowaveTime % 60) % 10) + ASCII_ZERO_NUMBER); /* Display first digits of seconds */
+        /* only the changed digits and bar cells are written */
+        Render_big_time(g_u16MicrowaveTime);
+        Render_progress_bar(g_u16last_cook_time - g_u16MicrowaveTime , g_u16last_cook_time);
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Heating_stage_update_function
+ *
+ * Description: 	when the sequence engine moves to the next stage of the
+ *                  heating process, this function applies heater power and
+ *                  fan duty of the new stage and displays it on LCD.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Heating_stage_update_function(void)
+{
+    /* check if new stage started by timer interrupt */
+    if(Sequence_stage_changed() == TRUE)
+    {
+        Apply_stage_outputs();
+    }
+    else
+    {
+        /* Do nothing */
     }
 }
 
@@ -112,10 +437,103 @@ void TIMER0_ISR(void)
     Timer0_write_counter(3037);
     /* decrement timer counter */
     g_u16MicrowaveTime--;
+    /* count down the running stage and move to next stage when it finishes */
+    Sequence_tick();
     /* set flag to refer one second passed */
     g_u8heating_finished_flag = 1;
 }
 
+/*******************************************************************************
+ * Function Name:	TIMER1_ISR
+ *
+ * Description: 	the function that send as call_back function to Timer1 interrupt
+ *                  to make system tick every 10ms which drives heater power.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void TIMER1_ISR(void)
+{
+    /* calculated number to get overflow interrupt every 10ms */
+    Timer1_write_counter(TIMER1_TICK_PRELOAD);
+    /* switch heater on or off depend on its power */
+    Heater_tick();
+    g_u16system_ticks++;
+    /* accept levels of door and weight buttons after debouncing */
+    Buttons_tick(g_u16system_ticks);
+    /* play the next note of the buzzer melody */
+    Buzzer_tick();
+}
+
+/*******************************************************************************
+ * Function Name:	Keypad_scan_function
+ *
+ * Description: 	scan the keypad once every system tick, the scan is done in
+ *                  the main loop not in Timer1 interrupt because rows of the
+ *                  keypad are on LCD data port.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Keypad_scan_function(void)
+{
+    uint16 u16ticks = System_get_ticks();
+    if(u16ticks != g_u16keypad_scan_tick)
+    {
+        g_u16keypad_scan_tick = u16ticks;
+        KeyPad_scan(u16ticks);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Sensors_events_function
+ *
+ * Description: 	read events of door and weight buttons, every press toggles
+ *                  state of its sensor when the system state allows it, the
+ *                  other events are dropped.
+ *                  note: the door is watched in idle and finishing states and
+ *                        the weight in idle state only.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sensors_events_function(void)
+{
+    StrButtons_event_t event;
+    while(Buttons_getEvent(&event) == TRUE)
+    {
+        if(event.event_t != BUTTONS_EVENT_PRESS)
+        {
+            /* Do nothing */
+        }
+        else if(event.u8pin == DOOR_SENSOR_PIN && g_system_state_var_t != SYSTEM_HEATING_STATE)
+        {
+            Door_sensor_function();
+        }
+        else if(event.u8pin == WEIGHT_SENSOR_PIN && g_system_state_var_t == SYSTEM_IDLE_STATE)
+        {
+            Weight_sensor_function();
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+}
+
 /*******************************************************************************
  * Function Name:	Set_and_Display_desired_temp
  *
@@ -133,21 +551,22 @@ void TIMER0_ISR(void)
  *******************************************************************************/
 void Set_and_Display_desired_temp(void)
 {
+    /* temperature which is selected by potentiometer device */
+    uint8 u8pot_reading = 0;
     /* start ADC sampling to get user selected temperature from potentiometer device */
     ADC_Start_conversion();
-    /* difference between max. and min. temperature can we get by our microwave is 50 degree*/
-    g_u8temperature = ADC_Read_value() * MAX_DEF_TEMPERATURE / 1023;
-    /* check if user inserted new value for the temperature to change duty cycle and LCD screen*/
-    if(g_u8old_temp_reading != g_u8temperature)
+    /* difference between max. and min. temperature can we get by our microwave is 50 degree,
+     * the reading is mapped by the learned range of the potentiometer */
+    u8pot_reading = Pot_get_setpoint(ADC_Read_value());
+    /* check if user inserted new value for the temperature to change duty cycle and LCD screen,
+     * the selected temperature of preset program is kept until the user moves the potentiometer */
+    if(g_u8old_temp_reading != u8pot_reading)
     {
-        /* update duty cycle for fan to get specified temperature */
-        PWM_DutyCycle(PWM_CHANNEL_1 , 100 - g_u8temperature * 2);
-        /* Display the new temperature on the screen */
-        LCD_SetDisplayPosition(13,2);
-        /* when user insert zero it mean 27c */
-        LCD_DisplaNumber(g_u8temperature + MIN_TEMPERATURE);
+        g_u8temperature = u8pot_reading;
+        /* update duty cycle of fan and display the new temperature */
+        Apply_temperature();
         /* update the old value to another check next time this function will be called */
-        g_u8old_temp_reading = g_u8temperature;
+        g_u8old_temp_reading = u8pot_reading;
     }
     else
     {
@@ -158,7 +577,7 @@ void Set_and_Display_desired_temp(void)
 /*******************************************************************************
  * Function Name:	Door_sensor_function
  *
- * Description: 	read door sensor which connected with micro_controller pin and
+ * Description: 	toggle state of the door when its button is pressed and
  *                  display state of the door on the screen when the heating process 
  *                  doesn't occur
  *                  note: during the heating process the door must be closed and we
@@ -173,35 +592,25 @@ void Set_and_Display_desired_temp(void)
  *******************************************************************************/
 void Door_sensor_function(void)
 {
-    /* check if sensor change its state (if push button toggle) */
-    if(GPIO_ReadFromPin(GPIO_PORTB , GPIO_PIN4) == LOW)
-    {
-        /* to avoid de_bouncing problem */
-        __delay_ms(10);
-        /* to not get more than one signal because the the user presses to long time */
-        while(GPIO_ReadFromPin(GPIO_PORTB , GPIO_PIN4) == LOW);
-        /* change the state of door and show this state on LCD */
-        if(g_door_state_t == DOOR_IS_CLOSED)
-        {
-            g_door_state_t = DOOR_IS_OPENED;
-            LCD_SetDisplayPosition(10,3);
-            LCD_SendDataString("Opened");
-        }
-        else
-        {
-            g_door_state_t = DOOR_IS_CLOSED;
-            LCD_SetDisplayPosition(10,3);
-            LCD_SendDataString("Closed");
-        }
+    /* change the state of door and show this state on LCD */
+    if(g_door_state_t == DOOR_IS_CLOSED)
+    {
+        g_door_state_t = DOOR_IS_OPENED;
     }
+    else
+    {
+        g_door_state_t = DOOR_IS_CLOSED;
+    }
+    /* the state is displayed only if the shown screen has it */
+    Screen_update(FIELD_DOOR);
 }
 
 /*******************************************************************************
  * Function Name:	Weight_sensor_function
  *
- * Description: 	read weight sensor which connected with micro_controller pin and
- *                  display state of the inside microwave status on the screen when 
- *                  the heating process doesn't occur.
+ * Description: 	toggle state of the inside microwave when its button is pressed
+ *                  and display state of the inside microwave status on the screen
+ *                  when the heating process doesn't occur.
  *                  note: we can't put or remove anything inside microwave when reading
  *                        of door sensor say the door is closed.
  *                  note: in this application, the push button work as weight sensor.
@@ -214,26 +623,19 @@ void Door_sensor_function(void)
  *******************************************************************************/
 void Weight_sensor_function(void)
 {
-    /* check if sensor change its state (if push button toggle) when the door is opened */
-    if(g_door_state_t == DOOR_IS_OPENED && GPIO_ReadFromPin(GPIO_PORTB , GPIO_PIN5) == LOW)
-    {
-        /* to avoid de_bouncing problem */
-        __delay_ms(10);
-        /* to not get more than one signal because the the user presses to long time */
-        while(GPIO_ReadFromPin(GPIO_PORTB , GPIO_PIN5) == LOW);
-        /* change the state of inside microwave when the door is opened and show this state on LCD */
+    /* change the state of inside microwave when the door is opened and show this state on LCD */
+    if(g_door_state_t == DOOR_IS_OPENED)
+    {
         if(g_inside_microwave == MICROWAVE_IS_EMPTY)
         {
             g_inside_microwave = MICROWAVE_HAS_SOMETHING_INSIDE;
-            LCD_SetDisplayPosition(10 , 4);
-            LCD_SendDataString("  Food");
         }
         else
         {
             g_inside_microwave = MICROWAVE_IS_EMPTY;
-            LCD_SetDisplayPosition(10 , 4);
-            LCD_SendDataString("N_Food");
         }
+        /* the state is displayed only if the shown screen has it */
+        Screen_update(FIELD_INSIDE);
     }
     else
     {
@@ -248,6 +650,10 @@ void Weight_sensor_function(void)
  *                  clear the wrong insertion and finally start the heating process
  *                  by KeyPad module and when the user write the time, the time displays
  *                  immediately on the LCD.
+ *                  note: pressing '*' before inserting any time opens preset programs
+ *                        menu to load preset program by its number, to save the
+ *                        last heating process as user preset or to reset the
+ *                        learned range of the potentiometer by '0'.
  *
  * Inputs:			NULL
  *
@@ -257,12 +663,15 @@ void Weight_sensor_function(void)
  *******************************************************************************/
 void User_insert_time_and_start_heating_function(void)
 {
-    /* initialize KeyPad every function calling because when ADC module corrupt Direction of pins*/
-    KeyPad_Initialization();
     /* get pressed key value */
     g_u8keypad_button_val = KeyPad_getPressedKey();
+    /* check if preset programs menu is opened to handle the pressed key by it */
+    if(g_preset_menu_t != PRESET_MENU_CLOSED)
+    {
+        Preset_menu_function(g_u8keypad_button_val);
+    }
     /* check if key is pressed and the key value is number from 0 to 9 to set timer */
-    if(g_u8keypad_button_val >= 0 && g_u8keypad_button_val < 10)
+    else if(g_u8keypad_button_val >= 0 && g_u8keypad_button_val < 10)
     {
         /* check this value for which digit in the timer value */
         switch(g_u8time_digits)
@@ -273,8 +682,7 @@ void User_insert_time_and_start_heating_function(void)
                 /* increment the number of digits in inserted number */
                 g_u8time_digits++;
                 /* Display the inserted number on LCD */
-                LCD_SetDisplayPosition(11,1);
-                LCD_SendDataString(g_u8timer_arr);
+                Screen_update(FIELD_TIME);
                 /* update timer counter with inserted key value */
                 g_u16MicrowaveTime = g_u8keypad_button_val;
                 break;
@@ -286,9 +694,7 @@ void User_insert_time_and_start_heating_function(void)
                 /* increment the number of digits in inserted number */
                 g_u8time_digits++;
                 /* Display the inserted number on LCD */
-                LCD_SetDisplayPosition(13,1);
-                LCD_SendDataByte(g_u8timer_arr[3]);
-                LCD_SendDataByte(g_u8timer_arr[4]);
+                Screen_update(FIELD_TIME);
                 /* update timer counter with inserted key value */
                 g_u16MicrowaveTime = g_u16MicrowaveTime * 10 + g_u8keypad_button_val;
                 break;
@@ -302,8 +708,7 @@ void User_insert_time_and_start_heating_function(void)
                 /* increment the number of digits in inserted number */
                 g_u8time_digits++;
                 /* Display the inserted number on LCD */
-                LCD_SetDisplayPosition(11,1);
-                LCD_SendDataString(g_u8timer_arr);
+                Screen_update(FIELD_TIME);
                 /* update timer counter with inserted key value */
                 g_u16MicrowaveTime = (g_u8timer_arr[1] - ASCII_ZERO_NUMBER) * 60 +
                         (g_u8timer_arr[3] - ASCII_ZERO_NUMBER) * 10 + g_u8keypad_button_val;
@@ -323,8 +728,7 @@ void User_insert_time_and_start_heating_function(void)
                     /* increment the number of digits to prevent any other number insertion */
                     g_u8time_digits++;
                     /* Display the inserted number on LCD */
-                    LCD_SetDisplayPosition(11,1);
-                    LCD_SendDataString(g_u8timer_arr);
+                    Screen_update(FIELD_TIME);
                     /* update timer counter with inserted key value */
                     g_u16MicrowaveTime = (g_u8timer_arr[0] - ASCII_ZERO_NUMBER) * 600 +
                             (g_u8timer_arr[1] - ASCII_ZERO_NUMBER) * 60 +
@@ -349,40 +753,49 @@ void User_insert_time_and_start_heating_function(void)
         {
             /* update digits of timer to prevent any modify in timer when the heating is paused */
             g_u8time_digits = 4;
+            /* save the new heating process values to allow the user saving it as user preset
+             * and start its stages from the first one */
+            if(g_u8heating_paused_flag == FALSE)
+            {
+                g_u16last_cook_time = g_u16MicrowaveTime;
+                g_u8last_cook_temperature = g_u8temperature;
+                /* inserted time is one stage at full power if preset program isn't loaded */
+                if(g_u8sequence_loaded_flag == FALSE)
+                {
+                    Sequence_load_single_stage(g_u16MicrowaveTime);
+                }
+                else
+                {
+                    g_u8sequence_loaded_flag = FALSE;
+                }
+                Sequence_start();
+            }
+            else
+            {
+                g_u8heating_paused_flag = FALSE;
+            }
             /* convert system state to the heating process and start count down the inserted timer */
             g_system_state_var_t = SYSTEM_HEATING_STATE;
-            /* Display the reminding time */ 
-            LCD_ClearScreen();
-            LCD_SendDataString("Timer:");
-            LCD_SetDisplayPosition(11,1);
-            LCD_SendDataByte((g_u16MicrowaveTime / 600) + ASCII_ZERO_NUMBER);       /* Display second digits of minutes */
-            LCD_SendDataByte(((g_u16MicrowaveTime / 60) % 10) + ASCII_ZERO_NUMBER); /* Display first digits of minutes */
-            LCD_SendDataByte(':');
-            LCD_SendDataByte(((g_u16MicrowaveTime % 60) / 10) + ASCII_ZERO_NUMBER); /* Display second digits of seconds */
-            LCD_SendDataByte(((g_u16MicrowaveTime % 60) % 10) + ASCII_ZERO_NUMBER); /* Display first digits of seconds */
-            /* Display current selected temperature*/
-            LCD_SetDisplayPosition(0 , 2);
-            LCD_SendDataString("Temperature:");
-            LCD_SetDisplayPosition(13,2);
-            LCD_DisplaNumber(g_u8temperature + MIN_TEMPERATURE);
-            LCD_SetDisplayPosition(15,2);
-            LCD_SendDataByte('c');
-            LCD_SetDisplayPosition(0,3);
-            /* Display State of system and options for the user in this state */
-            LCD_SendDataString("Heating Process ");
-            LCD_SendDataString("#:Pause ##:Stop");
+            /* Display the reminding time as big digits, the progress of the process,
+             * the running stage, the temperature and options for the user in this state */
+            Screen_show(&g_heating_screen);
             /* start PWM to turn on the fan to get selected temperature*/
             PWM_Start(PWM_CHANNEL_1);
-            /* turn on the heater */
-            GPIO_WriteOnPin(HEATER_PORT , HEATER_PIN , HIGH);
+            /* turn on the heater and the fan by the running stage and display it */
+            Apply_stage_outputs();
             /* turn on the LED */
             GPIO_WriteOnPin(LED_PORT , LED_PIN , HIGH);
-            /* enable timer 0, global interrupt and timer 0 interrupt to make timer 
-             * count down every one second */
-            Global_interrupt_enable();
+            /* enable timer 0 and its interrupt to make timer count down every
+             * one second, the interrupts are enabled once in main */
             Timer0_enable_overflow_interrupt();
             Timer0_enable();
         }
+        /* open preset programs menu when the user didn't insert any time */
+        else if(g_u8time_digits == 0)
+        {
+            g_preset_menu_t = PRESET_MENU_SELECT;
+            Screen_show(&g_preset_select_screen);
+        }
         else
         {
             /* Do nothing */
@@ -394,8 +807,6 @@ void User_insert_time_and_start_heating_function(void)
         /* change the old value of temp when user cancel the heating without change temperature
          to make the user see the current selected temperature */
         g_u8old_temp_reading = 100;
-        /* return to home screen to reenter the time again */
-        Home_screen_display();
         /* return the timer array elements to zero to reset them again */
         g_u8timer_arr[0] = ASCII_ZERO_NUMBER;
         g_u8timer_arr[1] = ASCII_ZERO_NUMBER;
@@ -405,6 +816,11 @@ void User_insert_time_and_start_heating_function(void)
         g_u8time_digits = 0;
         /* return timer zero counter to zero */
         g_u16MicrowaveTime = 0;
+        /* the paused heating process or the loaded preset program is canceled */
+        g_u8heating_paused_flag = FALSE;
+        g_u8sequence_loaded_flag = FALSE;
+        /* return to home screen to reenter the time again */
+        Home_screen_display();
     }
 }
 
@@ -431,9 +847,6 @@ void User_insert_time_and_start_heating_function(void)
  *******************************************************************************/
 void If_heating_is_canceled_function(void)
 {
-    /* initialize KeyPad every function calling because 
-     * when ADC module corrupt Direction of pins*/
-    KeyPad_Initialization();
     /* get pressed key value */
     g_u8keypad_button_val = KeyPad_getPressedKey();
     /* check if the user pressed on pause_cancel key*/
@@ -442,31 +855,47 @@ void If_heating_is_canceled_function(void)
         /* return system to Idle state as a pause condition without ability to modify timer time
          * before cancel the previous process by pressing on '#' again */
         g_system_state_var_t = SYSTEM_IDLE_STATE;
-        /* turn of the heater */
-        GPIO_WriteOnPin(HEATER_PORT , HEATER_PIN , LOW);
-        /* turn off the LED */
-        GPIO_WriteOnPin(LED_PORT , LED_PIN , LOW);
-        /* disable timer 0, global interrupt and timer 0 interrupt */
-        Global_interrupt_disable();
-        Timer0_disable_overflow_interrupt();
-        Timer0_disable();
-        /* Stop PWM to stop the fan */
-        PWM_Stop(PWM_CHANNEL_1);
-        /* Display Door and weight sensors states */
-        LCD_SetDisplayPosition(0,3);
-        LCD_SendDataString("Door_St:  Closed");
-        LCD_SetDisplayPosition(0,4);
-        LCD_SendDataString("Inside_St:  Food");
+        /* the heating process can continue by '*' as the same process */
+        g_u8heating_paused_flag = TRUE;
+        /* turn off the heater, the LED and the fan */
+        Stop_heating_devices();
+        /* Display Door and weight sensors states under the reminding time */
+        Screen_show(&g_paused_screen);
     }
 }
 
+/*******************************************************************************
+ * Function Name:	Heating_finished_function
+ *
+ * Description: 	this function occurs once when the reminding time of the
+ *                  heating process equal to zero, it moves the system to the
+ *                  end state, closes the heater and the fan and the LED and
+ *                  starts the alarm melody of the Buzzer.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Heating_finished_function(void)
+{
+    g_system_state_var_t = SYSTEM_END_TIME;
+    /* turn off the heater, the LED and the fan */
+    Stop_heating_devices();
+    /* the alarm is repeated till the user returns to idle state */
+    Buzzer_play(&g_finish_alarm);
+    Render_stop();
+    Screen_clear();
+}
+
 /*******************************************************************************
  * Function Name:	Heating_process_has_done_function
  *
  * Description: 	this function occurs when the heating process finished and
  *                  the reminding time equal to zero.
- *                  this function close the heater and the fan and the LED and 
- *                  invokes the Buzzer to alarm the user.
+ *                  this function blinks the finishing message while the Buzzer
+ *                  alarms the user.
  *                  note: the user should presses on # or open the door to return 
  *                        to idle state and exit from the heating finished state. 
  *
@@ -478,54 +907,33 @@ void If_heating_is_canceled_function(void)
  *******************************************************************************/
 void Heating_process_has_done_function(void)
 {
-    /* counter to blank LCD and Buzzer */
-    static uint16 u8counter = 0;
-    /* turn on the Buzzer */
-    GPIO_WriteOnPin(BUZZER_PORT, BUZZER_PIN , LOW);
-    /* turn off the heater */
-    GPIO_WriteOnPin(HEATER_PORT , HEATER_PIN , LOW);
-    /* turn off the LED */
-    GPIO_WriteOnPin(LED_PORT , LED_PIN , LOW);
-    /* Stop PWM to stop the fan */
-    PWM_Stop(PWM_CHANNEL_1);
-    /* disable timer 0, global interrupt and timer 0 interrupt */
-    Global_interrupt_disable();
-    Timer0_disable_overflow_interrupt();
-    Timer0_disable();
-    /* Blank the finishing process message on LCD and the buzzer alarm */
-    if(u8counter == 0)
+    /* state of the finishing message, 0 for displaying it then 1 while it's
+     * displayed and 2 while it's blanked */
+    static uint8 u8message_state = 0;
+    /* tick of the last change of the message state */
+    static uint16 u16message_tick = 0;
+    /* ticks since the last change of the message state */
+    uint16 u16elapsed_ticks = System_get_ticks() - u16message_tick;
+    /* Blank the finishing process message on LCD, the alarm is played by buzzer driver */
+    if(u8message_state == 0)
     {
-        LCD_SetDisplayPosition(0 , 1);
-        LCD_SendDataString("Timer:");
-        LCD_SetDisplayPosition(11 , 1);
-        LCD_SendDataString("00:00");
-        LCD_SendDataString("Heating finished");
-        LCD_SetDisplayPosition(0 , 3);
-        LCD_SendDataString("PRESS '#' to");
-        LCD_SetDisplayPosition(5 , 4);
-        LCD_SendDataString("return home");
-        LCD_SetDisplayPosition(11 , 1);
-        LCD_SendDataString("00:00");
-        u8counter++;
+        Screen_show(&g_finished_screen);
+        u16message_tick += u16elapsed_ticks;
+        u8message_state = 1;
     }
-    else if(u8counter < 250)
+    else if(u8message_state == 1 && u16elapsed_ticks >= FINISH_MESSAGE_TICKS)
     {
-        u8counter++;
-        GPIO_WriteOnPin(BUZZER_PORT , BUZZER_PIN , LOW);
+        Screen_clear();
+        u16message_tick += u16elapsed_ticks;
+        u8message_state = 2;
     }
-    else if(u8counter == 250)
+    else if(u8message_state == 2 && u16elapsed_ticks >= FINISH_MESSAGE_TICKS)
     {
-        LCD_ClearScreen();
-        u8counter++;
-    }
-    else if(u8counter < 500)
-    {
-        u8counter++;
-        GPIO_WriteOnPin(BUZZER_PORT , BUZZER_PIN , HIGH);
+        u8message_state = 0;
     }
     else
     {
-        u8counter = 0;
+        /* Do nothing */
     }
 }
 
@@ -543,24 +951,16 @@ void Heating_process_has_done_function(void)
  *******************************************************************************/
 void Reset_to_idle_state(void)
 {
-    /* check if Door is opened, 
-     * that refer to the user knew the selected time of the heating finished */
-    Door_sensor_function();
-    /* initialize KeyPad every function calling because 
-     * when ADC module corrupt Direction of pins*/
-    KeyPad_Initialization();
     /* if the user pressed on '#' or the door is opened after finishing heating
      * the buzzer alarm will stop and system return to idle state to get new operation */
     if(KeyPad_getPressedKey() == '#' || g_door_state_t == DOOR_IS_OPENED)
     {
         g_system_state_var_t = SYSTEM_IDLE_STATE;
-        /* turn off the Buzzer */
-        GPIO_WriteOnPin(BUZZER_PORT , BUZZER_PIN , HIGH);
-        LCD_ClearScreen();
+        /* turn off the Buzzer and the LED */
+        Buzzer_stop();
+        GPIO_WriteOnGroup(&g_indicators_group , LOW);
         /* change the old value of temp to make the user see the current selected temperature */
         g_u8old_temp_reading = 100;
-        /* return to home screen to start new heating process */
-        Home_screen_display();
         /* return the timer array elements to zero to reset them again */
         g_u8timer_arr[0] = ASCII_ZERO_NUMBER;
         g_u8timer_arr[1] = ASCII_ZERO_NUMBER;
@@ -568,9 +968,228 @@ void Reset_to_idle_state(void)
         g_u8timer_arr[4] = ASCII_ZERO_NUMBER;
         /* to allow the user accessing on timer setting */
         g_u8time_digits = 0;
+        /* return to home screen to start new heating process */
+        Home_screen_display();
     } 
 }
 
+/*******************************************************************************
+ * Function Name:	Apply_temperature
+ *
+ * Description: 	update fan duty cycle depend on the selected temperature
+ *                  and display this temperature on LCD.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Apply_temperature(void)
+{
+    /* update duty cycle for fan to get specified temperature */
+    Apply_fan_duty();
+    /* Display the new temperature on the screen */
+    Screen_update(FIELD_TEMPERATURE);
+}
+
+/*******************************************************************************
+ * Function Name:	Apply_fan_duty
+ *
+ * Description: 	update fan duty cycle by the fan duty of the running stage
+ *                  or by the selected temperature if the stage doesn't fix it.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Apply_fan_duty(void)
+{
+    /* number of running stage and number of all stages */
+    uint8 u8stage_index = 0;
+    uint8 u8stages_number = 0;
+    /* the running stage of the heating process */
+    const StrSequence_stage_t * stage_ptr = Sequence_get_current_stage(&u8stage_index , &u8stages_number);
+    /* check if the running stage has fixed fan duty */
+    if(g_system_state_var_t == SYSTEM_HEATING_STATE && stage_ptr->u8fan_duty != SEQUENCE_FAN_FROM_TEMPERATURE)
+    {
+        PWM_DutyCycle(PWM_CHANNEL_1 , stage_ptr->u8fan_duty);
+    }
+    else
+    {
+        /* update duty cycle for fan to get specified temperature */
+        PWM_DutyCycle(PWM_CHANNEL_1 , 100 - g_u8temperature * 2);
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Apply_stage_outputs
+ *
+ * Description: 	apply heater power and fan duty of the running stage and
+ *                  display the stage number and its power on LCD.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Apply_stage_outputs(void)
+{
+    /* number of running stage and number of all stages */
+    uint8 u8stage_index = 0;
+    uint8 u8stages_number = 0;
+    /* the running stage of the heating process */
+    const StrSequence_stage_t * stage_ptr = Sequence_get_current_stage(&u8stage_index , &u8stages_number);
+    /* apply the stage power as on time of heater window */
+    Heater_set_power(stage_ptr->u8heater_power);
+    /* update fan duty cycle */
+    Apply_fan_duty();
+    /* Display the running stage and its power */
+    Screen_update(FIELD_STAGE);
+    Screen_update(FIELD_POWER);
+}
+
+/*******************************************************************************
+ * Function Name:	Preset_menu_function
+ *
+ * Description: 	handle pressed key when preset programs menu is opened to
+ *                  load preset program, save the last heating process as
+ *                  user preset or reset the range of the potentiometer.
+ *
+ * Inputs:			a_u8key           (uint8) value of pressed key
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Preset_menu_function(uint8 a_u8key)
+{
+    /* preset program which is loaded from flash table or EEPROM */
+    StrPreset_t preset_program;
+    /* counter to display preset name */
+    uint8 u8counter = 0;
+    /* check if the user wants to close the menu without any change */
+    if(a_u8key == '*')
+    {
+        g_preset_menu_t = PRESET_MENU_CLOSED;
+        /* make the user see the current selected temperature */
+        g_u8old_temp_reading = 100;
+        Home_screen_display();
+    }
+    /* check if the user is selecting preset program */
+    else if(g_preset_menu_t == PRESET_MENU_SELECT)
+    {
+        /* '#' moves the menu to save the last heating process */
+        if(a_u8key == '#')
+        {
+            g_preset_menu_t = PRESET_MENU_SAVE;
+            Screen_show(&g_preset_save_screen);
+        }
+        /* '0' returns the potentiometer to its default range when the learned
+         * range is wrong */
+        else if(a_u8key == 0)
+        {
+            Pot_reset_range();
+            g_preset_menu_t = PRESET_MENU_CLOSED;
+            g_u8old_temp_reading = 100;
+            Home_screen_display();
+        }
+        /* load the preset program of the pressed number directly to timer and temperature */
+        else if(a_u8key < 10 && Preset_load(a_u8key , &preset_program) == TRUE)
+        {
+            g_preset_menu_t = PRESET_MENU_CLOSED;
+            /* the heating time is the total time of the program stages */
+            g_u16MicrowaveTime = Sequence_load(preset_program.stages_ptr , preset_program.u8stages_number);
+            g_u8sequence_loaded_flag = TRUE;
+            g_u8timer_arr[0] = (g_u16MicrowaveTime / 600) + ASCII_ZERO_NUMBER;
+            g_u8timer_arr[1] = ((g_u16MicrowaveTime / 60) % 10) + ASCII_ZERO_NUMBER;
+            g_u8timer_arr[3] = ((g_u16MicrowaveTime % 60) / 10) + ASCII_ZERO_NUMBER;
+            g_u8timer_arr[4] = ((g_u16MicrowaveTime % 60) % 10) + ASCII_ZERO_NUMBER;
+            /* prevent any modify in the loaded time, '#' clears it */
+            g_u8time_digits = 4;
+            g_u8temperature = preset_program.u8temperature;
+            for(u8counter = 0 ; u8counter < PRESET_NAME_SIZE ; u8counter++)
+            {
+                g_u8preset_name_arr[u8counter] = preset_program.u8name[u8counter];
+            }
+            /* Display the loaded preset program with its name instead of "Time:" */
+            Home_screen_display();
+            Apply_temperature();
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    /* save the last heating process in user preset of the pressed number */
+    else
+    {
+        if(a_u8key < 10 && g_u16last_cook_time != 0 &&
+                Preset_save_user(a_u8key , g_u16last_cook_time , g_u8last_cook_temperature) == TRUE)
+        {
+            g_preset_menu_t = PRESET_MENU_CLOSED;
+            g_u8old_temp_reading = 100;
+            Home_screen_display();
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	System_get_ticks
+ *
+ * Description: 	read system ticks of Timer1 (10ms), 16 bits variable is read
+ *                  by two instructions so it's read again until getting the
+ *                  same value without interrupt between them.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			system ticks (uint16)
+ *******************************************************************************/
+static uint16 System_get_ticks(void)
+{
+    uint16 u16ticks = g_u16system_ticks;
+    while(u16ticks != g_u16system_ticks)
+    {
+        u16ticks = g_u16system_ticks;
+    }
+    return u16ticks;
+}
+
+/*******************************************************************************
+ * Function Name:	Stop_heating_devices
+ *
+ * Description: 	turn off the heater, the LED and the fan and stop timer 0
+ *                  of the heating time.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Stop_heating_devices(void)
+{
+    /* turn off the heater now, stopping the process doesn't wait its min. on time */
+    Heater_trip();
+    /* turn off the LED */
+    GPIO_WriteOnPin(LED_PORT , LED_PIN , LOW);
+    /* disable timer 0 and timer 0 interrupt, global interrupt still enabled
+     * for heater timer */
+    Timer0_disable_overflow_interrupt();
+    Timer0_disable();
+    /* Stop PWM to stop the fan */
+    PWM_Stop(PWM_CHANNEL_1);
+}
+
 /*******************************************************************************
  * Function Name:	Welcome_screen_display
  *
@@ -585,14 +1204,7 @@ void Reset_to_idle_state(void)
 void Welcome_screen_display(void)
 {
     /* Display Welcome Screen on LCD when the microwave starts */
-    LCD_SetDisplayPosition(3,1);
-    LCD_SendDataString("Welcome to");
-    LCD_SetDisplayPosition(0,2);
-    LCD_SendDataString("----------------");
-    LCD_SetDisplayPosition(0,3);
-    LCD_SendDataString("SWIFT ACT");
-    LCD_SetDisplayPosition(7,4);
-    LCD_SendDataString("MicroWave");
+    Screen_show(&g_welcome_screen);
     __delay_ms(2000);
 }
 
@@ -610,34 +1222,204 @@ void Welcome_screen_display(void)
  *******************************************************************************/
 void Home_screen_display(void)
 {
-    /* Display home Screen on LCD after welcome message screen or at idle state of the system */
-    LCD_ClearScreen();
-    LCD_SendDataString("Time:");
-    LCD_SetDisplayPosition(11,1);
-    LCD_SendDataString("__:__");
-    LCD_SetDisplayPosition(0,2);
-    LCD_SendDataString("Temperature:");
-    LCD_SetDisplayPosition(15,2);
-    LCD_SendDataByte('c');
-    /* display state of door sensor at start or when the heating is paused */
-    LCD_SetDisplayPosition(0,3);
-    if(g_door_state_t == DOOR_IS_CLOSED)
+    /* Display home Screen on LCD after welcome message screen or at idle state of the system,
+     * the big digits of the heating screen aren't displayed anymore */
+    Render_stop();
+    Screen_show(&g_home_screen);
+}
+
+
+/*******************************************************************************
+ * Function Name:	Format_name
+ *
+ * Description: 	name of the loaded preset program or "Time:" label, 10 characters.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u8text_ptr      (uint8*) characters of the field
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Format_name(uint8 * a_u8text_ptr)
+{
+    /* label of the time which is padded by spaces */
+    const uint8 * name_ptr = (const uint8 *)"Time:";
+    uint8 u8counter = 0;
+    if(g_u8sequence_loaded_flag == TRUE)
     {
-        LCD_SendDataString("Door_St:  Closed");
+        name_ptr = g_u8preset_name_arr;
     }
     else
     {
-        LCD_SendDataString("Door_St:  Opened");
+        /* Do nothing */
     }
-    /* display state of weight sensor at start or when the heating is paused */
-    LCD_SetDisplayPosition(0,4);
-    if(g_inside_microwave == MICROWAVE_IS_EMPTY)
+    for(u8counter = 0 ; u8counter < 10 ; u8counter++)
     {
-        LCD_SendDataString("Inside_St:N_Food");
+        if(*name_ptr != '\0')
+        {
+            a_u8text_ptr[u8counter] = *name_ptr;
+            name_ptr++;
+        }
+        else
+        {
+            a_u8text_ptr[u8counter] = ' ';
+        }
     }
-    else
+}
+
+/*******************************************************************************
+ * Function Name:	Format_time
+ *
+ * Description: 	inserted time "mm:ss" or "__:__" before inserting any digit.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u8text_ptr      (uint8*) characters of the field
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Format_time(uint8 * a_u8text_ptr)
+{
+    uint8 u8counter = 0;
+    for(u8counter = 0 ; u8counter < 5 ; u8counter++)
     {
-        LCD_SendDataString("Inside_St:  Food");
+        if(g_u8time_digits == 0)
+        {
+            a_u8text_ptr[u8counter] = (u8counter == 2) ? ':' : '_';
+        }
+        else
+        {
+            a_u8text_ptr[u8counter] = g_u8timer_arr[u8counter];
+        }
     }
 }
 
+/*******************************************************************************
+ * Function Name:	Format_temperature
+ *
+ * Description: 	selected temperature in celsius, 2 characters.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u8text_ptr      (uint8*) characters of the field
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Format_temperature(uint8 * a_u8text_ptr)
+{
+    /* when user insert zero it mean 27c */
+    uint8 u8temperature = g_u8temperature + MIN_TEMPERATURE;
+    a_u8text_ptr[0] = (u8temperature / 10) + ASCII_ZERO_NUMBER;
+    a_u8text_ptr[1] = (u8temperature % 10) + ASCII_ZERO_NUMBER;
+}
+
+/*******************************************************************************
+ * Function Name:	Format_door
+ *
+ * Description: 	state of the door sensor, 6 characters.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u8text_ptr      (uint8*) characters of the field
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Format_door(uint8 * a_u8text_ptr)
+{
+    const uint8 * state_ptr = (const uint8 *)((g_door_state_t == DOOR_IS_OPENED) ? "Opened" : "Closed");
+    uint8 u8counter = 0;
+    for(u8counter = 0 ; u8counter < 6 ; u8counter++)
+    {
+        a_u8text_ptr[u8counter] = state_ptr[u8counter];
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Format_inside
+ *
+ * Description: 	state of the weight sensor, 6 characters.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u8text_ptr      (uint8*) characters of the field
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Format_inside(uint8 * a_u8text_ptr)
+{
+    const uint8 * state_ptr = (const uint8 *)((g_inside_microwave == MICROWAVE_IS_EMPTY) ? "N_Food" : "  Food");
+    uint8 u8counter = 0;
+    for(u8counter = 0 ; u8counter < 6 ; u8counter++)
+    {
+        a_u8text_ptr[u8counter] = state_ptr[u8counter];
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Format_stage
+ *
+ * Description: 	number of running stage and number of all stages "1/3".
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u8text_ptr      (uint8*) characters of the field
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Format_stage(uint8 * a_u8text_ptr)
+{
+    uint8 u8stage_index = 0;
+    uint8 u8stages_number = 0;
+    (void)Sequence_get_current_stage(&u8stage_index , &u8stages_number);
+    a_u8text_ptr[0] = u8stage_index + ASCII_ZERO_NUMBER;
+    a_u8text_ptr[1] = '/';
+    a_u8text_ptr[2] = u8stages_number + ASCII_ZERO_NUMBER;
+}
+
+/*******************************************************************************
+ * Function Name:	Format_power
+ *
+ * Description: 	heater power of the running stage "100%".
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u8text_ptr      (uint8*) characters of the field
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Format_power(uint8 * a_u8text_ptr)
+{
+    uint8 u8stage_index = 0;
+    uint8 u8stages_number = 0;
+    uint8 u8power = Sequence_get_current_stage(&u8stage_index , &u8stages_number)->u8heater_power;
+    a_u8text_ptr[0] = (u8power == 100) ? '1' : ' ';
+    a_u8text_ptr[1] = (u8power >= 10) ? ((u8power / 10) % 10) + ASCII_ZERO_NUMBER : ' ';
+    a_u8text_ptr[2] = (u8power % 10) + ASCII_ZERO_NUMBER;
+    a_u8text_ptr[3] = '%';
+}
+
+/*******************************************************************************
+ * Function Name:	Draw_remaining_time
+ *
+ * Description: 	draw the reminding time as big digits and the progress bar
+ *                  of the heating process when it isn't paused.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Draw_remaining_time(void)
+{
+    Render_start();
+    Render_big_time(g_u16MicrowaveTime);
+    if(g_system_state_var_t == SYSTEM_HEATING_STATE)
+    {
+        Render_progress_bar(g_u16last_cook_time - g_u16MicrowaveTime , g_u16last_cook_time);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
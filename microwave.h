@@ -25,24 +25,35 @@
 #include "timers.h"
 #include "interrupt.h"
 #include "ADC.h"
+#include "heater.h"
 
 /*******************************************************************************
  *                              Definitions                                    *
  *******************************************************************************/
 #define _XTAL_FREQ              8000000u
+#ifndef ASCII_ZERO_NUMBER
 #define ASCII_ZERO_NUMBER       48u
+#endif
 #define MAX_DEF_TEMPERATURE     50u
 #define MIN_TEMPERATURE         27u
 #define LED_PIN                 GPIO_PIN7
 #define LED_PORT                GPIO_PORTB
 #define BUZZER_PIN              GPIO_PIN1
 #define BUZZER_PORT             GPIO_PORTC
-#define HEATER_PIN              GPIO_PIN5
-#define HEATER_PORT             GPIO_PORTC
 #define DOOR_SENSOR_PIN         GPIO_PIN4
 #define DOOR_SENSOR_PORT        GPIO_PORTB
 #define WEIGHT_SENSOR_PIN       GPIO_PIN5
 #define WEIGHT_SENSOR_PORT      GPIO_PORTB
+/* Timer1 preload to get overflow every 10ms (20000 counts of 0.5us) */
+#define TIMER1_TICK_PRELOAD     45536u
+/* ticks of displaying then blanking the finishing message (5 seconds) */
+#define FINISH_MESSAGE_TICKS    500u
+/* tone of the alarm when the heating process finished in Hz */
+#define FINISH_ALARM_FREQUENCY  2000u
+/* LED and Buzzer are indicators group, LED is on by high and Buzzer by low */
+#define INDICATORS_MASK(PORT)   (GPIO_GROUP_MASK(PORT , LED_PORT , LED_PIN) | \
+                                 GPIO_GROUP_MASK(PORT , BUZZER_PORT , BUZZER_PIN))
+#define INDICATORS_LEVEL(PORT)  GPIO_GROUP_MASK(PORT , LED_PORT , LED_PIN)
 
 /*******************************************************************************
  *                         Types Declaration                                   *
@@ -62,6 +73,8 @@ typedef enum {
 extern uint16 g_u16MicrowaveTime;
 /* System state variable that used to make system state machine */
 extern EnumSystem_states_t g_system_state_var_t;
+/* pins of LED and Buzzer to turn them on or off together */
+extern const StrGPIO_group_t g_indicators_group;
 
 /*******************************************************************************
  *                      Functions Prototypes                                   *
@@ -88,7 +101,8 @@ extern void Set_and_Display_desired_temp(void);
  * Function Name:	Display_remind_time
  *
  * Description: 	when heating process occur the reminding time for this
- *                  process displays on LCD by this function.
+ *                  process displays on LCD by this function as big digits
+ *                  with progress bar of the process.
  *
  * Inputs:			NULL
  *
@@ -98,6 +112,21 @@ extern void Set_and_Display_desired_temp(void);
  *******************************************************************************/
 extern void Display_remind_time (void);
 
+/*******************************************************************************
+ * Function Name:	Heating_stage_update_function
+ *
+ * Description: 	when the sequence engine moves to the next stage of the
+ *                  heating process, this function applies heater power and
+ *                  fan duty of the new stage and displays it on LCD.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Heating_stage_update_function(void);
+
 /*******************************************************************************
  * Function Name:	TIMER0_ISR
  *
@@ -113,10 +142,56 @@ extern void Display_remind_time (void);
  *******************************************************************************/
 extern void TIMER0_ISR(void);
 
+/*******************************************************************************
+ * Function Name:	TIMER1_ISR
+ *
+ * Description: 	the function that send as call_back function to Timer1 interrupt
+ *                  to make system tick every 10ms which drives heater power.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void TIMER1_ISR(void);
+
+/*******************************************************************************
+ * Function Name:	Keypad_scan_function
+ *
+ * Description: 	scan the keypad once every system tick, the scan is done in
+ *                  the main loop not in Timer1 interrupt because rows of the
+ *                  keypad are on LCD data port.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Keypad_scan_function(void);
+
+/*******************************************************************************
+ * Function Name:	Sensors_events_function
+ *
+ * Description: 	read events of door and weight buttons, every press toggles
+ *                  state of its sensor when the system state allows it, the
+ *                  other events are dropped.
+ *                  note: the door is watched in idle and finishing states and
+ *                        the weight in idle state only.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sensors_events_function(void);
+
 /*******************************************************************************
  * Function Name:	Door_sensor_function
  *
- * Description: 	read door sensor which connected with micro_controller pin and
+ * Description: 	toggle state of the door when its button is pressed and
  *                  display state of the door on the screen when the heating process 
  *                  doesn't occur
  *                  note: during the heating process the door must be closed and we
@@ -134,9 +209,9 @@ extern void Door_sensor_function(void);
 /*******************************************************************************
  * Function Name:	Weight_sensor_function
  *
- * Description: 	read weight sensor which connected with micro_controller pin and
- *                  display state of the inside microwave status on the screen when 
- *                  the heating process doesn't occur.
+ * Description: 	toggle state of the inside microwave when its button is pressed
+ *                  and display state of the inside microwave status on the screen
+ *                  when the heating process doesn't occur.
  *                  note: we can't put or remove anything inside microwave when reading
  *                        of door sensor say the door is closed.
  *                  note: in this application, the push button work as weight sensor.
@@ -188,13 +263,29 @@ extern void User_insert_time_and_start_heating_function(void);
  *******************************************************************************/
 extern void If_heating_is_canceled_function(void);
 
+/*******************************************************************************
+ * Function Name:	Heating_finished_function
+ *
+ * Description: 	this function occurs once when the reminding time of the
+ *                  heating process equal to zero, it moves the system to the
+ *                  end state, closes the heater and the fan and the LED and
+ *                  starts the alarm melody of the Buzzer.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Heating_finished_function(void);
+
 /*******************************************************************************
  * Function Name:	Heating_process_has_done_function
  *
  * Description: 	this function occurs when the heating process finished and
  *                  the reminding time equal to zero.
- *                  this function close the heater and the fan and the LED and 
- *                  invokes the Buzzer to alarm the user.
+ *                  this function blinks the finishing message while the Buzzer
+ *                  alarms the user.
  *                  note: the user should presses on # or open the door to return 
  *                        to idle state and exit from the heating finished state. 
  *
@@ -0,0 +1,300 @@
+/*******************************************************************************
+ *
+ * File:                pot.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of setpoint
+ *                      potentiometer module, the range of every pot is learned
+ *                      from its readings and saved in data EEPROM, so the
+ *                      tolerance of the pot and the ADC reference doesn't
+ *                      prevent the ends of the setpoint. the range is widened
+ *                      by bounded steps after some readings beyond its end
+ *                      and it can be reset to the default range.
+ *
+ * Revision history:    26/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "pot.h"
+#include "pot_config.h"
+#include "microwave.h"
+#include "EEPROM.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* there isn't accepted reading after initialization */
+#define POT_NO_READING                  0xFFFFu
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* learned range of the pot in ADC counts and its fixed point scale */
+static uint16 g_u16low_counts = POT_DEFAULT_LOW_COUNTS;
+static uint16 g_u16high_counts = POT_DEFAULT_HIGH_COUNTS;
+static uint16 g_u16scale = 0;
+/* readings in a row which are below or above the range */
+static uint8 g_u8low_readings = 0;
+static uint8 g_u8high_readings = 0;
+/* range which is saved in data EEPROM */
+static uint16 g_u16saved_low_counts = POT_DEFAULT_LOW_COUNTS;
+static uint16 g_u16saved_high_counts = POT_DEFAULT_HIGH_COUNTS;
+/* reading which gives the current setpoint */
+static uint16 g_u16accepted_counts = POT_NO_READING;
+static uint8 g_u8setpoint = 0;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Pot_save_range
+ *
+ * Description: 	save the learned range in data EEPROM.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pot_save_range(void);
+
+/*******************************************************************************
+ * Function Name:	Pot_compute_scale
+ *
+ * Description: 	compute the fixed point scale of the range, so the mapping
+ *                  itself doesn't divide.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pot_compute_scale(void);
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Pot_Initialization
+ *
+ * Description: 	load the learned range from data EEPROM or the default
+ *                  range if EEPROM hasn't valid range, the scale is computed
+ *                  from the loaded range.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Pot_Initialization(void)
+{
+    /* range which is read from data EEPROM */
+    uint16 u16low_counts = (uint16)EEPROM_Read_byte(POT_EEPROM_ADDRESS) << 8 |
+                           EEPROM_Read_byte(POT_EEPROM_ADDRESS + 1);
+    uint16 u16high_counts = (uint16)EEPROM_Read_byte(POT_EEPROM_ADDRESS + 2) << 8 |
+                            EEPROM_Read_byte(POT_EEPROM_ADDRESS + 3);
+    /* the learning only widens the default range, so the erased EEPROM (0xFFFF)
+     * or the range out of these limits isn't valid */
+    if(u16low_counts <= POT_DEFAULT_LOW_COUNTS && u16high_counts >= POT_DEFAULT_HIGH_COUNTS &&
+            u16high_counts <= POT_MAX_COUNTS)
+    {
+        g_u16low_counts = u16low_counts;
+        g_u16high_counts = u16high_counts;
+    }
+    else
+    {
+        g_u16low_counts = POT_DEFAULT_LOW_COUNTS;
+        g_u16high_counts = POT_DEFAULT_HIGH_COUNTS;
+    }
+    Pot_compute_scale();
+    g_u8low_readings = 0;
+    g_u8high_readings = 0;
+    g_u16saved_low_counts = g_u16low_counts;
+    g_u16saved_high_counts = g_u16high_counts;
+    g_u16accepted_counts = POT_NO_READING;
+    g_u8setpoint = 0;
+}
+
+/*******************************************************************************
+ * Function Name:	Pot_get_setpoint
+ *
+ * Description: 	learn the range from the ADC readings and map the reading
+ *                  to setpoint from 0 to MAX_DEF_TEMPERATURE by one multiply
+ *                  and shift, the ends of the range are dead bands and
+ *                  the small changes of the reading are ignored.
+ *
+ * Inputs:			a_u16counts       (uint16) ADC reading of the pot
+ *
+ * Outputs:			NULL
+ *
+ * Return:			setpoint (uint8)
+ *******************************************************************************/
+uint8 Pot_get_setpoint(uint16 a_u16counts)
+{
+    /* flag to check if the reading widened the range */
+    uint8 u8learned_flag = FALSE;
+    if(a_u16counts > POT_MAX_COUNTS)
+    {
+        a_u16counts = POT_MAX_COUNTS;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* widen the range toward the readings which are out of it, the end
+     * moves POT_LEARN_STEP_COUNTS max. after POT_LEARN_READINGS in a row */
+    if(a_u16counts < g_u16low_counts)
+    {
+        g_u8high_readings = 0;
+        g_u8low_readings++;
+        if(g_u8low_readings >= POT_LEARN_READINGS)
+        {
+            g_u8low_readings = 0;
+            g_u16low_counts = (g_u16low_counts - a_u16counts > POT_LEARN_STEP_COUNTS) ?
+                    g_u16low_counts - POT_LEARN_STEP_COUNTS : a_u16counts;
+            u8learned_flag = TRUE;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else if(a_u16counts > g_u16high_counts)
+    {
+        g_u8low_readings = 0;
+        g_u8high_readings++;
+        if(g_u8high_readings >= POT_LEARN_READINGS)
+        {
+            g_u8high_readings = 0;
+            g_u16high_counts = (a_u16counts - g_u16high_counts > POT_LEARN_STEP_COUNTS) ?
+                    g_u16high_counts + POT_LEARN_STEP_COUNTS : a_u16counts;
+            u8learned_flag = TRUE;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        g_u8low_readings = 0;
+        g_u8high_readings = 0;
+    }
+    /* the scale is computed again only when the range changes */
+    if(u8learned_flag == TRUE)
+    {
+        Pot_compute_scale();
+        if(g_u16saved_low_counts - g_u16low_counts >= POT_SAVE_STEP_COUNTS ||
+                g_u16high_counts - g_u16saved_high_counts >= POT_SAVE_STEP_COUNTS)
+        {
+            Pot_save_range();
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* the setpoint is mapped again only if the reading moved out of the
+     * hysteresis band of the accepted reading or the range changed */
+    if(g_u16accepted_counts == POT_NO_READING || u8learned_flag == TRUE ||
+            a_u16counts > g_u16accepted_counts + POT_HYSTERESIS_COUNTS ||
+            a_u16counts + POT_HYSTERESIS_COUNTS < g_u16accepted_counts)
+    {
+        g_u16accepted_counts = a_u16counts;
+        if(a_u16counts <= g_u16low_counts + POT_DEAD_BAND_COUNTS)
+        {
+            g_u8setpoint = 0;
+        }
+        else if(a_u16counts >= g_u16high_counts - POT_DEAD_BAND_COUNTS)
+        {
+            g_u8setpoint = MAX_DEF_TEMPERATURE;
+        }
+        else
+        {
+            g_u8setpoint = (uint8)(((uint32)(a_u16counts - g_u16low_counts - POT_DEAD_BAND_COUNTS) *
+                    g_u16scale) >> POT_SCALE_SHIFT);
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return g_u8setpoint;
+}
+
+/*******************************************************************************
+ * Function Name:	Pot_reset_range
+ *
+ * Description: 	forget the learned range and save the default range in
+ *                  data EEPROM, so a range widened by a faulty pot or noise
+ *                  is recovered.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Pot_reset_range(void)
+{
+    g_u16low_counts = POT_DEFAULT_LOW_COUNTS;
+    g_u16high_counts = POT_DEFAULT_HIGH_COUNTS;
+    Pot_compute_scale();
+    g_u8low_readings = 0;
+    g_u8high_readings = 0;
+    g_u16accepted_counts = POT_NO_READING;
+    Pot_save_range();
+}
+
+/*******************************************************************************
+ * Function Name:	Pot_save_range
+ *
+ * Description: 	save the learned range in data EEPROM.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pot_save_range(void)
+{
+    /* EEPROM_Write_byte doesn't write the bytes which didn't change */
+    EEPROM_Write_byte(POT_EEPROM_ADDRESS , (uint8)(g_u16low_counts >> 8));
+    EEPROM_Write_byte(POT_EEPROM_ADDRESS + 1 , (uint8)g_u16low_counts);
+    EEPROM_Write_byte(POT_EEPROM_ADDRESS + 2 , (uint8)(g_u16high_counts >> 8));
+    EEPROM_Write_byte(POT_EEPROM_ADDRESS + 3 , (uint8)g_u16high_counts);
+    g_u16saved_low_counts = g_u16low_counts;
+    g_u16saved_high_counts = g_u16high_counts;
+}
+
+/*******************************************************************************
+ * Function Name:	Pot_compute_scale
+ *
+ * Description: 	compute the fixed point scale of the range, so the mapping
+ *                  itself doesn't divide.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pot_compute_scale(void)
+{
+    g_u16scale = (uint16)(((uint32)MAX_DEF_TEMPERATURE << POT_SCALE_SHIFT) /
+            (g_u16high_counts - g_u16low_counts - 2u * POT_DEAD_BAND_COUNTS));
+}
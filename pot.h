@@ -0,0 +1,82 @@
+/*******************************************************************************
+ *
+ * File:                pot.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes and definitions of
+ *                      setpoint potentiometer module.
+ *
+ * Revision history:    26/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef POT_H
+#define	POT_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* max. reading of 10 bits ADC */
+#define POT_MAX_COUNTS                  1023u
+/* bits of the fraction of the fixed point scale */
+#define POT_SCALE_SHIFT                 16u
+
+/*******************************************************************************
+ *                            Functions Prototype                              *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Pot_Initialization
+ *
+ * Description: 	load the learned range from data EEPROM or the default
+ *                  range if EEPROM hasn't valid range, the scale is computed
+ *                  from the loaded range.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Pot_Initialization(void);
+
+/*******************************************************************************
+ * Function Name:	Pot_get_setpoint
+ *
+ * Description: 	learn the range from the ADC readings and map the reading
+ *                  to setpoint from 0 to MAX_DEF_TEMPERATURE by one multiply
+ *                  and shift, the ends of the range are dead bands and
+ *                  the small changes of the reading are ignored.
+ *
+ * Inputs:			a_u16counts       (uint16) ADC reading of the pot
+ *
+ * Outputs:			NULL
+ *
+ * Return:			setpoint (uint8)
+ *******************************************************************************/
+extern uint8 Pot_get_setpoint(uint16 a_u16counts);
+
+/*******************************************************************************
+ * Function Name:	Pot_reset_range
+ *
+ * Description: 	forget the learned range and save the default range in
+ *                  data EEPROM, so a range widened by a faulty pot or noise
+ *                  is recovered.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Pot_reset_range(void);
+
+#endif	/* POT_H */
@@ -0,0 +1,43 @@
+/*******************************************************************************
+ *
+ * File:                pot_config.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains configurations of setpoint potentiometer
+ *                      module.
+ *
+ * Revision history:    26/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef POT_CONFIG_H
+#define	POT_CONFIG_H
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* start of the learned range in data EEPROM after the user presets area
+ * (low counts "2 bytes" and high counts "2 bytes") */
+#define POT_EEPROM_ADDRESS              0x20u
+/* range which is used before learning, it is narrower than the full ADC
+ * range so every pot reaches its ends, the learning only widens it */
+#define POT_DEFAULT_LOW_COUNTS          64u
+#define POT_DEFAULT_HIGH_COUNTS         959u
+/* readings in a row beyond the same end of the range which widen it, so
+ * one noisy reading doesn't widen the range */
+#define POT_LEARN_READINGS              4u
+/* max. counts which one learning step moves the end of the range by */
+#define POT_LEARN_STEP_COUNTS           4u
+/* counts at every end of the range which give the end value */
+#define POT_DEAD_BAND_COUNTS            16u
+/* change of the reading in counts which is ignored to prevent jitter of
+ * the value between two steps */
+#define POT_HYSTERESIS_COUNTS           3u
+/* the learned range is saved again when one of its ends moves by these
+ * counts from the saved range to save EEPROM endurance */
+#define POT_SAVE_STEP_COUNTS            8u
+
+#endif	/* POT_CONFIG_H */
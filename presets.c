@@ -0,0 +1,153 @@
+/*******************************************************************************
+ *
+ * File:                presets.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of cooking presets
+ *                      module.
+ *
+ * Revision history:    2/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "presets.h"
+#include "microwave.h"
+#include "EEPROM.h"
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* stages of preset programs (duration , heater power , fan duty) */
+static const StrSequence_stage_t g_popcorn_stages[] = {
+    {150u , 100u , SEQUENCE_FAN_FROM_TEMPERATURE}
+};
+static const StrSequence_stage_t g_reheat_stages[] = {
+    {60u  , 100u , SEQUENCE_FAN_FROM_TEMPERATURE},
+    {30u  , 50u  , SEQUENCE_FAN_FROM_TEMPERATURE}
+};
+static const StrSequence_stage_t g_defrost_stages[] = {
+    {120u , 30u  , 40u},
+    {90u  , 100u , SEQUENCE_FAN_FROM_TEMPERATURE},
+    {60u  , 10u  , 20u}
+};
+
+/* preset programs table which is stored in program flash to not waste RAM,
+ * the table is ordered by the KeyPad numbers starting from PRESET_FIRST_ROM_KEY */
+static const StrPreset_t g_presets_table[PRESET_FIRST_USER_KEY - PRESET_FIRST_ROM_KEY] = {
+    /* name         temperature  stages */
+    {"Popcorn"  ,   50u ,        1u , g_popcorn_stages},
+    {"Reheat"   ,   30u ,        2u , g_reheat_stages},
+    {"Defrost"  ,   10u ,        3u , g_defrost_stages}
+};
+
+/* the only stage of user preset which is loaded from data EEPROM */
+static StrSequence_stage_t g_user_preset_stage;
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Preset_load
+ *
+ * Description: 	get preset program that assigned to the pressed key from
+ *                  program flash table or from user presets in data EEPROM.
+ *
+ * Inputs:			a_u8preset_key    (uint8) KeyPad number from 1 to 9
+ *
+ * Outputs:			a_preset_ptr      (StrPreset_t*) loaded preset program
+ *
+ * Return:			TRUE if the key has a valid preset, FALSE otherwise (uint8)
+ *******************************************************************************/
+uint8 Preset_load(uint8 a_u8preset_key , StrPreset_t * a_preset_ptr)
+{
+    uint8 retVal = FALSE;
+    /* EEPROM address of user preset */
+    uint8 u8address = 0;
+    /* heating time of user preset */
+    uint16 u16time = 0;
+    /* check if the preset is stored in program flash table */
+    if(a_u8preset_key >= PRESET_FIRST_ROM_KEY && a_u8preset_key < PRESET_FIRST_USER_KEY)
+    {
+        *a_preset_ptr = g_presets_table[a_u8preset_key - PRESET_FIRST_ROM_KEY];
+        retVal = TRUE;
+    }
+    /* check if the preset is one of user presets in data EEPROM */
+    else if(a_u8preset_key >= PRESET_FIRST_USER_KEY && a_u8preset_key <= PRESET_LAST_KEY)
+    {
+        u8address = PRESETS_EEPROM_START_ADDRESS +
+                (a_u8preset_key - PRESET_FIRST_USER_KEY) * PRESET_EEPROM_SLOT_SIZE;
+        u16time = (uint16)EEPROM_Read_byte(u8address) << 8 | EEPROM_Read_byte(u8address + 1);
+        a_preset_ptr->u8temperature = EEPROM_Read_byte(u8address + 2);
+        /* user preset is one stage at full power */
+        g_user_preset_stage.u16duration = u16time;
+        g_user_preset_stage.u8heater_power = SEQUENCE_FULL_POWER;
+        g_user_preset_stage.u8fan_duty = SEQUENCE_FAN_FROM_TEMPERATURE;
+        a_preset_ptr->u8stages_number = 1;
+        a_preset_ptr->stages_ptr = &g_user_preset_stage;
+        /* name of user preset is "User " followed by its key */
+        a_preset_ptr->u8name[0] = 'U';
+        a_preset_ptr->u8name[1] = 's';
+        a_preset_ptr->u8name[2] = 'e';
+        a_preset_ptr->u8name[3] = 'r';
+        a_preset_ptr->u8name[4] = ' ';
+        a_preset_ptr->u8name[5] = a_u8preset_key + ASCII_ZERO_NUMBER;
+        a_preset_ptr->u8name[6] = '\0';
+        /* erased or corrupted slot isn't valid preset */
+        if(u16time != 0 && u16time <= PRESET_MAX_TIME &&
+                a_preset_ptr->u8temperature <= MAX_DEF_TEMPERATURE)
+        {
+            retVal = TRUE;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Preset_save_user
+ *
+ * Description: 	save heating time and temperature in data EEPROM as user
+ *                  preset assigned to KeyPad number from 4 to 9.
+ *
+ * Inputs:			a_u8preset_key    (uint8)
+ *                  a_u16time         (uint16) heating time in seconds
+ *                  a_u8temperature   (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the preset is saved, FALSE otherwise (uint8)
+ *******************************************************************************/
+uint8 Preset_save_user(uint8 a_u8preset_key , uint16 a_u16time , uint8 a_u8temperature)
+{
+    uint8 retVal = FALSE;
+    /* EEPROM address of user preset */
+    uint8 u8address = 0;
+    /* check the key is assigned to user presets and the values are valid */
+    if(a_u8preset_key >= PRESET_FIRST_USER_KEY && a_u8preset_key <= PRESET_LAST_KEY &&
+            a_u16time != 0 && a_u16time <= PRESET_MAX_TIME && a_u8temperature <= MAX_DEF_TEMPERATURE)
+    {
+        u8address = PRESETS_EEPROM_START_ADDRESS +
+                (a_u8preset_key - PRESET_FIRST_USER_KEY) * PRESET_EEPROM_SLOT_SIZE;
+        EEPROM_Write_byte(u8address , (uint8)(a_u16time >> 8));
+        EEPROM_Write_byte(u8address + 1 , (uint8)a_u16time);
+        EEPROM_Write_byte(u8address + 2 , a_u8temperature);
+        retVal = TRUE;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ *
+ * File:                presets.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes, structures and
+ *                      definitions of cooking presets module.
+ *
+ * Revision history:    2/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef PRESETS_H
+#define	PRESETS_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+#include "sequence.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* presets programs are selected by KeyPad numbers from 1 to 9, programs from
+ * 1 to 3 are stored in program flash and from 4 to 9 are saved by the user */
+#define PRESET_FIRST_ROM_KEY                1u
+#define PRESET_FIRST_USER_KEY               4u
+#define PRESET_LAST_KEY                     9u
+/* max. characters of preset name that displayed on LCD */
+#define PRESET_NAME_SIZE                    11u
+/* start of user presets area in data EEPROM (time "2 bytes" then temperature),
+ * user preset is saved as one stage at full power */
+#define PRESETS_EEPROM_START_ADDRESS        0x00u
+#define PRESET_EEPROM_SLOT_SIZE             3u
+/* max. heating time in seconds (99:59) */
+#define PRESET_MAX_TIME                     5999u
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/******************************* StrPreset_t ***********************************/
+typedef struct{
+    uint8  u8name[PRESET_NAME_SIZE];            /* name to display on LCD */
+    uint8  u8temperature;                       /* temperature above MIN_TEMPERATURE */
+    uint8  u8stages_number;                     /* number of heating stages */
+    const StrSequence_stage_t * stages_ptr;     /* heating stages of the program */
+}StrPreset_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Preset_load
+ *
+ * Description: 	get preset program that assigned to the pressed key from
+ *                  program flash table or from user presets in data EEPROM.
+ *
+ * Inputs:			a_u8preset_key    (uint8) KeyPad number from 1 to 9
+ *
+ * Outputs:			a_preset_ptr      (StrPreset_t*) loaded preset program
+ *
+ * Return:			TRUE if the key has a valid preset, FALSE otherwise (uint8)
+ *******************************************************************************/
+extern uint8 Preset_load(uint8 a_u8preset_key , StrPreset_t * a_preset_ptr);
+
+/*******************************************************************************
+ * Function Name:	Preset_save_user
+ *
+ * Description: 	save heating time and temperature in data EEPROM as user
+ *                  preset assigned to KeyPad number from 4 to 9.
+ *
+ * Inputs:			a_u8preset_key    (uint8)
+ *                  a_u16time         (uint16) heating time in seconds
+ *                  a_u8temperature   (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the preset is saved, FALSE otherwise (uint8)
+ *******************************************************************************/
+extern uint8 Preset_save_user(uint8 a_u8preset_key , uint16 a_u16time , uint8 a_u8temperature);
+
+#endif	/* PRESETS_H */
+
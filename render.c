@@ -0,0 +1,365 @@
+/*******************************************************************************
+ *
+ * File:                render.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of big digits and
+ *                      progress bar rendering on LCD. digit is 3 columns of
+ *                      7 segments, every cell shows the horizontal segments
+ *                      of its top and bottom and the side cells show the
+ *                      vertical segments as full block.
+ *
+ * Revision history:    23/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "render.h"
+#include "LCD.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+#if RENDER_BAR_CELLS * RENDER_BAR_CELL_STEPS >= 0xFFu
+#error "steps of the progress bar should be less than 255"
+#endif
+/* digits of mm:ss and width of digit in columns */
+#define RENDER_TIME_DIGITS              4u
+#define RENDER_DIGIT_WIDTH              3u
+#define RENDER_COLON_COLUMN             (RENDER_TIME_COLUMN + 2u * RENDER_DIGIT_WIDTH)
+/* value of digit or bar which isn't displayed, it's drawn by the next call */
+#define RENDER_NO_VALUE                 0xFFu
+/* characters of CGROM which are used with the glyphs */
+#define RENDER_EMPTY_CELL               ' '
+#define RENDER_FULL_CELL                0xFFu
+/* glyphs, the bar glyphs are 1 to 4 steps of the cell */
+#define RENDER_GLYPH_UPPER              0u
+#define RENDER_GLYPH_LOWER              1u
+#define RENDER_GLYPH_BOTH               2u
+#define RENDER_GLYPH_DOT                3u
+#define RENDER_GLYPH_BAR                4u
+#define RENDER_GLYPHS_NUMBER            8u
+/* segments of the digit */
+#define RENDER_SEGMENT_A                0x01u           /* top */
+#define RENDER_SEGMENT_B                0x02u           /* upper right */
+#define RENDER_SEGMENT_C                0x04u           /* lower right */
+#define RENDER_SEGMENT_D                0x08u           /* bottom */
+#define RENDER_SEGMENT_E                0x10u           /* lower left */
+#define RENDER_SEGMENT_F                0x20u           /* upper left */
+#define RENDER_SEGMENT_G                0x40u           /* middle */
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/*************************** StrRender_row_t ***********************************/
+typedef struct{
+    uint8 u8top;                        /* segment at top of the row cells */
+    uint8 u8bottom;                     /* segment at bottom of the row cells */
+    uint8 u8left;                       /* segment of the left cell */
+    uint8 u8right;                      /* segment of the right cell */
+    uint8 u8colon_flag;                 /* TRUE if the colon has dot in the row */
+}StrRender_row_t;
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* rows of the glyphs, 5 pixels per row */
+static const uint8 g_u8glyphs_arr[RENDER_GLYPHS_NUMBER][LCD_GLYPH_ROWS] = {
+    {0x1F , 0x1F , 0x1F , 0x00 , 0x00 , 0x00 , 0x00 , 0x00} ,
+    {0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x1F , 0x1F , 0x1F} ,
+    {0x1F , 0x1F , 0x1F , 0x00 , 0x00 , 0x1F , 0x1F , 0x1F} ,
+    {0x00 , 0x00 , 0x0E , 0x0E , 0x0E , 0x00 , 0x00 , 0x00} ,
+    {0x10 , 0x10 , 0x10 , 0x10 , 0x10 , 0x10 , 0x10 , 0x10} ,
+    {0x18 , 0x18 , 0x18 , 0x18 , 0x18 , 0x18 , 0x18 , 0x18} ,
+    {0x1C , 0x1C , 0x1C , 0x1C , 0x1C , 0x1C , 0x1C , 0x1C} ,
+    {0x1E , 0x1E , 0x1E , 0x1E , 0x1E , 0x1E , 0x1E , 0x1E}
+};
+/* segments of digits from 0 to 9 */
+static const uint8 g_u8digits_segments_arr[10] = {0x3F , 0x06 , 0x5B , 0x4F , 0x66 , 0x6D , 0x7D , 0x07 , 0x7F , 0x6F};
+/* segments of every LCD row of the digit */
+static const StrRender_row_t g_digit_rows_arr[RENDER_DIGITS_ROWS] = {
+    {RENDER_SEGMENT_A , RENDER_SEGMENT_G , RENDER_SEGMENT_F , RENDER_SEGMENT_B , TRUE} ,
+    {0                , RENDER_SEGMENT_D , RENDER_SEGMENT_E , RENDER_SEGMENT_C , TRUE}
+};
+/* character codes of the glyphs in CGRAM */
+static uint8 g_u8codes_arr[RENDER_GLYPHS_NUMBER];
+/* displayed digits of mm:ss and steps of the bar */
+static uint8 g_u8digits_arr[RENDER_TIME_DIGITS] = {RENDER_NO_VALUE , RENDER_NO_VALUE , RENDER_NO_VALUE , RENDER_NO_VALUE};
+static uint8 g_u8bar_steps = RENDER_NO_VALUE;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Render_draw_digit
+ *
+ * Description: 	write all cells of big digit.
+ *
+ * Inputs:			a_u8column        (uint8) first column of the digit
+ *                  a_u8digit         (uint8) from 0 to 9
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Render_draw_digit(uint8 a_u8column , uint8 a_u8digit);
+
+/*******************************************************************************
+ * Function Name:	Render_bar_cell_code
+ *
+ * Description: 	get character of progress bar cell.
+ *
+ * Inputs:			a_u8steps         (uint8) steps of the whole bar
+ *                  a_u8cell          (uint8) index of the cell
+ *
+ * Outputs:			NULL
+ *
+ * Return:			character code (uint8)
+ *******************************************************************************/
+static uint8 Render_bar_cell_code(uint8 a_u8steps , uint8 a_u8cell);
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Render_start
+ *
+ * Description: 	pin the glyphs of the digits and the bar in CGRAM, draw
+ *                  the colon and make the next calls draw all digits and
+ *                  bar cells.
+ *                  note: it should be called after the screen is cleared.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Render_start(void)
+{
+    /* the glyph which isn't loaded is shown as full block (LCD_NO_GLYPH_CODE) */
+    for(uint8 u8counter = 0 ; u8counter < RENDER_GLYPHS_NUMBER ; u8counter++)
+    {
+        g_u8codes_arr[u8counter] = LCD_PinGlyph(g_u8glyphs_arr[u8counter]);
+    }
+    for(uint8 u8counter = 0 ; u8counter < RENDER_TIME_DIGITS ; u8counter++)
+    {
+        g_u8digits_arr[u8counter] = RENDER_NO_VALUE;
+    }
+    g_u8bar_steps = RENDER_NO_VALUE;
+    for(uint8 u8row = 0 ; u8row < RENDER_DIGITS_ROWS ; u8row++)
+    {
+        if(g_digit_rows_arr[u8row].u8colon_flag == TRUE)
+        {
+            LCD_SetDisplayPosition(RENDER_COLON_COLUMN , RENDER_TIME_ROW + u8row);
+            LCD_SendDataByte(g_u8codes_arr[RENDER_GLYPH_DOT]);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Render_big_time
+ *
+ * Description: 	draw time as big digits mm:ss, only the digits which
+ *                  changed from the last call are written.
+ *                  note: longer time is drawn as 99:59.
+ *
+ * Inputs:			a_u16seconds      (uint16) time in seconds up to 99:59
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Render_big_time(uint16 a_u16seconds)
+{
+    uint8 u8minutes = 0;
+    uint8 u8seconds = 0;
+    uint8 u8digits_arr[RENDER_TIME_DIGITS];
+    /* the tens of minutes are a digit from 0 to 9 */
+    if(a_u16seconds > RENDER_MAX_TIME)
+    {
+        a_u16seconds = RENDER_MAX_TIME;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    u8minutes = a_u16seconds / 60;
+    u8seconds = a_u16seconds % 60;
+    u8digits_arr[0] = u8minutes / 10;
+    u8digits_arr[1] = u8minutes % 10;
+    u8digits_arr[2] = u8seconds / 10;
+    u8digits_arr[3] = u8seconds % 10;
+    /* the seconds are after the colon */
+    uint8 u8column = RENDER_TIME_COLUMN;
+    for(uint8 u8counter = 0 ; u8counter < RENDER_TIME_DIGITS ; u8counter++)
+    {
+        if(u8digits_arr[u8counter] != g_u8digits_arr[u8counter])
+        {
+            g_u8digits_arr[u8counter] = u8digits_arr[u8counter];
+            Render_draw_digit(u8column , u8digits_arr[u8counter]);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        u8column += (u8counter == 1) ? RENDER_DIGIT_WIDTH + 1 : RENDER_DIGIT_WIDTH;
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Render_progress_bar
+ *
+ * Description: 	draw progress bar of RENDER_BAR_CELLS cells with
+ *                  RENDER_BAR_CELL_STEPS steps per cell, only the cells
+ *                  which changed from the last call are written.
+ *
+ * Inputs:			a_u16value        (uint16) done part of the total
+ *                  a_u16total        (uint16)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Render_progress_bar(uint16 a_u16value , uint16 a_u16total)
+{
+    uint8 u8steps = RENDER_BAR_CELLS * RENDER_BAR_CELL_STEPS;
+    uint8 u8code = 0;
+    /* TRUE when the previous cell is written so the LCD address is at this cell */
+    uint8 u8position_flag = FALSE;
+    if(a_u16value < a_u16total)
+    {
+        u8steps = ((uint32)a_u16value * (RENDER_BAR_CELLS * RENDER_BAR_CELL_STEPS)) / a_u16total;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    for(uint8 u8cell = 0 ; u8cell < RENDER_BAR_CELLS ; u8cell++)
+    {
+        u8code = Render_bar_cell_code(u8steps , u8cell);
+        if(g_u8bar_steps == RENDER_NO_VALUE || u8code != Render_bar_cell_code(g_u8bar_steps , u8cell))
+        {
+            if(u8position_flag == FALSE)
+            {
+                LCD_SetDisplayPosition(RENDER_BAR_COLUMN + u8cell , RENDER_BAR_ROW);
+                u8position_flag = TRUE;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            LCD_SendDataByte(u8code);
+        }
+        else
+        {
+            u8position_flag = FALSE;
+        }
+    }
+    g_u8bar_steps = u8steps;
+}
+
+/*******************************************************************************
+ * Function Name:	Render_stop
+ *
+ * Description: 	unpin the glyphs of the digits and the bar so the other
+ *                  screens can use their CGRAM slots.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Render_stop(void)
+{
+    for(uint8 u8counter = 0 ; u8counter < RENDER_GLYPHS_NUMBER ; u8counter++)
+    {
+        LCD_UnpinGlyph(g_u8glyphs_arr[u8counter]);
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Render_draw_digit
+ *
+ * Description: 	write all cells of big digit.
+ *
+ * Inputs:			a_u8column        (uint8) first column of the digit
+ *                  a_u8digit         (uint8) from 0 to 9
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Render_draw_digit(uint8 a_u8column , uint8 a_u8digit)
+{
+    uint8 u8segments = g_u8digits_segments_arr[a_u8digit];
+    const StrRender_row_t * row_ptr = NULL_PTR;
+    uint8 u8horizontal_code = 0;
+    for(uint8 u8row = 0 ; u8row < RENDER_DIGITS_ROWS ; u8row++)
+    {
+        row_ptr = &g_digit_rows_arr[u8row];
+        /* horizontal segments at top and bottom of the row cells */
+        if((u8segments & row_ptr->u8top) != 0 && (u8segments & row_ptr->u8bottom) != 0)
+        {
+            u8horizontal_code = g_u8codes_arr[RENDER_GLYPH_BOTH];
+        }
+        else if((u8segments & row_ptr->u8top) != 0)
+        {
+            u8horizontal_code = g_u8codes_arr[RENDER_GLYPH_UPPER];
+        }
+        else if((u8segments & row_ptr->u8bottom) != 0)
+        {
+            u8horizontal_code = g_u8codes_arr[RENDER_GLYPH_LOWER];
+        }
+        else
+        {
+            u8horizontal_code = RENDER_EMPTY_CELL;
+        }
+        LCD_SetDisplayPosition(a_u8column , RENDER_TIME_ROW + u8row);
+        LCD_SendDataByte(((u8segments & row_ptr->u8left) != 0) ? RENDER_FULL_CELL : u8horizontal_code);
+        LCD_SendDataByte(u8horizontal_code);
+        LCD_SendDataByte(((u8segments & row_ptr->u8right) != 0) ? RENDER_FULL_CELL : u8horizontal_code);
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Render_bar_cell_code
+ *
+ * Description: 	get character of progress bar cell.
+ *
+ * Inputs:			a_u8steps         (uint8) steps of the whole bar
+ *                  a_u8cell          (uint8) index of the cell
+ *
+ * Outputs:			NULL
+ *
+ * Return:			character code (uint8)
+ *******************************************************************************/
+static uint8 Render_bar_cell_code(uint8 a_u8steps , uint8 a_u8cell)
+{
+    uint8 retVal = RENDER_EMPTY_CELL;
+    uint8 u8cell_start = a_u8cell * RENDER_BAR_CELL_STEPS;
+    if(a_u8steps >= u8cell_start + RENDER_BAR_CELL_STEPS)
+    {
+        retVal = RENDER_FULL_CELL;
+    }
+    else if(a_u8steps > u8cell_start)
+    {
+        retVal = g_u8codes_arr[RENDER_GLYPH_BAR + (a_u8steps - u8cell_start) - 1];
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
@@ -0,0 +1,104 @@
+/*******************************************************************************
+ *
+ * File:                render.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes of big digits and
+ *                      progress bar rendering on LCD. the digits and the bar
+ *                      are drawn by fixed set of CGRAM glyphs and only the
+ *                      digits or the bar cells which changed are written.
+ *
+ * Revision history:    23/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef RENDER_H
+#define	RENDER_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+#include "render_config.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* columns of the big time mm:ss, digit is 3 columns and the colon is 1 */
+#define RENDER_TIME_WIDTH               13u
+/* rows of the big time, digit is 2 rows of the LCD */
+#define RENDER_DIGITS_ROWS              2u
+/* max. time of the big time mm:ss in seconds (99:59) */
+#define RENDER_MAX_TIME                 5999u
+/* steps of one cell of the progress bar, one step is one pixel column */
+#define RENDER_BAR_CELL_STEPS           5u
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Render_start
+ *
+ * Description: 	pin the glyphs of the digits and the bar in CGRAM, draw
+ *                  the colon and make the next calls draw all digits and
+ *                  bar cells.
+ *                  note: it should be called after the screen is cleared.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Render_start(void);
+
+/*******************************************************************************
+ * Function Name:	Render_big_time
+ *
+ * Description: 	draw time as big digits mm:ss, only the digits which
+ *                  changed from the last call are written.
+ *                  note: longer time is drawn as 99:59.
+ *
+ * Inputs:			a_u16seconds      (uint16) time in seconds up to 99:59
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Render_big_time(uint16 a_u16seconds);
+
+/*******************************************************************************
+ * Function Name:	Render_progress_bar
+ *
+ * Description: 	draw progress bar of RENDER_BAR_CELLS cells with
+ *                  RENDER_BAR_CELL_STEPS steps per cell, only the cells
+ *                  which changed from the last call are written.
+ *
+ * Inputs:			a_u16value        (uint16) done part of the total
+ *                  a_u16total        (uint16)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Render_progress_bar(uint16 a_u16value , uint16 a_u16total);
+
+/*******************************************************************************
+ * Function Name:	Render_stop
+ *
+ * Description: 	unpin the glyphs of the digits and the bar so the other
+ *                  screens can use their CGRAM slots.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Render_stop(void);
+
+#endif	/* RENDER_H */
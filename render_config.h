@@ -0,0 +1,31 @@
+/*******************************************************************************
+ *
+ * File:                render_config.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains configurations of big digits and progress
+ *                      bar rendering on LCD.
+ *
+ * Revision history:    23/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef RENDER_CONFIG_H
+#define	RENDER_CONFIG_H
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* first column and first row (from 1) of the big time mm:ss */
+#define RENDER_TIME_COLUMN              0u
+#define RENDER_TIME_ROW                 1u
+/*-----------------------------------------------------------------------------*/
+/* first column, row (from 1) and length in cells of the progress bar */
+#define RENDER_BAR_COLUMN               0u
+#define RENDER_BAR_ROW                  3u
+#define RENDER_BAR_CELLS                9u
+
+#endif	/* RENDER_CONFIG_H */
@@ -0,0 +1,201 @@
+/*******************************************************************************
+ *
+ * File:                screen.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of screens engine.
+ *                      displayed characters of the fields are kept to write
+ *                      only the changed ones.
+ *
+ * Revision history:    25/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "screen.h"
+#include "LCD.h"
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* displayed screen or NULL_PTR */
+static const StrScreen_t * g_screen_ptr = NULL_PTR;
+/* displayed characters of the fields of the screen one after another */
+static uint8 g_u8fields_text_arr[SCREEN_FIELDS_BUFFER_SIZE];
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Screen_write_field
+ *
+ * Description: 	format the field and write the characters which are
+ *                  different from its displayed text.
+ *
+ * Inputs:			a_field_ptr       (const StrScreen_field_t*)
+ *                  a_u8all_flag      (uint8) TRUE to write all characters
+ *
+ * Outputs:			a_u8displayed_ptr (uint8*) displayed text of the field
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Screen_write_field(const StrScreen_field_t * a_field_ptr , uint8 * a_u8displayed_ptr , uint8 a_u8all_flag);
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Screen_show
+ *
+ * Description: 	clear the LCD, write the static texts of the screen, call
+ *                  its draw function and write all its fields.
+ *                  note: fields over SCREEN_FIELDS_BUFFER_SIZE characters
+ *                        aren't displayed.
+ *
+ * Inputs:			a_screen_ptr      (const StrScreen_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Screen_show(const StrScreen_t * a_screen_ptr)
+{
+    const StrScreen_text_t * text_ptr = NULL_PTR;
+    const uint8 * u8character_ptr = NULL_PTR;
+    const StrScreen_field_t * field_ptr = NULL_PTR;
+    uint8 u8offset = 0;
+    LCD_ClearScreen();
+    g_screen_ptr = a_screen_ptr;
+    for(uint8 u8counter = 0 ; u8counter < a_screen_ptr->u8texts_number ; u8counter++)
+    {
+        text_ptr = &a_screen_ptr->texts_ptr[u8counter];
+        LCD_SetDisplayPosition(text_ptr->u8column , text_ptr->u8row);
+        for(u8character_ptr = text_ptr->text_ptr ; *u8character_ptr != '\0' ; u8character_ptr++)
+        {
+            LCD_SendDataByte(*u8character_ptr);
+        }
+    }
+    if(a_screen_ptr->draw_ptr != NULL_PTR)
+    {
+        a_screen_ptr->draw_ptr();
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    for(uint8 u8counter = 0 ; u8counter < a_screen_ptr->u8fields_number ; u8counter++)
+    {
+        field_ptr = &a_screen_ptr->fields_ptr[u8counter];
+        if(u8offset + field_ptr->u8width <= SCREEN_FIELDS_BUFFER_SIZE)
+        {
+            Screen_write_field(field_ptr , &g_u8fields_text_arr[u8offset] , TRUE);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        u8offset += field_ptr->u8width;
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Screen_update
+ *
+ * Description: 	format the field of the id if the displayed screen has it
+ *                  and write only its characters which changed.
+ *
+ * Inputs:			a_u8field_id      (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Screen_update(uint8 a_u8field_id)
+{
+    const StrScreen_field_t * field_ptr = NULL_PTR;
+    uint8 u8offset = 0;
+    if(g_screen_ptr != NULL_PTR)
+    {
+        for(uint8 u8counter = 0 ; u8counter < g_screen_ptr->u8fields_number ; u8counter++)
+        {
+            field_ptr = &g_screen_ptr->fields_ptr[u8counter];
+            if(field_ptr->u8id == a_u8field_id && u8offset + field_ptr->u8width <= SCREEN_FIELDS_BUFFER_SIZE)
+            {
+                Screen_write_field(field_ptr , &g_u8fields_text_arr[u8offset] , FALSE);
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            u8offset += field_ptr->u8width;
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Screen_clear
+ *
+ * Description: 	clear the LCD, no screen is displayed after it.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Screen_clear(void)
+{
+    LCD_ClearScreen();
+    g_screen_ptr = NULL_PTR;
+}
+
+/*******************************************************************************
+ * Function Name:	Screen_write_field
+ *
+ * Description: 	format the field and write the characters which are
+ *                  different from its displayed text.
+ *
+ * Inputs:			a_field_ptr       (const StrScreen_field_t*)
+ *                  a_u8all_flag      (uint8) TRUE to write all characters
+ *
+ * Outputs:			a_u8displayed_ptr (uint8*) displayed text of the field
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Screen_write_field(const StrScreen_field_t * a_field_ptr , uint8 * a_u8displayed_ptr , uint8 a_u8all_flag)
+{
+    uint8 u8text_arr[SCREEN_FIELD_MAX_WIDTH];
+    /* TRUE when the previous character is written so the LCD address is at this character */
+    uint8 u8position_flag = FALSE;
+    a_field_ptr->format_ptr(u8text_arr);
+    for(uint8 u8counter = 0 ; u8counter < a_field_ptr->u8width ; u8counter++)
+    {
+        if(a_u8all_flag == TRUE || u8text_arr[u8counter] != a_u8displayed_ptr[u8counter])
+        {
+            if(u8position_flag == FALSE)
+            {
+                LCD_SetDisplayPosition(a_field_ptr->u8column + u8counter , a_field_ptr->u8row);
+                u8position_flag = TRUE;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            LCD_SendDataByte(u8text_arr[u8counter]);
+            a_u8displayed_ptr[u8counter] = u8text_arr[u8counter];
+        }
+        else
+        {
+            u8position_flag = FALSE;
+        }
+    }
+}
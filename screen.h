@@ -0,0 +1,112 @@
+/*******************************************************************************
+ *
+ * File:                screen.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes, structures and
+ *                      definitions of screens engine. screen is constant
+ *                      table of static texts and positioned dynamic fields,
+ *                      the static texts are written once when the screen is
+ *                      shown and the fields are written by their formatters
+ *                      when their values change.
+ *
+ * Revision history:    25/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef SCREEN_H
+#define	SCREEN_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* max. width of one field, it's one line of the LCD */
+#define SCREEN_FIELD_MAX_WIDTH              16u
+/* displayed characters of all fields of one screen */
+#define SCREEN_FIELDS_BUFFER_SIZE           32u
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/*************************** StrScreen_text_t **********************************/
+typedef struct{
+    uint8 u8column;                     /* from 0 to 15 */
+    uint8 u8row;                        /* from 1 to 4 */
+    const uint8 * text_ptr;             /* null terminated string */
+}StrScreen_text_t;
+
+/*************************** StrScreen_field_t *********************************/
+typedef struct{
+    uint8 u8id;                         /* same id in all screens which show the value */
+    uint8 u8column;                     /* from 0 to 15 */
+    uint8 u8row;                        /* from 1 to 4 */
+    uint8 u8width;                      /* characters of the field */
+    void (*format_ptr)(uint8 * a_u8text_ptr);   /* writes u8width characters */
+}StrScreen_field_t;
+
+/*************************** StrScreen_t ***************************************/
+typedef struct{
+    const StrScreen_text_t * texts_ptr;
+    uint8 u8texts_number;
+    const StrScreen_field_t * fields_ptr;
+    uint8 u8fields_number;
+    void (*draw_ptr)(void);             /* draws content which isn't text or NULL_PTR */
+}StrScreen_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Screen_show
+ *
+ * Description: 	clear the LCD, write the static texts of the screen, call
+ *                  its draw function and write all its fields.
+ *                  note: fields over SCREEN_FIELDS_BUFFER_SIZE characters
+ *                        aren't displayed.
+ *
+ * Inputs:			a_screen_ptr      (const StrScreen_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Screen_show(const StrScreen_t * a_screen_ptr);
+
+/*******************************************************************************
+ * Function Name:	Screen_update
+ *
+ * Description: 	format the field of the id if the displayed screen has it
+ *                  and write only its characters which changed.
+ *
+ * Inputs:			a_u8field_id      (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Screen_update(uint8 a_u8field_id);
+
+/*******************************************************************************
+ * Function Name:	Screen_clear
+ *
+ * Description: 	clear the LCD, no screen is displayed after it.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Screen_clear(void);
+
+#endif	/* SCREEN_H */
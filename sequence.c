@@ -0,0 +1,207 @@
+/*******************************************************************************
+ *
+ * File:                sequence.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of cooking sequence
+ *                      engine that runs the heating process as ordered list of
+ *                      stages.
+ *
+ * Revision history:    4/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "sequence.h"
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* stages of the heating process */
+static StrSequence_stage_t g_stages_arr[SEQUENCE_MAX_STAGES];
+/* number of loaded stages */
+static uint8 g_u8stages_number = 0;
+/* index of the running stage, it's changed by timer interrupt */
+static volatile uint8 g_u8current_stage = 0;
+/* reminding time of the running stage in seconds */
+static volatile uint16 g_u16stage_remaining_time = 0;
+/* flag to refer that new stage is started and its outputs aren't applied yet */
+static volatile uint8 g_u8stage_changed_flag = FALSE;
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Sequence_load
+ *
+ * Description: 	copy list of stages (from program flash or RAM) to be the
+ *                  stages of the next heating process.
+ *                  note: stages over SEQUENCE_MAX_STAGES are ignored.
+ *                  note: the stages are cut at SEQUENCE_MAX_TOTAL_TIME, the
+ *                        stage which passes it is shortened and the stages
+ *                        after it are ignored.
+ *
+ * Inputs:			a_stages_ptr      (const StrSequence_stage_t*)
+ *                  a_u8stages_number (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			total time of the loaded stages in seconds (uint16)
+ *******************************************************************************/
+uint16 Sequence_load(const StrSequence_stage_t * a_stages_ptr , uint8 a_u8stages_number)
+{
+    /* summation of stages durations */
+    uint16 u16total_time = 0;
+    /* limit the number of stages to the size of stages array */
+    if(a_u8stages_number > SEQUENCE_MAX_STAGES)
+    {
+        a_u8stages_number = SEQUENCE_MAX_STAGES;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    g_u8stages_number = 0;
+    for(uint8 u8counter = 0 ; u8counter < a_u8stages_number && u16total_time < SEQUENCE_MAX_TOTAL_TIME ; u8counter++)
+    {
+        g_stages_arr[u8counter] = a_stages_ptr[u8counter];
+        /* the display and the countdown can't show more than SEQUENCE_MAX_TOTAL_TIME */
+        if(g_stages_arr[u8counter].u16duration > SEQUENCE_MAX_TOTAL_TIME - u16total_time)
+        {
+            g_stages_arr[u8counter].u16duration = SEQUENCE_MAX_TOTAL_TIME - u16total_time;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        u16total_time += g_stages_arr[u8counter].u16duration;
+        g_u8stages_number++;
+    }
+    return u16total_time;
+}
+
+/*******************************************************************************
+ * Function Name:	Sequence_load_single_stage
+ *
+ * Description: 	make the next heating process as one stage with the time
+ *                  inserted by the user at full heater power and the fan
+ *                  follows the selected temperature.
+ *
+ * Inputs:			a_u16duration     (uint16) time in seconds
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sequence_load_single_stage(uint16 a_u16duration)
+{
+    g_stages_arr[0].u16duration = a_u16duration;
+    g_stages_arr[0].u8heater_power = SEQUENCE_FULL_POWER;
+    g_stages_arr[0].u8fan_duty = SEQUENCE_FAN_FROM_TEMPERATURE;
+    g_u8stages_number = 1;
+}
+
+/*******************************************************************************
+ * Function Name:	Sequence_start
+ *
+ * Description: 	start the loaded stages from the first stage.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sequence_start(void)
+{
+    g_u8current_stage = 0;
+    g_u16stage_remaining_time = g_stages_arr[0].u16duration;
+    /* outputs of first stage should be applied */
+    g_u8stage_changed_flag = TRUE;
+}
+
+/*******************************************************************************
+ * Function Name:	Sequence_tick
+ *
+ * Description: 	count one second of the current stage and move to the next
+ *                  stage automatically when the current stage finishes.
+ *                  note: it is called from one second timer interrupt.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sequence_tick(void)
+{
+    /* count down the running stage */
+    if(g_u16stage_remaining_time != 0)
+    {
+        g_u16stage_remaining_time--;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* move to the next stage which has time when the running stage finishes */
+    while(g_u16stage_remaining_time == 0 && (g_u8current_stage + 1) < g_u8stages_number)
+    {
+        g_u8current_stage++;
+        g_u16stage_remaining_time = g_stages_arr[g_u8current_stage].u16duration;
+        g_u8stage_changed_flag = TRUE;
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Sequence_stage_changed
+ *
+ * Description: 	check if the engine moved to new stage since the last call
+ *                  to apply this stage outputs.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if new stage is started, FALSE otherwise (uint8)
+ *******************************************************************************/
+uint8 Sequence_stage_changed(void)
+{
+    uint8 retVal = FALSE;
+    if(g_u8stage_changed_flag == TRUE)
+    {
+        /* more than one change before this call are applied once by the current stage */
+        g_u8stage_changed_flag = FALSE;
+        retVal = TRUE;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Sequence_get_current_stage
+ *
+ * Description: 	get the current running stage.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u8stage_index_ptr   (uint8*) number of stage starts from 1
+ *                  a_u8stages_number_ptr (uint8*) number of loaded stages
+ *
+ * Return:			pointer to current stage (const StrSequence_stage_t*)
+ *******************************************************************************/
+const StrSequence_stage_t * Sequence_get_current_stage(uint8 * a_u8stage_index_ptr , uint8 * a_u8stages_number_ptr)
+{
+    /* take copy of the stage index because it's changed by timer interrupt */
+    uint8 u8current_stage = g_u8current_stage;
+    *a_u8stage_index_ptr = u8current_stage + 1;
+    *a_u8stages_number_ptr = g_u8stages_number;
+    return &g_stages_arr[u8current_stage];
+}
@@ -0,0 +1,143 @@
+/*******************************************************************************
+ *
+ * File:                sequence.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes, structures and
+ *                      definitions of cooking sequence engine that runs the
+ *                      heating process as ordered list of stages.
+ *
+ * Revision history:    4/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef SEQUENCE_H
+#define	SEQUENCE_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* max. number of stages in one heating process */
+#define SEQUENCE_MAX_STAGES                 4u
+/* fan duty value that makes the fan follow the temperature selected by the user */
+#define SEQUENCE_FAN_FROM_TEMPERATURE       0xFFu
+/* heater power level of normal heating process (percentage) */
+#define SEQUENCE_FULL_POWER                 100u
+/* max. total time of stages in seconds, it's the max. time of the display (99:59) */
+#define SEQUENCE_MAX_TOTAL_TIME             5999u
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/*************************** StrSequence_stage_t *******************************/
+typedef struct{
+    uint16 u16duration;                 /* stage time in seconds */
+    uint8  u8heater_power;              /* heater power level from 0 to 100 % */
+    uint8  u8fan_duty;                  /* fan duty from 0 to 100 % or SEQUENCE_FAN_FROM_TEMPERATURE */
+}StrSequence_stage_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Sequence_load
+ *
+ * Description: 	copy list of stages (from program flash or RAM) to be the
+ *                  stages of the next heating process.
+ *                  note: stages over SEQUENCE_MAX_STAGES are ignored.
+ *                  note: the stages are cut at SEQUENCE_MAX_TOTAL_TIME, the
+ *                        stage which passes it is shortened and the stages
+ *                        after it are ignored.
+ *
+ * Inputs:			a_stages_ptr      (const StrSequence_stage_t*)
+ *                  a_u8stages_number (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			total time of the loaded stages in seconds (uint16)
+ *******************************************************************************/
+extern uint16 Sequence_load(const StrSequence_stage_t * a_stages_ptr , uint8 a_u8stages_number);
+
+/*******************************************************************************
+ * Function Name:	Sequence_load_single_stage
+ *
+ * Description: 	make the next heating process as one stage with the time
+ *                  inserted by the user at full heater power and the fan
+ *                  follows the selected temperature.
+ *
+ * Inputs:			a_u16duration     (uint16) time in seconds
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sequence_load_single_stage(uint16 a_u16duration);
+
+/*******************************************************************************
+ * Function Name:	Sequence_start
+ *
+ * Description: 	start the loaded stages from the first stage.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sequence_start(void);
+
+/*******************************************************************************
+ * Function Name:	Sequence_tick
+ *
+ * Description: 	count one second of the current stage and move to the next
+ *                  stage automatically when the current stage finishes.
+ *                  note: it is called from one second timer interrupt.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sequence_tick(void);
+
+/*******************************************************************************
+ * Function Name:	Sequence_stage_changed
+ *
+ * Description: 	check if the engine moved to new stage since the last call
+ *                  to apply this stage outputs.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if new stage is started, FALSE otherwise (uint8)
+ *******************************************************************************/
+extern uint8 Sequence_stage_changed(void);
+
+/*******************************************************************************
+ * Function Name:	Sequence_get_current_stage
+ *
+ * Description: 	get the current running stage.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u8stage_index_ptr   (uint8*) number of stage starts from 1
+ *                  a_u8stages_number_ptr (uint8*) number of loaded stages
+ *
+ * Return:			pointer to current stage (const StrSequence_stage_t*)
+ *******************************************************************************/
+extern const StrSequence_stage_t * Sequence_get_current_stage(uint8 * a_u8stage_index_ptr , uint8 * a_u8stages_number_ptr);
+
+#endif	/* SEQUENCE_H */
+
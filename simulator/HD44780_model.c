@@ -0,0 +1,596 @@
+/*******************************************************************************
+ *
+ * File:                HD44780_model.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of simulated
+ *                      HD44780 LCD controller, transfers are latched on the
+ *                      falling edge of E pin in 8 bits or 4 bits interface
+ *                      as the real controller.
+ *
+ * Revision history:    8/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include <stdio.h>
+#include "HD44780_model.h"
+#include "simulator.h"
+#include "LCD_config.h"
+#include "helped_macros.h"
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+static StrHD44780_state_t g_lcd_state;
+static StrHD44780_counters_t g_lcd_counters;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	HD44780_write_callback
+ *
+ * Description: 	check E pin after every register change of the firmware
+ *                  and latch the transfer on its falling edge.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *                  a_u8old_value     (uint8)
+ *                  a_u8new_value     (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void HD44780_write_callback(uint16 a_u16address , uint8 a_u8old_value , uint8 a_u8new_value);
+
+/*******************************************************************************
+ * Function Name:	HD44780_execute
+ *
+ * Description: 	execute complete 8 bits instruction or data write.
+ *
+ * Inputs:			a_u8register_select   (uint8) LOW for instruction, HIGH for data
+ *                  a_u8value             (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void HD44780_execute(uint8 a_u8register_select , uint8 a_u8value);
+
+/*******************************************************************************
+ * Function Name:	HD44780_move_address_counter
+ *
+ * Description: 	increase or decrease DDRAM or CGRAM address after write
+ *                  depend on entry mode.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void HD44780_move_address_counter(void);
+
+/*******************************************************************************
+ * Function Name:	HD44780_ddram_index
+ *
+ * Description: 	convert DDRAM address to index in DDRAM array.
+ *
+ * Inputs:			a_u8address       (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			index from 0 to 79 (uint8)
+ *******************************************************************************/
+static uint8 HD44780_ddram_index(uint8 a_u8address);
+
+/* the model is attached to the register file by this structure */
+static const StrSim_peripheral_t g_lcd_peripheral = {HD44780_write_callback , NULL_PTR};
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	HD44780_Initialization
+ *
+ * Description: 	reset the LCD controller to its power on state and attach
+ *                  it to the simulator register file.
+ *                  note: it should be called after Sim_Initialization.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void HD44780_Initialization(void)
+{
+    /* internal reset: display clear, 8 bits interface, one line, display off */
+    for(uint8 u8counter = 0 ; u8counter < HD44780_DDRAM_SIZE ; u8counter++)
+    {
+        g_lcd_state.u8ddram_arr[u8counter] = ' ';
+    }
+    for(uint8 u8counter = 0 ; u8counter < HD44780_CGRAM_SIZE ; u8counter++)
+    {
+        g_lcd_state.u8cgram_arr[u8counter] = 0;
+    }
+    g_lcd_state.u8address_counter = 0;
+    g_lcd_state.u8cgram_selected = FALSE;
+    g_lcd_state.u8increment = TRUE;
+    g_lcd_state.u8shift_on_write = FALSE;
+    g_lcd_state.u8display_on = FALSE;
+    g_lcd_state.u8cursor_on = FALSE;
+    g_lcd_state.u8blink_on = FALSE;
+    g_lcd_state.u8eight_bit_mode = TRUE;
+    g_lcd_state.u8two_lines = FALSE;
+    g_lcd_state.u8display_shift = 0;
+    g_lcd_state.u8second_nibble = FALSE;
+    g_lcd_state.u8high_nibble = 0;
+    g_lcd_state.u8enable_level = GET_BIT(Sim_get_pin_levels(LCD_ORDER_PORT) , LCD_E_PIN);
+    g_lcd_state.u64busy_end_time = 0;
+    HD44780_reset_counters();
+    Sim_add_peripheral(&g_lcd_peripheral);
+}
+
+/*******************************************************************************
+ * Function Name:	HD44780_get_character
+ *
+ * Description: 	get character code which is visible in LCD position.
+ *
+ * Inputs:			a_u8row           (uint8) from 0 to 3
+ *                  a_u8column        (uint8) from 0 to 15
+ *
+ * Outputs:			NULL
+ *
+ * Return:			character code, space if the display is off (uint8)
+ *******************************************************************************/
+uint8 HD44780_get_character(uint8 a_u8row , uint8 a_u8column)
+{
+    uint8 retVal = ' ';
+    /* position of the character in its DDRAM line */
+    uint8 u8line_position = 0;
+    if(g_lcd_state.u8display_on == TRUE && a_u8row < HD44780_ROWS && a_u8column < HD44780_COLUMNS)
+    {
+        if(g_lcd_state.u8two_lines == TRUE)
+        {
+            /* rows 3 and 4 of 16x4 LCD are the continuation of lines 1 and 2 */
+            u8line_position = (a_u8column + (a_u8row / 2) * HD44780_COLUMNS +
+                    g_lcd_state.u8display_shift) % HD44780_LINE_SIZE;
+            retVal = g_lcd_state.u8ddram_arr[(a_u8row % 2) * HD44780_LINE_SIZE + u8line_position];
+        }
+        else
+        {
+            u8line_position = (a_u8column + a_u8row * HD44780_COLUMNS +
+                    g_lcd_state.u8display_shift) % HD44780_DDRAM_SIZE;
+            retVal = g_lcd_state.u8ddram_arr[u8line_position];
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	HD44780_get_row_text
+ *
+ * Description: 	get visible text of LCD row, not printable characters
+ *                  (as CGRAM characters) are replaced by HD44780_NOT_PRINTABLE.
+ *
+ * Inputs:			a_u8row           (uint8) from 0 to 3
+ *
+ * Outputs:			a_u8text_ptr      (uint8*) buffer of HD44780_COLUMNS + 1
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void HD44780_get_row_text(uint8 a_u8row , uint8 * a_u8text_ptr)
+{
+    uint8 u8character = 0;
+    for(uint8 u8column = 0 ; u8column < HD44780_COLUMNS ; u8column++)
+    {
+        u8character = HD44780_get_character(a_u8row , u8column);
+        if(u8character < ' ' || u8character > '}')
+        {
+            u8character = HD44780_NOT_PRINTABLE;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        a_u8text_ptr[u8column] = u8character;
+    }
+    a_u8text_ptr[HD44780_COLUMNS] = '\0';
+}
+
+/*******************************************************************************
+ * Function Name:	HD44780_print_screen
+ *
+ * Description: 	print the visible screen in frame on standard output.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void HD44780_print_screen(void)
+{
+    uint8 u8text_arr[HD44780_COLUMNS + 1];
+    printf("+----------------+\n");
+    for(uint8 u8row = 0 ; u8row < HD44780_ROWS ; u8row++)
+    {
+        HD44780_get_row_text(u8row , u8text_arr);
+        printf("|%s|\n" , (char*)u8text_arr);
+    }
+    printf("+----------------+\n");
+}
+
+/*******************************************************************************
+ * Function Name:	HD44780_get_state
+ *
+ * Description: 	get internal state of the LCD controller (memories,
+ *                  cursor and display control).
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			pointer to the state (const StrHD44780_state_t*)
+ *******************************************************************************/
+const StrHD44780_state_t * HD44780_get_state(void)
+{
+    return &g_lcd_state;
+}
+
+/*******************************************************************************
+ * Function Name:	HD44780_get_counters
+ *
+ * Description: 	get traffic counters of the LCD since the last reset of
+ *                  counters to measure cost of screens redraw.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_counters_ptr    (StrHD44780_counters_t*)
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void HD44780_get_counters(StrHD44780_counters_t * a_counters_ptr)
+{
+    *a_counters_ptr = g_lcd_counters;
+}
+
+/*******************************************************************************
+ * Function Name:	HD44780_reset_counters
+ *
+ * Description: 	reset traffic counters of the LCD.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void HD44780_reset_counters(void)
+{
+    g_lcd_counters.u32enable_strobes = 0;
+    g_lcd_counters.u32commands = 0;
+    g_lcd_counters.u32data_writes = 0;
+    g_lcd_counters.u32busy_violations = 0;
+    g_lcd_counters.u32hidden_writes = 0;
+}
+
+/*******************************************************************************
+ * Function Name:	HD44780_write_callback
+ *
+ * Description: 	check E pin after every register change of the firmware
+ *                  and latch the transfer on its falling edge.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *                  a_u8old_value     (uint8)
+ *                  a_u8new_value     (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void HD44780_write_callback(uint16 a_u16address , uint8 a_u8old_value , uint8 a_u8new_value)
+{
+    /* levels of control pins */
+    uint8 u8control_levels = 0;
+    /* level of data bus pins */
+    uint8 u8data_bus = 0;
+    /* E pin changes only by its latch or direction */
+    if(a_u16address == SIM_LATCH_ADDRESS(LCD_ORDER_PORT) || a_u16address == SIM_DIRECTION_ADDRESS(LCD_ORDER_PORT))
+    {
+        u8control_levels = Sim_get_pin_levels(LCD_ORDER_PORT);
+        if(g_lcd_state.u8enable_level == HIGH && GET_BIT(u8control_levels , LCD_E_PIN) == LOW)
+        {
+            g_lcd_counters.u32enable_strobes++;
+            u8data_bus = Sim_get_pin_levels(LCD_DATA_PORT);
+/* LCD pins D0-D3 aren't connected in 4 bits wiring */
+#if LCD_MODE == LCD_4BITS_MODE
+            u8data_bus &= 0xF0;
+#endif
+            /* read operations (busy flag) don't change the controller */
+            if(GET_BIT(u8control_levels , LCD_RW_PIN) == LOW)
+            {
+                if(g_lcd_state.u8eight_bit_mode == TRUE)
+                {
+                    HD44780_execute(GET_BIT(u8control_levels , LCD_RS_PIN) , u8data_bus);
+                }
+                else if(g_lcd_state.u8second_nibble == FALSE)
+                {
+                    g_lcd_state.u8high_nibble = u8data_bus & 0xF0;
+                    g_lcd_state.u8second_nibble = TRUE;
+                }
+                else
+                {
+                    g_lcd_state.u8second_nibble = FALSE;
+                    HD44780_execute(GET_BIT(u8control_levels , LCD_RS_PIN) ,
+                            g_lcd_state.u8high_nibble | (u8data_bus >> 4));
+                }
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        g_lcd_state.u8enable_level = GET_BIT(u8control_levels , LCD_E_PIN);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	HD44780_execute
+ *
+ * Description: 	execute complete 8 bits instruction or data write.
+ *
+ * Inputs:			a_u8register_select   (uint8) LOW for instruction, HIGH for data
+ *                  a_u8value             (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void HD44780_execute(uint8 a_u8register_select , uint8 a_u8value)
+{
+    uint64 u64time = Sim_get_time_us();
+    /* execution time of this instruction */
+    uint32 u32execution_time = HD44780_INSTRUCTION_TIME;
+    /* direction of entry mode while moving the cursor */
+    uint8 u8entry_increment = 0;
+    /* index of written character in DDRAM array */
+    uint8 u8index = 0;
+    /* the controller ignores transfers while it executes the last instruction */
+    if(u64time < g_lcd_state.u64busy_end_time)
+    {
+        g_lcd_counters.u32busy_violations++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    if(a_u8register_select == HIGH)
+    {
+        g_lcd_counters.u32data_writes++;
+        if(g_lcd_state.u8cgram_selected == TRUE)
+        {
+            /* characters are 5 pixels width */
+            g_lcd_state.u8cgram_arr[g_lcd_state.u8address_counter % HD44780_CGRAM_SIZE] = a_u8value & 0x1F;
+        }
+        else
+        {
+            u8index = HD44780_ddram_index(g_lcd_state.u8address_counter);
+            g_lcd_state.u8ddram_arr[u8index] = a_u8value;
+            /* 16x4 screen shows 32 characters of every line in two lines mode */
+            if((g_lcd_state.u8two_lines == TRUE &&
+                    (u8index % HD44780_LINE_SIZE + HD44780_LINE_SIZE - g_lcd_state.u8display_shift) % HD44780_LINE_SIZE >= 2 * HD44780_COLUMNS) ||
+                    (g_lcd_state.u8two_lines == FALSE &&
+                    (u8index + HD44780_DDRAM_SIZE - g_lcd_state.u8display_shift) % HD44780_DDRAM_SIZE >= HD44780_ROWS * HD44780_COLUMNS))
+            {
+                g_lcd_counters.u32hidden_writes++;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            if(g_lcd_state.u8shift_on_write == TRUE)
+            {
+                g_lcd_state.u8display_shift = (g_lcd_state.u8increment == TRUE) ?
+                        (g_lcd_state.u8display_shift + 1) % HD44780_LINE_SIZE :
+                        (g_lcd_state.u8display_shift + HD44780_LINE_SIZE - 1) % HD44780_LINE_SIZE;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        HD44780_move_address_counter();
+    }
+    else
+    {
+        g_lcd_counters.u32commands++;
+        /* instruction is selected by its highest set bit */
+        if(a_u8value & 0x80)
+        {
+            /* set DDRAM address */
+            g_lcd_state.u8address_counter = a_u8value & 0x7F;
+            g_lcd_state.u8cgram_selected = FALSE;
+        }
+        else if(a_u8value & 0x40)
+        {
+            /* set CGRAM address */
+            g_lcd_state.u8address_counter = a_u8value & 0x3F;
+            g_lcd_state.u8cgram_selected = TRUE;
+        }
+        else if(a_u8value & 0x20)
+        {
+            /* function set, the next transfer starts by high nibble */
+            g_lcd_state.u8eight_bit_mode = GET_BIT(a_u8value , 4);
+            g_lcd_state.u8two_lines = GET_BIT(a_u8value , 3);
+            g_lcd_state.u8second_nibble = FALSE;
+        }
+        else if(a_u8value & 0x10)
+        {
+            /* cursor or display shift */
+            if(GET_BIT(a_u8value , 3))
+            {
+                g_lcd_state.u8display_shift = GET_BIT(a_u8value , 2) ?
+                        (g_lcd_state.u8display_shift + HD44780_LINE_SIZE - 1) % HD44780_LINE_SIZE :
+                        (g_lcd_state.u8display_shift + 1) % HD44780_LINE_SIZE;
+            }
+            else
+            {
+                /* cursor moves as after write in the selected direction */
+                u8entry_increment = g_lcd_state.u8increment;
+                g_lcd_state.u8increment = GET_BIT(a_u8value , 2);
+                HD44780_move_address_counter();
+                g_lcd_state.u8increment = u8entry_increment;
+            }
+        }
+        else if(a_u8value & 0x08)
+        {
+            /* display on/off control */
+            g_lcd_state.u8display_on = GET_BIT(a_u8value , 2);
+            g_lcd_state.u8cursor_on = GET_BIT(a_u8value , 1);
+            g_lcd_state.u8blink_on = GET_BIT(a_u8value , 0);
+        }
+        else if(a_u8value & 0x04)
+        {
+            /* entry mode set */
+            g_lcd_state.u8increment = GET_BIT(a_u8value , 1);
+            g_lcd_state.u8shift_on_write = GET_BIT(a_u8value , 0);
+        }
+        else if(a_u8value & 0x02)
+        {
+            /* return home */
+            g_lcd_state.u8address_counter = 0;
+            g_lcd_state.u8cgram_selected = FALSE;
+            g_lcd_state.u8display_shift = 0;
+            u32execution_time = HD44780_CLEAR_TIME;
+        }
+        else if(a_u8value & 0x01)
+        {
+            /* clear display */
+            for(uint8 u8counter = 0 ; u8counter < HD44780_DDRAM_SIZE ; u8counter++)
+            {
+                g_lcd_state.u8ddram_arr[u8counter] = ' ';
+            }
+            g_lcd_state.u8address_counter = 0;
+            g_lcd_state.u8cgram_selected = FALSE;
+            g_lcd_state.u8display_shift = 0;
+            g_lcd_state.u8increment = TRUE;
+            u32execution_time = HD44780_CLEAR_TIME;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    g_lcd_state.u64busy_end_time = u64time + u32execution_time;
+}
+
+/*******************************************************************************
+ * Function Name:	HD44780_move_address_counter
+ *
+ * Description: 	increase or decrease DDRAM or CGRAM address after write
+ *                  depend on entry mode.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void HD44780_move_address_counter(void)
+{
+    uint8 u8address = g_lcd_state.u8address_counter;
+    if(g_lcd_state.u8cgram_selected == TRUE)
+    {
+        u8address = (g_lcd_state.u8increment == TRUE) ? u8address + 1 : u8address - 1;
+        u8address &= HD44780_CGRAM_SIZE - 1;
+    }
+    else if(g_lcd_state.u8two_lines == TRUE)
+    {
+        /* end of the first line continues in the second line and vice versa */
+        if(g_lcd_state.u8increment == TRUE)
+        {
+            u8address++;
+            if(u8address == HD44780_LINE_SIZE)
+            {
+                u8address = HD44780_SECOND_LINE_ADDRESS;
+            }
+            else if(u8address == HD44780_SECOND_LINE_ADDRESS + HD44780_LINE_SIZE)
+            {
+                u8address = 0;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else
+        {
+            if(u8address == 0)
+            {
+                u8address = HD44780_SECOND_LINE_ADDRESS + HD44780_LINE_SIZE - 1;
+            }
+            else if(u8address == HD44780_SECOND_LINE_ADDRESS)
+            {
+                u8address = HD44780_LINE_SIZE - 1;
+            }
+            else
+            {
+                u8address--;
+            }
+        }
+    }
+    else
+    {
+        u8address = (g_lcd_state.u8increment == TRUE) ?
+                (u8address + 1) % HD44780_DDRAM_SIZE :
+                (u8address + HD44780_DDRAM_SIZE - 1) % HD44780_DDRAM_SIZE;
+    }
+    g_lcd_state.u8address_counter = u8address;
+}
+
+/*******************************************************************************
+ * Function Name:	HD44780_ddram_index
+ *
+ * Description: 	convert DDRAM address to index in DDRAM array.
+ *
+ * Inputs:			a_u8address       (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			index from 0 to 79 (uint8)
+ *******************************************************************************/
+static uint8 HD44780_ddram_index(uint8 a_u8address)
+{
+    uint8 retVal = 0;
+    if(g_lcd_state.u8two_lines == TRUE)
+    {
+        /* addresses out of the lines wrap inside the line */
+        retVal = ((a_u8address & HD44780_SECOND_LINE_ADDRESS) ? HD44780_LINE_SIZE : 0) +
+                (a_u8address & (HD44780_SECOND_LINE_ADDRESS - 1)) % HD44780_LINE_SIZE;
+    }
+    else
+    {
+        retVal = a_u8address % HD44780_DDRAM_SIZE;
+    }
+    return retVal;
+}
@@ -0,0 +1,178 @@
+/*******************************************************************************
+ *
+ * File:                HD44780_model.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes, structures and
+ *                      definitions of simulated HD44780 LCD controller which
+ *                      is connected to the pins selected in LCD_config.h.
+ *
+ * Revision history:    8/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef HD44780_MODEL_H
+#define	HD44780_MODEL_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* visible screen of 16x4 LCD */
+#define HD44780_ROWS                        4u
+#define HD44780_COLUMNS                     16u
+/* display data RAM is two lines of 40 characters (or one line of 80) */
+#define HD44780_DDRAM_SIZE                  80u
+#define HD44780_LINE_SIZE                   40u
+#define HD44780_SECOND_LINE_ADDRESS         0x40u
+/* character generator RAM has 8 characters of 8 rows */
+#define HD44780_CGRAM_SIZE                  64u
+/* execution time of instructions in us */
+#define HD44780_CLEAR_TIME                  1520u
+#define HD44780_INSTRUCTION_TIME            37u
+/* character displayed in screen text instead of not printable character */
+#define HD44780_NOT_PRINTABLE               '?'
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/************************** StrHD44780_counters_t ******************************/
+typedef struct{
+    uint32 u32enable_strobes;           /* falling edges of E pin */
+    uint32 u32commands;                 /* executed instructions */
+    uint32 u32data_writes;              /* characters written in DDRAM or CGRAM */
+    uint32 u32busy_violations;          /* transfers before the last instruction finished */
+    uint32 u32hidden_writes;            /* characters written out of the visible screen */
+}StrHD44780_counters_t;
+
+/*************************** StrHD44780_state_t ********************************/
+typedef struct{
+    uint8  u8ddram_arr[HD44780_DDRAM_SIZE];
+    uint8  u8cgram_arr[HD44780_CGRAM_SIZE];
+    uint8  u8address_counter;           /* DDRAM or CGRAM address */
+    uint8  u8cgram_selected;            /* TRUE if data writes go to CGRAM */
+    uint8  u8increment;                 /* TRUE if address counter increases after write */
+    uint8  u8shift_on_write;            /* TRUE if display shifts after write */
+    uint8  u8display_on;
+    uint8  u8cursor_on;
+    uint8  u8blink_on;
+    uint8  u8eight_bit_mode;            /* interface data length */
+    uint8  u8two_lines;
+    uint8  u8display_shift;             /* display shift from 0 to 39 */
+    uint8  u8second_nibble;             /* TRUE if the next 4 bits transfer is the low nibble */
+    uint8  u8high_nibble;               /* first nibble of 4 bits transfer */
+    uint8  u8enable_level;              /* last level of E pin */
+    uint64 u64busy_end_time;            /* time in us when the last instruction finishes */
+}StrHD44780_state_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	HD44780_Initialization
+ *
+ * Description: 	reset the LCD controller to its power on state and attach
+ *                  it to the simulator register file.
+ *                  note: it should be called after Sim_Initialization.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void HD44780_Initialization(void);
+
+/*******************************************************************************
+ * Function Name:	HD44780_get_character
+ *
+ * Description: 	get character code which is visible in LCD position.
+ *
+ * Inputs:			a_u8row           (uint8) from 0 to 3
+ *                  a_u8column        (uint8) from 0 to 15
+ *
+ * Outputs:			NULL
+ *
+ * Return:			character code, space if the display is off (uint8)
+ *******************************************************************************/
+extern uint8 HD44780_get_character(uint8 a_u8row , uint8 a_u8column);
+
+/*******************************************************************************
+ * Function Name:	HD44780_get_row_text
+ *
+ * Description: 	get visible text of LCD row, not printable characters
+ *                  (as CGRAM characters) are replaced by HD44780_NOT_PRINTABLE.
+ *
+ * Inputs:			a_u8row           (uint8) from 0 to 3
+ *
+ * Outputs:			a_u8text_ptr      (uint8*) buffer of HD44780_COLUMNS + 1
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void HD44780_get_row_text(uint8 a_u8row , uint8 * a_u8text_ptr);
+
+/*******************************************************************************
+ * Function Name:	HD44780_print_screen
+ *
+ * Description: 	print the visible screen in frame on standard output.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void HD44780_print_screen(void);
+
+/*******************************************************************************
+ * Function Name:	HD44780_get_state
+ *
+ * Description: 	get internal state of the LCD controller (memories,
+ *                  cursor and display control).
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			pointer to the state (const StrHD44780_state_t*)
+ *******************************************************************************/
+extern const StrHD44780_state_t * HD44780_get_state(void);
+
+/*******************************************************************************
+ * Function Name:	HD44780_get_counters
+ *
+ * Description: 	get traffic counters of the LCD since the last reset of
+ *                  counters to measure cost of screens redraw.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_counters_ptr    (StrHD44780_counters_t*)
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void HD44780_get_counters(StrHD44780_counters_t * a_counters_ptr);
+
+/*******************************************************************************
+ * Function Name:	HD44780_reset_counters
+ *
+ * Description: 	reset traffic counters of the LCD.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void HD44780_reset_counters(void);
+
+#endif	/* HD44780_MODEL_H */
+
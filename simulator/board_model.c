@@ -0,0 +1,490 @@
+/*******************************************************************************
+ *
+ * File:                board_model.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of simulated
+ *                      microwave board, KeyPad keys connect row pins to column
+ *                      pins as the real switches matrix so any scanning method
+ *                      of the firmware reads them correctly, the matrix has
+ *                      no diodes so pressed keys make ghosting keys.
+ *
+ * Revision history:    10/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "board_model.h"
+#include "simulator.h"
+#include "peripherals_model.h"
+#include "microwave.h"
+#include "KeyPad_config.h"
+#include "PWM_MemMap.h"
+#include "timers_MemMap.h"
+#include "helped_macros.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* registers addresses, models access the register file directly */
+#define BOARD_CCP1_VALUE_ADDRESS            0xFBEu
+#define BOARD_CCP1_CONTROL_ADDRESS          0xFBDu
+#define BOARD_TIMER2_PERIOD_ADDRESS         0xFCBu
+#define BOARD_TIMER2_CONTROL_ADDRESS        0xFCAu
+#define BOARD_CCP2_CONTROL_ADDRESS          0xFBAu
+#define BOARD_INTCON_ADDRESS                0xFF2u
+/* CCP2 in compare toggle mode makes tone on the buzzer pin */
+#define BOARD_CCP_MODE_MASK                 0x0Fu
+#define BOARD_CCP_COMPARE_TOGGLE            0x02u
+/* RBIF flag of INTCON is set when levels of RB7:RB4 pins mismatch their
+ * levels at the last read of PORT B */
+#define BOARD_PORT_CHANGE_FLAG_BIT          0u
+#define BOARD_PORT_CHANGE_PINS              ((1u << DOOR_SENSOR_PIN) | (1u << WEIGHT_SENSOR_PIN))
+/* keys of the fourth column and the fourth row exist in some KeyPad types only */
+#if KEYPAD_TYPE == KEYPAD_3x4_TYPE || KEYPAD_TYPE == KEYPAD_4x4_TYPE
+#define BOARD_R1_C4                         R1_C4
+#define BOARD_R2_C4                         R2_C4
+#define BOARD_R3_C4                         R3_C4
+#else
+#define BOARD_R1_C4                         BOARD_NO_KEY
+#define BOARD_R2_C4                         BOARD_NO_KEY
+#define BOARD_R3_C4                         BOARD_NO_KEY
+#endif
+#if KEYPAD_TYPE == KEYPAD_4x3_TYPE || KEYPAD_TYPE == KEYPAD_4x4_TYPE
+#define BOARD_R4_C1                         R4_C1
+#define BOARD_R4_C2                         R4_C2
+#define BOARD_R4_C3                         R4_C3
+#else
+#define BOARD_R4_C1                         BOARD_NO_KEY
+#define BOARD_R4_C2                         BOARD_NO_KEY
+#define BOARD_R4_C3                         BOARD_NO_KEY
+#endif
+#if KEYPAD_TYPE == KEYPAD_4x4_TYPE
+#define BOARD_R4_C4                         R4_C4
+#else
+#define BOARD_R4_C4                         BOARD_NO_KEY
+#endif
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* key values of KeyPad matrix from KeyPad configurations */
+static const uint8 g_u8keys_arr[BOARD_MAX_ROWS][BOARD_MAX_COLUMNS] = {
+    {R1_C1       , R1_C2       , R1_C3       , BOARD_R1_C4},
+    {R2_C1       , R2_C2       , R2_C3       , BOARD_R2_C4},
+    {R3_C1       , R3_C2       , R3_C3       , BOARD_R3_C4},
+    {BOARD_R4_C1 , BOARD_R4_C2 , BOARD_R4_C3 , BOARD_R4_C4}
+};
+/* pressed keys */
+static uint8 g_u8pressed_arr[BOARD_MAX_ROWS][BOARD_MAX_COLUMNS];
+/* pressed push buttons */
+static uint8 g_u8door_pressed = FALSE;
+static uint8 g_u8weight_pressed = FALSE;
+/* real state of the door which is toggled by door button */
+static uint8 g_u8door_open = FALSE;
+static uint8 g_u8door_locked = FALSE;
+/* levels of push buttons pins at the last read of PORT B */
+static uint8 g_u8port_change_levels = BOARD_PORT_CHANGE_PINS;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Board_read_callback
+ *
+ * Description: 	calculate levels of KeyPad columns and push buttons pins
+ *                  before the firmware reads their port.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Board_read_callback(uint16 a_u16address);
+
+/*******************************************************************************
+ * Function Name:	Board_get_buttons_levels
+ *
+ * Description: 	calculate levels of push buttons pins, pressed button
+ *                  pulls its pin down.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			levels of PORT B with push buttons pins only (uint8)
+ *******************************************************************************/
+static uint8 Board_get_buttons_levels(void);
+
+/* the board is attached to the register file by this structure */
+static const StrSim_peripheral_t g_board_peripheral = {NULL_PTR , Board_read_callback};
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Board_Initialization
+ *
+ * Description: 	release all keys and buttons and attach the board to the
+ *                  simulator register file.
+ *                  note: it should be called after Sim_Initialization.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Board_Initialization(void)
+{
+    for(uint8 u8row = 0 ; u8row < BOARD_MAX_ROWS ; u8row++)
+    {
+        for(uint8 u8column = 0 ; u8column < BOARD_MAX_COLUMNS ; u8column++)
+        {
+            g_u8pressed_arr[u8row][u8column] = FALSE;
+        }
+    }
+    g_u8door_pressed = FALSE;
+    g_u8weight_pressed = FALSE;
+    g_u8door_open = FALSE;
+    g_u8door_locked = FALSE;
+    g_u8port_change_levels = BOARD_PORT_CHANGE_PINS;
+    Sim_add_peripheral(&g_board_peripheral);
+}
+
+/*******************************************************************************
+ * Function Name:	Board_set_key
+ *
+ * Description: 	press or release KeyPad key.
+ *
+ * Inputs:			a_u8key_value     (uint8) value returned by KeyPad driver
+ *                                    for this key (0-9 , '*' , '#')
+ *                  a_u8pressed       (uint8) TRUE to press, FALSE to release
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the key exists in the KeyPad, FALSE otherwise (uint8)
+ *******************************************************************************/
+uint8 Board_set_key(uint8 a_u8key_value , uint8 a_u8pressed)
+{
+    uint8 retVal = FALSE;
+    for(uint8 u8row = 0 ; u8row < N_ROW ; u8row++)
+    {
+        for(uint8 u8column = 0 ; u8column < N_COL ; u8column++)
+        {
+            if(g_u8keys_arr[u8row][u8column] == a_u8key_value)
+            {
+                g_u8pressed_arr[u8row][u8column] = a_u8pressed;
+                retVal = TRUE;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Board_set_button
+ *
+ * Description: 	press or release door or weight push button.
+ *
+ * Inputs:			a_button_t        (EnumBoard_button_t)
+ *                  a_u8pressed       (uint8) TRUE to press, FALSE to release
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Board_set_button(EnumBoard_button_t a_button_t , uint8 a_u8pressed)
+{
+    if(a_button_t == BOARD_DOOR_BUTTON)
+    {
+        /* the door changes its state when the button is pressed */
+        if(a_u8pressed == TRUE && g_u8door_pressed == FALSE && g_u8door_locked == FALSE)
+        {
+            g_u8door_open = !g_u8door_open;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        g_u8door_pressed = a_u8pressed;
+    }
+    else
+    {
+        g_u8weight_pressed = a_u8pressed;
+    }
+    /* interrupt on change flag is set when the pin mismatches its last read level */
+    if(Board_get_buttons_levels() != g_u8port_change_levels)
+    {
+        Sim_write_register(BOARD_INTCON_ADDRESS , Sim_read_register(BOARD_INTCON_ADDRESS) | (1u << BOARD_PORT_CHANGE_FLAG_BIT));
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Board_set_door_lock
+ *
+ * Description: 	lock or unlock the door, presses of door button don't
+ *                  open the locked door (as the door is locked in heating).
+ *
+ * Inputs:			a_u8locked        (uint8) TRUE to lock, FALSE to unlock
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Board_set_door_lock(uint8 a_u8locked)
+{
+    g_u8door_locked = a_u8locked;
+}
+
+/*******************************************************************************
+ * Function Name:	Board_set_pot_voltage
+ *
+ * Description: 	set voltage of potentiometer which selects the temperature.
+ *
+ * Inputs:			a_u16voltage      (uint16) voltage in mV from 0 to 5000
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Board_set_pot_voltage(uint16 a_u16voltage)
+{
+    Model_ADC_set_voltage(BOARD_POT_CHANNEL , a_u16voltage);
+}
+
+/*******************************************************************************
+ * Function Name:	Board_get_heater
+ *
+ * Description: 	get state of the heater output.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the heater is on, FALSE otherwise (uint8)
+ *******************************************************************************/
+uint8 Board_get_heater(void)
+{
+    return !GET_BIT(Sim_read_register(SIM_DIRECTION_ADDRESS(HEATER_PORT)) , HEATER_PIN) &&
+            GET_BIT(Sim_get_pin_levels(HEATER_PORT) , HEATER_PIN);
+}
+
+/*******************************************************************************
+ * Function Name:	Board_get_led
+ *
+ * Description: 	get state of the LED output.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the LED is on, FALSE otherwise (uint8)
+ *******************************************************************************/
+uint8 Board_get_led(void)
+{
+    return !GET_BIT(Sim_read_register(SIM_DIRECTION_ADDRESS(LED_PORT)) , LED_PIN) &&
+            GET_BIT(Sim_get_pin_levels(LED_PORT) , LED_PIN);
+}
+
+/*******************************************************************************
+ * Function Name:	Board_get_buzzer
+ *
+ * Description: 	get state of the buzzer output (it is active low), the tone
+ *                  of CCP2 toggles the pin so the buzzer is on while it runs.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the buzzer is on, FALSE otherwise (uint8)
+ *******************************************************************************/
+uint8 Board_get_buzzer(void)
+{
+    return !GET_BIT(Sim_read_register(SIM_DIRECTION_ADDRESS(BUZZER_PORT)) , BUZZER_PIN) &&
+            (!GET_BIT(Sim_get_pin_levels(BUZZER_PORT) , BUZZER_PIN) ||
+             (Sim_read_register(BOARD_CCP2_CONTROL_ADDRESS) & BOARD_CCP_MODE_MASK) == BOARD_CCP_COMPARE_TOGGLE);
+}
+
+/*******************************************************************************
+ * Function Name:	Board_get_fan_duty
+ *
+ * Description: 	get duty cycle of the fan from CCP1 PWM registers.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			duty cycle from 0 to 100 %, 0 if PWM is stopped (uint8)
+ *******************************************************************************/
+uint8 Board_get_fan_duty(void)
+{
+    uint8 retVal = 0;
+    uint8 u8control = Sim_read_register(BOARD_CCP1_CONTROL_ADDRESS);
+    /* 10 bits duty value and its value at 100 % duty */
+    uint32 u32duty_value = 0;
+    uint32 u32period_value = 0;
+    /* PWM mode is 11xx and timer 2 should run */
+    if(GET_BIT(u8control , CAPTURE_COMPARE_PWM_1_SELECT_MODE_BIT_3) &&
+            GET_BIT(u8control , CAPTURE_COMPARE_PWM_1_SELECT_MODE_BIT_2) &&
+            GET_BIT(Sim_read_register(BOARD_TIMER2_CONTROL_ADDRESS) , TIMER_2_ON_OFF_BIT))
+    {
+        u32duty_value = ((uint32)Sim_read_register(BOARD_CCP1_VALUE_ADDRESS) << 2) |
+                ((u8control >> PWM_1_DUTY_CYCLE_BIT_0) & 0x03);
+        u32period_value = ((uint32)Sim_read_register(BOARD_TIMER2_PERIOD_ADDRESS) + 1) << 2;
+        retVal = (u32duty_value >= u32period_value) ? 100 : (uint8)(u32duty_value * 100 / u32period_value);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Board_get_door_open
+ *
+ * Description: 	get the real state of the door, the door button toggles it
+ *                  on every press as the firmware does.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the door is opened, FALSE otherwise (uint8)
+ *******************************************************************************/
+uint8 Board_get_door_open(void)
+{
+    return g_u8door_open;
+}
+
+/*******************************************************************************
+ * Function Name:	Board_read_callback
+ *
+ * Description: 	calculate levels of KeyPad columns and push buttons pins
+ *                  before the firmware reads their port.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Board_read_callback(uint16 a_u16address)
+{
+    /* pull up resistors keep the inputs high when nothing pulls them down */
+    uint8 u8levels = 0xFF;
+    uint8 u8row_levels = 0;
+    /* rows and columns which are pulled down, bit of every row and column */
+    uint8 u8low_rows = 0;
+    uint8 u8low_columns = 0;
+    uint8 u8previous_rows = 0;
+    uint8 u8previous_columns = 0;
+    if(a_u16address == SIM_PORT_ADDRESS(KEYPAD_PORT_IN_COL) || a_u16address == SIM_PORT_ADDRESS(DOOR_SENSOR_PORT))
+    {
+        u8row_levels = Sim_get_pin_levels(KEYPAD_PORT_OUT_ROW);
+        for(uint8 u8row = 0 ; u8row < N_ROW ; u8row++)
+        {
+            if(GET_BIT(u8row_levels , (START_ROW + u8row)) == LOW)
+            {
+                SET_BIT(u8low_rows , u8row);
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        /* pressed key pulls its column down if its row is low, and its row if
+         * its column is low, the matrix has no diodes so three pressed keys
+         * at corners of rectangle pull the column of the fourth key too */
+        do
+        {
+            u8previous_rows = u8low_rows;
+            u8previous_columns = u8low_columns;
+            for(uint8 u8row = 0 ; u8row < N_ROW ; u8row++)
+            {
+                for(uint8 u8column = 0 ; u8column < N_COL ; u8column++)
+                {
+                    if(g_u8pressed_arr[u8row][u8column] == TRUE && GET_BIT(u8low_rows , u8row) != 0)
+                    {
+                        SET_BIT(u8low_columns , u8column);
+                    }
+                    else if(g_u8pressed_arr[u8row][u8column] == TRUE && GET_BIT(u8low_columns , u8column) != 0)
+                    {
+                        SET_BIT(u8low_rows , u8row);
+                    }
+                    else
+                    {
+                        /* Do nothing */
+                    }
+                }
+            }
+        }while(u8low_rows != u8previous_rows || u8low_columns != u8previous_columns);
+        for(uint8 u8column = 0 ; u8column < N_COL ; u8column++)
+        {
+            if(GET_BIT(u8low_columns , u8column) != 0)
+            {
+                CLEAR_BIT(u8levels , (START_COL + u8column));
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        g_u8port_change_levels = Board_get_buttons_levels();
+        u8levels &= g_u8port_change_levels | (uint8)~BOARD_PORT_CHANGE_PINS;
+        Sim_set_input_levels(KEYPAD_PORT_IN_COL , u8levels);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Board_get_buttons_levels
+ *
+ * Description: 	calculate levels of push buttons pins, pressed button
+ *                  pulls its pin down.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			levels of PORT B with push buttons pins only (uint8)
+ *******************************************************************************/
+static uint8 Board_get_buttons_levels(void)
+{
+    uint8 u8levels = BOARD_PORT_CHANGE_PINS;
+    if(g_u8door_pressed == TRUE)
+    {
+        CLEAR_BIT(u8levels , DOOR_SENSOR_PIN);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    if(g_u8weight_pressed == TRUE)
+    {
+        CLEAR_BIT(u8levels , WEIGHT_SENSOR_PIN);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return u8levels;
+}
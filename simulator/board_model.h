@@ -0,0 +1,190 @@
+/*******************************************************************************
+ *
+ * File:                board_model.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes and definitions of
+ *                      simulated microwave board: KeyPad matrix, door and
+ *                      weight push buttons, potentiometer and the outputs
+ *                      (heater, LED, buzzer and fan PWM).
+ *
+ * Revision history:    10/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef BOARD_MODEL_H
+#define	BOARD_MODEL_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* max. size of KeyPad matrix */
+#define BOARD_MAX_ROWS                      4u
+#define BOARD_MAX_COLUMNS                   4u
+/* value of not existing key */
+#define BOARD_NO_KEY                        0xFFu
+/* potentiometer is connected to ADC channel 0 */
+#define BOARD_POT_CHANNEL                   0u
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/************************** EnumBoard_button_t *********************************/
+typedef enum{
+            BOARD_DOOR_BUTTON,
+            BOARD_WEIGHT_BUTTON
+}EnumBoard_button_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Board_Initialization
+ *
+ * Description: 	release all keys and buttons and attach the board to the
+ *                  simulator register file.
+ *                  note: it should be called after Sim_Initialization.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Board_Initialization(void);
+
+/*******************************************************************************
+ * Function Name:	Board_set_key
+ *
+ * Description: 	press or release KeyPad key.
+ *
+ * Inputs:			a_u8key_value     (uint8) value returned by KeyPad driver
+ *                                    for this key (0-9 , '*' , '#')
+ *                  a_u8pressed       (uint8) TRUE to press, FALSE to release
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the key exists in the KeyPad, FALSE otherwise (uint8)
+ *******************************************************************************/
+extern uint8 Board_set_key(uint8 a_u8key_value , uint8 a_u8pressed);
+
+/*******************************************************************************
+ * Function Name:	Board_set_button
+ *
+ * Description: 	press or release door or weight push button.
+ *
+ * Inputs:			a_button_t        (EnumBoard_button_t)
+ *                  a_u8pressed       (uint8) TRUE to press, FALSE to release
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Board_set_button(EnumBoard_button_t a_button_t , uint8 a_u8pressed);
+
+/*******************************************************************************
+ * Function Name:	Board_set_door_lock
+ *
+ * Description: 	lock or unlock the door, presses of door button don't
+ *                  open the locked door (as the door is locked in heating).
+ *
+ * Inputs:			a_u8locked        (uint8) TRUE to lock, FALSE to unlock
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Board_set_door_lock(uint8 a_u8locked);
+
+/*******************************************************************************
+ * Function Name:	Board_set_pot_voltage
+ *
+ * Description: 	set voltage of potentiometer which selects the temperature.
+ *
+ * Inputs:			a_u16voltage      (uint16) voltage in mV from 0 to 5000
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Board_set_pot_voltage(uint16 a_u16voltage);
+
+/*******************************************************************************
+ * Function Name:	Board_get_heater
+ *
+ * Description: 	get state of the heater output.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the heater is on, FALSE otherwise (uint8)
+ *******************************************************************************/
+extern uint8 Board_get_heater(void);
+
+/*******************************************************************************
+ * Function Name:	Board_get_led
+ *
+ * Description: 	get state of the LED output.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the LED is on, FALSE otherwise (uint8)
+ *******************************************************************************/
+extern uint8 Board_get_led(void);
+
+/*******************************************************************************
+ * Function Name:	Board_get_buzzer
+ *
+ * Description: 	get state of the buzzer output (it is active low), the tone
+ *                  of CCP2 toggles the pin so the buzzer is on while it runs.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the buzzer is on, FALSE otherwise (uint8)
+ *******************************************************************************/
+extern uint8 Board_get_buzzer(void);
+
+/*******************************************************************************
+ * Function Name:	Board_get_fan_duty
+ *
+ * Description: 	get duty cycle of the fan from CCP1 PWM registers.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			duty cycle from 0 to 100 %, 0 if PWM is stopped (uint8)
+ *******************************************************************************/
+extern uint8 Board_get_fan_duty(void);
+
+/*******************************************************************************
+ * Function Name:	Board_get_door_open
+ *
+ * Description: 	get the real state of the door, the door button toggles it
+ *                  on every press as the firmware does.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the door is opened, FALSE otherwise (uint8)
+ *******************************************************************************/
+extern uint8 Board_get_door_open(void);
+
+#endif	/* BOARD_MODEL_H */
+
@@ -0,0 +1,414 @@
+/*******************************************************************************
+ *
+ * File:                fleet.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of fleet of
+ *                      simulated units, the build moves static variables of
+ *                      the firmware to fw_data and fw_bss sections and static
+ *                      variables of the simulator and the models to sim_data
+ *                      and sim_bss sections, so the context of unit is these
+ *                      sections which are copied in and out when the unit is
+ *                      selected. every unit runs on its own stack and it is
+ *                      paused at the end of the step from the simulator.
+ *
+ * Revision history:    15/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+#include "fleet.h"
+#include "simulator.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* sections of the context of unit */
+#define FLEET_REGIONS_NUMBER                4u
+/* direction of context copy */
+#define FLEET_SAVE_CONTEXT                  0u
+#define FLEET_LOAD_CONTEXT                  1u
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/****************************** StrFleet_unit_t ********************************/
+typedef struct{
+    ucontext_t context;                 /* registers and stack of the paused firmware */
+    uint8 * state_ptr;                  /* saved static variables */
+    uint8 * stack_ptr;
+    uint8 u8finished_flag;              /* TRUE if the firmware returned from main */
+}StrFleet_unit_t;
+
+/*******************************************************************************
+ *                            extern variables                                 *
+ *******************************************************************************/
+/* bounds of firmware and simulator sections which are defined by the linker */
+extern uint8 __start_fw_data[];
+extern uint8 __stop_fw_data[];
+extern uint8 __start_fw_bss[];
+extern uint8 __stop_fw_bss[];
+extern uint8 __start_sim_data[];
+extern uint8 __stop_sim_data[];
+extern uint8 __start_sim_bss[];
+extern uint8 __stop_sim_bss[];
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* start and end of every section of the context */
+static uint8 * const g_regions_arr[FLEET_REGIONS_NUMBER][2] = {
+    {__start_fw_data  , __stop_fw_data},
+    {__start_fw_bss   , __stop_fw_bss},
+    {__start_sim_data , __stop_sim_data},
+    {__start_sim_bss  , __stop_sim_bss}
+};
+static StrFleet_unit_t * g_units_ptr = NULL_PTR;
+static uint32 g_u32units_number = 0;
+/* unit whose context is in the sections */
+static uint32 g_u32selected_unit = 0;
+static uint32 g_u32context_size = 0;
+/* context of Fleet_step which the units return to at the end of the step */
+static ucontext_t g_scheduler_context;
+/* virtual time of the fleet and the end of the current step in us */
+static uint64 g_u64fleet_time = 0;
+static uint64 g_u64step_end = 0;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Fleet_copy_context
+ *
+ * Description: 	copy static variables sections to or from saved context.
+ *
+ * Inputs:			a_state_ptr       (uint8*) saved context
+ *                  a_u8direction     (uint8) FLEET_SAVE_CONTEXT or
+ *                                    FLEET_LOAD_CONTEXT
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Fleet_copy_context(uint8 * a_state_ptr , uint8 a_u8direction);
+
+/*******************************************************************************
+ * Function Name:	Fleet_unit_entry
+ *
+ * Description: 	run the firmware of the selected unit on its own stack.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Fleet_unit_entry(void);
+
+/*******************************************************************************
+ * Function Name:	Fleet_pause
+ *
+ * Description: 	return to Fleet_step when the selected unit reaches the
+ *                  end of the step, the unit continues from here in the
+ *                  next step.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Fleet_pause(void);
+
+/* main function of the firmware which is renamed in simulator build */
+extern void Firmware_main(void);
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Fleet_Initialization
+ *
+ * Description: 	create units with power on state of the firmware, the
+ *                  setup function of every unit is called while its context
+ *                  is selected to initialize the simulator and attach the
+ *                  models (without running the firmware).
+ *                  note: Sim_save_firmware_state should be called before it.
+ *
+ * Inputs:			a_u32units            (uint32) number of units
+ *                  a_setup_function_ptr  (void(*)(uint32)) called with unit
+ *                                        number
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the units are created, FALSE if there isn't
+ *                  enough memory (uint8)
+ *******************************************************************************/
+uint8 Fleet_Initialization(uint32 a_u32units , void (*a_setup_function_ptr)(uint32 a_u32unit))
+{
+    StrFleet_unit_t * unit_ptr = NULL_PTR;
+    g_u32context_size = 0;
+    for(uint8 u8region = 0 ; u8region < FLEET_REGIONS_NUMBER ; u8region++)
+    {
+        g_u32context_size += g_regions_arr[u8region][1] - g_regions_arr[u8region][0];
+    }
+    g_units_ptr = (StrFleet_unit_t *)calloc(a_u32units , sizeof(StrFleet_unit_t));
+    if(g_units_ptr == NULL_PTR || a_u32units == 0)
+    {
+        free(g_units_ptr);
+        g_units_ptr = NULL_PTR;
+        return FALSE;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    g_u32units_number = a_u32units;
+    for(uint32 u32unit = 0 ; u32unit < a_u32units ; u32unit++)
+    {
+        g_units_ptr[u32unit].state_ptr = (uint8 *)malloc(g_u32context_size);
+        g_units_ptr[u32unit].stack_ptr = (uint8 *)malloc(FLEET_STACK_SIZE);
+        if(g_units_ptr[u32unit].state_ptr == NULL_PTR || g_units_ptr[u32unit].stack_ptr == NULL_PTR)
+        {
+            Fleet_close();
+            return FALSE;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    /* all units start from the current state of the process */
+    Fleet_copy_context(g_units_ptr[0].state_ptr , FLEET_SAVE_CONTEXT);
+    for(uint32 u32unit = 1 ; u32unit < a_u32units ; u32unit++)
+    {
+        memcpy(g_units_ptr[u32unit].state_ptr , g_units_ptr[0].state_ptr , g_u32context_size);
+    }
+    g_u32selected_unit = 0;
+    g_u64fleet_time = 0;
+    for(uint32 u32unit = 0 ; u32unit < a_u32units ; u32unit++)
+    {
+        unit_ptr = &g_units_ptr[u32unit];
+        Fleet_select(u32unit);
+        Sim_restore_firmware_state();
+        a_setup_function_ptr(u32unit);
+        getcontext(&unit_ptr->context);
+        unit_ptr->context.uc_stack.ss_sp = unit_ptr->stack_ptr;
+        unit_ptr->context.uc_stack.ss_size = FLEET_STACK_SIZE;
+        unit_ptr->context.uc_link = &g_scheduler_context;
+        makecontext(&unit_ptr->context , Fleet_unit_entry , 0);
+        unit_ptr->u8finished_flag = FALSE;
+    }
+    return TRUE;
+}
+
+/*******************************************************************************
+ * Function Name:	Fleet_step
+ *
+ * Description: 	run the firmware of all units from the current virtual
+ *                  time of the fleet to the end of the step, the report
+ *                  function is called after every unit while its context
+ *                  is selected to read its outputs or change its inputs.
+ *
+ * Inputs:			a_u64time             (uint64) step time in us
+ *                  a_report_function_ptr (void(*)(uint32)) called with unit
+ *                                        number or NULL_PTR
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Fleet_step(uint64 a_u64time , void (*a_report_function_ptr)(uint32 a_u32unit))
+{
+    g_u64step_end = g_u64fleet_time + a_u64time;
+    for(uint32 u32unit = 0 ; u32unit < g_u32units_number ; u32unit++)
+    {
+        Fleet_select(u32unit);
+        if(g_units_ptr[u32unit].u8finished_flag == FALSE)
+        {
+            /* the first switch starts the unit by Fleet_unit_entry */
+            Sim_set_time_limit(g_u64step_end);
+            swapcontext(&g_scheduler_context , &g_units_ptr[u32unit].context);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        if(a_report_function_ptr != NULL_PTR)
+        {
+            a_report_function_ptr(u32unit);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    g_u64fleet_time = g_u64step_end;
+}
+
+/*******************************************************************************
+ * Function Name:	Fleet_select
+ *
+ * Description: 	save the context of the selected unit and load context of
+ *                  another unit, so functions of the simulator and models
+ *                  work on this unit.
+ *
+ * Inputs:			a_u32unit         (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Fleet_select(uint32 a_u32unit)
+{
+    if(a_u32unit != g_u32selected_unit && a_u32unit < g_u32units_number)
+    {
+        Fleet_copy_context(g_units_ptr[g_u32selected_unit].state_ptr , FLEET_SAVE_CONTEXT);
+        Fleet_copy_context(g_units_ptr[a_u32unit].state_ptr , FLEET_LOAD_CONTEXT);
+        g_u32selected_unit = a_u32unit;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Fleet_get_time_us
+ *
+ * Description: 	get virtual time of the fleet which all units reached.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			time in us (uint64)
+ *******************************************************************************/
+uint64 Fleet_get_time_us(void)
+{
+    return g_u64fleet_time;
+}
+
+/*******************************************************************************
+ * Function Name:	Fleet_get_context_size
+ *
+ * Description: 	get size of the static variables context of one unit.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			size in bytes (uint32)
+ *******************************************************************************/
+uint32 Fleet_get_context_size(void)
+{
+    return g_u32context_size;
+}
+
+/*******************************************************************************
+ * Function Name:	Fleet_close
+ *
+ * Description: 	free contexts and stacks of all units.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Fleet_close(void)
+{
+    if(g_units_ptr != NULL_PTR)
+    {
+        for(uint32 u32unit = 0 ; u32unit < g_u32units_number ; u32unit++)
+        {
+            free(g_units_ptr[u32unit].state_ptr);
+            free(g_units_ptr[u32unit].stack_ptr);
+        }
+        free(g_units_ptr);
+        g_units_ptr = NULL_PTR;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    g_u32units_number = 0;
+    g_u32selected_unit = 0;
+}
+
+/*******************************************************************************
+ * Function Name:	Fleet_copy_context
+ *
+ * Description: 	copy static variables sections to or from saved context.
+ *
+ * Inputs:			a_state_ptr       (uint8*) saved context
+ *                  a_u8direction     (uint8) FLEET_SAVE_CONTEXT or
+ *                                    FLEET_LOAD_CONTEXT
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Fleet_copy_context(uint8 * a_state_ptr , uint8 a_u8direction)
+{
+    uint32 u32size = 0;
+    for(uint8 u8region = 0 ; u8region < FLEET_REGIONS_NUMBER ; u8region++)
+    {
+        u32size = g_regions_arr[u8region][1] - g_regions_arr[u8region][0];
+        if(a_u8direction == FLEET_SAVE_CONTEXT)
+        {
+            memcpy(a_state_ptr , g_regions_arr[u8region][0] , u32size);
+        }
+        else
+        {
+            memcpy(g_regions_arr[u8region][0] , a_state_ptr , u32size);
+        }
+        a_state_ptr += u32size;
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Fleet_unit_entry
+ *
+ * Description: 	run the firmware of the selected unit on its own stack.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Fleet_unit_entry(void)
+{
+    Sim_set_pause_function(Fleet_pause);
+    Sim_run(Firmware_main , g_u64step_end);
+    /* the firmware returned from its main function, uc_link returns to Fleet_step */
+    g_units_ptr[g_u32selected_unit].u8finished_flag = TRUE;
+}
+
+/*******************************************************************************
+ * Function Name:	Fleet_pause
+ *
+ * Description: 	return to Fleet_step when the selected unit reaches the
+ *                  end of the step, the unit continues from here in the
+ *                  next step.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Fleet_pause(void)
+{
+    swapcontext(&g_units_ptr[g_u32selected_unit].context , &g_scheduler_context);
+}
@@ -0,0 +1,133 @@
+/*******************************************************************************
+ *
+ * File:                fleet.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes and definitions of
+ *                      fleet of simulated units in one process, every unit
+ *                      has its own context of static variables of the
+ *                      firmware, the simulator with its register file and
+ *                      the models and its own stack, the contexts are
+ *                      swapped to run the units one by one in steps of the
+ *                      virtual time.
+ *
+ * Revision history:    15/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef FLEET_H
+#define	FLEET_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* stack of every unit, the firmware with interrupt functions and the
+ * simulator functions over it */
+#define FLEET_STACK_SIZE                    0x10000u
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Fleet_Initialization
+ *
+ * Description: 	create units with power on state of the firmware, the
+ *                  setup function of every unit is called while its context
+ *                  is selected to initialize the simulator and attach the
+ *                  models (without running the firmware).
+ *                  note: Sim_save_firmware_state should be called before it.
+ *
+ * Inputs:			a_u32units            (uint32) number of units
+ *                  a_setup_function_ptr  (void(*)(uint32)) called with unit
+ *                                        number
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the units are created, FALSE if there isn't
+ *                  enough memory (uint8)
+ *******************************************************************************/
+extern uint8 Fleet_Initialization(uint32 a_u32units , void (*a_setup_function_ptr)(uint32 a_u32unit));
+
+/*******************************************************************************
+ * Function Name:	Fleet_step
+ *
+ * Description: 	run the firmware of all units from the current virtual
+ *                  time of the fleet to the end of the step, the report
+ *                  function is called after every unit while its context
+ *                  is selected to read its outputs or change its inputs.
+ *
+ * Inputs:			a_u64time             (uint64) step time in us
+ *                  a_report_function_ptr (void(*)(uint32)) called with unit
+ *                                        number or NULL_PTR
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Fleet_step(uint64 a_u64time , void (*a_report_function_ptr)(uint32 a_u32unit));
+
+/*******************************************************************************
+ * Function Name:	Fleet_select
+ *
+ * Description: 	save the context of the selected unit and load context of
+ *                  another unit, so functions of the simulator and models
+ *                  work on this unit.
+ *
+ * Inputs:			a_u32unit         (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Fleet_select(uint32 a_u32unit);
+
+/*******************************************************************************
+ * Function Name:	Fleet_get_time_us
+ *
+ * Description: 	get virtual time of the fleet which all units reached.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			time in us (uint64)
+ *******************************************************************************/
+extern uint64 Fleet_get_time_us(void);
+
+/*******************************************************************************
+ * Function Name:	Fleet_get_context_size
+ *
+ * Description: 	get size of the static variables context of one unit.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			size in bytes (uint32)
+ *******************************************************************************/
+extern uint32 Fleet_get_context_size(void);
+
+/*******************************************************************************
+ * Function Name:	Fleet_close
+ *
+ * Description: 	free contexts and stacks of all units.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Fleet_close(void);
+
+#endif	/* FLEET_H */
+
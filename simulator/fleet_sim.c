@@ -0,0 +1,304 @@
+/*******************************************************************************
+ *
+ * File:                fleet_sim.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            host application that runs many simulated units in
+ *                      one process, the scenarios of the script files are
+ *                      given to the units one by one and repeated until all
+ *                      units have scenarios, then all units run in steps of
+ *                      the virtual time to the end of the longest scenario.
+ *                      usage: fleet_sim [-n units] [-s step ms] [-v] files...
+ *
+ * Revision history:    15/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "board_model.h"
+#include "fleet.h"
+#include "scenario.h"
+#include "simulator.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+#define FLEET_SIM_MAX_SCENARIOS             64u
+#define FLEET_SIM_DEFAULT_UNITS             1000u
+/* step of the virtual time in ms */
+#define FLEET_SIM_DEFAULT_STEP              1000u
+#define FLEET_SIM_US_PER_MS                 1000u
+#define FLEET_SIM_US_PER_S                  1000000.0
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* scenarios of the script files and result of every unit */
+static StrScenario_t * g_scenarios_arr[FLEET_SIM_MAX_SCENARIOS];
+static uint32 g_u32scenarios_number = 0;
+static StrScenario_result_t * g_results_ptr = NULL_PTR;
+/* outputs of the units in the current step */
+static uint32 g_u32heating_units = 0;
+static uint32 g_u32fan_duty_sum = 0;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Fleet_sim_get_time
+ *
+ * Description: 	get monotonic host time.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			time in s (double)
+ *******************************************************************************/
+static double Fleet_sim_get_time(void);
+
+/*******************************************************************************
+ * Function Name:	Fleet_sim_setup
+ *
+ * Description: 	start scenario of the unit without running it.
+ *
+ * Inputs:			a_u32unit         (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Fleet_sim_setup(uint32 a_u32unit);
+
+/*******************************************************************************
+ * Function Name:	Fleet_sim_report
+ *
+ * Description: 	count outputs of the unit at the end of the step.
+ *
+ * Inputs:			a_u32unit         (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Fleet_sim_report(uint32 a_u32unit);
+
+/* host application */
+int main(int argc , char * argv[])
+{
+    uint32 u32units = FLEET_SIM_DEFAULT_UNITS;
+    uint64 u64step = FLEET_SIM_DEFAULT_STEP * FLEET_SIM_US_PER_MS;
+    uint64 u64end_time = 0;
+    uint8 u8verbose = FALSE;
+    uint32 u32failed = 0;
+    sint32 s32option = 0;
+    StrScenario_reader_t reader;
+    char error_arr[SCENARIO_MESSAGE_SIZE];
+    double start_time = 0;
+    double host_time = 0;
+    while((s32option = getopt(argc , argv , "n:s:v")) != -1)
+    {
+        if(s32option == 'n')
+        {
+            u32units = (uint32)strtoul(optarg , NULL_PTR , 10);
+        }
+        else if(s32option == 's')
+        {
+            u64step = strtoull(optarg , NULL_PTR , 10) * FLEET_SIM_US_PER_MS;
+        }
+        else if(s32option == 'v')
+        {
+            u8verbose = TRUE;
+        }
+        else
+        {
+            fprintf(stderr , "usage: %s [-n units] [-s step ms] [-v] files...\n" , argv[0]);
+            return 2;
+        }
+    }
+    for(sint32 s32file = optind ; s32file < argc ; s32file++)
+    {
+        if(Scenario_open(&reader , argv[s32file]) == FALSE)
+        {
+            fprintf(stderr , "%s: can't open file\n" , argv[s32file]);
+            return 2;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        error_arr[0] = '\0';
+        while(g_u32scenarios_number < FLEET_SIM_MAX_SCENARIOS)
+        {
+            /* the buffer of the last read stays for the next file at end of file */
+            if(g_scenarios_arr[g_u32scenarios_number] == NULL_PTR)
+            {
+                g_scenarios_arr[g_u32scenarios_number] = (StrScenario_t *)malloc(sizeof(StrScenario_t));
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            if(g_scenarios_arr[g_u32scenarios_number] == NULL_PTR ||
+                    Scenario_read(&reader , g_scenarios_arr[g_u32scenarios_number] , error_arr) == FALSE)
+            {
+                break;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            if(g_scenarios_arr[g_u32scenarios_number]->u64end_time > u64end_time)
+            {
+                u64end_time = g_scenarios_arr[g_u32scenarios_number]->u64end_time;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            g_u32scenarios_number++;
+        }
+        if(error_arr[0] != '\0')
+        {
+            fprintf(stderr , "%s\n" , error_arr);
+            return 2;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        Scenario_close(&reader);
+    }
+    g_results_ptr = (StrScenario_result_t *)calloc(u32units , sizeof(StrScenario_result_t));
+    if(g_u32scenarios_number == 0 || u32units == 0 || u64step == 0 || g_results_ptr == NULL_PTR)
+    {
+        fprintf(stderr , "usage: %s [-n units] [-s step ms] [-v] files...\n" , argv[0]);
+        return 2;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    Sim_save_firmware_state();
+    start_time = Fleet_sim_get_time();
+    if(Fleet_Initialization(u32units , Fleet_sim_setup) == FALSE)
+    {
+        fprintf(stderr , "not enough memory for %u units\n" , u32units);
+        return 2;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    while(Fleet_get_time_us() < u64end_time)
+    {
+        g_u32heating_units = 0;
+        g_u32fan_duty_sum = 0;
+        Fleet_step(u64step , Fleet_sim_report);
+        if(u8verbose == TRUE)
+        {
+            printf("%10.3f s virtual %8u heating %5.1f%% average fan duty %8.3f s host\n" ,
+                    Fleet_get_time_us() / FLEET_SIM_US_PER_S , g_u32heating_units ,
+                    (double)g_u32fan_duty_sum / u32units , Fleet_sim_get_time() - start_time);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    for(uint32 u32unit = 0 ; u32unit < u32units ; u32unit++)
+    {
+        Fleet_select(u32unit);
+        Scenario_finish();
+        if(g_results_ptr[u32unit].u8passed == FALSE)
+        {
+            if(u32failed == 0)
+            {
+                printf("FAIL unit %u %s\n     %s\n" , u32unit ,
+                        g_scenarios_arr[u32unit % g_u32scenarios_number]->name_arr , g_results_ptr[u32unit].message_arr);
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            u32failed++;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    host_time = Fleet_sim_get_time() - start_time;
+    printf("%u units, %u scenarios, %u failed, %u bytes context per unit, %.2f s: %.1f unit virtual s per host s\n" ,
+            u32units , g_u32scenarios_number , u32failed , Fleet_get_context_size() , host_time ,
+            (host_time > 0) ? u32units * (Fleet_get_time_us() / FLEET_SIM_US_PER_S) / host_time : 0.0);
+    Fleet_close();
+    return (u32failed > 0) ? 1 : 0;
+}
+
+/*******************************************************************************
+ * Function Name:	Fleet_sim_get_time
+ *
+ * Description: 	get monotonic host time.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			time in s (double)
+ *******************************************************************************/
+static double Fleet_sim_get_time(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC , &time);
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/*******************************************************************************
+ * Function Name:	Fleet_sim_setup
+ *
+ * Description: 	start scenario of the unit without running it.
+ *
+ * Inputs:			a_u32unit         (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Fleet_sim_setup(uint32 a_u32unit)
+{
+    Scenario_start(g_scenarios_arr[a_u32unit % g_u32scenarios_number] , &g_results_ptr[a_u32unit]);
+}
+
+/*******************************************************************************
+ * Function Name:	Fleet_sim_report
+ *
+ * Description: 	count outputs of the unit at the end of the step.
+ *
+ * Inputs:			a_u32unit         (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Fleet_sim_report(uint32 a_u32unit)
+{
+    if(Board_get_heater() == TRUE)
+    {
+        g_u32heating_units++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    g_u32fan_duty_sum += Board_get_fan_duty();
+}
@@ -0,0 +1,687 @@
+/*******************************************************************************
+ *
+ * File:                fuzz_keypad.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            fuzzing harness of the keypad time insertion and the
+ *                      door and weight sensors, every input byte is an event
+ *                      after the welcome screen and invariants of the firmware
+ *                      are checked on every register access:
+ *                          - the heater isn't on while the door is opened.
+ *                          - the remaining time doesn't exceed 99:59 (5999 s).
+ *                          - characters aren't written out of the LCD screen.
+ *                      it is LLVMFuzzerTestOneInput for libFuzzer or it has
+ *                      its own coverage guided driver which uses gcc
+ *                      -fsanitize-coverage=trace-pc on the firmware.
+ *                      usage: fuzz_keypad [-n runs] [-t seconds] [-s seed]
+ *                                         [-o directory] [-r] [files...]
+ *
+ *                      input byte: bits 0-3 event, bits 4-7 parameter
+ *                          0-9 digit key, 10 '*', 11 '#', 12 door, 13 weight
+ *                          14 potentiometer voltage = parameter * 333 mV
+ *                          15 no event
+ *                      the parameter of other events is the delay after them.
+ *
+ * Revision history:    12/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include "simulator.h"
+#include "HD44780_model.h"
+#include "board_model.h"
+#include "scenario.h"
+#include "microwave.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* events start after the welcome screen */
+#define FUZZ_START_TIME                     2100000u
+/* key and button press time and the minimum time between events in us, the
+ * keypad accepts key after two equal scans of 10ms */
+#define FUZZ_HOLD_TIME                      30000u
+#define FUZZ_STEP_TIME                      10000u
+/* run continues after the last event to see its effect */
+#define FUZZ_END_DELAY                      200000u
+/* firmware reads the door after release of its button and debouncing */
+#define FUZZ_DOOR_GRACE_TIME                100000u
+/* max. remaining time 99:59 */
+#define FUZZ_MAX_TIME                       5999u
+#define FUZZ_POT_STEP                       333u
+#define FUZZ_MAX_INPUT_SIZE                 64u
+#define FUZZ_EVENT_MASK                     0x0Fu
+#define FUZZ_STAR_EVENT                     10u
+#define FUZZ_HASH_EVENT                     11u
+#define FUZZ_DOOR_EVENT                     12u
+#define FUZZ_WEIGHT_EVENT                   13u
+#define FUZZ_POT_EVENT                      14u
+/* coverage map of firmware edges */
+#define FUZZ_MAP_SIZE                       0x10000u
+#define FUZZ_MAX_CORPUS                     2048u
+#define FUZZ_MAX_FINDINGS                   32u
+#define FUZZ_DEFAULT_TIME                   60u
+#define FUZZ_MESSAGE_SIZE                   128u
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* scenario built from the input */
+static StrScenario_t g_scenario;
+static StrScenario_result_t g_result;
+/* first violated invariant of the run */
+static char g_violation_arr[FUZZ_MESSAGE_SIZE];
+/* time when the heater is found on with opened door, 0 if it isn't */
+static uint64 g_u64door_heater_time = 0;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Fuzz_monitor_callback
+ *
+ * Description: 	lock the door in heating as the real door and check the
+ *                  heater and remaining time invariants.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Fuzz_monitor_callback(uint16 a_u16address);
+
+/*******************************************************************************
+ * Function Name:	Fuzz_run_input
+ *
+ * Description: 	convert input to scenario events, run the firmware from
+ *                  power on state and check invariants.
+ *
+ * Inputs:			a_u8data_ptr      (const uint8*)
+ *                  a_u32size         (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if an invariant is violated (g_violation_arr has
+ *                  its description), FALSE otherwise (uint8)
+ *******************************************************************************/
+static uint8 Fuzz_run_input(const uint8 * a_u8data_ptr , uint32 a_u32size);
+
+/* the monitor is attached after the board by this structure */
+static const StrSim_peripheral_t g_fuzz_monitor = {NULL_PTR , Fuzz_monitor_callback};
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Fuzz_monitor_callback
+ *
+ * Description: 	lock the door in heating as the real door and check the
+ *                  heater and remaining time invariants.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Fuzz_monitor_callback(uint16 a_u16address)
+{
+    uint64 u64time = Sim_get_time_us();
+    Board_set_door_lock((g_system_state_var_t == SYSTEM_HEATING_STATE) ? TRUE : FALSE);
+    if(g_violation_arr[0] != '\0')
+    {
+        /* the first violation is reported only */
+    }
+    else if(g_u16MicrowaveTime > FUZZ_MAX_TIME)
+    {
+        snprintf(g_violation_arr , FUZZ_MESSAGE_SIZE , "remaining time %u s at %llu us" ,
+                g_u16MicrowaveTime , (unsigned long long)u64time);
+    }
+    else if(Board_get_heater() == TRUE && Board_get_door_open() == TRUE)
+    {
+        if(g_u64door_heater_time == 0)
+        {
+            g_u64door_heater_time = u64time;
+        }
+        else if(u64time - g_u64door_heater_time > FUZZ_DOOR_GRACE_TIME)
+        {
+            snprintf(g_violation_arr , FUZZ_MESSAGE_SIZE , "heater is on with opened door at %llu us" ,
+                    (unsigned long long)g_u64door_heater_time);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        g_u64door_heater_time = 0;
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Fuzz_run_input
+ *
+ * Description: 	convert input to scenario events, run the firmware from
+ *                  power on state and check invariants.
+ *
+ * Inputs:			a_u8data_ptr      (const uint8*)
+ *                  a_u32size         (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if an invariant is violated (g_violation_arr has
+ *                  its description), FALSE otherwise (uint8)
+ *******************************************************************************/
+static uint8 Fuzz_run_input(const uint8 * a_u8data_ptr , uint32 a_u32size)
+{
+    uint64 u64time = FUZZ_START_TIME;
+    uint8 u8event = 0;
+    uint8 u8parameter = 0;
+    StrScenario_event_t * event_ptr = NULL_PTR;
+    StrHD44780_counters_t lcd_counters;
+    a_u32size = (a_u32size > FUZZ_MAX_INPUT_SIZE) ? FUZZ_MAX_INPUT_SIZE : a_u32size;
+    strcpy(g_scenario.name_arr , "fuzz");
+    g_scenario.file_name_ptr = "fuzz";
+    g_scenario.u16line = 0;
+    g_scenario.u16events_number = 0;
+    /* press and release events are in time order because the next event is after the release */
+    for(uint32 u32counter = 0 ; u32counter < a_u32size ; u32counter++)
+    {
+        u8event = a_u8data_ptr[u32counter] & FUZZ_EVENT_MASK;
+        u8parameter = a_u8data_ptr[u32counter] >> 4;
+        event_ptr = &g_scenario.events_arr[g_scenario.u16events_number];
+        memset(event_ptr , 0 , 2 * sizeof(StrScenario_event_t));
+        event_ptr[0].u64time = u64time;
+        event_ptr[1].u64time = u64time + FUZZ_HOLD_TIME;
+        if(u8event <= FUZZ_WEIGHT_EVENT)
+        {
+            event_ptr[0].event_t = (u8event == FUZZ_DOOR_EVENT) ? SCENARIO_DOOR_PRESS :
+                    (u8event == FUZZ_WEIGHT_EVENT) ? SCENARIO_WEIGHT_PRESS : SCENARIO_KEY_PRESS;
+            event_ptr[0].u16value = (u8event == FUZZ_STAR_EVENT) ? '*' :
+                    (u8event == FUZZ_HASH_EVENT) ? '#' : u8event;
+            /* release events follow press events in the enumeration */
+            event_ptr[1] = event_ptr[0];
+            event_ptr[1].event_t = (EnumScenario_event_t)(event_ptr[0].event_t + 1);
+            event_ptr[1].u64time = u64time + FUZZ_HOLD_TIME;
+            g_scenario.u16events_number += 2;
+            u64time += FUZZ_HOLD_TIME + (uint64)(u8parameter + 1) * FUZZ_STEP_TIME;
+        }
+        else if(u8event == FUZZ_POT_EVENT)
+        {
+            event_ptr[0].event_t = SCENARIO_POT_VOLTAGE;
+            event_ptr[0].u16value = (uint16)u8parameter * FUZZ_POT_STEP;
+            g_scenario.u16events_number++;
+            u64time += FUZZ_STEP_TIME;
+        }
+        else
+        {
+            u64time += (uint64)(u8parameter + 1) * FUZZ_STEP_TIME;
+        }
+    }
+    g_scenario.u64end_time = u64time + FUZZ_END_DELAY;
+    g_violation_arr[0] = '\0';
+    g_u64door_heater_time = 0;
+    Scenario_set_monitor(&g_fuzz_monitor);
+    Scenario_run(&g_scenario , &g_result);
+    HD44780_get_counters(&lcd_counters);
+    if(g_violation_arr[0] == '\0' && lcd_counters.u32hidden_writes != 0)
+    {
+        snprintf(g_violation_arr , FUZZ_MESSAGE_SIZE , "%u characters are written out of the LCD screen" ,
+                lcd_counters.u32hidden_writes);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return (g_violation_arr[0] != '\0') ? TRUE : FALSE;
+}
+
+#ifdef FUZZ_WITH_LIBFUZZER
+
+/* libFuzzer initialization */
+int LLVMFuzzerInitialize(int * argc , char *** argv)
+{
+    Sim_save_firmware_state();
+    return 0;
+}
+
+/* libFuzzer entry, violation is reported as crash */
+int LLVMFuzzerTestOneInput(const uint8_t * data , size_t size)
+{
+    if(Fuzz_run_input(data , (uint32)size) == TRUE)
+    {
+        fprintf(stderr , "invariant violation: %s\n" , g_violation_arr);
+        abort();
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return 0;
+}
+
+#else
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/**************************** StrFuzz_input_t **********************************/
+typedef struct{
+    uint8  u8data_arr[FUZZ_MAX_INPUT_SIZE];
+    uint32 u32size;
+}StrFuzz_input_t;
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* hit counts of firmware edges in the current run */
+static uint8 g_u8trace_arr[FUZZ_MAP_SIZE];
+/* hit counts classes found by all runs */
+static uint8 g_u8coverage_arr[FUZZ_MAP_SIZE];
+static uintptr_t g_previous_location = 0;
+static StrFuzz_input_t g_corpus_arr[FUZZ_MAX_CORPUS];
+static uint32 g_u32corpus_size = 0;
+/* running input to save it if the firmware crashes */
+static StrFuzz_input_t g_current_input;
+static const char * g_output_directory_ptr = NULL_PTR;
+/* classes of hit counts as 1, 2, 3, 4-7, 8-15, 16-31, 32-127, 128+ */
+static uint8 g_u8count_class_arr[256];
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Fuzz_save_input
+ *
+ * Description: 	write input to file in output directory.
+ *
+ * Inputs:			a_prefix_ptr      (const char*) file name prefix
+ *                  a_u32number       (uint32) file number
+ *                  a_input_ptr       (const StrFuzz_input_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Fuzz_save_input(const char * a_prefix_ptr , uint32 a_u32number , const StrFuzz_input_t * a_input_ptr);
+
+/*******************************************************************************
+ * Function Name:	Fuzz_has_new_coverage
+ *
+ * Description: 	add hit counts classes of the last run to the coverage.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u32edges_ptr    (uint32*) number of covered edges
+ *
+ * Return:			TRUE if the run found new edge or hit count class (uint8)
+ *******************************************************************************/
+static uint8 Fuzz_has_new_coverage(uint32 * a_u32edges_ptr);
+
+/*******************************************************************************
+ * Function Name:	Fuzz_mutate
+ *
+ * Description: 	change input by random bytes changes, insertions,
+ *                  deletions or splicing with another corpus input.
+ *
+ * Inputs:			a_input_ptr       (StrFuzz_input_t*)
+ *
+ * Outputs:			a_input_ptr       (StrFuzz_input_t*)
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Fuzz_mutate(StrFuzz_input_t * a_input_ptr);
+
+/*******************************************************************************
+ * Function Name:	Fuzz_crash_handler
+ *
+ * Description: 	save the running input when the firmware crashes.
+ *
+ * Inputs:			a_s32signal       (int)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Fuzz_crash_handler(int a_s32signal);
+
+/* called by instrumented firmware on every edge */
+void __sanitizer_cov_trace_pc(void)
+{
+    uintptr_t location = (uintptr_t)__builtin_return_address(0);
+    uint8 * u8count_ptr = &g_u8trace_arr[(location ^ g_previous_location) & (FUZZ_MAP_SIZE - 1)];
+    *u8count_ptr += (*u8count_ptr != 0xFF) ? 1 : 0;
+    g_previous_location = location >> 1;
+}
+
+/* host application */
+int main(int argc , char * argv[])
+{
+    uint64 u64runs = 0;
+    uint64 u64max_runs = 0;
+    uint32 u32time_limit = FUZZ_DEFAULT_TIME;
+    uint32 u32seed = (uint32)time(NULL);
+    uint8 u8reproduce = FALSE;
+    sint32 s32option = 0;
+    uint32 u32edges = 0;
+    uint32 u32findings = 0;
+    uint32 u32last_report = 0;
+    time_t start_time = time(NULL);
+    FILE * file_ptr = NULL_PTR;
+    while((s32option = getopt(argc , argv , "n:t:s:o:r")) != -1)
+    {
+        switch(s32option)
+        {
+            case 'n': u64max_runs = strtoull(optarg , NULL_PTR , 10); break;
+            case 't': u32time_limit = (uint32)strtoul(optarg , NULL_PTR , 10); break;
+            case 's': u32seed = (uint32)strtoul(optarg , NULL_PTR , 10); break;
+            case 'o': g_output_directory_ptr = optarg; break;
+            case 'r': u8reproduce = TRUE; break;
+            default:
+                fprintf(stderr , "usage: %s [-n runs] [-t seconds] [-s seed] [-o directory] [-r] [files...]\n" , argv[0]);
+                return 2;
+        }
+    }
+    Sim_save_firmware_state();
+    srand(u32seed);
+    for(uint32 u32counter = 1 ; u32counter < 256 ; u32counter++)
+    {
+        g_u8count_class_arr[u32counter] = (u32counter < 4) ? (uint8)(1 << (u32counter - 1)) :
+                (u32counter < 8) ? 0x08 : (u32counter < 16) ? 0x10 : (u32counter < 32) ? 0x20 :
+                (u32counter < 128) ? 0x40 : 0x80;
+    }
+    signal(SIGSEGV , Fuzz_crash_handler);
+    signal(SIGBUS , Fuzz_crash_handler);
+    signal(SIGFPE , Fuzz_crash_handler);
+    /* inputs of files are the first corpus or they are reproduced */
+    for(sint32 s32file = optind ; s32file < argc && g_u32corpus_size < FUZZ_MAX_CORPUS ; s32file++)
+    {
+        file_ptr = fopen(argv[s32file] , "rb");
+        if(file_ptr == NULL_PTR)
+        {
+            fprintf(stderr , "%s: can't open file\n" , argv[s32file]);
+            return 2;
+        }
+        else
+        {
+            g_current_input.u32size = (uint32)fread(g_current_input.u8data_arr , 1 , FUZZ_MAX_INPUT_SIZE , file_ptr);
+            fclose(file_ptr);
+        }
+        memset(g_u8trace_arr , 0 , FUZZ_MAP_SIZE);
+        if(Fuzz_run_input(g_current_input.u8data_arr , g_current_input.u32size) == TRUE)
+        {
+            printf("%s: %s\n" , argv[s32file] , g_violation_arr);
+            u32findings++;
+        }
+        else if(u8reproduce == TRUE)
+        {
+            printf("%s: no violation\n" , argv[s32file]);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        if(Fuzz_has_new_coverage(&u32edges) == TRUE || g_u32corpus_size == 0)
+        {
+            g_corpus_arr[g_u32corpus_size] = g_current_input;
+            g_u32corpus_size++;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    if(u8reproduce == TRUE)
+    {
+        return (u32findings > 0) ? 1 : 0;
+    }
+    else if(g_u32corpus_size == 0)
+    {
+        /* default input inserts 12:34 */
+        g_corpus_arr[0].u8data_arr[0] = 0x01;
+        g_corpus_arr[0].u8data_arr[1] = 0x02;
+        g_corpus_arr[0].u8data_arr[2] = 0x03;
+        g_corpus_arr[0].u8data_arr[3] = 0x04;
+        g_corpus_arr[0].u32size = 4;
+        g_u32corpus_size = 1;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    printf("seed %u, corpus %u\n" , u32seed , g_u32corpus_size);
+    while((u64max_runs == 0 || u64runs < u64max_runs) &&
+            (uint32)(time(NULL) - start_time) < u32time_limit)
+    {
+        g_current_input = g_corpus_arr[rand() % g_u32corpus_size];
+        Fuzz_mutate(&g_current_input);
+        memset(g_u8trace_arr , 0 , FUZZ_MAP_SIZE);
+        g_previous_location = 0;
+        if(Fuzz_run_input(g_current_input.u8data_arr , g_current_input.u32size) == TRUE)
+        {
+            if(u32findings < FUZZ_MAX_FINDINGS)
+            {
+                printf("violation %u: %s\n" , u32findings , g_violation_arr);
+                Fuzz_save_input("violation" , u32findings , &g_current_input);
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            u32findings++;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        if(Fuzz_has_new_coverage(&u32edges) == TRUE && g_u32corpus_size < FUZZ_MAX_CORPUS)
+        {
+            g_corpus_arr[g_u32corpus_size] = g_current_input;
+            Fuzz_save_input("corpus" , g_u32corpus_size , &g_current_input);
+            g_u32corpus_size++;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        u64runs++;
+        if((uint32)(time(NULL) - start_time) >= u32last_report + 10)
+        {
+            u32last_report = (uint32)(time(NULL) - start_time);
+            printf("#%llu corpus %u edges %u violations %u %.1f runs/s\n" , (unsigned long long)u64runs ,
+                    g_u32corpus_size , u32edges , u32findings , (double)u64runs / u32last_report);
+            fflush(stdout);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    printf("#%llu done: corpus %u edges %u violations %u\n" , (unsigned long long)u64runs ,
+            g_u32corpus_size , u32edges , u32findings);
+    return (u32findings > 0) ? 1 : 0;
+}
+
+/*******************************************************************************
+ * Function Name:	Fuzz_save_input
+ *
+ * Description: 	write input to file in output directory.
+ *
+ * Inputs:			a_prefix_ptr      (const char*) file name prefix
+ *                  a_u32number       (uint32) file number
+ *                  a_input_ptr       (const StrFuzz_input_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Fuzz_save_input(const char * a_prefix_ptr , uint32 a_u32number , const StrFuzz_input_t * a_input_ptr)
+{
+    char file_name_arr[256];
+    FILE * file_ptr = NULL_PTR;
+    if(g_output_directory_ptr != NULL_PTR)
+    {
+        snprintf(file_name_arr , sizeof(file_name_arr) , "%s/%s-%04u" , g_output_directory_ptr , a_prefix_ptr , a_u32number);
+        file_ptr = fopen(file_name_arr , "wb");
+        if(file_ptr != NULL_PTR)
+        {
+            fwrite(a_input_ptr->u8data_arr , 1 , a_input_ptr->u32size , file_ptr);
+            fclose(file_ptr);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Fuzz_has_new_coverage
+ *
+ * Description: 	add hit counts classes of the last run to the coverage.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u32edges_ptr    (uint32*) number of covered edges
+ *
+ * Return:			TRUE if the run found new edge or hit count class (uint8)
+ *******************************************************************************/
+static uint8 Fuzz_has_new_coverage(uint32 * a_u32edges_ptr)
+{
+    uint8 retVal = FALSE;
+    uint8 u8class = 0;
+    for(uint32 u32counter = 0 ; u32counter < FUZZ_MAP_SIZE ; u32counter++)
+    {
+        u8class = g_u8count_class_arr[g_u8trace_arr[u32counter]];
+        if((u8class & ~g_u8coverage_arr[u32counter]) != 0)
+        {
+            if(g_u8coverage_arr[u32counter] == 0)
+            {
+                (*a_u32edges_ptr)++;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            g_u8coverage_arr[u32counter] |= u8class;
+            retVal = TRUE;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Fuzz_mutate
+ *
+ * Description: 	change input by random bytes changes, insertions,
+ *                  deletions or splicing with another corpus input.
+ *
+ * Inputs:			a_input_ptr       (StrFuzz_input_t*)
+ *
+ * Outputs:			a_input_ptr       (StrFuzz_input_t*)
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Fuzz_mutate(StrFuzz_input_t * a_input_ptr)
+{
+    uint32 u32changes = 1 + rand() % 4;
+    uint32 u32position = 0;
+    const StrFuzz_input_t * other_ptr = NULL_PTR;
+    for(uint32 u32counter = 0 ; u32counter < u32changes ; u32counter++)
+    {
+        u32position = (a_input_ptr->u32size > 0) ? (uint32)rand() % a_input_ptr->u32size : 0;
+        switch(rand() % 5)
+        {
+            case 0:
+                /* new event in place of an event */
+                if(a_input_ptr->u32size > 0)
+                {
+                    a_input_ptr->u8data_arr[u32position] = (uint8)rand();
+                }
+                break;
+            case 1:
+                /* the same event with another parameter */
+                if(a_input_ptr->u32size > 0)
+                {
+                    a_input_ptr->u8data_arr[u32position] ^= (uint8)(1 << (4 + rand() % 4));
+                }
+                break;
+            case 2:
+                /* insert event */
+                if(a_input_ptr->u32size < FUZZ_MAX_INPUT_SIZE)
+                {
+                    memmove(&a_input_ptr->u8data_arr[u32position + 1] , &a_input_ptr->u8data_arr[u32position] ,
+                            a_input_ptr->u32size - u32position);
+                    a_input_ptr->u8data_arr[u32position] = (uint8)rand();
+                    a_input_ptr->u32size++;
+                }
+                break;
+            case 3:
+                /* remove event */
+                if(a_input_ptr->u32size > 1)
+                {
+                    memmove(&a_input_ptr->u8data_arr[u32position] , &a_input_ptr->u8data_arr[u32position + 1] ,
+                            a_input_ptr->u32size - u32position - 1);
+                    a_input_ptr->u32size--;
+                }
+                break;
+            default:
+                /* continue with the end of another input */
+                other_ptr = &g_corpus_arr[rand() % g_u32corpus_size];
+                if(other_ptr->u32size > 0)
+                {
+                    for(uint32 u32other = rand() % other_ptr->u32size ;
+                            u32other < other_ptr->u32size && u32position < FUZZ_MAX_INPUT_SIZE ;
+                            u32other++ , u32position++)
+                    {
+                        a_input_ptr->u8data_arr[u32position] = other_ptr->u8data_arr[u32other];
+                    }
+                    a_input_ptr->u32size = u32position;
+                }
+                break;
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Fuzz_crash_handler
+ *
+ * Description: 	save the running input when the firmware crashes.
+ *
+ * Inputs:			a_s32signal       (int)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Fuzz_crash_handler(int a_s32signal)
+{
+    Fuzz_save_input("crash" , (uint32)a_s32signal , &g_current_input);
+    _exit(3);
+}
+
+#endif
@@ -0,0 +1,420 @@
+/*******************************************************************************
+ *
+ * File:                hex_sim.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            host application that runs scenarios of script files
+ *                      on the production hex file by the instruction level
+ *                      core with the same models, so results and cycles are
+ *                      of the code built by XC8 and not of the host build.
+ *                      functions of the symbols file get their calls, self
+ *                      cycles and cycles with called functions.
+ *                      usage: hex_sim [-x hex] [-y sym] [-n functions] files...
+ *
+ * Revision history:    16/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "pic18_core.h"
+#include "scenario.h"
+#include "simulator.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+#define HEX_SIM_DEFAULT_HEX                 "../dist/default/production/SwiftAct_Project_event_trigger.X.production.hex"
+#define HEX_SIM_DEFAULT_SYM                 "../dist/default/production/SwiftAct_Project_event_trigger.X.production.sym"
+#define HEX_SIM_DEFAULT_FUNCTIONS           12u
+#define HEX_SIM_MAX_FUNCTIONS               256u
+#define HEX_SIM_NAME_SIZE                   64u
+/* code symbols of the end of functions are this prefix and function name */
+#define HEX_SIM_END_PREFIX                  "__end_of_"
+#define HEX_SIM_US_PER_S                    1000000.0
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/*************************** StrHex_sim_function_t *****************************/
+typedef struct{
+    char   name_arr[HEX_SIM_NAME_SIZE];
+    uint32 u32start;                    /* byte address */
+    uint32 u32end;                      /* first byte after the function or 0 */
+    uint32 u32calls;
+    uint64 u64self_cycles;
+    uint64 u64inclusive_cycles;
+}StrHex_sim_function_t;
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* functions of the symbols file and code which isn't in any of them */
+static StrHex_sim_function_t g_functions_arr[HEX_SIM_MAX_FUNCTIONS + 1];
+static uint32 g_u32functions_number = 0;
+/* functions ordered by self cycles of the last run */
+static StrHex_sim_function_t g_report_arr[HEX_SIM_MAX_FUNCTIONS + 1];
+/* scenario is static because it is large */
+static StrScenario_t g_scenario;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Hex_sim_load_symbols
+ *
+ * Description: 	load functions which have start and end code symbols from
+ *                  symbols file of XC8 (name, address, space, class, flags).
+ *
+ * Inputs:			a_file_name_ptr   (const char*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the file is loaded, FALSE otherwise (uint8)
+ *******************************************************************************/
+static uint8 Hex_sim_load_symbols(const char * a_file_name_ptr);
+
+/*******************************************************************************
+ * Function Name:	Hex_sim_collect_profile
+ *
+ * Description: 	add profile of every instruction address of the last run
+ *                  to the inner function which contains it.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Hex_sim_collect_profile(void);
+
+/*******************************************************************************
+ * Function Name:	Hex_sim_compare_cycles
+ *
+ * Description: 	order functions by self cycles for qsort (most first).
+ *
+ * Inputs:			a_first_ptr       (const void*)
+ *                  a_second_ptr      (const void*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			order (int)
+ *******************************************************************************/
+static int Hex_sim_compare_cycles(const void * a_first_ptr , const void * a_second_ptr);
+
+/*******************************************************************************
+ * Function Name:	Hex_sim_compare_addresses
+ *
+ * Description: 	order functions by start address for qsort.
+ *
+ * Inputs:			a_first_ptr       (const void*)
+ *                  a_second_ptr      (const void*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			order (int)
+ *******************************************************************************/
+static int Hex_sim_compare_addresses(const void * a_first_ptr , const void * a_second_ptr);
+
+/* host application */
+int main(int argc , char * argv[])
+{
+    const char * hex_file_ptr = HEX_SIM_DEFAULT_HEX;
+    const char * sym_file_ptr = HEX_SIM_DEFAULT_SYM;
+    uint32 u32functions = HEX_SIM_DEFAULT_FUNCTIONS;
+    uint32 u32scenarios = 0;
+    uint32 u32failed = 0;
+    sint32 s32option = 0;
+    uint64 u64cycles = 0;
+    StrScenario_reader_t reader;
+    StrScenario_result_t result;
+    StrHex_sim_function_t * function_ptr = NULL_PTR;
+    char error_arr[SCENARIO_MESSAGE_SIZE];
+    while((s32option = getopt(argc , argv , "x:y:n:")) != -1)
+    {
+        if(s32option == 'x')
+        {
+            hex_file_ptr = optarg;
+        }
+        else if(s32option == 'y')
+        {
+            sym_file_ptr = optarg;
+        }
+        else if(s32option == 'n')
+        {
+            u32functions = (uint32)strtoul(optarg , NULL_PTR , 10);
+        }
+        else
+        {
+            fprintf(stderr , "usage: %s [-x hex] [-y sym] [-n functions] files...\n" , argv[0]);
+            return 2;
+        }
+    }
+    if(Pic18_load_hex(hex_file_ptr) == FALSE)
+    {
+        fprintf(stderr , "%s: can't load hex file\n" , hex_file_ptr);
+        return 2;
+    }
+    else if(Hex_sim_load_symbols(sym_file_ptr) == FALSE)
+    {
+        fprintf(stderr , "%s: can't load symbols file\n" , sym_file_ptr);
+        return 2;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    Sim_save_firmware_state();
+    Scenario_set_firmware(Pic18_run , NULL_PTR , NULL_PTR);
+    for(sint32 s32file = optind ; s32file < argc ; s32file++)
+    {
+        if(Scenario_open(&reader , argv[s32file]) == FALSE)
+        {
+            fprintf(stderr , "%s: can't open file\n" , argv[s32file]);
+            return 2;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        error_arr[0] = '\0';
+        while(Scenario_read(&reader , &g_scenario , error_arr) == TRUE)
+        {
+            Scenario_run(&g_scenario , &result);
+            u64cycles = Pic18_get_cycles();
+            u32scenarios++;
+            if(result.u8passed == TRUE)
+            {
+                printf("PASS %-32s %8.3f s virtual %12llu cycles %12llu instructions\n" , g_scenario.name_arr ,
+                        result.u64virtual_time / HEX_SIM_US_PER_S , u64cycles , Pic18_get_instructions());
+            }
+            else
+            {
+                u32failed++;
+                printf("FAIL %-32s %8.3f s virtual %12llu cycles %12llu instructions\n     %s\n" , g_scenario.name_arr ,
+                        result.u64virtual_time / HEX_SIM_US_PER_S , u64cycles , Pic18_get_instructions() ,
+                        result.message_arr);
+            }
+            Hex_sim_collect_profile();
+            printf("     %-32s %10s %12s %6s %12s\n" , "function" , "calls" , "self cycles" , "self" , "with calls");
+            for(uint32 u32counter = 0 ; u32counter < u32functions && u32counter <= g_u32functions_number ; u32counter++)
+            {
+                function_ptr = &g_report_arr[u32counter];
+                if(function_ptr->u64self_cycles == 0)
+                {
+                    break;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+                printf("     %-32s %10u %12llu %5.1f%% %12llu\n" , function_ptr->name_arr , function_ptr->u32calls ,
+                        function_ptr->u64self_cycles , (u64cycles > 0) ? 100.0 * function_ptr->u64self_cycles / u64cycles : 0.0 ,
+                        function_ptr->u64inclusive_cycles);
+            }
+        }
+        Scenario_close(&reader);
+        if(error_arr[0] != '\0')
+        {
+            fprintf(stderr , "%s\n" , error_arr);
+            return 2;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    printf("%u scenarios, %u failed\n" , u32scenarios , u32failed);
+    return (u32failed > 0) ? 1 : 0;
+}
+
+/*******************************************************************************
+ * Function Name:	Hex_sim_load_symbols
+ *
+ * Description: 	load functions which have start and end code symbols from
+ *                  symbols file of XC8 (name, address, space, class, flags).
+ *
+ * Inputs:			a_file_name_ptr   (const char*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the file is loaded, FALSE otherwise (uint8)
+ *******************************************************************************/
+static uint8 Hex_sim_load_symbols(const char * a_file_name_ptr)
+{
+    FILE * file_ptr = fopen(a_file_name_ptr , "r");
+    char name_arr[HEX_SIM_NAME_SIZE];
+    char class_arr[HEX_SIM_NAME_SIZE];
+    uint32 u32address = 0;
+    uint32 u32symbol = 0;
+    const char * function_name_ptr = NULL_PTR;
+    uint8 u8end_flag = FALSE;
+    if(file_ptr == NULL_PTR)
+    {
+        return FALSE;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    while(fscanf(file_ptr , "%63s %x %*s %63s %*s" , name_arr , &u32address , class_arr) == 3)
+    {
+        /* functions are _name symbols and their ends are __end_of_name ones */
+        u8end_flag = (strncmp(name_arr , HEX_SIM_END_PREFIX , strlen(HEX_SIM_END_PREFIX)) == 0) ? TRUE : FALSE;
+        function_name_ptr = (u8end_flag == TRUE) ? &name_arr[strlen(HEX_SIM_END_PREFIX)] : &name_arr[1];
+        if(strcmp(class_arr , "CODE") != 0 || name_arr[0] != '_' || strchr(name_arr , '@') != NULL_PTR)
+        {
+            continue;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        for(u32symbol = 0 ; u32symbol < g_u32functions_number ; u32symbol++)
+        {
+            if(strcmp(g_functions_arr[u32symbol].name_arr , function_name_ptr) == 0)
+            {
+                break;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        if(u32symbol == g_u32functions_number && g_u32functions_number < HEX_SIM_MAX_FUNCTIONS)
+        {
+            memset(&g_functions_arr[u32symbol] , 0 , sizeof(StrHex_sim_function_t));
+            snprintf(g_functions_arr[u32symbol].name_arr , HEX_SIM_NAME_SIZE , "%s" , function_name_ptr);
+            g_u32functions_number++;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        if(u32symbol == g_u32functions_number)
+        {
+            /* Do nothing */
+        }
+        else if(u8end_flag == TRUE)
+        {
+            g_functions_arr[u32symbol].u32end = u32address;
+        }
+        else
+        {
+            g_functions_arr[u32symbol].u32start = u32address;
+        }
+    }
+    fclose(file_ptr);
+    /* symbols without end aren't functions */
+    u32symbol = 0;
+    for(uint32 u32counter = 0 ; u32counter < g_u32functions_number ; u32counter++)
+    {
+        if(g_functions_arr[u32counter].u32end > g_functions_arr[u32counter].u32start)
+        {
+            g_functions_arr[u32symbol] = g_functions_arr[u32counter];
+            u32symbol++;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    g_u32functions_number = u32symbol;
+    qsort(g_functions_arr , g_u32functions_number , sizeof(StrHex_sim_function_t) , Hex_sim_compare_addresses);
+    memset(&g_functions_arr[g_u32functions_number] , 0 , sizeof(StrHex_sim_function_t));
+    strcpy(g_functions_arr[g_u32functions_number].name_arr , "(other code)");
+    return (g_u32functions_number > 0) ? TRUE : FALSE;
+}
+
+/*******************************************************************************
+ * Function Name:	Hex_sim_collect_profile
+ *
+ * Description: 	add profile of every instruction address of the last run
+ *                  to the inner function which contains it.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Hex_sim_collect_profile(void)
+{
+    StrHex_sim_function_t * function_ptr = NULL_PTR;
+    for(uint32 u32counter = 0 ; u32counter <= g_u32functions_number ; u32counter++)
+    {
+        g_functions_arr[u32counter].u32calls = 0;
+        g_functions_arr[u32counter].u64self_cycles = 0;
+        g_functions_arr[u32counter].u64inclusive_cycles = 0;
+    }
+    for(uint32 u32address = 0 ; u32address < PIC18_PROGRAM_SIZE ; u32address += 2)
+    {
+        /* functions are sorted by address so the inner one is the last one
+         * which contains the address (the interrupt function contains the
+         * others from its vector) */
+        function_ptr = &g_functions_arr[g_u32functions_number];
+        for(uint32 u32counter = 0 ; u32counter < g_u32functions_number ; u32counter++)
+        {
+            if(g_functions_arr[u32counter].u32start <= u32address && u32address < g_functions_arr[u32counter].u32end)
+            {
+                function_ptr = &g_functions_arr[u32counter];
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        function_ptr->u32calls += Pic18_get_calls(u32address);
+        function_ptr->u64self_cycles += Pic18_get_self_cycles(u32address);
+        function_ptr->u64inclusive_cycles += Pic18_get_inclusive_cycles(u32address);
+    }
+    /* code out of the functions is shown in the table as function */
+    memcpy(g_report_arr , g_functions_arr , sizeof(StrHex_sim_function_t) * (g_u32functions_number + 1));
+    qsort(g_report_arr , g_u32functions_number + 1 , sizeof(StrHex_sim_function_t) , Hex_sim_compare_cycles);
+}
+
+/*******************************************************************************
+ * Function Name:	Hex_sim_compare_cycles
+ *
+ * Description: 	order functions by self cycles for qsort (most first).
+ *
+ * Inputs:			a_first_ptr       (const void*)
+ *                  a_second_ptr      (const void*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			order (int)
+ *******************************************************************************/
+static int Hex_sim_compare_cycles(const void * a_first_ptr , const void * a_second_ptr)
+{
+    uint64 u64first = ((const StrHex_sim_function_t *)a_first_ptr)->u64self_cycles;
+    uint64 u64second = ((const StrHex_sim_function_t *)a_second_ptr)->u64self_cycles;
+    return (u64first < u64second) ? 1 : (u64first > u64second) ? -1 : 0;
+}
+
+/*******************************************************************************
+ * Function Name:	Hex_sim_compare_addresses
+ *
+ * Description: 	order functions by start address for qsort.
+ *
+ * Inputs:			a_first_ptr       (const void*)
+ *                  a_second_ptr      (const void*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			order (int)
+ *******************************************************************************/
+static int Hex_sim_compare_addresses(const void * a_first_ptr , const void * a_second_ptr)
+{
+    uint32 u32first = ((const StrHex_sim_function_t *)a_first_ptr)->u32start;
+    uint32 u32second = ((const StrHex_sim_function_t *)a_second_ptr)->u32start;
+    return (u32first > u32second) ? 1 : (u32first < u32second) ? -1 : 0;
+}
@@ -0,0 +1,394 @@
+/*******************************************************************************
+ *
+ * File:                peripherals_model.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of simulated
+ *                      internal peripherals of PIC18F4520 (ADC and data
+ *                      EEPROM), their operations finish after their real time
+ *                      on the virtual clock by events of the simulator.
+ *
+ * Revision history:    8/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "peripherals_model.h"
+#include "simulator.h"
+#include "ADC_MemMap.h"
+#include "EEPROM_MemMap.h"
+#include "interrupt_MemMap.h"
+#include "helped_macros.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* registers addresses, models access the register file directly */
+#define MODEL_ADC_CONTROL_0_ADDRESS         0xFC2u
+#define MODEL_ADC_CONTROL_2_ADDRESS         0xFC0u
+#define MODEL_ADC_VALUE_HIGH_ADDRESS        0xFC4u
+#define MODEL_ADC_VALUE_LOW_ADDRESS         0xFC3u
+#define MODEL_EEPROM_CONTROL_1_ADDRESS      0xFA6u
+#define MODEL_EEPROM_CONTROL_2_ADDRESS      0xFA7u
+#define MODEL_EEPROM_DATA_ADDRESS           0xFA8u
+#define MODEL_EEPROM_ADDRESS_ADDRESS        0xFA9u
+#define MODEL_PERIPHERAL_FLAGS_1_ADDRESS    0xF9Eu
+#define MODEL_PERIPHERAL_FLAGS_2_ADDRESS    0xFA1u
+/* steps of EEPROM write unlock sequence */
+#define MODEL_EEPROM_UNLOCK_NONE            0u
+#define MODEL_EEPROM_UNLOCK_55              1u
+#define MODEL_EEPROM_UNLOCK_AA              2u
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* analog inputs in mV */
+static uint16 g_u16analog_voltages_arr[MODEL_ADC_CHANNELS_NUMBER];
+/* running conversion and its end time in instruction cycles */
+static uint8 g_u8adc_converting_flag = FALSE;
+static uint8 g_u8adc_channel = 0;
+static uint64 g_u64adc_end_cycle = 0;
+/* data EEPROM memory and running write cycle */
+static uint8 g_u8eeprom_arr[MODEL_EEPROM_SIZE];
+static uint8 g_u8eeprom_unlock_step = MODEL_EEPROM_UNLOCK_NONE;
+static uint8 g_u8eeprom_writing_flag = FALSE;
+static uint8 g_u8eeprom_write_address = 0;
+static uint8 g_u8eeprom_write_data = 0;
+static uint64 g_u64eeprom_end_cycle = 0;
+static uint32 g_u32eeprom_write_cycles = 0;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Models_write_callback
+ *
+ * Description: 	start ADC conversion or EEPROM read/write when the
+ *                  firmware sets their control bits.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *                  a_u8old_value     (uint8)
+ *                  a_u8new_value     (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Models_write_callback(uint16 a_u16address , uint8 a_u8old_value , uint8 a_u8new_value);
+
+/*******************************************************************************
+ * Function Name:	Models_event_callback
+ *
+ * Description: 	finish ADC conversion or EEPROM write cycle at the end of
+ *                  their time.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Models_event_callback(void);
+
+/*******************************************************************************
+ * Function Name:	Models_schedule_event
+ *
+ * Description: 	set event of the models at the end of the nearest running
+ *                  operation.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Models_schedule_event(void);
+
+/* the models are attached to the register file by this structure */
+static const StrSim_peripheral_t g_models_peripheral = {Models_write_callback , NULL_PTR , Models_event_callback};
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Models_Initialization
+ *
+ * Description: 	reset ADC and data EEPROM models (EEPROM is erased) and
+ *                  attach them to the simulator register file.
+ *                  note: it should be called after Sim_Initialization.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Models_Initialization(void)
+{
+    for(uint8 u8counter = 0 ; u8counter < MODEL_ADC_CHANNELS_NUMBER ; u8counter++)
+    {
+        g_u16analog_voltages_arr[u8counter] = 0;
+    }
+    g_u8adc_converting_flag = FALSE;
+    for(uint16 u16counter = 0 ; u16counter < MODEL_EEPROM_SIZE ; u16counter++)
+    {
+        g_u8eeprom_arr[u16counter] = 0xFF;
+    }
+    g_u8eeprom_unlock_step = MODEL_EEPROM_UNLOCK_NONE;
+    g_u8eeprom_writing_flag = FALSE;
+    g_u32eeprom_write_cycles = 0;
+    Sim_add_peripheral(&g_models_peripheral);
+}
+
+/*******************************************************************************
+ * Function Name:	Model_ADC_set_voltage
+ *
+ * Description: 	set voltage of analog input which is converted by the next
+ *                  conversion on this channel.
+ *
+ * Inputs:			a_u8channel       (uint8) from 0 to 12
+ *                  a_u16voltage      (uint16) voltage in mV from 0 to 5000
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Model_ADC_set_voltage(uint8 a_u8channel , uint16 a_u16voltage)
+{
+    if(a_u8channel < MODEL_ADC_CHANNELS_NUMBER)
+    {
+        g_u16analog_voltages_arr[a_u8channel] = (a_u16voltage > MODEL_ADC_REFERENCE_VOLTAGE) ?
+                MODEL_ADC_REFERENCE_VOLTAGE : a_u16voltage;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Model_EEPROM_get_memory
+ *
+ * Description: 	get the data EEPROM memory to check or preload its content.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			pointer to MODEL_EEPROM_SIZE bytes (uint8*)
+ *******************************************************************************/
+uint8 * Model_EEPROM_get_memory(void)
+{
+    return g_u8eeprom_arr;
+}
+
+/*******************************************************************************
+ * Function Name:	Model_EEPROM_get_write_cycles
+ *
+ * Description: 	get number of write cycles to measure EEPROM wear.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			number of write cycles (uint32)
+ *******************************************************************************/
+uint32 Model_EEPROM_get_write_cycles(void)
+{
+    return g_u32eeprom_write_cycles;
+}
+
+/*******************************************************************************
+ * Function Name:	Models_write_callback
+ *
+ * Description: 	start ADC conversion or EEPROM read/write when the
+ *                  firmware sets their control bits.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *                  a_u8old_value     (uint8)
+ *                  a_u8new_value     (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Models_write_callback(uint16 a_u16address , uint8 a_u8old_value , uint8 a_u8new_value)
+{
+    switch(a_u16address)
+    {
+        case MODEL_ADC_CONTROL_0_ADDRESS:
+            /* conversion starts by setting GO bit while the module is enabled */
+            if(GET_BIT(a_u8new_value , ADC_START_CONVERSION_BIT) && !GET_BIT(a_u8old_value , ADC_START_CONVERSION_BIT) &&
+                    GET_BIT(a_u8new_value , ADC_ENABLE_BIT))
+            {
+                g_u8adc_converting_flag = TRUE;
+                g_u8adc_channel = (a_u8new_value >> ADC_SELECT_CHANNEL_BIT_0) & 0x0F;
+                g_u64adc_end_cycle = Sim_get_cycles() + MODEL_ADC_CONVERSION_TIME * SIM_CYCLES_PER_US;
+                Models_schedule_event();
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            break;
+        case MODEL_EEPROM_CONTROL_2_ADDRESS:
+            /* write cycle is allowed only after writing 0x55 then 0xAA */
+            if(a_u8new_value == 0x55)
+            {
+                g_u8eeprom_unlock_step = MODEL_EEPROM_UNLOCK_55;
+            }
+            else if(a_u8new_value == 0xAA && g_u8eeprom_unlock_step == MODEL_EEPROM_UNLOCK_55)
+            {
+                g_u8eeprom_unlock_step = MODEL_EEPROM_UNLOCK_AA;
+            }
+            else
+            {
+                g_u8eeprom_unlock_step = MODEL_EEPROM_UNLOCK_NONE;
+            }
+            break;
+        case MODEL_EEPROM_CONTROL_1_ADDRESS:
+            if(GET_BIT(a_u8new_value , EEPROM_READ_CONTROL_BIT))
+            {
+                /* data is available in the next instruction cycle */
+                Sim_write_register(MODEL_EEPROM_DATA_ADDRESS ,
+                        g_u8eeprom_arr[Sim_read_register(MODEL_EEPROM_ADDRESS_ADDRESS)]);
+                CLEAR_BIT(a_u8new_value , EEPROM_READ_CONTROL_BIT);
+                Sim_write_register(MODEL_EEPROM_CONTROL_1_ADDRESS , a_u8new_value);
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            if(GET_BIT(a_u8new_value , EEPROM_WRITE_CONTROL_BIT) && !GET_BIT(a_u8old_value , EEPROM_WRITE_CONTROL_BIT))
+            {
+                if(GET_BIT(a_u8new_value , EEPROM_WRITE_ENABLE_BIT) && g_u8eeprom_unlock_step == MODEL_EEPROM_UNLOCK_AA)
+                {
+                    g_u8eeprom_writing_flag = TRUE;
+                    g_u8eeprom_write_address = Sim_read_register(MODEL_EEPROM_ADDRESS_ADDRESS);
+                    g_u8eeprom_write_data = Sim_read_register(MODEL_EEPROM_DATA_ADDRESS);
+                    g_u64eeprom_end_cycle = Sim_get_cycles() + MODEL_EEPROM_WRITE_TIME * SIM_CYCLES_PER_US;
+                    Models_schedule_event();
+                }
+                else
+                {
+                    /* WR bit can't be set without the unlock sequence */
+                    CLEAR_BIT(a_u8new_value , EEPROM_WRITE_CONTROL_BIT);
+                    Sim_write_register(MODEL_EEPROM_CONTROL_1_ADDRESS , a_u8new_value);
+                }
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            g_u8eeprom_unlock_step = MODEL_EEPROM_UNLOCK_NONE;
+            break;
+        default:
+            /* the unlock sequence must not be interrupted by other writes */
+            g_u8eeprom_unlock_step = MODEL_EEPROM_UNLOCK_NONE;
+            break;
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Models_event_callback
+ *
+ * Description: 	finish ADC conversion or EEPROM write cycle at the end of
+ *                  their time.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Models_event_callback(void)
+{
+    /* result of ADC conversion */
+    uint16 u16result = 0;
+    if(g_u8adc_converting_flag == TRUE && Sim_get_cycles() >= g_u64adc_end_cycle)
+    {
+        g_u8adc_converting_flag = FALSE;
+        if(g_u8adc_channel < MODEL_ADC_CHANNELS_NUMBER)
+        {
+            u16result = (uint32)g_u16analog_voltages_arr[g_u8adc_channel] * MODEL_ADC_MAX_VALUE /
+                    MODEL_ADC_REFERENCE_VOLTAGE;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        /* save the result in the selected justification format */
+        if(GET_BIT(Sim_read_register(MODEL_ADC_CONTROL_2_ADDRESS) , ADC_SELECT_RESULT_FORMAT))
+        {
+            Sim_write_register(MODEL_ADC_VALUE_HIGH_ADDRESS , (uint8)(u16result >> 8));
+            Sim_write_register(MODEL_ADC_VALUE_LOW_ADDRESS , (uint8)u16result);
+        }
+        else
+        {
+            Sim_write_register(MODEL_ADC_VALUE_HIGH_ADDRESS , (uint8)(u16result >> 2));
+            Sim_write_register(MODEL_ADC_VALUE_LOW_ADDRESS , (uint8)(u16result << 6));
+        }
+        Sim_write_register(MODEL_ADC_CONTROL_0_ADDRESS ,
+                Sim_read_register(MODEL_ADC_CONTROL_0_ADDRESS) & ~(1 << ADC_START_CONVERSION_BIT));
+        Sim_write_register(MODEL_PERIPHERAL_FLAGS_1_ADDRESS ,
+                Sim_read_register(MODEL_PERIPHERAL_FLAGS_1_ADDRESS) | (1 << ADC_CONVERTER_INTERRUPT_FLAG_BIT));
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    if(g_u8eeprom_writing_flag == TRUE && Sim_get_cycles() >= g_u64eeprom_end_cycle)
+    {
+        g_u8eeprom_writing_flag = FALSE;
+        g_u8eeprom_arr[g_u8eeprom_write_address] = g_u8eeprom_write_data;
+        g_u32eeprom_write_cycles++;
+        Sim_write_register(MODEL_EEPROM_CONTROL_1_ADDRESS ,
+                Sim_read_register(MODEL_EEPROM_CONTROL_1_ADDRESS) & ~(1 << EEPROM_WRITE_CONTROL_BIT));
+        Sim_write_register(MODEL_PERIPHERAL_FLAGS_2_ADDRESS ,
+                Sim_read_register(MODEL_PERIPHERAL_FLAGS_2_ADDRESS) | (1 << EEPROM_WRITE_INTERRUPT_FLAG_BIT));
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    Models_schedule_event();
+}
+
+/*******************************************************************************
+ * Function Name:	Models_schedule_event
+ *
+ * Description: 	set event of the models at the end of the nearest running
+ *                  operation.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Models_schedule_event(void)
+{
+    uint64 u64event_cycle = SIM_NO_EVENT;
+    if(g_u8adc_converting_flag == TRUE)
+    {
+        u64event_cycle = g_u64adc_end_cycle;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    if(g_u8eeprom_writing_flag == TRUE && g_u64eeprom_end_cycle < u64event_cycle)
+    {
+        u64event_cycle = g_u64eeprom_end_cycle;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    Sim_schedule_event(&g_models_peripheral , u64event_cycle);
+}
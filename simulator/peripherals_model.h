@@ -0,0 +1,100 @@
+/*******************************************************************************
+ *
+ * File:                peripherals_model.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes and definitions of
+ *                      simulated internal peripherals of PIC18F4520 which the
+ *                      firmware waits for their hardware flags (ADC and data
+ *                      EEPROM).
+ *
+ * Revision history:    8/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef PERIPHERALS_MODEL_H
+#define	PERIPHERALS_MODEL_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* ADC has 13 channels with 10 bits result referenced to 5V */
+#define MODEL_ADC_CHANNELS_NUMBER           13u
+#define MODEL_ADC_MAX_VALUE                 1023u
+#define MODEL_ADC_REFERENCE_VOLTAGE         5000u
+/* time of acquisition and conversion with the firmware configuration in us */
+#define MODEL_ADC_CONVERSION_TIME           32u
+/* data EEPROM size and time of write cycle in us */
+#define MODEL_EEPROM_SIZE                   256u
+#define MODEL_EEPROM_WRITE_TIME             4000u
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Models_Initialization
+ *
+ * Description: 	reset ADC and data EEPROM models (EEPROM is erased) and
+ *                  attach them to the simulator register file.
+ *                  note: it should be called after Sim_Initialization.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Models_Initialization(void);
+
+/*******************************************************************************
+ * Function Name:	Model_ADC_set_voltage
+ *
+ * Description: 	set voltage of analog input which is converted by the next
+ *                  conversion on this channel.
+ *
+ * Inputs:			a_u8channel       (uint8) from 0 to 12
+ *                  a_u16voltage      (uint16) voltage in mV from 0 to 5000
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Model_ADC_set_voltage(uint8 a_u8channel , uint16 a_u16voltage);
+
+/*******************************************************************************
+ * Function Name:	Model_EEPROM_get_memory
+ *
+ * Description: 	get the data EEPROM memory to check or preload its content.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			pointer to MODEL_EEPROM_SIZE bytes (uint8*)
+ *******************************************************************************/
+extern uint8 * Model_EEPROM_get_memory(void);
+
+/*******************************************************************************
+ * Function Name:	Model_EEPROM_get_write_cycles
+ *
+ * Description: 	get number of write cycles to measure EEPROM wear.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			number of write cycles (uint32)
+ *******************************************************************************/
+extern uint32 Model_EEPROM_get_write_cycles(void);
+
+#endif	/* PERIPHERALS_MODEL_H */
+
@@ -0,0 +1,1687 @@
+/*******************************************************************************
+ *
+ * File:                pic18_core.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of instruction
+ *                      level core of PIC18, the core owns registers from
+ *                      STATUS to TOSU (except INTCON registers) and all other
+ *                      data memory is the register file of the simulator, so
+ *                      models see the accesses of the compiled firmware as
+ *                      the accesses of its host build.
+ *                      cycles of every instruction are passed to the
+ *                      simulator clock after the instruction is executed.
+ *
+ * Revision history:    16/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "pic18_core.h"
+#include "simulator.h"
+#include "helped_macros.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* program counter and table pointer are 21 bits but program memory is less */
+#define PIC18_PC_MASK                       0x1FFFFEu
+#define PIC18_TABLE_POINTER_MASK            0x3FFFFFu
+#define PIC18_DATA_ADDRESS_MASK             0x0FFFu
+/* registers from STATUS to TOSU are owned by the core */
+#define PIC18_FIRST_CORE_ADDRESS            0xFD8u
+#define PIC18_CORE_REGISTERS_NUMBER         0x28u
+#define PIC18_REGISTER(ADDRESS)             g_u8core_registers_arr[(ADDRESS) - PIC18_FIRST_CORE_ADDRESS]
+#define PIC18_STATUS_ADDRESS                0xFD8u
+#define PIC18_FSR2L_ADDRESS                 0xFD9u
+#define PIC18_FSR2H_ADDRESS                 0xFDAu
+#define PIC18_BSR_ADDRESS                   0xFE0u
+#define PIC18_FSR1L_ADDRESS                 0xFE1u
+#define PIC18_FSR1H_ADDRESS                 0xFE2u
+#define PIC18_WREG_ADDRESS                  0xFE8u
+#define PIC18_FSR0L_ADDRESS                 0xFE9u
+#define PIC18_FSR0H_ADDRESS                 0xFEAu
+#define PIC18_INTCON3_ADDRESS               0xFF0u
+#define PIC18_INTCON_ADDRESS                0xFF2u
+#define PIC18_PRODL_ADDRESS                 0xFF3u
+#define PIC18_PRODH_ADDRESS                 0xFF4u
+#define PIC18_TABLAT_ADDRESS                0xFF5u
+#define PIC18_TBLPTRL_ADDRESS               0xFF6u
+#define PIC18_TBLPTRH_ADDRESS               0xFF7u
+#define PIC18_TBLPTRU_ADDRESS               0xFF8u
+#define PIC18_PCL_ADDRESS                   0xFF9u
+#define PIC18_PCLATH_ADDRESS                0xFFAu
+#define PIC18_PCLATU_ADDRESS                0xFFBu
+#define PIC18_STKPTR_ADDRESS                0xFFCu
+#define PIC18_TOSL_ADDRESS                  0xFFDu
+#define PIC18_TOSH_ADDRESS                  0xFFEu
+#define PIC18_TOSU_ADDRESS                  0xFFFu
+#define PIC18_RCON_ADDRESS                  0xFD0u
+/* indirect registers INDFn, POSTINCn, POSTDECn, PREINCn and PLUSWn of the 3
+ * FSRs are 5 registers of every 8 registers from PLUSW2 address */
+#define PIC18_FIRST_INDIRECT_ADDRESS        0xFDBu
+#define PIC18_INDIRECT_GROUPS               3u
+#define PIC18_INDIRECT_REGISTERS            5u
+#define PIC18_INDIRECT_GROUP_SIZE           8u
+#define PIC18_INDF                          4u
+#define PIC18_POSTINC                       3u
+#define PIC18_POSTDEC                       2u
+#define PIC18_PREINC                        1u
+#define PIC18_PLUSW                         0u
+/* STATUS bits */
+#define PIC18_C_BIT                         0u
+#define PIC18_DC_BIT                        1u
+#define PIC18_Z_BIT                         2u
+#define PIC18_OV_BIT                        3u
+#define PIC18_N_BIT                         4u
+#define PIC18_ALL_FLAGS                     0x1Fu
+/* STKPTR register */
+#define PIC18_STKFUL_BIT                    7u
+#define PIC18_STKUNF_BIT                    6u
+#define PIC18_STACK_POINTER_MASK            0x1Fu
+#define PIC18_STACK_FLAGS_MASK              0xC0u
+/* INTCON and RCON bits */
+#define PIC18_GIEH_BIT                      7u
+#define PIC18_GIEL_BIT                      6u
+#define PIC18_IPEN_BIT                      7u
+/* cycles of interrupt latency (forced call to the vector) */
+#define PIC18_INTERRUPT_CYCLES              3u
+/* frame of the return stack which isn't a call (PUSH instruction) */
+#define PIC18_NO_FRAME                      0xFFFFFFFFu
+/* Intel hex file */
+#define PIC18_HEX_LINE_SIZE                 600u
+#define PIC18_HEX_DATA_RECORD               0x00u
+#define PIC18_HEX_END_RECORD                0x01u
+#define PIC18_HEX_SEGMENT_RECORD            0x02u
+#define PIC18_HEX_LINEAR_RECORD             0x04u
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+static uint8 g_u8program_arr[PIC18_PROGRAM_SIZE];
+/* program counter (address of the next instruction) and registers of the core */
+static uint32 g_u32pc = PIC18_RESET_VECTOR;
+static uint8 g_u8core_registers_arr[PIC18_CORE_REGISTERS_NUMBER];
+static uint32 g_u32stack_arr[PIC18_STACK_LEVELS + 1];
+static uint8 g_u8stack_pointer = 0;
+/* shadow registers of fast call and return */
+static uint8 g_u8fast_wreg = 0;
+static uint8 g_u8fast_status = 0;
+static uint8 g_u8fast_bsr = 0;
+/* the instruction wrote PCL so it takes additional cycle */
+static uint8 g_u8pc_written_flag = FALSE;
+static uint64 g_u64instructions = 0;
+static uint64 g_u64cycles = 0;
+/* profile of the run, calls are counted at the level of the return stack
+ * which they push with the cycles at the call to add to the callee at return */
+static uint64 g_u64self_cycles_arr[PIC18_PROGRAM_SIZE / 2];
+static uint32 g_u32calls_arr[PIC18_PROGRAM_SIZE / 2];
+static uint64 g_u64inclusive_cycles_arr[PIC18_PROGRAM_SIZE / 2];
+static uint32 g_u32frame_callee_arr[PIC18_STACK_LEVELS + 1];
+static uint64 g_u64frame_start_arr[PIC18_STACK_LEVELS + 1];
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Pic18_reset
+ *
+ * Description: 	reset registers of the core, its return stack, counters
+ *                  and profile.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pic18_reset(void);
+
+/*******************************************************************************
+ * Function Name:	Pic18_step
+ *
+ * Description: 	execute one instruction and pass its cycles to the clock.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pic18_step(void);
+
+/*******************************************************************************
+ * Function Name:	Pic18_interrupt
+ *
+ * Description: 	vector interrupt request as the hardware does, return
+ *                  address is pushed, W, STATUS and BSR are saved in fast
+ *                  registers and global interrupt bit of the level is cleared.
+ *
+ * Inputs:			a_u8level         (uint8) SIM_LOW_INTERRUPT or
+ *                                    SIM_HIGH_INTERRUPT
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pic18_interrupt(uint8 a_u8level);
+
+/*******************************************************************************
+ * Function Name:	Pic18_execute_control
+ *
+ * Description: 	execute instruction whose high nibble is 0 (control,
+ *                  table and literal instructions, DECF and MULWF).
+ *
+ * Inputs:			a_u16word         (uint16) opcode
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles (uint8)
+ *******************************************************************************/
+static uint8 Pic18_execute_control(uint16 a_u16word);
+
+/*******************************************************************************
+ * Function Name:	Pic18_execute_byte
+ *
+ * Description: 	execute byte oriented file register instruction.
+ *
+ * Inputs:			a_u16word         (uint16) opcode
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles (uint8)
+ *******************************************************************************/
+static uint8 Pic18_execute_byte(uint16 a_u16word);
+
+/*******************************************************************************
+ * Function Name:	Pic18_execute_bit
+ *
+ * Description: 	execute bit oriented file register instruction.
+ *
+ * Inputs:			a_u16word         (uint16) opcode
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles (uint8)
+ *******************************************************************************/
+static uint8 Pic18_execute_bit(uint16 a_u16word);
+
+/*******************************************************************************
+ * Function Name:	Pic18_execute_branch
+ *
+ * Description: 	execute MOVFF, branch, call, goto and LFSR instructions.
+ *
+ * Inputs:			a_u16word         (uint16) opcode
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles (uint8)
+ *******************************************************************************/
+static uint8 Pic18_execute_branch(uint16 a_u16word);
+
+/*******************************************************************************
+ * Function Name:	Pic18_fetch
+ *
+ * Description: 	read instruction word of program memory.
+ *
+ * Inputs:			a_u32address      (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			word (uint16)
+ *******************************************************************************/
+static uint16 Pic18_fetch(uint32 a_u32address);
+
+/*******************************************************************************
+ * Function Name:	Pic18_file_address
+ *
+ * Description: 	get data address of file register instruction from its
+ *                  access bit and BSR, indirect registers are resolved to the
+ *                  address of their FSR which is modified once.
+ *
+ * Inputs:			a_u16word         (uint16) opcode
+ *
+ * Outputs:			NULL
+ *
+ * Return:			data address (uint16)
+ *******************************************************************************/
+static uint16 Pic18_file_address(uint16 a_u16word);
+
+/*******************************************************************************
+ * Function Name:	Pic18_resolve_address
+ *
+ * Description: 	get address which is accessed by data address, it is the
+ *                  same address or address of FSR if it is indirect register
+ *                  (with increment or decrement of the FSR).
+ *
+ * Inputs:			a_u16address      (uint16)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			data address (uint16)
+ *******************************************************************************/
+static uint16 Pic18_resolve_address(uint16 a_u16address);
+
+/*******************************************************************************
+ * Function Name:	Pic18_read
+ *
+ * Description: 	read data memory, registers of the core are read here and
+ *                  others from the register file of the simulator.
+ *
+ * Inputs:			a_u16address      (uint16) resolved address
+ *
+ * Outputs:			NULL
+ *
+ * Return:			value (uint8)
+ *******************************************************************************/
+static uint8 Pic18_read(uint16 a_u16address);
+
+/*******************************************************************************
+ * Function Name:	Pic18_write
+ *
+ * Description: 	write data memory, registers of the core are written here
+ *                  and others to the register file of the simulator.
+ *
+ * Inputs:			a_u16address      (uint16) resolved address
+ *                  a_u8value         (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pic18_write(uint16 a_u16address , uint8 a_u8value);
+
+/*******************************************************************************
+ * Function Name:	Pic18_add
+ *
+ * Description: 	add two bytes and carry and set C, DC, Z, OV and N flags,
+ *                  subtraction is addition of the complement with carry as
+ *                  not borrow.
+ *
+ * Inputs:			a_u8first         (uint8)
+ *                  a_u8second        (uint8)
+ *                  a_u8carry         (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			result (uint8)
+ *******************************************************************************/
+static uint8 Pic18_add(uint8 a_u8first , uint8 a_u8second , uint8 a_u8carry);
+
+/*******************************************************************************
+ * Function Name:	Pic18_set_zero_negative
+ *
+ * Description: 	set Z and N flags by result.
+ *
+ * Inputs:			a_u8result        (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pic18_set_zero_negative(uint8 a_u8result);
+
+/*******************************************************************************
+ * Function Name:	Pic18_call
+ *
+ * Description: 	push return address and jump to called address, the call
+ *                  is counted in the profile.
+ *
+ * Inputs:			a_u32address      (uint32) called address
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pic18_call(uint32 a_u32address);
+
+/*******************************************************************************
+ * Function Name:	Pic18_return
+ *
+ * Description: 	pop return address to the program counter, the cycles of
+ *                  the call are added to the called address in the profile.
+ *
+ * Inputs:			a_u8cycles        (uint8) cycles of the return instruction
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pic18_return(uint8 a_u8cycles);
+
+/*******************************************************************************
+ * Function Name:	Pic18_push
+ *
+ * Description: 	push address to the return stack, STKFUL bit is set when
+ *                  it is full.
+ *
+ * Inputs:			a_u32address      (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pic18_push(uint32 a_u32address);
+
+/*******************************************************************************
+ * Function Name:	Pic18_pop
+ *
+ * Description: 	pop address from the return stack, STKUNF bit is set when
+ *                  it is empty.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			address (uint32)
+ *******************************************************************************/
+static uint32 Pic18_pop(void);
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Pic18_load_hex
+ *
+ * Description: 	load program memory from Intel hex file, records of
+ *                  configuration words and ID locations are ignored.
+ *
+ * Inputs:			a_file_name_ptr   (const char*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the file is loaded, FALSE if it can't be opened
+ *                  or has invalid record (uint8)
+ *******************************************************************************/
+uint8 Pic18_load_hex(const char * a_file_name_ptr)
+{
+    uint8 retVal = FALSE;
+    FILE * file_ptr = fopen(a_file_name_ptr , "r");
+    char line_arr[PIC18_HEX_LINE_SIZE];
+    uint8 record_arr[PIC18_HEX_LINE_SIZE / 2];
+    uint32 u32base = 0;
+    uint32 u32address = 0;
+    uint32 u32size = 0;
+    uint32 u32byte = 0;
+    uint8 u8checksum = 0;
+    /* unprogrammed words are 0xFFFF */
+    memset(g_u8program_arr , 0xFF , sizeof(g_u8program_arr));
+    while(file_ptr != NULL_PTR && fgets(line_arr , sizeof(line_arr) , file_ptr) != NULL_PTR)
+    {
+        if(line_arr[0] != ':')
+        {
+            break;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        u32size = 0;
+        u8checksum = 0;
+        while(u32size < sizeof(record_arr) && sscanf(&line_arr[1 + u32size * 2] , "%2x" , &u32byte) == 1)
+        {
+            record_arr[u32size] = (uint8)u32byte;
+            u8checksum += (uint8)u32byte;
+            u32size++;
+        }
+        /* count, address, type and checksum with the data bytes */
+        if(u32size < 5 || u32size != record_arr[0] + 5u || u8checksum != 0)
+        {
+            break;
+        }
+        else if(record_arr[3] == PIC18_HEX_DATA_RECORD)
+        {
+            u32address = u32base + ((uint32)record_arr[1] << 8) + record_arr[2];
+            for(uint32 u32counter = 0 ; u32counter < record_arr[0] ; u32counter++)
+            {
+                if(u32address + u32counter < PIC18_PROGRAM_SIZE)
+                {
+                    g_u8program_arr[u32address + u32counter] = record_arr[4 + u32counter];
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+        }
+        else if(record_arr[3] == PIC18_HEX_END_RECORD)
+        {
+            retVal = TRUE;
+            break;
+        }
+        else if(record_arr[3] == PIC18_HEX_SEGMENT_RECORD)
+        {
+            u32base = (((uint32)record_arr[4] << 8) + record_arr[5]) << 4;
+        }
+        else if(record_arr[3] == PIC18_HEX_LINEAR_RECORD)
+        {
+            u32base = (((uint32)record_arr[4] << 8) + record_arr[5]) << 16;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    if(file_ptr != NULL_PTR)
+    {
+        fclose(file_ptr);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_run
+ *
+ * Description: 	reset the core and its profile and run the loaded program
+ *                  from reset vector, it is the entry function of Sim_run
+ *                  and it doesn't return.
+ *                  note: interrupt functions of the simulator should be
+ *                        NULL_PTR, the core vectors the interrupts itself.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Pic18_run(void)
+{
+    uint8 u8level = SIM_NO_INTERRUPT;
+    Pic18_reset();
+    while(1)
+    {
+        /* interrupt is vectored between instructions */
+        u8level = Sim_get_interrupt_request();
+        if(u8level != SIM_NO_INTERRUPT)
+        {
+            Pic18_interrupt(u8level);
+        }
+        else
+        {
+            Pic18_step();
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_get_instructions
+ *
+ * Description: 	get number of executed instructions in the last run.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			instructions (uint64)
+ *******************************************************************************/
+uint64 Pic18_get_instructions(void)
+{
+    return g_u64instructions;
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_get_cycles
+ *
+ * Description: 	get instruction cycles which are executed by the core in
+ *                  the last run including interrupts latency.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles (uint64)
+ *******************************************************************************/
+uint64 Pic18_get_cycles(void)
+{
+    return g_u64cycles;
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_get_self_cycles
+ *
+ * Description: 	get cycles of the instruction at program address in the
+ *                  last run.
+ *
+ * Inputs:			a_u32address      (uint32) byte address of the instruction
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles (uint64)
+ *******************************************************************************/
+uint64 Pic18_get_self_cycles(uint32 a_u32address)
+{
+    return (a_u32address < PIC18_PROGRAM_SIZE) ? g_u64self_cycles_arr[a_u32address >> 1] : 0;
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_get_calls
+ *
+ * Description: 	get number of calls (and interrupts vectoring) to program
+ *                  address in the last run.
+ *
+ * Inputs:			a_u32address      (uint32) byte address of called code
+ *
+ * Outputs:			NULL
+ *
+ * Return:			calls (uint32)
+ *******************************************************************************/
+uint32 Pic18_get_calls(uint32 a_u32address)
+{
+    return (a_u32address < PIC18_PROGRAM_SIZE) ? g_u32calls_arr[a_u32address >> 1] : 0;
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_get_inclusive_cycles
+ *
+ * Description: 	get cycles from calls to program address to their returns
+ *                  in the last run, it includes the called functions and
+ *                  interrupts in the middle of the calls.
+ *
+ * Inputs:			a_u32address      (uint32) byte address of called code
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles (uint64)
+ *******************************************************************************/
+uint64 Pic18_get_inclusive_cycles(uint32 a_u32address)
+{
+    return (a_u32address < PIC18_PROGRAM_SIZE) ? g_u64inclusive_cycles_arr[a_u32address >> 1] : 0;
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_reset
+ *
+ * Description: 	reset registers of the core, its return stack, counters
+ *                  and profile.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pic18_reset(void)
+{
+    g_u32pc = PIC18_RESET_VECTOR;
+    memset(g_u8core_registers_arr , 0 , sizeof(g_u8core_registers_arr));
+    memset(g_u32stack_arr , 0 , sizeof(g_u32stack_arr));
+    g_u8stack_pointer = 0;
+    g_u8fast_wreg = 0;
+    g_u8fast_status = 0;
+    g_u8fast_bsr = 0;
+    g_u8pc_written_flag = FALSE;
+    g_u64instructions = 0;
+    g_u64cycles = 0;
+    memset(g_u64self_cycles_arr , 0 , sizeof(g_u64self_cycles_arr));
+    memset(g_u32calls_arr , 0 , sizeof(g_u32calls_arr));
+    memset(g_u64inclusive_cycles_arr , 0 , sizeof(g_u64inclusive_cycles_arr));
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_step
+ *
+ * Description: 	execute one instruction and pass its cycles to the clock.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pic18_step(void)
+{
+    uint32 u32address = g_u32pc;
+    uint16 u16word = Pic18_fetch(u32address);
+    uint8 u8cycles = 1;
+    g_u32pc = (u32address + 2) & PIC18_PC_MASK;
+    switch(u16word >> 12)
+    {
+        case 0x0:
+            u8cycles = Pic18_execute_control(u16word);
+            break;
+        case 0x1:
+        case 0x2:
+        case 0x3:
+        case 0x4:
+        case 0x5:
+        case 0x6:
+            u8cycles = Pic18_execute_byte(u16word);
+            break;
+        case 0x7:
+        case 0x8:
+        case 0x9:
+        case 0xA:
+        case 0xB:
+            u8cycles = Pic18_execute_bit(u16word);
+            break;
+        case 0xC:
+        case 0xD:
+        case 0xE:
+            u8cycles = Pic18_execute_branch(u16word);
+            break;
+        default:
+            /* second word of skipped two words instruction is NOP */
+            break;
+    }
+    if(g_u8pc_written_flag == TRUE)
+    {
+        g_u8pc_written_flag = FALSE;
+        u8cycles++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    g_u64instructions++;
+    g_u64cycles += u8cycles;
+    if(u32address < PIC18_PROGRAM_SIZE)
+    {
+        g_u64self_cycles_arr[u32address >> 1] += u8cycles;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    Sim_bus_cycles(u8cycles);
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_interrupt
+ *
+ * Description: 	vector interrupt request as the hardware does, return
+ *                  address is pushed, W, STATUS and BSR are saved in fast
+ *                  registers and global interrupt bit of the level is cleared.
+ *
+ * Inputs:			a_u8level         (uint8) SIM_LOW_INTERRUPT or
+ *                                    SIM_HIGH_INTERRUPT
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pic18_interrupt(uint8 a_u8level)
+{
+    uint8 u8intcon = Sim_bus_read(PIC18_INTCON_ADDRESS);
+    uint32 u32vector = (a_u8level == SIM_LOW_INTERRUPT) ? PIC18_LOW_VECTOR : PIC18_HIGH_VECTOR;
+    g_u8fast_wreg = PIC18_REGISTER(PIC18_WREG_ADDRESS);
+    g_u8fast_status = PIC18_REGISTER(PIC18_STATUS_ADDRESS);
+    g_u8fast_bsr = PIC18_REGISTER(PIC18_BSR_ADDRESS);
+    if(a_u8level == SIM_LOW_INTERRUPT)
+    {
+        CLEAR_BIT(u8intcon , PIC18_GIEL_BIT);
+    }
+    else
+    {
+        CLEAR_BIT(u8intcon , PIC18_GIEH_BIT);
+    }
+    Sim_bus_write(PIC18_INTCON_ADDRESS , u8intcon);
+    Pic18_call(u32vector);
+    g_u64cycles += PIC18_INTERRUPT_CYCLES;
+    g_u64self_cycles_arr[u32vector >> 1] += PIC18_INTERRUPT_CYCLES;
+    Sim_bus_cycles(PIC18_INTERRUPT_CYCLES);
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_execute_control
+ *
+ * Description: 	execute instruction whose high nibble is 0 (control,
+ *                  table and literal instructions, DECF and MULWF).
+ *
+ * Inputs:			a_u16word         (uint16) opcode
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles (uint8)
+ *******************************************************************************/
+static uint8 Pic18_execute_control(uint16 a_u16word)
+{
+    uint8 retVal = 1;
+    uint8 u8literal = a_u16word & 0xFF;
+    uint8 u8wreg = PIC18_REGISTER(PIC18_WREG_ADDRESS);
+    uint8 u8status = 0;
+    uint16 u16result = 0;
+    uint32 u32pointer = 0;
+    switch(a_u16word >> 8)
+    {
+        case 0x00:
+            if(u8literal == 0x05)
+            {
+                /* PUSH */
+                Pic18_push(g_u32pc);
+                g_u32frame_callee_arr[g_u8stack_pointer & PIC18_STACK_POINTER_MASK] = PIC18_NO_FRAME;
+            }
+            else if(u8literal == 0x06)
+            {
+                /* POP */
+                Pic18_pop();
+            }
+            else if(u8literal == 0x07)
+            {
+                /* DAW */
+                u8status = PIC18_REGISTER(PIC18_STATUS_ADDRESS);
+                u16result = u8wreg;
+                if((u16result & 0x0F) > 9 || GET_BIT(u8status , PIC18_DC_BIT))
+                {
+                    u16result += 0x06;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+                if(u16result > 0x9F || GET_BIT(u8status , PIC18_C_BIT))
+                {
+                    u16result += 0x60;
+                    SET_BIT(u8status , PIC18_C_BIT);
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+                PIC18_REGISTER(PIC18_WREG_ADDRESS) = (uint8)u16result;
+                PIC18_REGISTER(PIC18_STATUS_ADDRESS) = u8status;
+            }
+            else if(u8literal >= 0x08 && u8literal <= 0x0F)
+            {
+                /* TBLRD and TBLWT with *, *+, *- and +* modes, writes of
+                 * program memory aren't supported */
+                u32pointer = PIC18_REGISTER(PIC18_TBLPTRL_ADDRESS) | ((uint32)PIC18_REGISTER(PIC18_TBLPTRH_ADDRESS) << 8) |
+                        ((uint32)PIC18_REGISTER(PIC18_TBLPTRU_ADDRESS) << 16);
+                if((u8literal & 0x03) == 0x03)
+                {
+                    u32pointer++;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+                if(u8literal < 0x0C)
+                {
+                    PIC18_REGISTER(PIC18_TABLAT_ADDRESS) = (u32pointer < PIC18_PROGRAM_SIZE) ? g_u8program_arr[u32pointer] : 0;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+                if((u8literal & 0x03) == 0x01)
+                {
+                    u32pointer++;
+                }
+                else if((u8literal & 0x03) == 0x02)
+                {
+                    u32pointer--;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+                u32pointer &= PIC18_TABLE_POINTER_MASK;
+                PIC18_REGISTER(PIC18_TBLPTRL_ADDRESS) = (uint8)u32pointer;
+                PIC18_REGISTER(PIC18_TBLPTRH_ADDRESS) = (uint8)(u32pointer >> 8);
+                PIC18_REGISTER(PIC18_TBLPTRU_ADDRESS) = (uint8)(u32pointer >> 16);
+                retVal = 2;
+            }
+            else if(u8literal == 0x10 || u8literal == 0x11)
+            {
+                /* RETFIE sets the global interrupt bit which is cleared by the
+                 * vectoring, high priority one first */
+                u8status = Sim_bus_read(PIC18_INTCON_ADDRESS);
+                if(GET_BIT(Sim_bus_read(PIC18_RCON_ADDRESS) , PIC18_IPEN_BIT) == 0 || GET_BIT(u8status , PIC18_GIEH_BIT) == 0)
+                {
+                    SET_BIT(u8status , PIC18_GIEH_BIT);
+                }
+                else
+                {
+                    SET_BIT(u8status , PIC18_GIEL_BIT);
+                }
+                Sim_bus_write(PIC18_INTCON_ADDRESS , u8status);
+                retVal = 2;
+                Pic18_return(retVal);
+                if(u8literal == 0x11)
+                {
+                    PIC18_REGISTER(PIC18_WREG_ADDRESS) = g_u8fast_wreg;
+                    PIC18_REGISTER(PIC18_STATUS_ADDRESS) = g_u8fast_status;
+                    PIC18_REGISTER(PIC18_BSR_ADDRESS) = g_u8fast_bsr;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+            else if(u8literal == 0x12 || u8literal == 0x13)
+            {
+                /* RETURN */
+                retVal = 2;
+                Pic18_return(retVal);
+                if(u8literal == 0x13)
+                {
+                    PIC18_REGISTER(PIC18_WREG_ADDRESS) = g_u8fast_wreg;
+                    PIC18_REGISTER(PIC18_STATUS_ADDRESS) = g_u8fast_status;
+                    PIC18_REGISTER(PIC18_BSR_ADDRESS) = g_u8fast_bsr;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+            else if(u8literal == 0xFF)
+            {
+                /* RESET restarts the program with the same peripherals */
+                g_u32pc = PIC18_RESET_VECTOR;
+                g_u8stack_pointer = 0;
+            }
+            else
+            {
+                /* NOP, SLEEP and CLRWDT */
+            }
+            break;
+        case 0x01:
+            /* MOVLB */
+            PIC18_REGISTER(PIC18_BSR_ADDRESS) = u8literal & 0x0F;
+            break;
+        case 0x08:
+            /* SUBLW */
+            PIC18_REGISTER(PIC18_WREG_ADDRESS) = Pic18_add(u8literal , ~u8wreg , 1);
+            break;
+        case 0x09:
+            /* IORLW */
+            PIC18_REGISTER(PIC18_WREG_ADDRESS) = u8wreg | u8literal;
+            Pic18_set_zero_negative(u8wreg | u8literal);
+            break;
+        case 0x0A:
+            /* XORLW */
+            PIC18_REGISTER(PIC18_WREG_ADDRESS) = u8wreg ^ u8literal;
+            Pic18_set_zero_negative(u8wreg ^ u8literal);
+            break;
+        case 0x0B:
+            /* ANDLW */
+            PIC18_REGISTER(PIC18_WREG_ADDRESS) = u8wreg & u8literal;
+            Pic18_set_zero_negative(u8wreg & u8literal);
+            break;
+        case 0x0C:
+            /* RETLW */
+            PIC18_REGISTER(PIC18_WREG_ADDRESS) = u8literal;
+            retVal = 2;
+            Pic18_return(retVal);
+            break;
+        case 0x0D:
+            /* MULLW */
+            u16result = (uint16)u8wreg * u8literal;
+            PIC18_REGISTER(PIC18_PRODL_ADDRESS) = (uint8)u16result;
+            PIC18_REGISTER(PIC18_PRODH_ADDRESS) = (uint8)(u16result >> 8);
+            break;
+        case 0x0E:
+            /* MOVLW */
+            PIC18_REGISTER(PIC18_WREG_ADDRESS) = u8literal;
+            break;
+        case 0x0F:
+            /* ADDLW */
+            PIC18_REGISTER(PIC18_WREG_ADDRESS) = Pic18_add(u8wreg , u8literal , 0);
+            break;
+        default:
+            /* MULWF and DECF */
+            retVal = Pic18_execute_byte(a_u16word);
+            break;
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_execute_byte
+ *
+ * Description: 	execute byte oriented file register instruction.
+ *
+ * Inputs:			a_u16word         (uint16) opcode
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles (uint8)
+ *******************************************************************************/
+static uint8 Pic18_execute_byte(uint16 a_u16word)
+{
+    uint8 retVal = 1;
+    uint16 u16address = Pic18_file_address(a_u16word);
+    uint8 u8value = Pic18_read(u16address);
+    uint8 u8wreg = PIC18_REGISTER(PIC18_WREG_ADDRESS);
+    uint8 u8carry = GET_BIT(PIC18_REGISTER(PIC18_STATUS_ADDRESS) , PIC18_C_BIT);
+    uint8 u8result = 0;
+    uint8 u8store_flag = TRUE;
+    uint8 u8skip_flag = FALSE;
+    uint16 u16product = 0;
+    switch(a_u16word >> 10)
+    {
+        case 0x00:
+            /* MULWF */
+            u16product = (uint16)u8wreg * u8value;
+            PIC18_REGISTER(PIC18_PRODL_ADDRESS) = (uint8)u16product;
+            PIC18_REGISTER(PIC18_PRODH_ADDRESS) = (uint8)(u16product >> 8);
+            u8store_flag = FALSE;
+            break;
+        case 0x01:
+            /* DECF */
+            u8result = Pic18_add(u8value , 0xFF , 0);
+            break;
+        case 0x04:
+            /* IORWF */
+            u8result = u8value | u8wreg;
+            Pic18_set_zero_negative(u8result);
+            break;
+        case 0x05:
+            /* ANDWF */
+            u8result = u8value & u8wreg;
+            Pic18_set_zero_negative(u8result);
+            break;
+        case 0x06:
+            /* XORWF */
+            u8result = u8value ^ u8wreg;
+            Pic18_set_zero_negative(u8result);
+            break;
+        case 0x07:
+            /* COMF */
+            u8result = ~u8value;
+            Pic18_set_zero_negative(u8result);
+            break;
+        case 0x08:
+            /* ADDWFC */
+            u8result = Pic18_add(u8value , u8wreg , u8carry);
+            break;
+        case 0x09:
+            /* ADDWF */
+            u8result = Pic18_add(u8value , u8wreg , 0);
+            break;
+        case 0x0A:
+            /* INCF */
+            u8result = Pic18_add(u8value , 1 , 0);
+            break;
+        case 0x0B:
+            /* DECFSZ */
+            u8result = u8value - 1;
+            u8skip_flag = (u8result == 0) ? TRUE : FALSE;
+            break;
+        case 0x0C:
+            /* RRCF */
+            u8result = (u8value >> 1) | (u8carry << 7);
+            PIC18_REGISTER(PIC18_STATUS_ADDRESS) = (PIC18_REGISTER(PIC18_STATUS_ADDRESS) & ~(1 << PIC18_C_BIT)) | (u8value & 0x01);
+            Pic18_set_zero_negative(u8result);
+            break;
+        case 0x0D:
+            /* RLCF */
+            u8result = (u8value << 1) | u8carry;
+            PIC18_REGISTER(PIC18_STATUS_ADDRESS) = (PIC18_REGISTER(PIC18_STATUS_ADDRESS) & ~(1 << PIC18_C_BIT)) | (u8value >> 7);
+            Pic18_set_zero_negative(u8result);
+            break;
+        case 0x0E:
+            /* SWAPF */
+            u8result = (u8value << 4) | (u8value >> 4);
+            break;
+        case 0x0F:
+            /* INCFSZ */
+            u8result = u8value + 1;
+            u8skip_flag = (u8result == 0) ? TRUE : FALSE;
+            break;
+        case 0x10:
+            /* RRNCF */
+            u8result = (u8value >> 1) | (u8value << 7);
+            Pic18_set_zero_negative(u8result);
+            break;
+        case 0x11:
+            /* RLNCF */
+            u8result = (u8value << 1) | (u8value >> 7);
+            Pic18_set_zero_negative(u8result);
+            break;
+        case 0x12:
+            /* INFSNZ */
+            u8result = u8value + 1;
+            u8skip_flag = (u8result != 0) ? TRUE : FALSE;
+            break;
+        case 0x13:
+            /* DCFSNZ */
+            u8result = u8value - 1;
+            u8skip_flag = (u8result != 0) ? TRUE : FALSE;
+            break;
+        case 0x14:
+            /* MOVF */
+            u8result = u8value;
+            Pic18_set_zero_negative(u8result);
+            break;
+        case 0x15:
+            /* SUBFWB */
+            u8result = Pic18_add(u8wreg , ~u8value , u8carry);
+            break;
+        case 0x16:
+            /* SUBWFB */
+            u8result = Pic18_add(u8value , ~u8wreg , u8carry);
+            break;
+        case 0x17:
+            /* SUBWF */
+            u8result = Pic18_add(u8value , ~u8wreg , 1);
+            break;
+        default:
+            /* instructions without destination bit */
+            u8store_flag = FALSE;
+            switch((a_u16word >> 9) & 0x07)
+            {
+                case 0x0:
+                    /* CPFSLT */
+                    u8skip_flag = (u8value < u8wreg) ? TRUE : FALSE;
+                    break;
+                case 0x1:
+                    /* CPFSEQ */
+                    u8skip_flag = (u8value == u8wreg) ? TRUE : FALSE;
+                    break;
+                case 0x2:
+                    /* CPFSGT */
+                    u8skip_flag = (u8value > u8wreg) ? TRUE : FALSE;
+                    break;
+                case 0x3:
+                    /* TSTFSZ */
+                    u8skip_flag = (u8value == 0) ? TRUE : FALSE;
+                    break;
+                case 0x4:
+                    /* SETF */
+                    Pic18_write(u16address , 0xFF);
+                    break;
+                case 0x5:
+                    /* CLRF */
+                    Pic18_write(u16address , 0);
+                    SET_BIT(PIC18_REGISTER(PIC18_STATUS_ADDRESS) , PIC18_Z_BIT);
+                    break;
+                case 0x6:
+                    /* NEGF */
+                    Pic18_write(u16address , Pic18_add(0 , ~u8value , 1));
+                    break;
+                default:
+                    /* MOVWF */
+                    Pic18_write(u16address , u8wreg);
+                    break;
+            }
+            break;
+    }
+    if(u8store_flag == FALSE)
+    {
+        /* Do nothing */
+    }
+    else if(GET_BIT(a_u16word , 9) != 0)
+    {
+        Pic18_write(u16address , u8result);
+    }
+    else
+    {
+        PIC18_REGISTER(PIC18_WREG_ADDRESS) = u8result;
+    }
+    /* skipped instruction is NOP, second word of two words one is NOP too */
+    if(u8skip_flag == TRUE)
+    {
+        g_u32pc = (g_u32pc + 2) & PIC18_PC_MASK;
+        retVal++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_execute_bit
+ *
+ * Description: 	execute bit oriented file register instruction.
+ *
+ * Inputs:			a_u16word         (uint16) opcode
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles (uint8)
+ *******************************************************************************/
+static uint8 Pic18_execute_bit(uint16 a_u16word)
+{
+    uint8 retVal = 1;
+    uint16 u16address = Pic18_file_address(a_u16word);
+    uint8 u8value = Pic18_read(u16address);
+    uint8 u8bit = (a_u16word >> 9) & 0x07;
+    uint8 u8skip_flag = FALSE;
+    switch(a_u16word >> 12)
+    {
+        case 0x7:
+            /* BTG */
+            TOGGLE_BIT(u8value , u8bit);
+            Pic18_write(u16address , u8value);
+            break;
+        case 0x8:
+            /* BSF */
+            SET_BIT(u8value , u8bit);
+            Pic18_write(u16address , u8value);
+            break;
+        case 0x9:
+            /* BCF */
+            CLEAR_BIT(u8value , u8bit);
+            Pic18_write(u16address , u8value);
+            break;
+        case 0xA:
+            /* BTFSS */
+            u8skip_flag = (GET_BIT(u8value , u8bit) != 0) ? TRUE : FALSE;
+            break;
+        default:
+            /* BTFSC */
+            u8skip_flag = (GET_BIT(u8value , u8bit) == 0) ? TRUE : FALSE;
+            break;
+    }
+    if(u8skip_flag == TRUE)
+    {
+        g_u32pc = (g_u32pc + 2) & PIC18_PC_MASK;
+        retVal++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_execute_branch
+ *
+ * Description: 	execute MOVFF, branch, call, goto and LFSR instructions.
+ *
+ * Inputs:			a_u16word         (uint16) opcode
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles (uint8)
+ *******************************************************************************/
+static uint8 Pic18_execute_branch(uint16 a_u16word)
+{
+    uint8 retVal = 2;
+    uint16 u16second_word = 0;
+    uint16 u16address = 0;
+    uint8 u8value = 0;
+    uint8 u8status = PIC18_REGISTER(PIC18_STATUS_ADDRESS);
+    uint8 u8condition = 0;
+    sint16 s16offset = 0;
+    if((a_u16word >> 12) == 0xC)
+    {
+        /* MOVFF */
+        u16address = Pic18_resolve_address(a_u16word & PIC18_DATA_ADDRESS_MASK);
+        u8value = Pic18_read(u16address);
+        u16second_word = Pic18_fetch(g_u32pc);
+        g_u32pc = (g_u32pc + 2) & PIC18_PC_MASK;
+        Pic18_write(Pic18_resolve_address(u16second_word & PIC18_DATA_ADDRESS_MASK) , u8value);
+    }
+    else if((a_u16word >> 12) == 0xD)
+    {
+        /* BRA and RCALL with 11 bits signed offset in words */
+        s16offset = (sint16)((a_u16word & 0x7FF) << 5) >> 5;
+        if(GET_BIT(a_u16word , 11) != 0)
+        {
+            Pic18_call((g_u32pc + s16offset * 2) & PIC18_PC_MASK);
+        }
+        else
+        {
+            g_u32pc = (g_u32pc + s16offset * 2) & PIC18_PC_MASK;
+        }
+    }
+    else if(((a_u16word >> 8) & 0x0F) < 0x08)
+    {
+        /* BZ, BNZ, BC, BNC, BOV, BNOV, BN and BNN, even ones branch if the flag is set */
+        switch((a_u16word >> 9) & 0x03)
+        {
+            case 0x0:
+                u8condition = GET_BIT(u8status , PIC18_Z_BIT);
+                break;
+            case 0x1:
+                u8condition = GET_BIT(u8status , PIC18_C_BIT);
+                break;
+            case 0x2:
+                u8condition = GET_BIT(u8status , PIC18_OV_BIT);
+                break;
+            default:
+                u8condition = GET_BIT(u8status , PIC18_N_BIT);
+                break;
+        }
+        if(u8condition != GET_BIT(a_u16word , 8))
+        {
+            g_u32pc = (g_u32pc + (sint8)(a_u16word & 0xFF) * 2) & PIC18_PC_MASK;
+        }
+        else
+        {
+            retVal = 1;
+        }
+    }
+    else if(((a_u16word >> 8) & 0x0F) < 0x0C)
+    {
+        /* extended instructions are NOP when they are disabled */
+        retVal = 1;
+    }
+    else
+    {
+        /* CALL, LFSR and GOTO have second word */
+        u16second_word = Pic18_fetch(g_u32pc);
+        g_u32pc = (g_u32pc + 2) & PIC18_PC_MASK;
+        switch((a_u16word >> 8) & 0x0F)
+        {
+            case 0xC:
+            case 0xD:
+                /* CALL saves W, STATUS and BSR in fast registers with s bit */
+                if(GET_BIT(a_u16word , 8) != 0)
+                {
+                    g_u8fast_wreg = PIC18_REGISTER(PIC18_WREG_ADDRESS);
+                    g_u8fast_status = u8status;
+                    g_u8fast_bsr = PIC18_REGISTER(PIC18_BSR_ADDRESS);
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+                Pic18_call(((((uint32)u16second_word & 0xFFF) << 8) | (a_u16word & 0xFF)) << 1);
+                break;
+            case 0xE:
+                /* LFSR */
+                u8value = (a_u16word >> 4) & 0x03;
+                u16address = (u8value == 0) ? PIC18_FSR0L_ADDRESS : (u8value == 1) ? PIC18_FSR1L_ADDRESS : PIC18_FSR2L_ADDRESS;
+                PIC18_REGISTER(u16address) = (uint8)u16second_word;
+                PIC18_REGISTER(u16address + 1) = a_u16word & 0x0F;
+                break;
+            default:
+                /* GOTO */
+                g_u32pc = ((((uint32)u16second_word & 0xFFF) << 8) | (a_u16word & 0xFF)) << 1;
+                break;
+        }
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_fetch
+ *
+ * Description: 	read instruction word of program memory.
+ *
+ * Inputs:			a_u32address      (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			word (uint16)
+ *******************************************************************************/
+static uint16 Pic18_fetch(uint32 a_u32address)
+{
+    uint16 retVal = 0xFFFF;
+    if(a_u32address < PIC18_PROGRAM_SIZE)
+    {
+        retVal = g_u8program_arr[a_u32address] | ((uint16)g_u8program_arr[a_u32address + 1] << 8);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_file_address
+ *
+ * Description: 	get data address of file register instruction from its
+ *                  access bit and BSR, indirect registers are resolved to the
+ *                  address of their FSR which is modified once.
+ *
+ * Inputs:			a_u16word         (uint16) opcode
+ *
+ * Outputs:			NULL
+ *
+ * Return:			data address (uint16)
+ *******************************************************************************/
+static uint16 Pic18_file_address(uint16 a_u16word)
+{
+    uint16 u16address = a_u16word & 0xFF;
+    if(GET_BIT(a_u16word , 8) != 0)
+    {
+        u16address |= (uint16)PIC18_REGISTER(PIC18_BSR_ADDRESS) << 8;
+    }
+    else if(u16address >= 0x80)
+    {
+        /* access bank upper half is the special function registers */
+        u16address |= 0xF00;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return Pic18_resolve_address(u16address);
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_resolve_address
+ *
+ * Description: 	get address which is accessed by data address, it is the
+ *                  same address or address of FSR if it is indirect register
+ *                  (with increment or decrement of the FSR).
+ *
+ * Inputs:			a_u16address      (uint16)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			data address (uint16)
+ *******************************************************************************/
+static uint16 Pic18_resolve_address(uint16 a_u16address)
+{
+    uint16 retVal = a_u16address;
+    uint16 u16offset = a_u16address - PIC18_FIRST_INDIRECT_ADDRESS;
+    uint16 u16fsr_address = 0;
+    uint16 u16fsr = 0;
+    if(a_u16address >= PIC18_FIRST_INDIRECT_ADDRESS &&
+            u16offset < PIC18_INDIRECT_GROUPS * PIC18_INDIRECT_GROUP_SIZE &&
+            (u16offset % PIC18_INDIRECT_GROUP_SIZE) < PIC18_INDIRECT_REGISTERS)
+    {
+        /* FSR of the group is 2 registers before its PLUSW register */
+        u16fsr_address = a_u16address - (u16offset % PIC18_INDIRECT_GROUP_SIZE) - 2;
+        u16fsr = PIC18_REGISTER(u16fsr_address) | ((uint16)PIC18_REGISTER(u16fsr_address + 1) << 8);
+        retVal = u16fsr;
+        switch(u16offset % PIC18_INDIRECT_GROUP_SIZE)
+        {
+            case PIC18_POSTINC:
+                u16fsr++;
+                break;
+            case PIC18_POSTDEC:
+                u16fsr--;
+                break;
+            case PIC18_PREINC:
+                u16fsr++;
+                retVal = u16fsr;
+                break;
+            case PIC18_PLUSW:
+                retVal = u16fsr + (sint8)PIC18_REGISTER(PIC18_WREG_ADDRESS);
+                break;
+            default:
+                /* INDF */
+                break;
+        }
+        PIC18_REGISTER(u16fsr_address) = (uint8)u16fsr;
+        PIC18_REGISTER(u16fsr_address + 1) = (u16fsr >> 8) & 0x0F;
+        retVal &= PIC18_DATA_ADDRESS_MASK;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_read
+ *
+ * Description: 	read data memory, registers of the core are read here and
+ *                  others from the register file of the simulator.
+ *
+ * Inputs:			a_u16address      (uint16) resolved address
+ *
+ * Outputs:			NULL
+ *
+ * Return:			value (uint8)
+ *******************************************************************************/
+static uint8 Pic18_read(uint16 a_u16address)
+{
+    uint8 retVal = 0;
+    uint16 u16offset = a_u16address - PIC18_FIRST_INDIRECT_ADDRESS;
+    uint32 u32top = g_u32stack_arr[g_u8stack_pointer & PIC18_STACK_POINTER_MASK];
+    if(a_u16address < PIC18_FIRST_CORE_ADDRESS ||
+            (a_u16address >= PIC18_INTCON3_ADDRESS && a_u16address <= PIC18_INTCON_ADDRESS))
+    {
+        retVal = Sim_bus_read(a_u16address);
+    }
+    else if(a_u16address == PIC18_PCL_ADDRESS)
+    {
+        /* reading PCL latches the high bytes of the program counter */
+        PIC18_REGISTER(PIC18_PCLATH_ADDRESS) = (uint8)(g_u32pc >> 8);
+        PIC18_REGISTER(PIC18_PCLATU_ADDRESS) = (uint8)(g_u32pc >> 16);
+        retVal = (uint8)g_u32pc;
+    }
+    else if(a_u16address == PIC18_STKPTR_ADDRESS)
+    {
+        retVal = g_u8stack_pointer;
+    }
+    else if(a_u16address >= PIC18_TOSL_ADDRESS)
+    {
+        retVal = (uint8)(u32top >> ((a_u16address - PIC18_TOSL_ADDRESS) * 8));
+    }
+    else if(a_u16address >= PIC18_FIRST_INDIRECT_ADDRESS &&
+            u16offset < PIC18_INDIRECT_GROUPS * PIC18_INDIRECT_GROUP_SIZE &&
+            (u16offset % PIC18_INDIRECT_GROUP_SIZE) < PIC18_INDIRECT_REGISTERS)
+    {
+        /* indirect register which is pointed by FSR reads 0 */
+    }
+    else
+    {
+        retVal = PIC18_REGISTER(a_u16address);
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_write
+ *
+ * Description: 	write data memory, registers of the core are written here
+ *                  and others to the register file of the simulator.
+ *
+ * Inputs:			a_u16address      (uint16) resolved address
+ *                  a_u8value         (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pic18_write(uint16 a_u16address , uint8 a_u8value)
+{
+    uint16 u16offset = a_u16address - PIC18_FIRST_INDIRECT_ADDRESS;
+    uint8 u8shift = 0;
+    uint32 * u32top_ptr = &g_u32stack_arr[g_u8stack_pointer & PIC18_STACK_POINTER_MASK];
+    if(a_u16address < PIC18_FIRST_CORE_ADDRESS ||
+            (a_u16address >= PIC18_INTCON3_ADDRESS && a_u16address <= PIC18_INTCON_ADDRESS))
+    {
+        Sim_bus_write(a_u16address , a_u8value);
+    }
+    else if(a_u16address == PIC18_PCL_ADDRESS)
+    {
+        /* computed jump to the latched high bytes */
+        g_u32pc = (((uint32)PIC18_REGISTER(PIC18_PCLATU_ADDRESS) << 16) |
+                ((uint32)PIC18_REGISTER(PIC18_PCLATH_ADDRESS) << 8) | a_u8value) & PIC18_PC_MASK;
+        g_u8pc_written_flag = TRUE;
+    }
+    else if(a_u16address == PIC18_STKPTR_ADDRESS)
+    {
+        /* overflow and underflow bits are cleared only */
+        g_u8stack_pointer = (g_u8stack_pointer & a_u8value & PIC18_STACK_FLAGS_MASK) | (a_u8value & PIC18_STACK_POINTER_MASK);
+    }
+    else if(a_u16address >= PIC18_TOSL_ADDRESS)
+    {
+        u8shift = (a_u16address - PIC18_TOSL_ADDRESS) * 8;
+        *u32top_ptr = ((*u32top_ptr & ~(0xFFu << u8shift)) | ((uint32)a_u8value << u8shift)) & PIC18_PC_MASK;
+    }
+    else if(a_u16address >= PIC18_FIRST_INDIRECT_ADDRESS &&
+            u16offset < PIC18_INDIRECT_GROUPS * PIC18_INDIRECT_GROUP_SIZE &&
+            (u16offset % PIC18_INDIRECT_GROUP_SIZE) < PIC18_INDIRECT_REGISTERS)
+    {
+        /* indirect register which is pointed by FSR isn't written */
+    }
+    else if(a_u16address == PIC18_STATUS_ADDRESS)
+    {
+        PIC18_REGISTER(a_u16address) = a_u8value & PIC18_ALL_FLAGS;
+    }
+    else if(a_u16address == PIC18_BSR_ADDRESS || a_u16address == PIC18_FSR0H_ADDRESS ||
+            a_u16address == PIC18_FSR1H_ADDRESS || a_u16address == PIC18_FSR2H_ADDRESS)
+    {
+        PIC18_REGISTER(a_u16address) = a_u8value & 0x0F;
+    }
+    else
+    {
+        PIC18_REGISTER(a_u16address) = a_u8value;
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_add
+ *
+ * Description: 	add two bytes and carry and set C, DC, Z, OV and N flags,
+ *                  subtraction is addition of the complement with carry as
+ *                  not borrow.
+ *
+ * Inputs:			a_u8first         (uint8)
+ *                  a_u8second        (uint8)
+ *                  a_u8carry         (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			result (uint8)
+ *******************************************************************************/
+static uint8 Pic18_add(uint8 a_u8first , uint8 a_u8second , uint8 a_u8carry)
+{
+    uint16 u16sum = (uint16)a_u8first + a_u8second + a_u8carry;
+    uint8 retVal = (uint8)u16sum;
+    uint8 u8status = 0;
+    u8status |= (u16sum >> 8) << PIC18_C_BIT;
+    u8status |= (((a_u8first & 0x0F) + (a_u8second & 0x0F) + a_u8carry) > 0x0F) << PIC18_DC_BIT;
+    u8status |= (retVal == 0) << PIC18_Z_BIT;
+    u8status |= (((a_u8first ^ retVal) & (a_u8second ^ retVal) & 0x80) != 0) << PIC18_OV_BIT;
+    u8status |= (retVal >> 7) << PIC18_N_BIT;
+    PIC18_REGISTER(PIC18_STATUS_ADDRESS) = u8status;
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_set_zero_negative
+ *
+ * Description: 	set Z and N flags by result.
+ *
+ * Inputs:			a_u8result        (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pic18_set_zero_negative(uint8 a_u8result)
+{
+    uint8 u8status = PIC18_REGISTER(PIC18_STATUS_ADDRESS) & ~((1 << PIC18_Z_BIT) | (1 << PIC18_N_BIT));
+    u8status |= (a_u8result == 0) << PIC18_Z_BIT;
+    u8status |= (a_u8result >> 7) << PIC18_N_BIT;
+    PIC18_REGISTER(PIC18_STATUS_ADDRESS) = u8status;
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_call
+ *
+ * Description: 	push return address and jump to called address, the call
+ *                  is counted in the profile.
+ *
+ * Inputs:			a_u32address      (uint32) called address
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pic18_call(uint32 a_u32address)
+{
+    uint8 u8level = 0;
+    Pic18_push(g_u32pc);
+    u8level = g_u8stack_pointer & PIC18_STACK_POINTER_MASK;
+    g_u32frame_callee_arr[u8level] = a_u32address;
+    g_u64frame_start_arr[u8level] = g_u64cycles;
+    if(a_u32address < PIC18_PROGRAM_SIZE)
+    {
+        g_u32calls_arr[a_u32address >> 1]++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    g_u32pc = a_u32address;
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_return
+ *
+ * Description: 	pop return address to the program counter, the cycles of
+ *                  the call are added to the called address in the profile.
+ *
+ * Inputs:			a_u8cycles        (uint8) cycles of the return instruction
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pic18_return(uint8 a_u8cycles)
+{
+    uint8 u8level = g_u8stack_pointer & PIC18_STACK_POINTER_MASK;
+    uint32 u32callee = g_u32frame_callee_arr[u8level];
+    if(u8level != 0 && u32callee < PIC18_PROGRAM_SIZE)
+    {
+        g_u64inclusive_cycles_arr[u32callee >> 1] += g_u64cycles + a_u8cycles - g_u64frame_start_arr[u8level];
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    g_u32pc = Pic18_pop();
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_push
+ *
+ * Description: 	push address to the return stack, STKFUL bit is set when
+ *                  it is full.
+ *
+ * Inputs:			a_u32address      (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Pic18_push(uint32 a_u32address)
+{
+    uint8 u8level = g_u8stack_pointer & PIC18_STACK_POINTER_MASK;
+    if(u8level < PIC18_STACK_LEVELS)
+    {
+        u8level++;
+        g_u8stack_pointer = (g_u8stack_pointer & PIC18_STACK_FLAGS_MASK) | u8level;
+        g_u32stack_arr[u8level] = a_u32address;
+    }
+    else
+    {
+        SET_BIT(g_u8stack_pointer , PIC18_STKFUL_BIT);
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Pic18_pop
+ *
+ * Description: 	pop address from the return stack, STKUNF bit is set when
+ *                  it is empty.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			address (uint32)
+ *******************************************************************************/
+static uint32 Pic18_pop(void)
+{
+    uint8 u8level = g_u8stack_pointer & PIC18_STACK_POINTER_MASK;
+    uint32 retVal = g_u32stack_arr[u8level];
+    if(u8level > 0)
+    {
+        g_u8stack_pointer = (g_u8stack_pointer & PIC18_STACK_FLAGS_MASK) | (u8level - 1);
+    }
+    else
+    {
+        /* empty stack returns to reset vector */
+        retVal = PIC18_RESET_VECTOR;
+        SET_BIT(g_u8stack_pointer , PIC18_STKUNF_BIT);
+    }
+    return retVal;
+}
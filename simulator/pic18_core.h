@@ -0,0 +1,149 @@
+/*******************************************************************************
+ *
+ * File:                pic18_core.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes and definitions of
+ *                      instruction level core of PIC18 (without extended
+ *                      instructions) which runs the hex file built by XC8
+ *                      with cycles of the datasheet, data memory and special
+ *                      function registers of the peripherals are the register
+ *                      file of the simulator so the same models run with it.
+ *                      the core counts cycles of every instruction address
+ *                      and calls with their inclusive cycles for profiling.
+ *
+ * Revision history:    16/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef PIC18_CORE_H
+#define	PIC18_CORE_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* program memory of PIC18F4520 in bytes */
+#define PIC18_PROGRAM_SIZE                  0x8000u
+/* levels of the hardware return stack */
+#define PIC18_STACK_LEVELS                  31u
+/* vectors of reset and interrupts */
+#define PIC18_RESET_VECTOR                  0x0000u
+#define PIC18_HIGH_VECTOR                   0x0008u
+#define PIC18_LOW_VECTOR                    0x0018u
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Pic18_load_hex
+ *
+ * Description: 	load program memory from Intel hex file, records of
+ *                  configuration words and ID locations are ignored.
+ *
+ * Inputs:			a_file_name_ptr   (const char*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the file is loaded, FALSE if it can't be opened
+ *                  or has invalid record (uint8)
+ *******************************************************************************/
+extern uint8 Pic18_load_hex(const char * a_file_name_ptr);
+
+/*******************************************************************************
+ * Function Name:	Pic18_run
+ *
+ * Description: 	reset the core and its profile and run the loaded program
+ *                  from reset vector, it is the entry function of Sim_run
+ *                  and it doesn't return.
+ *                  note: interrupt functions of the simulator should be
+ *                        NULL_PTR, the core vectors the interrupts itself.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Pic18_run(void);
+
+/*******************************************************************************
+ * Function Name:	Pic18_get_instructions
+ *
+ * Description: 	get number of executed instructions in the last run.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			instructions (uint64)
+ *******************************************************************************/
+extern uint64 Pic18_get_instructions(void);
+
+/*******************************************************************************
+ * Function Name:	Pic18_get_cycles
+ *
+ * Description: 	get instruction cycles which are executed by the core in
+ *                  the last run including interrupts latency.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles (uint64)
+ *******************************************************************************/
+extern uint64 Pic18_get_cycles(void);
+
+/*******************************************************************************
+ * Function Name:	Pic18_get_self_cycles
+ *
+ * Description: 	get cycles of the instruction at program address in the
+ *                  last run.
+ *
+ * Inputs:			a_u32address      (uint32) byte address of the instruction
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles (uint64)
+ *******************************************************************************/
+extern uint64 Pic18_get_self_cycles(uint32 a_u32address);
+
+/*******************************************************************************
+ * Function Name:	Pic18_get_calls
+ *
+ * Description: 	get number of calls (and interrupts vectoring) to program
+ *                  address in the last run.
+ *
+ * Inputs:			a_u32address      (uint32) byte address of called code
+ *
+ * Outputs:			NULL
+ *
+ * Return:			calls (uint32)
+ *******************************************************************************/
+extern uint32 Pic18_get_calls(uint32 a_u32address);
+
+/*******************************************************************************
+ * Function Name:	Pic18_get_inclusive_cycles
+ *
+ * Description: 	get cycles from calls to program address to their returns
+ *                  in the last run, it includes the called functions and
+ *                  interrupts in the middle of the calls.
+ *
+ * Inputs:			a_u32address      (uint32) byte address of called code
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles (uint64)
+ *******************************************************************************/
+extern uint64 Pic18_get_inclusive_cycles(uint32 a_u32address);
+
+#endif	/* PIC18_CORE_H */
+
@@ -0,0 +1,1221 @@
+/*******************************************************************************
+ *
+ * File:                scenario.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of scenario engine,
+ *                      the engine is attached to the register file before the
+ *                      board so inputs which are due are applied before the
+ *                      board calculates levels of the pins read by firmware.
+ *
+ * Revision history:    10/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "scenario.h"
+#include "simulator.h"
+#include "HD44780_model.h"
+#include "peripherals_model.h"
+#include "timers_model.h"
+#include "board_model.h"
+#include "KeyPad.h"
+#include "KeyPad_config.h"
+#include "helped_macros.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+#define SCENARIO_US_PER_MS                  1000u
+#define SCENARIO_COMMENT_CHARACTER          '#'
+#define SCENARIO_MAX_DUTY                   100u
+#define SCENARIO_FIRST_LCD_ROW              1u
+/* registers of the time base check, the time base is timer 3 */
+#define SCENARIO_INTCON_ADDRESS             0xFF2u
+#define SCENARIO_GIEH_BIT                   7u
+#define SCENARIO_PIR2_ADDRESS               0xFA1u
+#define SCENARIO_TMR3IF_BIT                 1u
+#define SCENARIO_TIMEBASE_TIMER             3u
+#define SCENARIO_TIMEBASE_HALF_PERIOD       0x8000u
+/* max. difference in us between the time base and the virtual time around
+ * its read, both of them are truncated to us */
+#define SCENARIO_TIMEBASE_TOLERANCE         2u
+/* compare registers of CCP2 which the buzzer moves in the low priority interrupt */
+#define SCENARIO_CCPR2L_ADDRESS             0xFBBu
+#define SCENARIO_CCPR2H_ADDRESS             0xFBCu
+/* keypad check scans the keypad every system tick (10 ms) and after the
+ * release till the debouncing accepts it */
+#define SCENARIO_KEYPAD_TICK_TIME           10000u
+#define SCENARIO_KEYPAD_RELEASE_SCANS       (KEYPAD_DEBOUNCE_SCANS + 1u)
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* running scenario and its result */
+static const StrScenario_t * g_scenario_ptr = NULL_PTR;
+static StrScenario_result_t * g_result_ptr = NULL_PTR;
+/* index of the next event which isn't applied */
+static uint16 g_u16next_event = 0;
+/* model which checks invariants of the firmware */
+static const StrSim_peripheral_t * g_monitor_ptr = NULL_PTR;
+/* nesting check: its start, the nested interrupts when the compare value is
+ * read and the updates of the compare value which are interrupted */
+static uint8 g_u8nesting_flag = FALSE;
+static uint64 g_u64nesting_start = 0;
+static uint8 g_u8compare_read_flag = FALSE;
+static uint64 g_u64compare_read_nesting = 0;
+static uint32 g_u32compare_updates = 0;
+static uint32 g_u32broken_updates = 0;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Scenario_add_event
+ *
+ * Description: 	insert event in scenario after all events of the same or
+ *                  earlier time to keep script order of simultaneous events.
+ *
+ * Inputs:			a_event_ptr       (const StrScenario_event_t*)
+ *
+ * Outputs:			a_scenario_ptr    (StrScenario_t*)
+ *
+ * Return:			TRUE if the event is added, FALSE if scenario is full (uint8)
+ *******************************************************************************/
+static uint8 Scenario_add_event(StrScenario_t * a_scenario_ptr , const StrScenario_event_t * a_event_ptr);
+
+/*******************************************************************************
+ * Function Name:	Scenario_parse_line
+ *
+ * Description: 	parse event line of the script and add its events.
+ *
+ * Inputs:			a_line_ptr        (char*) it is modified by the parser
+ *                  a_u16line         (uint16) line number
+ *
+ * Outputs:			a_scenario_ptr    (StrScenario_t*)
+ *                  a_error_ptr       (char*)
+ *
+ * Return:			TRUE if the line is valid, FALSE otherwise (uint8)
+ *******************************************************************************/
+static uint8 Scenario_parse_line(StrScenario_t * a_scenario_ptr , char * a_line_ptr , uint16 a_u16line , char * a_error_ptr);
+
+/*******************************************************************************
+ * Function Name:	Scenario_apply_events
+ *
+ * Description: 	apply inputs and check outputs of all events which are due
+ *                  at virtual time.
+ *
+ * Inputs:			a_u64time         (uint64) virtual time in us
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Scenario_apply_events(uint64 a_u64time);
+
+/*******************************************************************************
+ * Function Name:	Scenario_check
+ *
+ * Description: 	count expectation and record its failure.
+ *
+ * Inputs:			a_event_ptr       (const StrScenario_event_t*)
+ *                  a_u8passed        (uint8)
+ *                  a_actual_ptr      (const char*) actual output for message
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Scenario_check(const StrScenario_event_t * a_event_ptr , uint8 a_u8passed , const char * a_actual_ptr);
+
+/*******************************************************************************
+ * Function Name:	Scenario_check_timebase
+ *
+ * Description: 	read the time base of the firmware for the duration of the
+ *                  event and check that it doesn't go back and it follows
+ *                  the virtual time.
+ *
+ * Inputs:			a_event_ptr       (const StrScenario_event_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Scenario_check_timebase(const StrScenario_event_t * a_event_ptr);
+
+/*******************************************************************************
+ * Function Name:	Scenario_check_nesting
+ *
+ * Description: 	check that the high priority interrupts preempted the
+ *                  low priority function since the start of the nesting
+ *                  check and none of them came between reading and writing
+ *                  the compare value of CCP2.
+ *
+ * Inputs:			a_event_ptr       (const StrScenario_event_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Scenario_check_nesting(const StrScenario_event_t * a_event_ptr);
+
+/*******************************************************************************
+ * Function Name:	Scenario_check_keypad
+ *
+ * Description: 	hold the key of the event, scan the keypad every tick
+ *                  instead of the firmware and check the kinds of the events
+ *                  and their ticks, long press after KEYPAD_LONG_PRESS_TICKS
+ *                  and repeat every KEYPAD_REPEAT_TICKS.
+ *
+ * Inputs:			a_event_ptr       (const StrScenario_event_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Scenario_check_keypad(const StrScenario_event_t * a_event_ptr);
+
+/*******************************************************************************
+ * Function Name:	Scenario_read_callback
+ *
+ * Description: 	start update of the compare value of CCP2 when the low
+ *                  priority function reads it in the nesting check.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Scenario_read_callback(uint16 a_u16address);
+
+/*******************************************************************************
+ * Function Name:	Scenario_write_callback
+ *
+ * Description: 	end update of the compare value of CCP2 when the low
+ *                  priority function writes its high byte in the nesting
+ *                  check and count it as broken if high priority function
+ *                  ran in the middle of it.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *                  a_u8old_value     (uint8)
+ *                  a_u8new_value     (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Scenario_write_callback(uint16 a_u16address , uint8 a_u8old_value , uint8 a_u8new_value);
+
+/*******************************************************************************
+ * Function Name:	Scenario_event_callback
+ *
+ * Description: 	apply events at their time and schedule the next one, so
+ *                  the simulator doesn't skip them in delays or idle loops.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Scenario_event_callback(void);
+
+/*******************************************************************************
+ * Function Name:	Scenario_schedule_event
+ *
+ * Description: 	set the time of the next event which isn't applied as
+ *                  event of the engine in the simulator.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Scenario_schedule_event(void);
+
+/* the engine is attached to the register file by this structure */
+static const StrSim_peripheral_t g_scenario_peripheral = {Scenario_write_callback , Scenario_read_callback ,
+        Scenario_event_callback};
+
+/* main and interrupt functions of the firmware, main is renamed in simulator
+ * build and low priority function exists with two interrupt levels only,
+ * they are weak for applications which run other firmware */
+extern void Firmware_main(void) __attribute__((weak));
+extern void ISR(void) __attribute__((weak));
+extern void ISRL(void) __attribute__((weak));
+extern uint32 Timebase_now_us(void) __attribute__((weak));
+extern uint32 Timebase_now_ms(void) __attribute__((weak));
+extern void KeyPad_scan(uint16 a_u16time) __attribute__((weak));
+extern uint8 KeyPad_getEvent(StrKeyPad_event_t * a_event_ptr) __attribute__((weak));
+/* firmware which runs the scenarios */
+static void (*g_main_function_ptr)(void) = Firmware_main;
+static void (*g_high_interrupt_ptr)(void) = ISR;
+static void (*g_low_interrupt_ptr)(void) = ISRL;
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Scenario_open
+ *
+ * Description: 	open script file to read its scenarios one by one.
+ *
+ * Inputs:			a_file_name_ptr   (const char*)
+ *
+ * Outputs:			a_reader_ptr      (StrScenario_reader_t*)
+ *
+ * Return:			TRUE if the file is opened, FALSE otherwise (uint8)
+ *******************************************************************************/
+uint8 Scenario_open(StrScenario_reader_t * a_reader_ptr , const char * a_file_name_ptr)
+{
+    a_reader_ptr->file_ptr = fopen(a_file_name_ptr , "r");
+    a_reader_ptr->file_name_ptr = a_file_name_ptr;
+    a_reader_ptr->u16line = 0;
+    a_reader_ptr->u8line_pending = FALSE;
+    return (a_reader_ptr->file_ptr != NULL_PTR) ? TRUE : FALSE;
+}
+
+/*******************************************************************************
+ * Function Name:	Scenario_read
+ *
+ * Description: 	read the next scenario of the script, events are sorted by
+ *                  time so releases of keys come in their right places.
+ *
+ * Inputs:			a_reader_ptr      (StrScenario_reader_t*)
+ *
+ * Outputs:			a_scenario_ptr    (StrScenario_t*)
+ *                  a_error_ptr       (char*) buffer of SCENARIO_MESSAGE_SIZE
+ *
+ * Return:			TRUE if scenario is read, FALSE at end of file or syntax
+ *                  error (a_error_ptr is empty at end of file) (uint8)
+ *******************************************************************************/
+uint8 Scenario_read(StrScenario_reader_t * a_reader_ptr , StrScenario_t * a_scenario_ptr , char * a_error_ptr)
+{
+    uint8 u8header_found = FALSE;
+    uint8 u8end_found = FALSE;
+    char * line_ptr = NULL_PTR;
+    char name_arr[SCENARIO_NAME_SIZE];
+    char command_arr[16];
+    unsigned long u32time = 0;
+    a_error_ptr[0] = '\0';
+    a_scenario_ptr->u16events_number = 0;
+    a_scenario_ptr->u64end_time = 0;
+    a_scenario_ptr->file_name_ptr = a_reader_ptr->file_name_ptr;
+    while(a_reader_ptr->u8line_pending == TRUE ||
+            fgets(a_reader_ptr->line_arr , SCENARIO_LINE_SIZE , a_reader_ptr->file_ptr) != NULL_PTR)
+    {
+        if(a_reader_ptr->u8line_pending == FALSE)
+        {
+            a_reader_ptr->u16line++;
+        }
+        else
+        {
+            a_reader_ptr->u8line_pending = FALSE;
+        }
+        line_ptr = a_reader_ptr->line_arr;
+        line_ptr[strcspn(line_ptr , "\r\n")] = '\0';
+        line_ptr += strspn(line_ptr , " \t");
+        if(line_ptr[0] == '\0' || line_ptr[0] == SCENARIO_COMMENT_CHARACTER)
+        {
+            /* Do nothing */
+        }
+        else if(sscanf(line_ptr , "scenario %47s" , name_arr) == 1)
+        {
+            if(u8header_found == TRUE)
+            {
+                /* header of the next scenario is kept for the next read */
+                a_reader_ptr->u8line_pending = TRUE;
+                break;
+            }
+            else
+            {
+                u8header_found = TRUE;
+                u8end_found = FALSE;
+                strcpy(a_scenario_ptr->name_arr , name_arr);
+                a_scenario_ptr->u16line = a_reader_ptr->u16line;
+            }
+        }
+        else if(u8header_found == FALSE)
+        {
+            snprintf(a_error_ptr , SCENARIO_MESSAGE_SIZE , "%s:%u: event before scenario header" ,
+                    a_reader_ptr->file_name_ptr , a_reader_ptr->u16line);
+            return FALSE;
+        }
+        else if(sscanf(line_ptr , "%lu %15s" , &u32time , command_arr) == 2 && strcmp(command_arr , "end") == 0)
+        {
+            a_scenario_ptr->u64end_time = (uint64)u32time * SCENARIO_US_PER_MS;
+            u8end_found = TRUE;
+        }
+        else if(Scenario_parse_line(a_scenario_ptr , line_ptr , a_reader_ptr->u16line , a_error_ptr) == FALSE)
+        {
+            return FALSE;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    if(u8header_found == TRUE && u8end_found == FALSE)
+    {
+        a_scenario_ptr->u64end_time = SCENARIO_DEFAULT_END_DELAY * SCENARIO_US_PER_MS;
+        if(a_scenario_ptr->u16events_number > 0)
+        {
+            a_scenario_ptr->u64end_time += a_scenario_ptr->events_arr[a_scenario_ptr->u16events_number - 1].u64time;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return u8header_found;
+}
+
+/*******************************************************************************
+ * Function Name:	Scenario_close
+ *
+ * Description: 	close script file.
+ *
+ * Inputs:			a_reader_ptr      (StrScenario_reader_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Scenario_close(StrScenario_reader_t * a_reader_ptr)
+{
+    if(a_reader_ptr->file_ptr != NULL_PTR)
+    {
+        fclose(a_reader_ptr->file_ptr);
+        a_reader_ptr->file_ptr = NULL_PTR;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Scenario_set_monitor
+ *
+ * Description: 	attach model to the register file after the board in the
+ *                  next runs to check invariants of the firmware on every
+ *                  register access.
+ *
+ * Inputs:			a_monitor_ptr     (const StrSim_peripheral_t*) NULL_PTR
+ *                                    to remove the monitor
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Scenario_set_monitor(const StrSim_peripheral_t * a_monitor_ptr)
+{
+    g_monitor_ptr = a_monitor_ptr;
+}
+
+/*******************************************************************************
+ * Function Name:	Scenario_set_firmware
+ *
+ * Description: 	set main and interrupt functions which run the next
+ *                  scenarios instead of the firmware of the simulator build.
+ *
+ * Inputs:			a_main_function_ptr (void(*)(void))
+ *                  a_high_function_ptr (void(*)(void)) or NULL_PTR
+ *                  a_low_function_ptr  (void(*)(void)) or NULL_PTR
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Scenario_set_firmware(void (*a_main_function_ptr)(void) , void (*a_high_function_ptr)(void) ,
+        void (*a_low_function_ptr)(void))
+{
+    g_main_function_ptr = a_main_function_ptr;
+    g_high_interrupt_ptr = a_high_function_ptr;
+    g_low_interrupt_ptr = a_low_function_ptr;
+}
+
+/*******************************************************************************
+ * Function Name:	Scenario_start
+ *
+ * Description: 	reset the simulator, its models and static variables of
+ *                  the firmware and attach the engine to apply inputs and
+ *                  check outputs of the scenario at their times in the next
+ *                  run of the firmware.
+ *                  note: Sim_save_firmware_state should be called before the
+ *                        first scenario.
+ *
+ * Inputs:			a_scenario_ptr    (const StrScenario_t*)
+ *
+ * Outputs:			a_result_ptr      (StrScenario_result_t*) it is completed
+ *                                    by Scenario_finish
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Scenario_start(const StrScenario_t * a_scenario_ptr , StrScenario_result_t * a_result_ptr)
+{
+    g_scenario_ptr = a_scenario_ptr;
+    g_result_ptr = a_result_ptr;
+    g_u16next_event = 0;
+    g_u8nesting_flag = FALSE;
+    memset(a_result_ptr , 0 , sizeof(StrScenario_result_t));
+    Sim_restore_firmware_state();
+    Sim_Initialization();
+    /* the engine applies inputs before the board reads them */
+    Sim_add_peripheral(&g_scenario_peripheral);
+    HD44780_Initialization();
+    Models_Initialization();
+    Timers_model_Initialization();
+    Board_Initialization();
+    if(g_monitor_ptr != NULL_PTR)
+    {
+        Sim_add_peripheral(g_monitor_ptr);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    Sim_set_interrupt_functions(g_high_interrupt_ptr , g_low_interrupt_ptr);
+    Scenario_schedule_event();
+}
+
+/*******************************************************************************
+ * Function Name:	Scenario_finish
+ *
+ * Description: 	apply the events of the started scenario up to its end
+ *                  time and complete its result.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Scenario_finish(void)
+{
+    /* the run stops before the accesses at end time so its events are applied here */
+    Scenario_apply_events(g_scenario_ptr->u64end_time);
+    g_result_ptr->u64virtual_time = Sim_get_time_us();
+    g_result_ptr->u8passed = (g_result_ptr->u16failures == 0) ? TRUE : FALSE;
+}
+
+/*******************************************************************************
+ * Function Name:	Scenario_run
+ *
+ * Description: 	reset the simulator, its models and static variables of
+ *                  the firmware, run the firmware from its main function to
+ *                  the end time of the scenario while applying inputs and
+ *                  checking outputs at their times.
+ *                  note: Sim_save_firmware_state should be called before the
+ *                        first run.
+ *
+ * Inputs:			a_scenario_ptr    (const StrScenario_t*)
+ *
+ * Outputs:			a_result_ptr      (StrScenario_result_t*)
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Scenario_run(const StrScenario_t * a_scenario_ptr , StrScenario_result_t * a_result_ptr)
+{
+    Scenario_start(a_scenario_ptr , a_result_ptr);
+    Sim_run(g_main_function_ptr , a_scenario_ptr->u64end_time);
+    Scenario_finish();
+}
+
+/*******************************************************************************
+ * Function Name:	Scenario_add_event
+ *
+ * Description: 	insert event in scenario after all events of the same or
+ *                  earlier time to keep script order of simultaneous events.
+ *
+ * Inputs:			a_event_ptr       (const StrScenario_event_t*)
+ *
+ * Outputs:			a_scenario_ptr    (StrScenario_t*)
+ *
+ * Return:			TRUE if the event is added, FALSE if scenario is full (uint8)
+ *******************************************************************************/
+static uint8 Scenario_add_event(StrScenario_t * a_scenario_ptr , const StrScenario_event_t * a_event_ptr)
+{
+    uint8 retVal = FALSE;
+    uint16 u16index = a_scenario_ptr->u16events_number;
+    if(a_scenario_ptr->u16events_number < SCENARIO_MAX_EVENTS)
+    {
+        while(u16index > 0 && a_scenario_ptr->events_arr[u16index - 1].u64time > a_event_ptr->u64time)
+        {
+            a_scenario_ptr->events_arr[u16index] = a_scenario_ptr->events_arr[u16index - 1];
+            u16index--;
+        }
+        a_scenario_ptr->events_arr[u16index] = *a_event_ptr;
+        a_scenario_ptr->u16events_number++;
+        retVal = TRUE;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Scenario_parse_line
+ *
+ * Description: 	parse event line of the script and add its events.
+ *
+ * Inputs:			a_line_ptr        (char*) it is modified by the parser
+ *                  a_u16line         (uint16) line number
+ *
+ * Outputs:			a_scenario_ptr    (StrScenario_t*)
+ *                  a_error_ptr       (char*)
+ *
+ * Return:			TRUE if the line is valid, FALSE otherwise (uint8)
+ *******************************************************************************/
+static uint8 Scenario_parse_line(StrScenario_t * a_scenario_ptr , char * a_line_ptr , uint16 a_u16line , char * a_error_ptr)
+{
+    uint8 retVal = TRUE;
+    StrScenario_event_t event;
+    StrScenario_event_t release_event;
+    uint8 u8release = FALSE;
+    unsigned long u32time = 0;
+    unsigned long u32argument = SCENARIO_DEFAULT_HOLD_TIME;
+    unsigned u32column = 0;
+    unsigned u32row = 0;
+    char command_arr[16];
+    char argument_arr[16];
+    char option_arr[16];
+    char * text_ptr = NULL_PTR;
+    char * text_end_ptr = NULL_PTR;
+    sint32 s32fields = sscanf(a_line_ptr , "%lu %15s %15s %lu" , &u32time , command_arr , argument_arr , &u32argument);
+    memset(&event , 0 , sizeof(event));
+    event.u64time = (uint64)u32time * SCENARIO_US_PER_MS;
+    event.u16line = a_u16line;
+    if(s32fields < 2)
+    {
+        retVal = FALSE;
+    }
+    else if(strcmp(command_arr , "key") == 0 && s32fields >= 3 && strlen(argument_arr) == 1)
+    {
+        event.event_t = SCENARIO_KEY_PRESS;
+        /* KeyPad driver returns digits as numbers and other keys as characters */
+        event.u16value = (argument_arr[0] >= '0' && argument_arr[0] <= '9') ?
+                (uint16)(argument_arr[0] - '0') : (uint16)argument_arr[0];
+        u8release = TRUE;
+    }
+    else if(strcmp(command_arr , "door") == 0 || strcmp(command_arr , "weight") == 0)
+    {
+        event.event_t = (command_arr[0] == 'd') ? SCENARIO_DOOR_PRESS : SCENARIO_WEIGHT_PRESS;
+        /* hold time is the first argument of buttons */
+        u32argument = (s32fields >= 3) ? strtoul(argument_arr , NULL_PTR , 10) : SCENARIO_DEFAULT_HOLD_TIME;
+        u8release = TRUE;
+    }
+    else if(strcmp(command_arr , "pot") == 0 && s32fields >= 3)
+    {
+        event.event_t = SCENARIO_POT_VOLTAGE;
+        event.u16value = (uint16)strtoul(argument_arr , NULL_PTR , 10);
+    }
+    else if(strcmp(command_arr , "lcd") == 0 &&
+            sscanf(a_line_ptr , "%*u %*s %u %u" , &u32column , &u32row) == 2 &&
+            u32column < HD44780_COLUMNS && u32row >= SCENARIO_FIRST_LCD_ROW && u32row <= HD44780_ROWS &&
+            (text_ptr = strchr(a_line_ptr , '"')) != NULL_PTR &&
+            (text_end_ptr = strrchr(a_line_ptr , '"')) != text_ptr &&
+            text_end_ptr - text_ptr - 1 <= HD44780_COLUMNS - u32column)
+    {
+        event.event_t = SCENARIO_EXPECT_LCD;
+        event.u8column = (uint8)u32column;
+        event.u8row = (uint8)u32row;
+        memcpy(event.text_arr , text_ptr + 1 , text_end_ptr - text_ptr - 1);
+        event.text_arr[text_end_ptr - text_ptr - 1] = '\0';
+    }
+    else if((strcmp(command_arr , "heater") == 0 || strcmp(command_arr , "led") == 0 || strcmp(command_arr , "buzzer") == 0) &&
+            s32fields >= 3 && (strcmp(argument_arr , "on") == 0 || strcmp(argument_arr , "off") == 0))
+    {
+        event.event_t = (command_arr[0] == 'h') ? SCENARIO_EXPECT_HEATER :
+                (command_arr[0] == 'l') ? SCENARIO_EXPECT_LED : SCENARIO_EXPECT_BUZZER;
+        event.u16value = (strcmp(argument_arr , "on") == 0) ? TRUE : FALSE;
+    }
+    else if(strcmp(command_arr , "fan") == 0 && s32fields >= 3)
+    {
+        event.event_t = SCENARIO_EXPECT_FAN;
+        event.u16value = (strcmp(argument_arr , "off") == 0) ? 0 : (uint16)strtoul(argument_arr , NULL_PTR , 10);
+        retVal = (event.u16value <= SCENARIO_MAX_DUTY) ? TRUE : FALSE;
+    }
+    else if(strcmp(command_arr , "timebase") == 0 && s32fields >= 3)
+    {
+        event.event_t = SCENARIO_CHECK_TIMEBASE;
+        event.u16value = (uint16)strtoul(argument_arr , NULL_PTR , 10);
+        if(sscanf(a_line_ptr , "%*u %*s %*s %15s" , option_arr) == 1)
+        {
+            event.u8masked_flag = TRUE;
+            retVal = (strcmp(option_arr , "masked") == 0) ? TRUE : FALSE;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else if(strcmp(command_arr , "keypad") == 0 && s32fields == 4 && strlen(argument_arr) == 1 &&
+            (text_ptr = strchr(a_line_ptr , '"')) != NULL_PTR &&
+            (text_end_ptr = strrchr(a_line_ptr , '"')) != text_ptr &&
+            text_end_ptr - text_ptr - 1 <= HD44780_COLUMNS)
+    {
+        event.event_t = SCENARIO_CHECK_KEYPAD;
+        event.u16value = (argument_arr[0] >= '0' && argument_arr[0] <= '9') ?
+                (uint16)(argument_arr[0] - '0') : (uint16)argument_arr[0];
+        event.u16hold_time = (uint16)u32argument;
+        memcpy(event.text_arr , text_ptr + 1 , text_end_ptr - text_ptr - 1);
+        event.text_arr[text_end_ptr - text_ptr - 1] = '\0';
+        if(sscanf(a_line_ptr , "%*u %*s %*s %*u %15s" , option_arr) == 1 && option_arr[0] != '"')
+        {
+            event.u8queued_flag = TRUE;
+            retVal = (strcmp(option_arr , "queued") == 0) ? TRUE : FALSE;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else if(strcmp(command_arr , "nesting") == 0 && s32fields >= 3)
+    {
+        /* the check is added as release of the start after the duration */
+        event.event_t = SCENARIO_NESTING_START;
+        u32argument = strtoul(argument_arr , NULL_PTR , 10);
+        u8release = TRUE;
+    }
+    else
+    {
+        retVal = FALSE;
+    }
+    if(retVal == TRUE)
+    {
+        retVal = Scenario_add_event(a_scenario_ptr , &event);
+        if(u8release == TRUE && retVal == TRUE)
+        {
+            /* release events follow press events in the enumeration */
+            release_event = event;
+            release_event.event_t = (EnumScenario_event_t)(event.event_t + 1);
+            release_event.u64time += (uint64)u32argument * SCENARIO_US_PER_MS;
+            retVal = Scenario_add_event(a_scenario_ptr , &release_event);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        if(retVal == FALSE)
+        {
+            snprintf(a_error_ptr , SCENARIO_MESSAGE_SIZE , "%s:%u: too many events" ,
+                    a_scenario_ptr->file_name_ptr , a_u16line);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        snprintf(a_error_ptr , SCENARIO_MESSAGE_SIZE , "%s:%u: invalid event \"%s\"" ,
+                a_scenario_ptr->file_name_ptr , a_u16line , a_line_ptr);
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Scenario_apply_events
+ *
+ * Description: 	apply inputs and check outputs of all events which are due
+ *                  at virtual time.
+ *
+ * Inputs:			a_u64time         (uint64) virtual time in us
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Scenario_apply_events(uint64 a_u64time)
+{
+    const StrScenario_event_t * event_ptr = NULL_PTR;
+    uint8 u8text_arr[HD44780_COLUMNS + 1];
+    char actual_arr[HD44780_COLUMNS + 1];
+    uint8 u8actual = 0;
+    while(g_u16next_event < g_scenario_ptr->u16events_number &&
+            g_scenario_ptr->events_arr[g_u16next_event].u64time <= a_u64time)
+    {
+        event_ptr = &g_scenario_ptr->events_arr[g_u16next_event];
+        g_u16next_event++;
+        switch(event_ptr->event_t)
+        {
+            case SCENARIO_KEY_PRESS:
+            case SCENARIO_KEY_RELEASE:
+                Board_set_key((uint8)event_ptr->u16value , (event_ptr->event_t == SCENARIO_KEY_PRESS) ? TRUE : FALSE);
+                break;
+            case SCENARIO_DOOR_PRESS:
+            case SCENARIO_DOOR_RELEASE:
+                Board_set_button(BOARD_DOOR_BUTTON , (event_ptr->event_t == SCENARIO_DOOR_PRESS) ? TRUE : FALSE);
+                break;
+            case SCENARIO_WEIGHT_PRESS:
+            case SCENARIO_WEIGHT_RELEASE:
+                Board_set_button(BOARD_WEIGHT_BUTTON , (event_ptr->event_t == SCENARIO_WEIGHT_PRESS) ? TRUE : FALSE);
+                break;
+            case SCENARIO_POT_VOLTAGE:
+                Board_set_pot_voltage(event_ptr->u16value);
+                break;
+            case SCENARIO_EXPECT_LCD:
+                HD44780_get_row_text(event_ptr->u8row - SCENARIO_FIRST_LCD_ROW , u8text_arr);
+                strcpy(actual_arr , (char*)&u8text_arr[event_ptr->u8column]);
+                actual_arr[strlen(event_ptr->text_arr)] = '\0';
+                Scenario_check(event_ptr , (strcmp(actual_arr , event_ptr->text_arr) == 0) ? TRUE : FALSE , actual_arr);
+                break;
+            case SCENARIO_EXPECT_HEATER:
+            case SCENARIO_EXPECT_LED:
+            case SCENARIO_EXPECT_BUZZER:
+                u8actual = (event_ptr->event_t == SCENARIO_EXPECT_HEATER) ? Board_get_heater() :
+                        (event_ptr->event_t == SCENARIO_EXPECT_LED) ? Board_get_led() : Board_get_buzzer();
+                Scenario_check(event_ptr , (u8actual == event_ptr->u16value) ? TRUE : FALSE , (u8actual == TRUE) ? "on" : "off");
+                break;
+            case SCENARIO_EXPECT_FAN:
+                u8actual = Board_get_fan_duty();
+                snprintf(actual_arr , sizeof(actual_arr) , "%u" , u8actual);
+                Scenario_check(event_ptr , (u8actual == event_ptr->u16value) ? TRUE : FALSE , actual_arr);
+                break;
+            case SCENARIO_CHECK_TIMEBASE:
+                Scenario_check_timebase(event_ptr);
+                break;
+            case SCENARIO_NESTING_START:
+                g_u8nesting_flag = TRUE;
+                g_u64nesting_start = Sim_get_nested_interrupts();
+                g_u8compare_read_flag = FALSE;
+                g_u32compare_updates = 0;
+                g_u32broken_updates = 0;
+                break;
+            case SCENARIO_CHECK_NESTING:
+                Scenario_check_nesting(event_ptr);
+                break;
+            case SCENARIO_CHECK_KEYPAD:
+                Scenario_check_keypad(event_ptr);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Scenario_check
+ *
+ * Description: 	count expectation and record its failure.
+ *
+ * Inputs:			a_event_ptr       (const StrScenario_event_t*)
+ *                  a_u8passed        (uint8)
+ *                  a_actual_ptr      (const char*) actual output for message
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Scenario_check(const StrScenario_event_t * a_event_ptr , uint8 a_u8passed , const char * a_actual_ptr)
+{
+    g_result_ptr->u16checks++;
+    if(a_u8passed == FALSE)
+    {
+        if(g_result_ptr->u16failures == 0)
+        {
+            snprintf(g_result_ptr->message_arr , SCENARIO_MESSAGE_SIZE , "%s:%u: at %llu ms got \"%s\"" ,
+                    g_scenario_ptr->file_name_ptr , a_event_ptr->u16line ,
+                    (unsigned long long)(a_event_ptr->u64time / SCENARIO_US_PER_MS) , a_actual_ptr);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        g_result_ptr->u16failures++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Scenario_check_timebase
+ *
+ * Description: 	read the time base of the firmware for the duration of the
+ *                  event and check that it doesn't go back and it follows
+ *                  the virtual time.
+ *
+ * Inputs:			a_event_ptr       (const StrScenario_event_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Scenario_check_timebase(const StrScenario_event_t * a_event_ptr)
+{
+    char actual_arr[SCENARIO_MESSAGE_SIZE] = "no time base";
+    uint8 u8passed = FALSE;
+    uint8 u8last_read_flag = FALSE;
+    uint8 u8intcon = 0;
+    uint64 u64duration = (uint64)a_event_ptr->u16value * SCENARIO_US_PER_MS;
+    /* virtual time before and after the first read and the current read,
+     * the interrupts may run in the middle of the read */
+    uint64 u64start_time = 0;
+    uint64 u64first_time = 0;
+    uint64 u64read_time = 0;
+    uint64 u64time = 0;
+    uint32 u32first_us = 0;
+    uint32 u32last_us = 0;
+    uint32 u32last_ms = 0;
+    uint32 u32us = 0;
+    uint32 u32ms = 0;
+    /* reads while the overflow is pending and the counter is after it */
+    uint32 u32pending_reads = 0;
+    uint64 u64elapsed = 0;
+    if(Timebase_now_us == NULL_PTR || Timebase_now_ms == NULL_PTR)
+    {
+        /* Do nothing */
+    }
+    else if(Sim_get_interrupt_level() != SIM_NO_INTERRUPT)
+    {
+        /* the interrupt of the overflow can't come in interrupt function */
+        snprintf(actual_arr , sizeof(actual_arr) , "check in interrupt function");
+    }
+    else
+    {
+        u8passed = TRUE;
+        /* the reads loop isn't idle loop of the firmware */
+        Sim_set_idle_skip(FALSE);
+        if(a_event_ptr->u8masked_flag == TRUE)
+        {
+            u8intcon = Sim_read_register(SCENARIO_INTCON_ADDRESS);
+            CLEAR_BIT(u8intcon , SCENARIO_GIEH_BIT);
+            Sim_write_register(SCENARIO_INTCON_ADDRESS , u8intcon);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        u64start_time = Sim_get_time_us();
+        u32first_us = Timebase_now_us();
+        u64first_time = Sim_get_time_us();
+        u32last_us = u32first_us;
+        u32last_ms = Timebase_now_ms();
+        while(u8passed == TRUE && u8last_read_flag == FALSE)
+        {
+            /* the last read is after enabling the interrupts, so the pending
+             * interrupts run in it and the time base doesn't go back after them */
+            if(Sim_get_time_us() - u64start_time >= u64duration)
+            {
+                u8last_read_flag = TRUE;
+                if(a_event_ptr->u8masked_flag == TRUE)
+                {
+                    /* the flags of INTCON may be set while the interrupts are disabled */
+                    u8intcon = Sim_read_register(SCENARIO_INTCON_ADDRESS);
+                    SET_BIT(u8intcon , SCENARIO_GIEH_BIT);
+                    Sim_write_register(SCENARIO_INTCON_ADDRESS , u8intcon);
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+            else if(GET_BIT(Sim_read_register(SCENARIO_PIR2_ADDRESS) , SCENARIO_TMR3IF_BIT) != 0 &&
+                    Timers_model_get_counter(SCENARIO_TIMEBASE_TIMER) < SCENARIO_TIMEBASE_HALF_PERIOD)
+            {
+                u32pending_reads++;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            u64read_time = Sim_get_time_us();
+            u32us = Timebase_now_us();
+            u32ms = Timebase_now_ms();
+            u64time = Sim_get_time_us();
+            u64elapsed = (uint32)(u32us - u32first_us);
+            if((sint32)(u32us - u32last_us) < 0 || (sint32)(u32ms - u32last_ms) < 0 ||
+                    u64elapsed + SCENARIO_TIMEBASE_TOLERANCE + u64first_time < u64read_time ||
+                    u64elapsed + u64start_time > u64time + SCENARIO_TIMEBASE_TOLERANCE)
+            {
+                u8passed = FALSE;
+                snprintf(actual_arr , sizeof(actual_arr) , "%u us %u ms after %u us %u ms at %llu us" ,
+                        u32us , u32ms , u32last_us , u32last_ms , (unsigned long long)u64time);
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            u32last_us = u32us;
+            u32last_ms = u32ms;
+        }
+        if(u8passed == TRUE && a_event_ptr->u8masked_flag == TRUE && u32pending_reads == 0)
+        {
+            u8passed = FALSE;
+            snprintf(actual_arr , sizeof(actual_arr) , "no read of pending overflow");
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        Sim_set_idle_skip(TRUE);
+    }
+    Scenario_check(a_event_ptr , u8passed , actual_arr);
+}
+
+/*******************************************************************************
+ * Function Name:	Scenario_check_nesting
+ *
+ * Description: 	check that the high priority interrupts preempted the
+ *                  low priority function since the start of the nesting
+ *                  check and none of them came between reading and writing
+ *                  the compare value of CCP2.
+ *
+ * Inputs:			a_event_ptr       (const StrScenario_event_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Scenario_check_nesting(const StrScenario_event_t * a_event_ptr)
+{
+    char actual_arr[SCENARIO_MESSAGE_SIZE];
+    uint64 u64nested = Sim_get_nested_interrupts() - g_u64nesting_start;
+    g_u8nesting_flag = FALSE;
+    snprintf(actual_arr , sizeof(actual_arr) , "%llu nested, %u of %u compare updates interrupted" ,
+            (unsigned long long)u64nested , g_u32broken_updates , g_u32compare_updates);
+    Scenario_check(a_event_ptr , (u64nested != 0 && g_u32compare_updates != 0 && g_u32broken_updates == 0) ?
+            TRUE : FALSE , actual_arr);
+}
+
+/*******************************************************************************
+ * Function Name:	Scenario_check_keypad
+ *
+ * Description: 	hold the key of the event, scan the keypad every tick
+ *                  instead of the firmware and check the kinds of the events
+ *                  and their ticks, long press after KEYPAD_LONG_PRESS_TICKS
+ *                  and repeat every KEYPAD_REPEAT_TICKS.
+ *
+ * Inputs:			a_event_ptr       (const StrScenario_event_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Scenario_check_keypad(const StrScenario_event_t * a_event_ptr)
+{
+    char actual_arr[SCENARIO_MESSAGE_SIZE] = "no keypad";
+    /* kinds of the read events as the script writes them */
+    char kinds_arr[HD44780_COLUMNS + 2];
+    uint8 u8kinds_number = 0;
+    uint8 u8passed = FALSE;
+    StrKeyPad_event_t keypad_event;
+    /* tick of the previous press, long press or repeat event */
+    uint16 u16last_time = 0;
+    uint16 u16hold_scans = a_event_ptr->u16hold_time / (SCENARIO_KEYPAD_TICK_TIME / SCENARIO_US_PER_MS);
+    if(KeyPad_scan == NULL_PTR || KeyPad_getEvent == NULL_PTR)
+    {
+        /* Do nothing */
+    }
+    else if(Sim_get_interrupt_level() != SIM_NO_INTERRUPT)
+    {
+        /* the firmware scans the keypad in the main loop only */
+        snprintf(actual_arr , sizeof(actual_arr) , "check in interrupt function");
+    }
+    else
+    {
+        u8passed = TRUE;
+        actual_arr[0] = '\0';
+        /* the scans loop isn't idle loop of the firmware */
+        Sim_set_idle_skip(FALSE);
+        /* events which the firmware didn't read aren't of this check */
+        while(KeyPad_getEvent(&keypad_event) == TRUE)
+        {
+            /* Do nothing */
+        }
+        Board_set_key((uint8)a_event_ptr->u16value , TRUE);
+        for(uint16 u16tick = 0 ; u16tick < u16hold_scans + SCENARIO_KEYPAD_RELEASE_SCANS ; u16tick++)
+        {
+            if(u16tick == u16hold_scans)
+            {
+                Board_set_key((uint8)a_event_ptr->u16value , FALSE);
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            KeyPad_scan(u16tick);
+            /* queued events are read after the release */
+            while((a_event_ptr->u8queued_flag == FALSE || u16tick + 1u == u16hold_scans + SCENARIO_KEYPAD_RELEASE_SCANS) &&
+                    KeyPad_getEvent(&keypad_event) == TRUE)
+            {
+                if(u8kinds_number <= HD44780_COLUMNS)
+                {
+                    kinds_arr[u8kinds_number] = (keypad_event.event_t == KEYPAD_EVENT_PRESS) ? 'P' :
+                            (keypad_event.event_t == KEYPAD_EVENT_RELEASE) ? 'U' :
+                            (keypad_event.event_t == KEYPAD_EVENT_LONG_PRESS) ? 'L' : 'R';
+                    u8kinds_number++;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+                /* long press and repeats follow the previous event by their ticks */
+                if(u8passed == TRUE &&
+                        ((keypad_event.event_t == KEYPAD_EVENT_LONG_PRESS &&
+                        (uint16)(keypad_event.u16time - u16last_time) != KEYPAD_LONG_PRESS_TICKS) ||
+                        (keypad_event.event_t == KEYPAD_EVENT_REPEAT &&
+                        (uint16)(keypad_event.u16time - u16last_time) != KEYPAD_REPEAT_TICKS)))
+                {
+                    u8passed = FALSE;
+                    snprintf(actual_arr , sizeof(actual_arr) , " event %u at tick %u after tick %u" ,
+                            u8kinds_number , keypad_event.u16time , u16last_time);
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+                if(keypad_event.event_t != KEYPAD_EVENT_RELEASE)
+                {
+                    u16last_time = keypad_event.u16time;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+            Sim_delay_us(SCENARIO_KEYPAD_TICK_TIME);
+        }
+        kinds_arr[u8kinds_number] = '\0';
+        if(strcmp(kinds_arr , a_event_ptr->text_arr) != 0)
+        {
+            u8passed = FALSE;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        /* the message is the read events and the first wrong tick */
+        memmove(actual_arr + u8kinds_number , actual_arr , strlen(actual_arr) + 1);
+        memcpy(actual_arr , kinds_arr , u8kinds_number);
+        Sim_set_idle_skip(TRUE);
+    }
+    Scenario_check(a_event_ptr , u8passed , actual_arr);
+}
+
+/*******************************************************************************
+ * Function Name:	Scenario_read_callback
+ *
+ * Description: 	start update of the compare value of CCP2 when the low
+ *                  priority function reads it in the nesting check.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Scenario_read_callback(uint16 a_u16address)
+{
+    if(g_u8nesting_flag == TRUE && g_u8compare_read_flag == FALSE &&
+            (a_u16address == SCENARIO_CCPR2L_ADDRESS || a_u16address == SCENARIO_CCPR2H_ADDRESS) &&
+            Sim_get_interrupt_level() == SIM_LOW_INTERRUPT)
+    {
+        g_u8compare_read_flag = TRUE;
+        g_u64compare_read_nesting = Sim_get_nested_interrupts();
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Scenario_write_callback
+ *
+ * Description: 	end update of the compare value of CCP2 when the low
+ *                  priority function writes its high byte in the nesting
+ *                  check and count it as broken if high priority function
+ *                  ran in the middle of it.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *                  a_u8old_value     (uint8)
+ *                  a_u8new_value     (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Scenario_write_callback(uint16 a_u16address , uint8 a_u8old_value , uint8 a_u8new_value)
+{
+    if(g_u8nesting_flag == TRUE && g_u8compare_read_flag == TRUE && a_u16address == SCENARIO_CCPR2H_ADDRESS &&
+            Sim_get_interrupt_level() == SIM_LOW_INTERRUPT)
+    {
+        g_u8compare_read_flag = FALSE;
+        g_u32compare_updates++;
+        if(Sim_get_nested_interrupts() != g_u64compare_read_nesting)
+        {
+            g_u32broken_updates++;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Scenario_event_callback
+ *
+ * Description: 	apply events at their time and schedule the next one, so
+ *                  the simulator doesn't skip them in delays or idle loops.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Scenario_event_callback(void)
+{
+    Scenario_apply_events(Sim_get_time_us());
+    Scenario_schedule_event();
+}
+
+/*******************************************************************************
+ * Function Name:	Scenario_schedule_event
+ *
+ * Description: 	set the time of the next event which isn't applied as
+ *                  event of the engine in the simulator.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Scenario_schedule_event(void)
+{
+    if(g_u16next_event < g_scenario_ptr->u16events_number)
+    {
+        Sim_schedule_event(&g_scenario_peripheral ,
+                g_scenario_ptr->events_arr[g_u16next_event].u64time * SIM_CYCLES_PER_US);
+    }
+    else
+    {
+        Sim_schedule_event(&g_scenario_peripheral , SIM_NO_EVENT);
+    }
+}
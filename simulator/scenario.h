@@ -0,0 +1,268 @@
+/*******************************************************************************
+ *
+ * File:                scenario.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes, structures and
+ *                      definitions of scenario engine which reads scripts of
+ *                      timestamped board inputs and expected outputs and runs
+ *                      the firmware against them in the simulator.
+ *
+ *                      script lines (time is virtual time in ms):
+ *                          scenario <name>
+ *                          <time> key <0-9|*|#> [hold time]
+ *                          <time> door [hold time]
+ *                          <time> weight [hold time]
+ *                          <time> pot <voltage in mV>
+ *                          <time> lcd <column 0-15> <row 1-4> "<text>"
+ *                          <time> heater|led|buzzer on|off
+ *                          <time> fan <duty 0-100>|off
+ *                          <time> timebase <duration in ms> [masked]
+ *                          <time> nesting <duration in ms>
+ *                          <time> keypad <key> <hold time> [queued] "<events>"
+ *                          <time> end
+ *                      text after '#' at start of line is a comment.
+ *                      timebase reads the time base of the firmware for the
+ *                      duration and checks that it doesn't go back and it
+ *                      follows the virtual time, masked reads it with
+ *                      disabled interrupts so the overflow of timer 3 is
+ *                      pending (less than half period of the timer, 16 ms).
+ *                      nesting checks for the duration that the high priority
+ *                      interrupts preempt the low priority function of the
+ *                      buzzer but not between reading and writing the compare
+ *                      value of CCP2.
+ *                      keypad holds the key and scans the keypad every tick
+ *                      instead of the firmware, the events are P press, L
+ *                      long press, R repeat and U release and their ticks
+ *                      are checked, queued reads them after the release so
+ *                      the events after the full queue are dropped.
+ *
+ * Revision history:    10/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef SCENARIO_H
+#define	SCENARIO_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include <stdio.h>
+#include "stdtypes.h"
+#include "HD44780_model.h"
+#include "simulator.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* max. events of one scenario (key and button press is two events) */
+#define SCENARIO_MAX_EVENTS                 256u
+#define SCENARIO_NAME_SIZE                  48u
+#define SCENARIO_MESSAGE_SIZE               160u
+#define SCENARIO_LINE_SIZE                  160u
+/* hold time of key or button if the script doesn't give it */
+#define SCENARIO_DEFAULT_HOLD_TIME          100u
+/* scenario without end line runs to the last event and this time after it */
+#define SCENARIO_DEFAULT_END_DELAY          100u
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/************************** EnumScenario_event_t *******************************/
+typedef enum{
+            SCENARIO_KEY_PRESS,
+            SCENARIO_KEY_RELEASE,
+            SCENARIO_DOOR_PRESS,
+            SCENARIO_DOOR_RELEASE,
+            SCENARIO_WEIGHT_PRESS,
+            SCENARIO_WEIGHT_RELEASE,
+            SCENARIO_POT_VOLTAGE,
+            SCENARIO_EXPECT_LCD,
+            SCENARIO_EXPECT_HEATER,
+            SCENARIO_EXPECT_LED,
+            SCENARIO_EXPECT_BUZZER,
+            SCENARIO_EXPECT_FAN,
+            SCENARIO_CHECK_TIMEBASE,
+            SCENARIO_NESTING_START,
+            SCENARIO_CHECK_NESTING,
+            SCENARIO_CHECK_KEYPAD
+}EnumScenario_event_t;
+
+/************************** StrScenario_event_t ********************************/
+typedef struct{
+    uint64 u64time;                             /* virtual time in us */
+    EnumScenario_event_t event_t;
+    uint16 u16value;                            /* key, voltage, output state, duty or duration */
+    uint16 u16hold_time;                        /* hold time of keypad check in ms */
+    uint8  u8column;                            /* LCD position of expected text */
+    uint8  u8row;
+    uint8  u8masked_flag;                       /* TRUE if the time base is read with disabled interrupts */
+    uint8  u8queued_flag;                       /* TRUE if keypad events are read after the release */
+    uint16 u16line;                             /* script line to report failures */
+    char   text_arr[HD44780_COLUMNS + 1];
+}StrScenario_event_t;
+
+/****************************** StrScenario_t **********************************/
+typedef struct{
+    char   name_arr[SCENARIO_NAME_SIZE];
+    const char * file_name_ptr;
+    uint16 u16line;                             /* line of scenario header */
+    uint64 u64end_time;                         /* virtual time in us */
+    uint16 u16events_number;
+    StrScenario_event_t events_arr[SCENARIO_MAX_EVENTS];
+}StrScenario_t;
+
+/************************** StrScenario_result_t *******************************/
+typedef struct{
+    uint8  u8passed;
+    uint16 u16checks;                           /* evaluated expectations */
+    uint16 u16failures;
+    uint64 u64virtual_time;                     /* in us */
+    char   message_arr[SCENARIO_MESSAGE_SIZE];  /* first failure */
+}StrScenario_result_t;
+
+/************************** StrScenario_reader_t *******************************/
+typedef struct{
+    FILE * file_ptr;
+    const char * file_name_ptr;
+    uint16 u16line;
+    uint8  u8line_pending;                      /* TRUE if line_arr is header of next scenario */
+    char   line_arr[SCENARIO_LINE_SIZE];
+}StrScenario_reader_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Scenario_open
+ *
+ * Description: 	open script file to read its scenarios one by one.
+ *
+ * Inputs:			a_file_name_ptr   (const char*)
+ *
+ * Outputs:			a_reader_ptr      (StrScenario_reader_t*)
+ *
+ * Return:			TRUE if the file is opened, FALSE otherwise (uint8)
+ *******************************************************************************/
+extern uint8 Scenario_open(StrScenario_reader_t * a_reader_ptr , const char * a_file_name_ptr);
+
+/*******************************************************************************
+ * Function Name:	Scenario_read
+ *
+ * Description: 	read the next scenario of the script, events are sorted by
+ *                  time so releases of keys come in their right places.
+ *
+ * Inputs:			a_reader_ptr      (StrScenario_reader_t*)
+ *
+ * Outputs:			a_scenario_ptr    (StrScenario_t*)
+ *                  a_error_ptr       (char*) buffer of SCENARIO_MESSAGE_SIZE
+ *
+ * Return:			TRUE if scenario is read, FALSE at end of file or syntax
+ *                  error (a_error_ptr is empty at end of file) (uint8)
+ *******************************************************************************/
+extern uint8 Scenario_read(StrScenario_reader_t * a_reader_ptr , StrScenario_t * a_scenario_ptr , char * a_error_ptr);
+
+/*******************************************************************************
+ * Function Name:	Scenario_close
+ *
+ * Description: 	close script file.
+ *
+ * Inputs:			a_reader_ptr      (StrScenario_reader_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Scenario_close(StrScenario_reader_t * a_reader_ptr);
+
+/*******************************************************************************
+ * Function Name:	Scenario_set_monitor
+ *
+ * Description: 	attach model to the register file after the board in the
+ *                  next runs to check invariants of the firmware on every
+ *                  register access.
+ *
+ * Inputs:			a_monitor_ptr     (const StrSim_peripheral_t*) NULL_PTR
+ *                                    to remove the monitor
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Scenario_set_monitor(const StrSim_peripheral_t * a_monitor_ptr);
+
+/*******************************************************************************
+ * Function Name:	Scenario_set_firmware
+ *
+ * Description: 	set main and interrupt functions which run the next
+ *                  scenarios instead of the firmware of the simulator build.
+ *
+ * Inputs:			a_main_function_ptr (void(*)(void))
+ *                  a_high_function_ptr (void(*)(void)) or NULL_PTR
+ *                  a_low_function_ptr  (void(*)(void)) or NULL_PTR
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Scenario_set_firmware(void (*a_main_function_ptr)(void) , void (*a_high_function_ptr)(void) ,
+        void (*a_low_function_ptr)(void));
+
+/*******************************************************************************
+ * Function Name:	Scenario_start
+ *
+ * Description: 	reset the simulator, its models and static variables of
+ *                  the firmware and attach the engine to apply inputs and
+ *                  check outputs of the scenario at their times in the next
+ *                  run of the firmware.
+ *                  note: Sim_save_firmware_state should be called before the
+ *                        first scenario.
+ *
+ * Inputs:			a_scenario_ptr    (const StrScenario_t*)
+ *
+ * Outputs:			a_result_ptr      (StrScenario_result_t*) it is completed
+ *                                    by Scenario_finish
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Scenario_start(const StrScenario_t * a_scenario_ptr , StrScenario_result_t * a_result_ptr);
+
+/*******************************************************************************
+ * Function Name:	Scenario_finish
+ *
+ * Description: 	apply the events of the started scenario up to its end
+ *                  time and complete its result.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Scenario_finish(void);
+
+/*******************************************************************************
+ * Function Name:	Scenario_run
+ *
+ * Description: 	reset the simulator, its models and static variables of
+ *                  the firmware, run the firmware from its main function to
+ *                  the end time of the scenario while applying inputs and
+ *                  checking outputs at their times.
+ *                  note: Sim_save_firmware_state should be called before the
+ *                        first run.
+ *
+ * Inputs:			a_scenario_ptr    (const StrScenario_t*)
+ *
+ * Outputs:			a_result_ptr      (StrScenario_result_t*)
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Scenario_run(const StrScenario_t * a_scenario_ptr , StrScenario_result_t * a_result_ptr);
+
+#endif	/* SCENARIO_H */
+
@@ -0,0 +1,426 @@
+/*******************************************************************************
+ *
+ * File:                scenario_runner.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            host application that runs scenarios of script files
+ *                      in parallel, every scenario runs in its own process so
+ *                      the firmware starts from its power on state and crash
+ *                      of one scenario doesn't stop the others.
+ *                      usage: scenario_runner [-j jobs] [-v] [-w directory]
+ *                                  [-p ports] [-r records] files...
+ *                      -w writes pins activity of the ports of every scenario
+ *                      to VCD file of its name in the directory.
+ *
+ * Revision history:    10/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "scenario.h"
+#include "simulator.h"
+#include "vcd_model.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* max. scenarios which run at the same time */
+#define RUNNER_MAX_JOBS                 256u
+#define RUNNER_US_PER_S                 1000000.0
+/* max. size of VCD file path */
+#define RUNNER_PATH_SIZE                512u
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/***************************** StrRunner_job_t *********************************/
+typedef struct{
+    pid_t  process_id;                  /* 0 if the job is free */
+    sint32 s32pipe;                     /* read end of result pipe */
+    double host_start_time;             /* in s */
+    char   name_arr[SCENARIO_NAME_SIZE];
+    const char * file_name_ptr;
+    uint16 u16line;
+}StrRunner_job_t;
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+static StrRunner_job_t g_jobs_arr[RUNNER_MAX_JOBS];
+static uint32 g_u32jobs_number = 0;
+static uint8 g_u8verbose = FALSE;
+/* directory of VCD files or NULL_PTR */
+static const char * g_vcd_directory_ptr = NULL_PTR;
+static uint8 g_u8vcd_ports_mask = VCD_ALL_PORTS;
+static uint32 g_u32vcd_records = VCD_DEFAULT_RECORDS;
+/* totals of all scenarios */
+static uint32 g_u32scenarios = 0;
+static uint32 g_u32failed = 0;
+static uint64 g_u64virtual_time = 0;
+/* scenario is static to keep the stack of child process small */
+static StrScenario_t g_scenario;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Runner_get_time
+ *
+ * Description: 	get monotonic host time.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			time in s (double)
+ *******************************************************************************/
+static double Runner_get_time(void);
+
+/*******************************************************************************
+ * Function Name:	Runner_start
+ *
+ * Description: 	run scenario in new process in free job.
+ *
+ * Inputs:			a_scenario_ptr    (const StrScenario_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Runner_start(const StrScenario_t * a_scenario_ptr);
+
+/*******************************************************************************
+ * Function Name:	Runner_wait
+ *
+ * Description: 	wait for any running scenario to finish and report it.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Runner_wait(void);
+
+/*******************************************************************************
+ * Function Name:	Runner_record
+ *
+ * Description: 	run scenario with pins recording and write its VCD file.
+ *
+ * Inputs:			a_scenario_ptr    (const StrScenario_t*)
+ *
+ * Outputs:			a_result_ptr      (StrScenario_result_t*)
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Runner_record(const StrScenario_t * a_scenario_ptr , StrScenario_result_t * a_result_ptr);
+
+/* main function of the firmware which is renamed in simulator build */
+extern void Firmware_main(void);
+
+/* host application */
+int main(int argc , char * argv[])
+{
+    uint32 u32jobs = (uint32)sysconf(_SC_NPROCESSORS_ONLN);
+    sint32 s32option = 0;
+    uint8 u8errors = FALSE;
+    StrScenario_reader_t reader;
+    char error_arr[SCENARIO_MESSAGE_SIZE];
+    double start_time = 0;
+    double host_time = 0;
+    while((s32option = getopt(argc , argv , "j:vw:p:r:")) != -1)
+    {
+        if(s32option == 'j')
+        {
+            u32jobs = (uint32)strtoul(optarg , NULL_PTR , 10);
+        }
+        else if(s32option == 'v')
+        {
+            g_u8verbose = TRUE;
+        }
+        else if(s32option == 'w')
+        {
+            g_vcd_directory_ptr = optarg;
+        }
+        else if(s32option == 'p')
+        {
+            g_u8vcd_ports_mask = Vcd_model_get_ports_mask(optarg);
+        }
+        else if(s32option == 'r')
+        {
+            g_u32vcd_records = (uint32)strtoul(optarg , NULL_PTR , 10);
+        }
+        else
+        {
+            fprintf(stderr , "usage: %s [-j jobs] [-v] [-w directory] [-p ports] [-r records] files...\n" , argv[0]);
+            return 2;
+        }
+    }
+    Sim_save_firmware_state();
+    u32jobs = (u32jobs == 0) ? 1 : (u32jobs > RUNNER_MAX_JOBS) ? RUNNER_MAX_JOBS : u32jobs;
+    start_time = Runner_get_time();
+    for(sint32 s32file = optind ; s32file < argc ; s32file++)
+    {
+        if(Scenario_open(&reader , argv[s32file]) == FALSE)
+        {
+            fprintf(stderr , "%s: can't open file\n" , argv[s32file]);
+            u8errors = TRUE;
+            continue;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        while(Scenario_read(&reader , &g_scenario , error_arr) == TRUE)
+        {
+            if(g_u32jobs_number == u32jobs)
+            {
+                Runner_wait();
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            Runner_start(&g_scenario);
+        }
+        if(error_arr[0] != '\0')
+        {
+            fprintf(stderr , "%s\n" , error_arr);
+            u8errors = TRUE;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        Scenario_close(&reader);
+    }
+    while(g_u32jobs_number > 0)
+    {
+        Runner_wait();
+    }
+    host_time = Runner_get_time() - start_time;
+    printf("%u scenarios, %u failed, %u jobs, %.2f s: %.1f scenarios/s, %.1f virtual s per host s\n" ,
+            g_u32scenarios , g_u32failed , u32jobs , host_time ,
+            (host_time > 0) ? g_u32scenarios / host_time : 0.0 ,
+            (host_time > 0) ? g_u64virtual_time / RUNNER_US_PER_S / host_time : 0.0);
+    return (g_u32failed > 0 || u8errors == TRUE) ? 1 : 0;
+}
+
+/*******************************************************************************
+ * Function Name:	Runner_get_time
+ *
+ * Description: 	get monotonic host time.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			time in s (double)
+ *******************************************************************************/
+static double Runner_get_time(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC , &time);
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/*******************************************************************************
+ * Function Name:	Runner_start
+ *
+ * Description: 	run scenario in new process in free job.
+ *
+ * Inputs:			a_scenario_ptr    (const StrScenario_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Runner_start(const StrScenario_t * a_scenario_ptr)
+{
+    StrRunner_job_t * job_ptr = NULL_PTR;
+    StrScenario_result_t result;
+    int pipe_arr[2];
+    for(uint32 u32counter = 0 ; u32counter < RUNNER_MAX_JOBS ; u32counter++)
+    {
+        if(g_jobs_arr[u32counter].process_id == 0)
+        {
+            job_ptr = &g_jobs_arr[u32counter];
+            break;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    if(pipe(pipe_arr) != 0)
+    {
+        perror("pipe");
+        exit(2);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    fflush(stdout);
+    job_ptr->host_start_time = Runner_get_time();
+    job_ptr->process_id = fork();
+    if(job_ptr->process_id == 0)
+    {
+        /* child process runs the firmware and sends its result */
+        close(pipe_arr[0]);
+        if(g_vcd_directory_ptr != NULL_PTR)
+        {
+            Runner_record(a_scenario_ptr , &result);
+        }
+        else
+        {
+            Scenario_run(a_scenario_ptr , &result);
+        }
+        if(write(pipe_arr[1] , &result , sizeof(result)) != sizeof(result))
+        {
+            _exit(2);
+        }
+        else
+        {
+            _exit(0);
+        }
+    }
+    else if(job_ptr->process_id < 0)
+    {
+        perror("fork");
+        exit(2);
+    }
+    else
+    {
+        close(pipe_arr[1]);
+        job_ptr->s32pipe = pipe_arr[0];
+        strcpy(job_ptr->name_arr , a_scenario_ptr->name_arr);
+        job_ptr->file_name_ptr = a_scenario_ptr->file_name_ptr;
+        job_ptr->u16line = a_scenario_ptr->u16line;
+        g_u32jobs_number++;
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Runner_wait
+ *
+ * Description: 	wait for any running scenario to finish and report it.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Runner_wait(void)
+{
+    StrRunner_job_t * job_ptr = NULL_PTR;
+    StrScenario_result_t result;
+    int status = 0;
+    pid_t process_id = waitpid(-1 , &status , 0);
+    double host_time = 0;
+    for(uint32 u32counter = 0 ; u32counter < RUNNER_MAX_JOBS ; u32counter++)
+    {
+        if(process_id > 0 && g_jobs_arr[u32counter].process_id == process_id)
+        {
+            job_ptr = &g_jobs_arr[u32counter];
+            break;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    if(job_ptr == NULL_PTR)
+    {
+        return;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    host_time = Runner_get_time() - job_ptr->host_start_time;
+    g_u32scenarios++;
+    if(read(job_ptr->s32pipe , &result , sizeof(result)) != sizeof(result))
+    {
+        /* the process crashed before sending its result */
+        memset(&result , 0 , sizeof(result));
+        snprintf(result.message_arr , SCENARIO_MESSAGE_SIZE , "%s:%u: crashed (status 0x%x)" ,
+                job_ptr->file_name_ptr , job_ptr->u16line , status);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    g_u64virtual_time += result.u64virtual_time;
+    if(result.u8passed == TRUE)
+    {
+        if(g_u8verbose == TRUE)
+        {
+            printf("PASS %-32s %8.3f s virtual %8.3f s host %4u checks\n" , job_ptr->name_arr ,
+                    result.u64virtual_time / RUNNER_US_PER_S , host_time , result.u16checks);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        g_u32failed++;
+        printf("FAIL %-32s %8.3f s virtual %8.3f s host %4u/%u checks failed\n     %s\n" , job_ptr->name_arr ,
+                result.u64virtual_time / RUNNER_US_PER_S , host_time , result.u16failures , result.u16checks ,
+                result.message_arr);
+    }
+    close(job_ptr->s32pipe);
+    job_ptr->process_id = 0;
+    g_u32jobs_number--;
+}
+
+/*******************************************************************************
+ * Function Name:	Runner_record
+ *
+ * Description: 	run scenario with pins recording and write its VCD file.
+ *
+ * Inputs:			a_scenario_ptr    (const StrScenario_t*)
+ *
+ * Outputs:			a_result_ptr      (StrScenario_result_t*)
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Runner_record(const StrScenario_t * a_scenario_ptr , StrScenario_result_t * a_result_ptr)
+{
+    char path_arr[RUNNER_PATH_SIZE];
+    Scenario_start(a_scenario_ptr , a_result_ptr);
+    if(Vcd_model_Initialization(g_u8vcd_ports_mask , g_u32vcd_records) == FALSE)
+    {
+        fprintf(stderr , "%s: can't record pins\n" , a_scenario_ptr->name_arr);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    Sim_run(Firmware_main , a_scenario_ptr->u64end_time);
+    Scenario_finish();
+    snprintf(path_arr , sizeof(path_arr) , "%s/%s.vcd" , g_vcd_directory_ptr , a_scenario_ptr->name_arr);
+    if(Vcd_model_write(path_arr) == FALSE)
+    {
+        fprintf(stderr , "%s: can't write file\n" , path_arr);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    Vcd_model_close();
+}
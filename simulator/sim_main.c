@@ -0,0 +1,146 @@
+/*******************************************************************************
+ *
+ * File:                sim_main.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            host application that runs the firmware on the
+ *                      simulator for virtual time and prints the LCD screen.
+ *                      usage: microwave_sim [-w file.vcd] [-p ports]
+ *                                  [-r records] [-i] [time in ms] [pot voltage in mV]
+ *                      -w writes pins activity of the ports (letters as
+ *                      "ace", all ports by default) with the last records
+ *                      changes, -i disables idle loops skipping so the pins
+ *                      of the skipped loops (as the keypad scan) are recorded.
+ *
+ * Revision history:    8/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "simulator.h"
+#include "HD44780_model.h"
+#include "peripherals_model.h"
+#include "timers_model.h"
+#include "vcd_model.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* default run time covers welcome screen and drawing home screen */
+#define SIM_MAIN_DEFAULT_TIME           3000u
+/* potentiometer is connected to channel 0 */
+#define SIM_MAIN_POT_CHANNEL            0u
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/* main and interrupt functions of the firmware, main is renamed in simulator
+ * build and low priority function exists with two interrupt levels only */
+extern void Firmware_main(void);
+extern void ISR(void);
+extern void ISRL(void) __attribute__((weak));
+
+/* host application */
+int main(int argc , char * argv[])
+{
+    /* virtual time of the run in ms */
+    uint32 u32time = SIM_MAIN_DEFAULT_TIME;
+    /* pins recording of the run */
+    const char * vcd_file_ptr = NULL_PTR;
+    uint8 u8ports_mask = VCD_ALL_PORTS;
+    uint32 u32records = VCD_DEFAULT_RECORDS;
+    uint8 u8idle_skip = TRUE;
+    sint32 s32option = 0;
+    /* LCD traffic of the run */
+    StrHD44780_counters_t lcd_counters;
+    while((s32option = getopt(argc , argv , "w:p:r:i")) != -1)
+    {
+        if(s32option == 'w')
+        {
+            vcd_file_ptr = optarg;
+        }
+        else if(s32option == 'p')
+        {
+            u8ports_mask = Vcd_model_get_ports_mask(optarg);
+        }
+        else if(s32option == 'r')
+        {
+            u32records = (uint32)strtoul(optarg , NULL_PTR , 10);
+        }
+        else if(s32option == 'i')
+        {
+            u8idle_skip = FALSE;
+        }
+        else
+        {
+            fprintf(stderr , "usage: %s [-w file.vcd] [-p ports] [-r records] [-i] [time in ms] [pot voltage in mV]\n" , argv[0]);
+            return 2;
+        }
+    }
+    if(optind < argc)
+    {
+        u32time = (uint32)strtoul(argv[optind] , NULL_PTR , 10);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    Sim_Initialization();
+    HD44780_Initialization();
+    Models_Initialization();
+    Timers_model_Initialization();
+    Sim_set_interrupt_functions(ISR , ISRL);
+    Sim_set_idle_skip(u8idle_skip);
+    if(optind + 1 < argc)
+    {
+        Model_ADC_set_voltage(SIM_MAIN_POT_CHANNEL , (uint16)strtoul(argv[optind + 1] , NULL_PTR , 10));
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    if(vcd_file_ptr != NULL_PTR && Vcd_model_Initialization(u8ports_mask , u32records) == FALSE)
+    {
+        fprintf(stderr , "can't record %u changes\n" , u32records);
+        return 2;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    Sim_run(Firmware_main , (uint64)u32time * 1000u);
+    HD44780_print_screen();
+    HD44780_get_counters(&lcd_counters);
+    printf("virtual time: %llu us\n" , (unsigned long long)Sim_get_time_us());
+    printf("register accesses: %llu\n" , (unsigned long long)Sim_get_register_accesses());
+    printf("skipped idle time: %llu us\n" , (unsigned long long)(Sim_get_skipped_cycles() / SIM_CYCLES_PER_US));
+    printf("LCD: %u strobes, %u commands, %u data writes, %u busy violations, %u hidden writes\n" ,
+            lcd_counters.u32enable_strobes , lcd_counters.u32commands ,
+            lcd_counters.u32data_writes , lcd_counters.u32busy_violations ,
+            lcd_counters.u32hidden_writes);
+    if(vcd_file_ptr != NULL_PTR)
+    {
+        if(Vcd_model_write(vcd_file_ptr) == FALSE)
+        {
+            fprintf(stderr , "%s: can't write file\n" , vcd_file_ptr);
+            return 2;
+        }
+        else
+        {
+            printf("VCD: %s, %llu old changes dropped\n" , vcd_file_ptr ,
+                    (unsigned long long)Vcd_model_get_dropped());
+        }
+        Vcd_model_close();
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return 0;
+}
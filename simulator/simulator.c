@@ -0,0 +1,1441 @@
+/*******************************************************************************
+ *
+ * File:                simulator.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of host simulator
+ *                      core, the firmware gets pointer to the register in the
+ *                      simulated register file on every access so the change
+ *                      of the last accessed register is detected on the next
+ *                      access (or delay) and sent to the peripherals models.
+ *                      the clock jumps over delays and idle loops to the next
+ *                      event of the models, where the interrupt functions of
+ *                      the firmware are called if their flags are enabled.
+ *
+ * Revision history:    8/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include <setjmp.h>
+#include <string.h>
+#include "simulator.h"
+#include "helped_macros.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* interrupt registers and their bits */
+#define SIM_INTCON_ADDRESS                  0xFF2u
+#define SIM_INTCON2_ADDRESS                 0xFF1u
+#define SIM_INTCON3_ADDRESS                 0xFF0u
+#define SIM_RCON_ADDRESS                    0xFD0u
+#define SIM_PIE1_ADDRESS                    0xF9Du
+#define SIM_PIR1_ADDRESS                    0xF9Eu
+#define SIM_IPR1_ADDRESS                    0xF9Fu
+#define SIM_PIE2_ADDRESS                    0xFA0u
+#define SIM_PIR2_ADDRESS                    0xFA1u
+#define SIM_IPR2_ADDRESS                    0xFA2u
+#define SIM_GIEH_BIT                        7u
+#define SIM_GIEL_BIT                        6u
+#define SIM_IPEN_BIT                        7u
+/* INT0 has always high priority, TMR0 and RB priorities are INTCON2 bits 2 and 0 */
+#define SIM_INTCON_HIGH_MASK(INTCON2)       (((INTCON2) & 0x05u) | 0x02u)
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/***************************** StrSim_idle_loop_t ******************************/
+typedef struct{
+    const void * pc_ptr;                /* code address of the loop point, NULL_PTR if not chosen */
+    const void * frame_ptr;             /* stack frame at the loop point */
+    uint64 u64cycles;                   /* clock at the last visit */
+    uint64 u64accesses;                 /* registers accesses at the last visit */
+    uint64 u64next_sample;              /* registers accesses to choose new point */
+    uint8  u8misses;                    /* visits without useful skip */
+}StrSim_idle_loop_t;
+
+/*******************************************************************************
+ *                            extern variables                                 *
+ *******************************************************************************/
+/* bounds of firmware sections which are defined by the linker, they are
+ * weak so applications without firmware objects (as PIC18 core) are linked */
+extern uint8 __start_fw_data[] __attribute__((weak));
+extern uint8 __stop_fw_data[] __attribute__((weak));
+extern uint8 __start_fw_bss[] __attribute__((weak));
+extern uint8 __stop_fw_bss[] __attribute__((weak));
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* simulated data memory, only special function registers are used */
+static volatile uint8 g_u8registers_arr[SIM_REGISTERS_NUMBER];
+/* attached peripherals models */
+static const StrSim_peripheral_t * g_peripherals_arr[SIM_MAX_PERIPHERALS];
+static uint8 g_u8peripherals_number = 0;
+/* last accessed register and its value at the access time */
+static uint16 g_u16pending_address = SIM_NO_ADDRESS;
+static uint8 g_u8pending_value = 0;
+/* external levels of input pins (pull up resistors by default) */
+static uint8 g_u8input_levels_arr[SIM_PORTS_NUMBER];
+/* virtual clock in instruction cycles */
+static uint64 g_u64cycles = 0;
+/* number of registers accesses of the firmware */
+static uint64 g_u64register_accesses = 0;
+/* events of the attached models and the nearest of them */
+static uint64 g_u64events_arr[SIM_MAX_PERIPHERALS];
+static uint64 g_u64next_event = SIM_NO_EVENT;
+/* interrupt functions of the firmware and the running interrupt level */
+static void (*g_high_interrupt_ptr)(void) = NULL_PTR;
+static void (*g_low_interrupt_ptr)(void) = NULL_PTR;
+static uint8 g_u8interrupt_level = SIM_NO_INTERRUPT;
+/* calls of interrupt functions, SLEEP waits for the next one */
+static uint64 g_u64interrupts_number = 0;
+/* calls of high priority function which interrupted the low priority one */
+static uint64 g_u64nested_interrupts_number = 0;
+/* levels of pins which are driven by peripherals instead of the latch */
+static uint8 g_u8override_masks_arr[SIM_PORTS_NUMBER];
+static uint8 g_u8override_levels_arr[SIM_PORTS_NUMBER];
+/* idle loops detection, state of the firmware at the last visit of the loop point */
+static uint8 g_u8idle_skip_flag = TRUE;
+static StrSim_idle_loop_t g_idle_loop;
+static uint8 g_u8idle_state_arr[SIM_IDLE_STATE_SIZE];
+static uint32 g_u32idle_state_size = 0;
+static uint8 g_u8idle_equal_flag = FALSE;
+static uint32 g_u32idle_random = 1;
+static uint64 g_u64skipped_cycles = 0;
+/* stack frame of Sim_run, the firmware stack is below it */
+static uint8 * g_u8stack_base_ptr = NULL_PTR;
+/* time limit of the current run in instruction cycles */
+static uint64 g_u64cycles_limit = 0;
+static uint8 g_u8running_flag = FALSE;
+/* context to return from the firmware when the time limit is reached or
+ * function which pauses the run at the limit */
+static jmp_buf g_run_exit_context;
+static void (*g_pause_function_ptr)(void) = NULL_PTR;
+/* informed when external levels or peripheral outputs of port are set */
+static void (*g_pins_function_ptr)(uint8 a_u8port) = NULL_PTR;
+/* saved static variables of the firmware, they are the same for all
+ * simulated units so they are out of bss section of the simulator state */
+static uint8 g_u8firmware_state_arr[SIM_FIRMWARE_STATE_SIZE] __attribute__((section(".bss.sim_shared")));
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Sim_sync_pending_access
+ *
+ * Description: 	check if the firmware changed the last accessed register
+ *                  and inform peripherals models by the change.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Sim_sync_pending_access(void);
+
+/*******************************************************************************
+ * Function Name:	Sim_advance_cycles
+ *
+ * Description: 	advance the virtual clock and stop the run when its time
+ *                  limit is reached.
+ *
+ * Inputs:			a_u64cycles       (uint64)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Sim_advance_cycles(uint64 a_u64cycles);
+
+/*******************************************************************************
+ * Function Name:	Sim_run_events
+ *
+ * Description: 	call event callbacks of the models whose event time is
+ *                  reached and find the next event.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Sim_run_events(void);
+
+/*******************************************************************************
+ * Function Name:	Sim_check_interrupts
+ *
+ * Description: 	call interrupt function of the firmware if enabled
+ *                  interrupt flag is set, global interrupt bit of its level
+ *                  is cleared while it runs as the hardware does.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Sim_check_interrupts(void);
+
+/*******************************************************************************
+ * Function Name:	Sim_idle_check
+ *
+ * Description: 	detect idle loop of the firmware by returning to chosen
+ *                  code point with the same state and advance the clock by
+ *                  whole loops to just before the next event.
+ *
+ * Inputs:			a_pc_ptr          (const void*) code address of the access
+ *                  a_frame_ptr       (const void*) stack frame of the access
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Sim_idle_check(const void * a_pc_ptr , const void * a_frame_ptr);
+
+/*******************************************************************************
+ * Function Name:	Sim_idle_compare_state
+ *
+ * Description: 	compare the current state of the firmware (callee saved
+ *                  registers, stack, static variables, special function
+ *                  registers, inputs and events) with its saved state and
+ *                  save the current one.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the state isn't changed, FALSE otherwise (uint8)
+ *******************************************************************************/
+static uint8 Sim_idle_compare_state(void) __attribute__((noinline));
+
+/*******************************************************************************
+ * Function Name:	Sim_idle_compare_region
+ *
+ * Description: 	compare memory region with its part of the saved state
+ *                  and save it.
+ *
+ * Inputs:			a_region_ptr      (const void*)
+ *                  a_u32size         (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Sim_idle_compare_region(const void * a_region_ptr , uint32 a_u32size);
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Sim_Initialization
+ *
+ * Description: 	reset registers to their power on values, reset virtual
+ *                  clock and remove all attached peripherals models.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sim_Initialization(void)
+{
+    for(uint16 u16counter = 0 ; u16counter < SIM_REGISTERS_NUMBER ; u16counter++)
+    {
+        g_u8registers_arr[u16counter] = 0;
+    }
+    /* all pins are input pins after reset */
+    for(uint8 u8port = GPIO_PORTA ; u8port < SIM_PORTS_NUMBER ; u8port++)
+    {
+        g_u8registers_arr[SIM_DIRECTION_ADDRESS(u8port)] = 0xFF;
+        g_u8input_levels_arr[u8port] = 0xFF;
+    }
+    /* PORTE has 3 pins only */
+    g_u8registers_arr[SIM_DIRECTION_ADDRESS(GPIO_PORTE)] = 0x07;
+    for(uint8 u8port = GPIO_PORTA ; u8port < SIM_PORTS_NUMBER ; u8port++)
+    {
+        g_u8override_masks_arr[u8port] = 0;
+    }
+    /* interrupts have high priority after reset */
+    g_u8registers_arr[SIM_INTCON2_ADDRESS] = 0xF5;
+    g_u8registers_arr[SIM_INTCON3_ADDRESS] = 0xC0;
+    g_u8registers_arr[SIM_IPR1_ADDRESS] = 0xFF;
+    g_u8registers_arr[SIM_IPR2_ADDRESS] = 0xDF;
+    g_u8peripherals_number = 0;
+    g_u64next_event = SIM_NO_EVENT;
+    g_high_interrupt_ptr = NULL_PTR;
+    g_low_interrupt_ptr = NULL_PTR;
+    g_u8interrupt_level = SIM_NO_INTERRUPT;
+    g_u64nested_interrupts_number = 0;
+    g_u8idle_skip_flag = TRUE;
+    g_idle_loop.pc_ptr = NULL_PTR;
+    g_idle_loop.u64next_sample = SIM_IDLE_SAMPLE_ACCESSES;
+    g_u64skipped_cycles = 0;
+    g_u16pending_address = SIM_NO_ADDRESS;
+    g_u64cycles = 0;
+    g_u64register_accesses = 0;
+    g_u8running_flag = FALSE;
+    g_pause_function_ptr = NULL_PTR;
+    g_pins_function_ptr = NULL_PTR;
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_add_peripheral
+ *
+ * Description: 	attach peripheral model to the register file.
+ *
+ * Inputs:			a_peripheral_ptr  (const StrSim_peripheral_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the model is attached, FALSE otherwise (uint8)
+ *******************************************************************************/
+uint8 Sim_add_peripheral(const StrSim_peripheral_t * a_peripheral_ptr)
+{
+    uint8 retVal = FALSE;
+    if(g_u8peripherals_number < SIM_MAX_PERIPHERALS)
+    {
+        g_peripherals_arr[g_u8peripherals_number] = a_peripheral_ptr;
+        g_u64events_arr[g_u8peripherals_number] = SIM_NO_EVENT;
+        g_u8peripherals_number++;
+        retVal = TRUE;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_schedule_event
+ *
+ * Description: 	set the time of the next event of attached model, the
+ *                  virtual clock stops at this time to call its event
+ *                  callback even if the firmware is in delay or idle loop.
+ *                  note: every model has one event, the new time replaces
+ *                        the old one.
+ *
+ * Inputs:			a_peripheral_ptr  (const StrSim_peripheral_t*)
+ *                  a_u64cycle        (uint64) event time in instruction
+ *                                    cycles or SIM_NO_EVENT to cancel it
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sim_schedule_event(const StrSim_peripheral_t * a_peripheral_ptr , uint64 a_u64cycle)
+{
+    g_u64next_event = SIM_NO_EVENT;
+    for(uint8 u8counter = 0 ; u8counter < g_u8peripherals_number ; u8counter++)
+    {
+        if(g_peripherals_arr[u8counter] == a_peripheral_ptr)
+        {
+            g_u64events_arr[u8counter] = a_u64cycle;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        if(g_u64events_arr[u8counter] < g_u64next_event)
+        {
+            g_u64next_event = g_u64events_arr[u8counter];
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_set_interrupt_functions
+ *
+ * Description: 	set interrupt functions of the firmware which are called
+ *                  when enabled interrupt flag is set, the low priority
+ *                  function is used only if the firmware sets IPEN bit.
+ *
+ * Inputs:			a_high_function_ptr   (void(*)(void)) high priority (or the
+ *                                        only) interrupt function
+ *                  a_low_function_ptr    (void(*)(void)) NULL_PTR if the
+ *                                        firmware has one interrupt level
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sim_set_interrupt_functions(void (*a_high_function_ptr)(void) , void (*a_low_function_ptr)(void))
+{
+    g_high_interrupt_ptr = a_high_function_ptr;
+    g_low_interrupt_ptr = a_low_function_ptr;
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_set_idle_skip
+ *
+ * Description: 	enable or disable skipping of idle loops, idle loop is
+ *                  detected when the firmware returns to the same point of
+ *                  its code with the same state so it repeats itself until
+ *                  the next event of the models.
+ *                  note: it is enabled by Sim_Initialization.
+ *
+ * Inputs:			a_u8enable        (uint8) TRUE or FALSE
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sim_set_idle_skip(uint8 a_u8enable)
+{
+    g_u8idle_skip_flag = a_u8enable;
+    g_idle_loop.pc_ptr = NULL_PTR;
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_run
+ *
+ * Description: 	run the firmware entry function until the virtual clock
+ *                  reaches the time limit.
+ *                  note: the firmware doesn't return so the run is stopped
+ *                        from the register access which exceeds the limit.
+ *
+ * Inputs:			a_entry_function_ptr  (void(*)(void)) firmware main function
+ *                  a_u64time_limit       (uint64) virtual time limit in us
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the run is stopped by time limit, FALSE if the
+ *                  entry function returned (uint8)
+ *******************************************************************************/
+uint8 Sim_run(void (*a_entry_function_ptr)(void) , uint64 a_u64time_limit)
+{
+    uint8 retVal = FALSE;
+    g_u64cycles_limit = a_u64time_limit * SIM_CYCLES_PER_US;
+    g_u8running_flag = TRUE;
+    g_u8interrupt_level = SIM_NO_INTERRUPT;
+    g_u8stack_base_ptr = (uint8 *)__builtin_frame_address(0);
+    if(setjmp(g_run_exit_context) == 0)
+    {
+        a_entry_function_ptr();
+        /* apply the last write of the firmware before leaving */
+        Sim_sync_pending_access();
+    }
+    else
+    {
+        retVal = TRUE;
+    }
+    g_u8running_flag = FALSE;
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_set_time_limit
+ *
+ * Description: 	change the time limit of the current run.
+ *
+ * Inputs:			a_u64time_limit   (uint64) virtual time limit in us
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sim_set_time_limit(uint64 a_u64time_limit)
+{
+    g_u64cycles_limit = a_u64time_limit * SIM_CYCLES_PER_US;
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_set_pause_function
+ *
+ * Description: 	set function which is called when the run reaches its
+ *                  time limit instead of stopping the run, the firmware
+ *                  continues from the same point when it returns so it
+ *                  should extend the limit by Sim_set_time_limit first.
+ *                  note: it is removed by Sim_Initialization.
+ *
+ * Inputs:			a_pause_function_ptr  (void(*)(void)) NULL_PTR to stop
+ *                                        the run at its limit
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sim_set_pause_function(void (*a_pause_function_ptr)(void))
+{
+    g_pause_function_ptr = a_pause_function_ptr;
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_set_pins_function
+ *
+ * Description: 	set function which is called when external levels or
+ *                  peripheral outputs of port are set, it is used by models
+ *                  which record the pins because these changes aren't
+ *                  register writes of the firmware.
+ *                  note: it is removed by Sim_Initialization.
+ *
+ * Inputs:			a_pins_function_ptr   (void(*)(uint8)) it takes the port
+ *                                        GPIO_PORTA to GPIO_PORTE
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sim_set_pins_function(void (*a_pins_function_ptr)(uint8 a_u8port))
+{
+    g_pins_function_ptr = a_pins_function_ptr;
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_register_access
+ *
+ * Description: 	give the firmware address of register in the simulated
+ *                  register file, the last access is checked first to call
+ *                  peripherals models if the firmware changed its value.
+ *                  note: it is used by REGISTER_8BIT macro in host build.
+ *
+ * Inputs:			a_u16address      (uint16) register address
+ *
+ * Outputs:			NULL
+ *
+ * Return:			pointer to the register (volatile uint8*)
+ *******************************************************************************/
+volatile uint8 * Sim_register_access(uint16 a_u16address)
+{
+    /* the address is masked to stay inside the register file */
+    a_u16address &= SIM_REGISTERS_NUMBER - 1;
+    Sim_sync_pending_access();
+    g_u64register_accesses++;
+    /* idle loops are detected out of interrupt functions only */
+    if(g_u8idle_skip_flag == TRUE && g_u8interrupt_level == SIM_NO_INTERRUPT)
+    {
+        Sim_idle_check(__builtin_return_address(0) , __builtin_frame_address(0));
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    Sim_advance_cycles(SIM_REGISTER_ACCESS_CYCLES);
+    /* models update their registers (as flags or inputs) before the firmware reads them */
+    for(uint8 u8counter = 0 ; u8counter < g_u8peripherals_number ; u8counter++)
+    {
+        if(g_peripherals_arr[u8counter]->read_callback != NULL_PTR)
+        {
+            g_peripherals_arr[u8counter]->read_callback(a_u16address);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    /* reading the port gives levels of its pins */
+    if(a_u16address >= SIM_PORT_ADDRESS(GPIO_PORTA) && a_u16address <= SIM_PORT_ADDRESS(GPIO_PORTE))
+    {
+        g_u8registers_arr[a_u16address] = Sim_get_pin_levels(a_u16address - SIM_PORT_ADDRESS(GPIO_PORTA));
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    g_u16pending_address = a_u16address;
+    g_u8pending_value = g_u8registers_arr[a_u16address];
+    return &g_u8registers_arr[a_u16address];
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_delay_us
+ *
+ * Description: 	advance the virtual clock by delay of the firmware.
+ *
+ * Inputs:			a_u32time         (uint32) time in us
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sim_delay_us(uint32 a_u32time)
+{
+    Sim_sync_pending_access();
+    Sim_advance_cycles((uint64)a_u32time * SIM_CYCLES_PER_US);
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_sleep
+ *
+ * Description: 	SLEEP instruction in Idle mode (IDLEN bit), the CPU stops
+ *                  and the peripherals run so the virtual clock jumps to the
+ *                  events of the models until an interrupt function runs.
+ *                  note: Sleep mode which stops the peripherals isn't
+ *                        simulated.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sim_sleep(void)
+{
+    uint64 u64interrupts_number = g_u64interrupts_number;
+    Sim_sync_pending_access();
+    Sim_check_interrupts();
+    while(g_u64interrupts_number == u64interrupts_number)
+    {
+        if(g_u64next_event < g_u64cycles_limit)
+        {
+            Sim_advance_cycles((g_u64next_event > g_u64cycles) ? (g_u64next_event - g_u64cycles) : 0);
+        }
+        else
+        {
+            /* no event before the limit, the run ends or pauses there */
+            Sim_advance_cycles((g_u64cycles_limit > g_u64cycles) ? (g_u64cycles_limit - g_u64cycles) : 1);
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_read_register
+ *
+ * Description: 	read register value from peripherals models or test code
+ *                  without running the models or advancing the clock.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			register value (uint8)
+ *******************************************************************************/
+uint8 Sim_read_register(uint16 a_u16address)
+{
+    return g_u8registers_arr[a_u16address & (SIM_REGISTERS_NUMBER - 1)];
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_write_register
+ *
+ * Description: 	write register value from peripherals models (as hardware
+ *                  flags) without running the models or advancing the clock.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *                  a_u8value         (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sim_write_register(uint16 a_u16address , uint8 a_u8value)
+{
+    a_u16address &= SIM_REGISTERS_NUMBER - 1;
+    g_u8registers_arr[a_u16address] = a_u8value;
+    /* hardware change of the pending register isn't a firmware write */
+    if(a_u16address == g_u16pending_address)
+    {
+        g_u8pending_value = a_u8value;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_get_pin_levels
+ *
+ * Description: 	get levels of port pins, output pins follow the port latch
+ *                  (or the peripheral which overrides it) and input pins
+ *                  follow the external levels.
+ *
+ * Inputs:			a_u8port          (uint8) GPIO_PORTA to GPIO_PORTE
+ *
+ * Outputs:			NULL
+ *
+ * Return:			levels of the 8 pins (uint8)
+ *******************************************************************************/
+uint8 Sim_get_pin_levels(uint8 a_u8port)
+{
+    uint8 u8direction = g_u8registers_arr[SIM_DIRECTION_ADDRESS(a_u8port)];
+    uint8 u8outputs = (g_u8registers_arr[SIM_LATCH_ADDRESS(a_u8port)] & ~g_u8override_masks_arr[a_u8port]) |
+            (g_u8override_levels_arr[a_u8port] & g_u8override_masks_arr[a_u8port]);
+    return (u8outputs & ~u8direction) | (g_u8input_levels_arr[a_u8port] & u8direction);
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_set_output_override
+ *
+ * Description: 	make peripheral (as CCP compare output) drive port pins
+ *                  instead of the port latch when they are output pins.
+ *
+ * Inputs:			a_u8port          (uint8) GPIO_PORTA to GPIO_PORTE
+ *                  a_u8mask          (uint8) pins of the peripheral
+ *                  a_u8levels        (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sim_set_output_override(uint8 a_u8port , uint8 a_u8mask , uint8 a_u8levels)
+{
+    if(a_u8port < SIM_PORTS_NUMBER)
+    {
+        g_u8override_masks_arr[a_u8port] = a_u8mask;
+        g_u8override_levels_arr[a_u8port] = a_u8levels;
+        if(g_pins_function_ptr != NULL_PTR)
+        {
+            g_pins_function_ptr(a_u8port);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_set_input_levels
+ *
+ * Description: 	set external levels that drive port pins when they are
+ *                  configured as input pins.
+ *
+ * Inputs:			a_u8port          (uint8) GPIO_PORTA to GPIO_PORTE
+ *                  a_u8levels        (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sim_set_input_levels(uint8 a_u8port , uint8 a_u8levels)
+{
+    if(a_u8port < SIM_PORTS_NUMBER)
+    {
+        g_u8input_levels_arr[a_u8port] = a_u8levels;
+        if(g_pins_function_ptr != NULL_PTR)
+        {
+            g_pins_function_ptr(a_u8port);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_get_cycles
+ *
+ * Description: 	get the virtual clock in instruction cycles.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			instruction cycles since initialization (uint64)
+ *******************************************************************************/
+uint64 Sim_get_cycles(void)
+{
+    return g_u64cycles;
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_get_time_us
+ *
+ * Description: 	get the virtual clock in micro seconds.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			time since initialization in us (uint64)
+ *******************************************************************************/
+uint64 Sim_get_time_us(void)
+{
+    return g_u64cycles / SIM_CYCLES_PER_US;
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_get_register_accesses
+ *
+ * Description: 	get number of registers accesses of the firmware.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			number of accesses since initialization (uint64)
+ *******************************************************************************/
+uint64 Sim_get_register_accesses(void)
+{
+    return g_u64register_accesses;
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_get_skipped_cycles
+ *
+ * Description: 	get instruction cycles of idle loops which are skipped
+ *                  without running the firmware.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			skipped cycles since initialization (uint64)
+ *******************************************************************************/
+uint64 Sim_get_skipped_cycles(void)
+{
+    return g_u64skipped_cycles;
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_get_interrupt_level
+ *
+ * Description: 	get priority level of the interrupt function which is
+ *                  running now.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			SIM_NO_INTERRUPT, SIM_LOW_INTERRUPT or SIM_HIGH_INTERRUPT (uint8)
+ *******************************************************************************/
+uint8 Sim_get_interrupt_level(void)
+{
+    return g_u8interrupt_level;
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_get_nested_interrupts
+ *
+ * Description: 	get number of calls of the high priority interrupt
+ *                  function which interrupted the low priority one.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			nested calls since initialization (uint64)
+ *******************************************************************************/
+uint64 Sim_get_nested_interrupts(void)
+{
+    return g_u64nested_interrupts_number;
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_get_interrupt_request
+ *
+ * Description: 	get priority level of enabled interrupt flags which are
+ *                  set, global interrupt bits of INTCON register gate the
+ *                  levels as the hardware does.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			SIM_NO_INTERRUPT, SIM_LOW_INTERRUPT or SIM_HIGH_INTERRUPT (uint8)
+ *******************************************************************************/
+uint8 Sim_get_interrupt_request(void)
+{
+    uint8 u8intcon = g_u8registers_arr[SIM_INTCON_ADDRESS];
+    uint8 u8intcon2 = g_u8registers_arr[SIM_INTCON2_ADDRESS];
+    uint8 u8intcon3 = g_u8registers_arr[SIM_INTCON3_ADDRESS];
+    /* enable bits of INTCON and INTCON3 sources are 3 bits above their flags */
+    uint8 u8core_pending = (u8intcon >> 3) & u8intcon & 0x07;
+    uint8 u8external_pending = (u8intcon3 >> 3) & u8intcon3 & 0x03;
+    uint8 u8peripheral1_pending = g_u8registers_arr[SIM_PIR1_ADDRESS] & g_u8registers_arr[SIM_PIE1_ADDRESS];
+    uint8 u8peripheral2_pending = g_u8registers_arr[SIM_PIR2_ADDRESS] & g_u8registers_arr[SIM_PIE2_ADDRESS];
+    uint8 retVal = SIM_NO_INTERRUPT;
+    if(GET_BIT(u8intcon , SIM_GIEH_BIT) == 0)
+    {
+        /* Do nothing */
+    }
+    else if(GET_BIT(g_u8registers_arr[SIM_RCON_ADDRESS] , SIM_IPEN_BIT) == 0)
+    {
+        /* one interrupt level, peripherals interrupts need PEIE bit */
+        if(u8core_pending != 0 || u8external_pending != 0 ||
+                (GET_BIT(u8intcon , SIM_GIEL_BIT) != 0 && (u8peripheral1_pending != 0 || u8peripheral2_pending != 0)))
+        {
+            retVal = SIM_HIGH_INTERRUPT;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else if((u8core_pending & SIM_INTCON_HIGH_MASK(u8intcon2)) != 0 ||
+            (u8external_pending & (u8intcon3 >> 6)) != 0 ||
+            (u8peripheral1_pending & g_u8registers_arr[SIM_IPR1_ADDRESS]) != 0 ||
+            (u8peripheral2_pending & g_u8registers_arr[SIM_IPR2_ADDRESS]) != 0)
+    {
+        retVal = SIM_HIGH_INTERRUPT;
+    }
+    else if(GET_BIT(u8intcon , SIM_GIEL_BIT) != 0 && (u8core_pending != 0 || u8external_pending != 0 ||
+            u8peripheral1_pending != 0 || u8peripheral2_pending != 0))
+    {
+        /* pending interrupts which aren't high priority are low priority */
+        retVal = SIM_LOW_INTERRUPT;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_bus_read
+ *
+ * Description: 	read data memory from instruction level core, special
+ *                  function registers are updated by the models first as
+ *                  the register access of the compiled firmware.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			register value (uint8)
+ *******************************************************************************/
+uint8 Sim_bus_read(uint16 a_u16address)
+{
+    a_u16address &= SIM_REGISTERS_NUMBER - 1;
+    if(a_u16address >= SIM_FIRST_SFR_ADDRESS)
+    {
+        g_u64register_accesses++;
+        for(uint8 u8counter = 0 ; u8counter < g_u8peripherals_number ; u8counter++)
+        {
+            if(g_peripherals_arr[u8counter]->read_callback != NULL_PTR)
+            {
+                g_peripherals_arr[u8counter]->read_callback(a_u16address);
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        if(a_u16address >= SIM_PORT_ADDRESS(GPIO_PORTA) && a_u16address <= SIM_PORT_ADDRESS(GPIO_PORTE))
+        {
+            g_u8registers_arr[a_u16address] = Sim_get_pin_levels(a_u16address - SIM_PORT_ADDRESS(GPIO_PORTA));
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return g_u8registers_arr[a_u16address];
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_bus_write
+ *
+ * Description: 	write data memory from instruction level core, the
+ *                  models are informed by the change of special function
+ *                  registers as the register access of the compiled firmware.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *                  a_u8value         (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sim_bus_write(uint16 a_u16address , uint8 a_u8value)
+{
+    a_u16address &= SIM_REGISTERS_NUMBER - 1;
+    if(a_u16address >= SIM_FIRST_SFR_ADDRESS)
+    {
+        /* the models see the write as modified register after their update */
+        g_u16pending_address = a_u16address;
+        g_u8pending_value = Sim_bus_read(a_u16address);
+        g_u8registers_arr[a_u16address] = a_u8value;
+        Sim_sync_pending_access();
+    }
+    else
+    {
+        g_u8registers_arr[a_u16address] = a_u8value;
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_bus_cycles
+ *
+ * Description: 	advance the virtual clock by executed instruction cycles,
+ *                  events of the models run at their times and the run
+ *                  stops (or pauses) at its time limit.
+ *                  note: interrupt functions aren't called when they aren't
+ *                        set, the core checks Sim_get_interrupt_request.
+ *
+ * Inputs:			a_u8cycles        (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sim_bus_cycles(uint8 a_u8cycles)
+{
+    Sim_advance_cycles(a_u8cycles);
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_save_firmware_state
+ *
+ * Description: 	save static variables of the firmware to restore them
+ *                  before every run, the build moves them to fw_data and
+ *                  fw_bss sections.
+ *                  note: it should be called before the first run.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the variables are saved, FALSE if their size
+ *                  exceeds SIM_FIRMWARE_STATE_SIZE (uint8)
+ *******************************************************************************/
+uint8 Sim_save_firmware_state(void)
+{
+    uint8 retVal = FALSE;
+    uint32 u32data_size = __stop_fw_data - __start_fw_data;
+    if(u32data_size <= SIM_FIRMWARE_STATE_SIZE)
+    {
+        /* bss section is zero at start so the initialized data is enough */
+        memcpy(g_u8firmware_state_arr , __start_fw_data , u32data_size);
+        retVal = TRUE;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_restore_firmware_state
+ *
+ * Description: 	return static variables of the firmware to their saved
+ *                  values so the next run starts from power on state in the
+ *                  same process.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Sim_restore_firmware_state(void)
+{
+    memcpy(__start_fw_data , g_u8firmware_state_arr , __stop_fw_data - __start_fw_data);
+    memset(__start_fw_bss , 0 , __stop_fw_bss - __start_fw_bss);
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_sync_pending_access
+ *
+ * Description: 	check if the firmware changed the last accessed register
+ *                  and inform peripherals models by the change.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Sim_sync_pending_access(void)
+{
+    uint16 u16address = g_u16pending_address;
+    uint8 u8old_value = g_u8pending_value;
+    uint8 u8new_value = 0;
+    if(u16address != SIM_NO_ADDRESS)
+    {
+        g_u16pending_address = SIM_NO_ADDRESS;
+        u8new_value = g_u8registers_arr[u16address];
+        if(u8new_value != u8old_value)
+        {
+            /* writing the port is writing its latch */
+            if(u16address >= SIM_PORT_ADDRESS(GPIO_PORTA) && u16address <= SIM_PORT_ADDRESS(GPIO_PORTE))
+            {
+                u16address += SIM_LATCH_ADDRESS(GPIO_PORTA) - SIM_PORT_ADDRESS(GPIO_PORTA);
+                u8old_value = g_u8registers_arr[u16address];
+                g_u8registers_arr[u16address] = u8new_value;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            for(uint8 u8counter = 0 ; u8counter < g_u8peripherals_number ; u8counter++)
+            {
+                if(g_peripherals_arr[u8counter]->write_callback != NULL_PTR)
+                {
+                    g_peripherals_arr[u8counter]->write_callback(u16address , u8old_value , u8new_value);
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_advance_cycles
+ *
+ * Description: 	advance the virtual clock and stop the run when its time
+ *                  limit is reached.
+ *
+ * Inputs:			a_u64cycles       (uint64)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Sim_advance_cycles(uint64 a_u64cycles)
+{
+    uint64 u64end_cycle = g_u64cycles + a_u64cycles;
+    uint64 u64interrupt_start = 0;
+    do
+    {
+        /* events in the middle of the delay run at their times and interrupt
+         * functions extend the delay by their time as the delay is cycles loop */
+        while(g_u64next_event <= u64end_cycle && g_u64next_event < g_u64cycles_limit)
+        {
+            if(g_u64next_event > g_u64cycles)
+            {
+                g_u64cycles = g_u64next_event;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            Sim_run_events();
+            u64interrupt_start = g_u64cycles;
+            Sim_check_interrupts();
+            u64end_cycle += g_u64cycles - u64interrupt_start;
+        }
+        if(u64end_cycle > g_u64cycles)
+        {
+            g_u64cycles = u64end_cycle;
+        }
+        else
+        {
+            u64end_cycle = g_u64cycles;
+        }
+        if(g_u8running_flag == TRUE && g_u64cycles >= g_u64cycles_limit)
+        {
+            /* the run ends or pauses at its limit even if it is in the middle
+             * of delay, the rest of the delay continues after the pause */
+            g_u64cycles = g_u64cycles_limit;
+            if(g_pause_function_ptr == NULL_PTR)
+            {
+                g_u8running_flag = FALSE;
+                longjmp(g_run_exit_context , 1);
+            }
+            else
+            {
+                g_pause_function_ptr();
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }while(g_u64cycles < u64end_cycle);
+    /* flags which are enabled by the last access of the firmware */
+    Sim_check_interrupts();
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_run_events
+ *
+ * Description: 	call event callbacks of the models whose event time is
+ *                  reached and find the next event.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Sim_run_events(void)
+{
+    for(uint8 u8counter = 0 ; u8counter < g_u8peripherals_number ; u8counter++)
+    {
+        if(g_u64events_arr[u8counter] <= g_u64cycles)
+        {
+            /* the callback schedules the next event of the model if it has */
+            g_u64events_arr[u8counter] = SIM_NO_EVENT;
+            if(g_peripherals_arr[u8counter]->event_callback != NULL_PTR)
+            {
+                g_peripherals_arr[u8counter]->event_callback();
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    g_u64next_event = SIM_NO_EVENT;
+    for(uint8 u8counter = 0 ; u8counter < g_u8peripherals_number ; u8counter++)
+    {
+        if(g_u64events_arr[u8counter] < g_u64next_event)
+        {
+            g_u64next_event = g_u64events_arr[u8counter];
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_check_interrupts
+ *
+ * Description: 	call interrupt function of the firmware if enabled
+ *                  interrupt flag is set, global interrupt bit of its level
+ *                  is cleared while it runs as the hardware does.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Sim_check_interrupts(void)
+{
+    uint8 u8intcon = 0;
+    uint8 u8level = Sim_get_interrupt_request();
+    uint8 u8previous_level = g_u8interrupt_level;
+    uint8 u8enable_bit = (u8level == SIM_LOW_INTERRUPT) ? SIM_GIEL_BIT : SIM_GIEH_BIT;
+    void (*function_ptr)(void) = (u8level == SIM_LOW_INTERRUPT) ? g_low_interrupt_ptr : g_high_interrupt_ptr;
+    /* high priority interrupt can interrupt low priority function only */
+    if(u8level > g_u8interrupt_level && function_ptr != NULL_PTR)
+    {
+        g_u8interrupt_level = u8level;
+        /* the hardware clears global interrupt bit of the level and RETFIE sets it */
+        u8intcon = g_u8registers_arr[SIM_INTCON_ADDRESS];
+        CLEAR_BIT(u8intcon , u8enable_bit);
+        Sim_write_register(SIM_INTCON_ADDRESS , u8intcon);
+        g_u64cycles += SIM_INTERRUPT_CYCLES;
+        g_u64interrupts_number++;
+        if(u8previous_level == SIM_LOW_INTERRUPT)
+        {
+            g_u64nested_interrupts_number++;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        function_ptr();
+        /* apply the last write of the interrupt function before returning */
+        Sim_sync_pending_access();
+        u8intcon = g_u8registers_arr[SIM_INTCON_ADDRESS];
+        SET_BIT(u8intcon , u8enable_bit);
+        Sim_write_register(SIM_INTCON_ADDRESS , u8intcon);
+        g_u8interrupt_level = u8previous_level;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_idle_check
+ *
+ * Description: 	detect idle loop of the firmware by returning to chosen
+ *                  code point with the same state and advance the clock by
+ *                  whole loops to just before the next event.
+ *
+ * Inputs:			a_pc_ptr          (const void*) code address of the access
+ *                  a_frame_ptr       (const void*) stack frame of the access
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Sim_idle_check(const void * a_pc_ptr , const void * a_frame_ptr)
+{
+    uint64 u64loop_cycles = 0;
+    uint64 u64loop_accesses = 0;
+    uint64 u64end_cycle = (g_u64next_event < g_u64cycles_limit) ? g_u64next_event : g_u64cycles_limit;
+    uint64 u64loops = 0;
+    if(g_idle_loop.pc_ptr == NULL_PTR)
+    {
+        /* the loop point is chosen after random number of accesses to not
+         * choose the same point of the loop every time */
+        if(g_u64register_accesses >= g_idle_loop.u64next_sample)
+        {
+            g_idle_loop.pc_ptr = a_pc_ptr;
+            g_idle_loop.frame_ptr = a_frame_ptr;
+            g_idle_loop.u8misses = 0;
+            g_idle_loop.u64cycles = g_u64cycles;
+            g_idle_loop.u64accesses = g_u64register_accesses;
+            Sim_idle_compare_state();
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else if(a_pc_ptr == g_idle_loop.pc_ptr && a_frame_ptr == g_idle_loop.frame_ptr)
+    {
+        g_idle_loop.u8misses++;
+        if(Sim_idle_compare_state() == TRUE)
+        {
+            /* the same state repeats the same loop until the next event,
+             * the last loop before the event runs to reach it at its time */
+            u64loop_cycles = g_u64cycles - g_idle_loop.u64cycles;
+            u64loop_accesses = g_u64register_accesses - g_idle_loop.u64accesses;
+            if(u64loop_cycles > 0 && u64end_cycle > g_u64cycles)
+            {
+                u64loops = (u64end_cycle - g_u64cycles) / u64loop_cycles;
+                u64loops = (u64loops > 0) ? u64loops - 1 : 0;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            g_u64cycles += u64loops * u64loop_cycles;
+            g_u64register_accesses += u64loops * u64loop_accesses;
+            g_u64skipped_cycles += u64loops * u64loop_cycles;
+            /* the point is kept while it gives useful skips */
+            if(u64loops * u64loop_cycles >= SIM_IDLE_MIN_SKIP_CYCLES)
+            {
+                g_idle_loop.u8misses = 0;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        g_idle_loop.u64cycles = g_u64cycles;
+        g_idle_loop.u64accesses = g_u64register_accesses;
+    }
+    else if(g_u64register_accesses - g_idle_loop.u64accesses > SIM_IDLE_MAX_LOOP_ACCESSES)
+    {
+        /* the point isn't in loop */
+        g_idle_loop.u8misses = SIM_IDLE_MAX_MISSES;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    if(g_idle_loop.pc_ptr != NULL_PTR && g_idle_loop.u8misses >= SIM_IDLE_MAX_MISSES)
+    {
+        g_idle_loop.pc_ptr = NULL_PTR;
+        g_u32idle_random = g_u32idle_random * 1103515245u + 12345u;
+        g_idle_loop.u64next_sample = g_u64register_accesses + SIM_IDLE_SAMPLE_ACCESSES +
+                ((g_u32idle_random >> 16) & SIM_IDLE_SAMPLE_RANDOM_MASK);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_idle_compare_state
+ *
+ * Description: 	compare the current state of the firmware (callee saved
+ *                  registers, stack, static variables, special function
+ *                  registers, inputs and events) with its saved state and
+ *                  save the current one.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the state isn't changed, FALSE otherwise (uint8)
+ *******************************************************************************/
+static uint8 Sim_idle_compare_state(void)
+{
+    /* registers which the firmware keeps its variables in them over the
+     * call are saved in the context, unused parts of it stay zero */
+    jmp_buf context;
+    uint8 * stack_ptr = (uint8 *)__builtin_frame_address(0);
+    memset(&context , 0 , sizeof(context));
+    setjmp(context);
+    g_u32idle_state_size = 0;
+    g_u8idle_equal_flag = TRUE;
+    Sim_idle_compare_region(&context , sizeof(context));
+    Sim_idle_compare_region(stack_ptr , g_u8stack_base_ptr - stack_ptr);
+    Sim_idle_compare_region(__start_fw_data , __stop_fw_data - __start_fw_data);
+    Sim_idle_compare_region(__start_fw_bss , __stop_fw_bss - __start_fw_bss);
+    Sim_idle_compare_region((const uint8 *)&g_u8registers_arr[SIM_FIRST_SFR_ADDRESS] ,
+            SIM_REGISTERS_NUMBER - SIM_FIRST_SFR_ADDRESS);
+    Sim_idle_compare_region(g_u8input_levels_arr , sizeof(g_u8input_levels_arr));
+    Sim_idle_compare_region(g_u8override_masks_arr , sizeof(g_u8override_masks_arr));
+    Sim_idle_compare_region(g_u8override_levels_arr , sizeof(g_u8override_levels_arr));
+    /* events which the loop doesn't wait for stay at the same times */
+    Sim_idle_compare_region(g_u64events_arr , g_u8peripherals_number * sizeof(uint64));
+    return g_u8idle_equal_flag;
+}
+
+/*******************************************************************************
+ * Function Name:	Sim_idle_compare_region
+ *
+ * Description: 	compare memory region with its part of the saved state
+ *                  and save it.
+ *
+ * Inputs:			a_region_ptr      (const void*)
+ *                  a_u32size         (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Sim_idle_compare_region(const void * a_region_ptr , uint32 a_u32size)
+{
+    uint8 * state_ptr = &g_u8idle_state_arr[g_u32idle_state_size];
+    if(g_u32idle_state_size + a_u32size > SIM_IDLE_STATE_SIZE)
+    {
+        /* too big state is never equal */
+        g_u8idle_equal_flag = FALSE;
+    }
+    else
+    {
+        if(g_u8idle_equal_flag == TRUE && memcmp(state_ptr , a_region_ptr , a_u32size) != 0)
+        {
+            g_u8idle_equal_flag = FALSE;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        memcpy(state_ptr , a_region_ptr , a_u32size);
+        g_u32idle_state_size += a_u32size;
+    }
+}
@@ -0,0 +1,533 @@
+/*******************************************************************************
+ *
+ * File:                simulator.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes, structures and
+ *                      definitions of host simulator core which replaces the
+ *                      special function registers of PIC18F4520 by simulated
+ *                      register file and runs the peripherals models on every
+ *                      register access of the firmware.
+ *                      the clock is virtual, delays and idle loops of the
+ *                      firmware advance it to the next event of the models
+ *                      without running their time on the host.
+ *
+ * Revision history:    8/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef SIMULATOR_H
+#define	SIMULATOR_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+#include "GPIO.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* instruction cycle is Fosc/4 = 2MHz */
+#define SIM_CYCLES_PER_US                   2u
+/* approximated instruction cycles of the code around every register access */
+#define SIM_REGISTER_ACCESS_CYCLES          2u
+/* size of data memory address space, special function registers are 0xF80-0xFFF */
+#define SIM_REGISTERS_NUMBER                0x1000u
+#define SIM_FIRST_SFR_ADDRESS               0xF80u
+/* max. number of peripherals models attached to the register file */
+#define SIM_MAX_PERIPHERALS                 8u
+/* ports registers, port index is GPIO_PORTA to GPIO_PORTE */
+#define SIM_PORTS_NUMBER                    5u
+#define SIM_PORT_ADDRESS(PORT)              (0xF80u + (PORT))
+#define SIM_LATCH_ADDRESS(PORT)             (0xF89u + (PORT))
+#define SIM_DIRECTION_ADDRESS(PORT)         (0xF92u + (PORT))
+/* value of register address that refer to no pending access */
+#define SIM_NO_ADDRESS                      0xFFFFu
+/* max. size of firmware static variables (fw_data and fw_bss sections) */
+#define SIM_FIRMWARE_STATE_SIZE             0x2000u
+/* value of event time that refers to no scheduled event */
+#define SIM_NO_EVENT                        0xFFFFFFFFFFFFFFFFull
+/* approximated instruction cycles of interrupt latency, context saving and return */
+#define SIM_INTERRUPT_CYCLES                20u
+/* priority levels of interrupt request */
+#define SIM_NO_INTERRUPT                    0u
+#define SIM_LOW_INTERRUPT                   1u
+#define SIM_HIGH_INTERRUPT                  2u
+/* idle loops detection: registers accesses between choosing new loop point
+ * (and random part of them), max. accesses of one loop, max. visits of the
+ * loop point without useful skip and min. useful skip in instruction cycles */
+#define SIM_IDLE_SAMPLE_ACCESSES            256u
+#define SIM_IDLE_SAMPLE_RANDOM_MASK         0x3Fu
+#define SIM_IDLE_MAX_LOOP_ACCESSES          8192u
+#define SIM_IDLE_MAX_MISSES                 8u
+#define SIM_IDLE_MIN_SKIP_CYCLES            1000u
+/* max. size of firmware state which is compared to detect idle loop (stack,
+ * static variables, special function registers and models events) */
+#define SIM_IDLE_STATE_SIZE                 0x1000u
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/**************************** StrSim_peripheral_t ******************************/
+typedef struct{
+    /* called when the firmware changes value of any register */
+    void (*write_callback)(uint16 a_u16address , uint8 a_u8old_value , uint8 a_u8new_value);
+    /* called before the firmware reads or modifies any register */
+    void (*read_callback)(uint16 a_u16address);
+    /* called when the virtual clock reaches the event time of the model
+     * which is set by Sim_schedule_event */
+    void (*event_callback)(void);
+}StrSim_peripheral_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Sim_Initialization
+ *
+ * Description: 	reset registers to their power on values, reset virtual
+ *                  clock and remove all attached peripherals models.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sim_Initialization(void);
+
+/*******************************************************************************
+ * Function Name:	Sim_add_peripheral
+ *
+ * Description: 	attach peripheral model to the register file.
+ *
+ * Inputs:			a_peripheral_ptr  (const StrSim_peripheral_t*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the model is attached, FALSE otherwise (uint8)
+ *******************************************************************************/
+extern uint8 Sim_add_peripheral(const StrSim_peripheral_t * a_peripheral_ptr);
+
+/*******************************************************************************
+ * Function Name:	Sim_schedule_event
+ *
+ * Description: 	set the time of the next event of attached model, the
+ *                  virtual clock stops at this time to call its event
+ *                  callback even if the firmware is in delay or idle loop.
+ *                  note: every model has one event, the new time replaces
+ *                        the old one.
+ *
+ * Inputs:			a_peripheral_ptr  (const StrSim_peripheral_t*)
+ *                  a_u64cycle        (uint64) event time in instruction
+ *                                    cycles or SIM_NO_EVENT to cancel it
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sim_schedule_event(const StrSim_peripheral_t * a_peripheral_ptr , uint64 a_u64cycle);
+
+/*******************************************************************************
+ * Function Name:	Sim_set_interrupt_functions
+ *
+ * Description: 	set interrupt functions of the firmware which are called
+ *                  when enabled interrupt flag is set, the low priority
+ *                  function is used only if the firmware sets IPEN bit.
+ *
+ * Inputs:			a_high_function_ptr   (void(*)(void)) high priority (or the
+ *                                        only) interrupt function
+ *                  a_low_function_ptr    (void(*)(void)) NULL_PTR if the
+ *                                        firmware has one interrupt level
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sim_set_interrupt_functions(void (*a_high_function_ptr)(void) , void (*a_low_function_ptr)(void));
+
+/*******************************************************************************
+ * Function Name:	Sim_set_idle_skip
+ *
+ * Description: 	enable or disable skipping of idle loops, idle loop is
+ *                  detected when the firmware returns to the same point of
+ *                  its code with the same state so it repeats itself until
+ *                  the next event of the models.
+ *                  note: it is enabled by Sim_Initialization.
+ *
+ * Inputs:			a_u8enable        (uint8) TRUE or FALSE
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sim_set_idle_skip(uint8 a_u8enable);
+
+/*******************************************************************************
+ * Function Name:	Sim_run
+ *
+ * Description: 	run the firmware entry function until the virtual clock
+ *                  reaches the time limit.
+ *                  note: the firmware doesn't return so the run is stopped
+ *                        from the register access which exceeds the limit.
+ *
+ * Inputs:			a_entry_function_ptr  (void(*)(void)) firmware main function
+ *                  a_u64time_limit       (uint64) virtual time limit in us
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the run is stopped by time limit, FALSE if the
+ *                  entry function returned (uint8)
+ *******************************************************************************/
+extern uint8 Sim_run(void (*a_entry_function_ptr)(void) , uint64 a_u64time_limit);
+
+/*******************************************************************************
+ * Function Name:	Sim_set_time_limit
+ *
+ * Description: 	change the time limit of the current run.
+ *
+ * Inputs:			a_u64time_limit   (uint64) virtual time limit in us
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sim_set_time_limit(uint64 a_u64time_limit);
+
+/*******************************************************************************
+ * Function Name:	Sim_set_pause_function
+ *
+ * Description: 	set function which is called when the run reaches its
+ *                  time limit instead of stopping the run, the firmware
+ *                  continues from the same point when it returns so it
+ *                  should extend the limit by Sim_set_time_limit first.
+ *                  note: it is removed by Sim_Initialization.
+ *
+ * Inputs:			a_pause_function_ptr  (void(*)(void)) NULL_PTR to stop
+ *                                        the run at its limit
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sim_set_pause_function(void (*a_pause_function_ptr)(void));
+
+/*******************************************************************************
+ * Function Name:	Sim_set_pins_function
+ *
+ * Description: 	set function which is called when external levels or
+ *                  peripheral outputs of port are set, it is used by models
+ *                  which record the pins because these changes aren't
+ *                  register writes of the firmware.
+ *                  note: it is removed by Sim_Initialization.
+ *
+ * Inputs:			a_pins_function_ptr   (void(*)(uint8)) it takes the port
+ *                                        GPIO_PORTA to GPIO_PORTE
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sim_set_pins_function(void (*a_pins_function_ptr)(uint8 a_u8port));
+
+/*******************************************************************************
+ * Function Name:	Sim_register_access
+ *
+ * Description: 	give the firmware address of register in the simulated
+ *                  register file, the last access is checked first to call
+ *                  peripherals models if the firmware changed its value.
+ *                  note: it is used by REGISTER_8BIT macro in host build.
+ *
+ * Inputs:			a_u16address      (uint16) register address
+ *
+ * Outputs:			NULL
+ *
+ * Return:			pointer to the register (volatile uint8*)
+ *******************************************************************************/
+extern volatile uint8 * Sim_register_access(uint16 a_u16address);
+
+/*******************************************************************************
+ * Function Name:	Sim_delay_us
+ *
+ * Description: 	advance the virtual clock by delay of the firmware.
+ *
+ * Inputs:			a_u32time         (uint32) time in us
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sim_delay_us(uint32 a_u32time);
+
+/*******************************************************************************
+ * Function Name:	Sim_sleep
+ *
+ * Description: 	SLEEP instruction in Idle mode, the virtual clock jumps to
+ *                  the events of the models until an interrupt function runs.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sim_sleep(void);
+
+/*******************************************************************************
+ * Function Name:	Sim_read_register
+ *
+ * Description: 	read register value from peripherals models or test code
+ *                  without running the models or advancing the clock.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			register value (uint8)
+ *******************************************************************************/
+extern uint8 Sim_read_register(uint16 a_u16address);
+
+/*******************************************************************************
+ * Function Name:	Sim_write_register
+ *
+ * Description: 	write register value from peripherals models (as hardware
+ *                  flags) without running the models or advancing the clock.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *                  a_u8value         (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sim_write_register(uint16 a_u16address , uint8 a_u8value);
+
+/*******************************************************************************
+ * Function Name:	Sim_get_pin_levels
+ *
+ * Description: 	get levels of port pins, output pins follow the port latch
+ *                  and input pins follow the external levels.
+ *
+ * Inputs:			a_u8port          (uint8) GPIO_PORTA to GPIO_PORTE
+ *
+ * Outputs:			NULL
+ *
+ * Return:			levels of the 8 pins (uint8)
+ *******************************************************************************/
+extern uint8 Sim_get_pin_levels(uint8 a_u8port);
+
+/*******************************************************************************
+ * Function Name:	Sim_set_output_override
+ *
+ * Description: 	make peripheral (as CCP compare output) drive port pins
+ *                  instead of the port latch when they are output pins.
+ *
+ * Inputs:			a_u8port          (uint8) GPIO_PORTA to GPIO_PORTE
+ *                  a_u8mask          (uint8) pins of the peripheral
+ *                  a_u8levels        (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sim_set_output_override(uint8 a_u8port , uint8 a_u8mask , uint8 a_u8levels);
+
+/*******************************************************************************
+ * Function Name:	Sim_set_input_levels
+ *
+ * Description: 	set external levels that drive port pins when they are
+ *                  configured as input pins.
+ *
+ * Inputs:			a_u8port          (uint8) GPIO_PORTA to GPIO_PORTE
+ *                  a_u8levels        (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sim_set_input_levels(uint8 a_u8port , uint8 a_u8levels);
+
+/*******************************************************************************
+ * Function Name:	Sim_get_cycles
+ *
+ * Description: 	get the virtual clock in instruction cycles.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			instruction cycles since initialization (uint64)
+ *******************************************************************************/
+extern uint64 Sim_get_cycles(void);
+
+/*******************************************************************************
+ * Function Name:	Sim_get_time_us
+ *
+ * Description: 	get the virtual clock in micro seconds.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			time since initialization in us (uint64)
+ *******************************************************************************/
+extern uint64 Sim_get_time_us(void);
+
+/*******************************************************************************
+ * Function Name:	Sim_get_register_accesses
+ *
+ * Description: 	get number of registers accesses of the firmware.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			number of accesses since initialization (uint64)
+ *******************************************************************************/
+extern uint64 Sim_get_register_accesses(void);
+
+/*******************************************************************************
+ * Function Name:	Sim_get_skipped_cycles
+ *
+ * Description: 	get instruction cycles of idle loops which are skipped
+ *                  without running the firmware.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			skipped cycles since initialization (uint64)
+ *******************************************************************************/
+extern uint64 Sim_get_skipped_cycles(void);
+
+/*******************************************************************************
+ * Function Name:	Sim_get_interrupt_level
+ *
+ * Description: 	get priority level of the interrupt function which is
+ *                  running now.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			SIM_NO_INTERRUPT, SIM_LOW_INTERRUPT or SIM_HIGH_INTERRUPT (uint8)
+ *******************************************************************************/
+extern uint8 Sim_get_interrupt_level(void);
+
+/*******************************************************************************
+ * Function Name:	Sim_get_nested_interrupts
+ *
+ * Description: 	get number of calls of the high priority interrupt
+ *                  function which interrupted the low priority one.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			nested calls since initialization (uint64)
+ *******************************************************************************/
+extern uint64 Sim_get_nested_interrupts(void);
+
+/*******************************************************************************
+ * Function Name:	Sim_get_interrupt_request
+ *
+ * Description: 	get priority level of enabled interrupt flags which are
+ *                  set, global interrupt bits of INTCON register gate the
+ *                  levels as the hardware does.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			SIM_NO_INTERRUPT, SIM_LOW_INTERRUPT or SIM_HIGH_INTERRUPT (uint8)
+ *******************************************************************************/
+extern uint8 Sim_get_interrupt_request(void);
+
+/*******************************************************************************
+ * Function Name:	Sim_bus_read
+ *
+ * Description: 	read data memory from instruction level core, special
+ *                  function registers are updated by the models first as
+ *                  the register access of the compiled firmware.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			register value (uint8)
+ *******************************************************************************/
+extern uint8 Sim_bus_read(uint16 a_u16address);
+
+/*******************************************************************************
+ * Function Name:	Sim_bus_write
+ *
+ * Description: 	write data memory from instruction level core, the
+ *                  models are informed by the change of special function
+ *                  registers as the register access of the compiled firmware.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *                  a_u8value         (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sim_bus_write(uint16 a_u16address , uint8 a_u8value);
+
+/*******************************************************************************
+ * Function Name:	Sim_bus_cycles
+ *
+ * Description: 	advance the virtual clock by executed instruction cycles,
+ *                  events of the models run at their times and the run
+ *                  stops (or pauses) at its time limit.
+ *                  note: interrupt functions aren't called when they aren't
+ *                        set, the core checks Sim_get_interrupt_request.
+ *
+ * Inputs:			a_u8cycles        (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sim_bus_cycles(uint8 a_u8cycles);
+
+/*******************************************************************************
+ * Function Name:	Sim_save_firmware_state
+ *
+ * Description: 	save static variables of the firmware to restore them
+ *                  before every run, the build moves them to fw_data and
+ *                  fw_bss sections.
+ *                  note: it should be called before the first run.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the variables are saved, FALSE if their size
+ *                  exceeds SIM_FIRMWARE_STATE_SIZE (uint8)
+ *******************************************************************************/
+extern uint8 Sim_save_firmware_state(void);
+
+/*******************************************************************************
+ * Function Name:	Sim_restore_firmware_state
+ *
+ * Description: 	return static variables of the firmware to their saved
+ *                  values so the next run starts from power on state in the
+ *                  same process.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Sim_restore_firmware_state(void);
+
+#endif	/* SIMULATOR_H */
+
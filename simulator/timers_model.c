@@ -0,0 +1,808 @@
+/*******************************************************************************
+ *
+ * File:                timers_model.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of simulated
+ *                      timers 0 to 3 and compare mode of CCP1 and CCP2, every
+ *                      timer keeps its counter at base cycle and the counter
+ *                      is calculated from the virtual clock when it is read,
+ *                      so the timers don't run on every instruction cycle
+ *                      and the simulator stops only at their overflows and
+ *                      compare matches.
+ *                      note: overflow of timer whose flag is already set is
+ *                            not scheduled till the firmware clears the flag.
+ *                      note: the high byte which is latched by reading the
+ *                            low byte is written to its buffer register when
+ *                            the firmware accesses it, as access to the low
+ *                            byte may be write which loads the buffer.
+ *
+ * Revision history:    14/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "timers_model.h"
+#include "simulator.h"
+#include "timers_MemMap.h"
+#include "interrupt_MemMap.h"
+#include "helped_macros.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* registers addresses, models access the register file directly */
+#define MODEL_TIMER_0_CONTROL_ADDRESS       0xFD5u
+#define MODEL_TIMER_0_LOW_ADDRESS           0xFD6u
+#define MODEL_TIMER_0_HIGH_ADDRESS          0xFD7u
+#define MODEL_TIMER_1_CONTROL_ADDRESS       0xFCDu
+#define MODEL_TIMER_1_LOW_ADDRESS           0xFCEu
+#define MODEL_TIMER_1_HIGH_ADDRESS          0xFCFu
+#define MODEL_TIMER_2_CONTROL_ADDRESS       0xFCAu
+#define MODEL_TIMER_2_PERIOD_ADDRESS        0xFCBu
+#define MODEL_TIMER_2_ADDRESS               0xFCCu
+#define MODEL_TIMER_3_CONTROL_ADDRESS       0xFB1u
+#define MODEL_TIMER_3_LOW_ADDRESS           0xFB2u
+#define MODEL_TIMER_3_HIGH_ADDRESS          0xFB3u
+#define MODEL_CCP_1_CONTROL_ADDRESS         0xFBDu
+#define MODEL_CCP_1_LOW_ADDRESS             0xFBEu
+#define MODEL_CCP_1_HIGH_ADDRESS            0xFBFu
+#define MODEL_CCP_2_CONTROL_ADDRESS         0xFBAu
+#define MODEL_CCP_2_LOW_ADDRESS             0xFBBu
+#define MODEL_CCP_2_HIGH_ADDRESS            0xFBCu
+#define MODEL_INTERRUPT_CONTROL_1_ADDRESS   0xFF2u
+#define MODEL_PERIPHERAL_FLAGS_1_ADDRESS    0xF9Eu
+#define MODEL_PERIPHERAL_FLAGS_2_ADDRESS    0xFA1u
+/* timers indices, timer 2 counter is reset when it matches PR2 */
+#define MODEL_TIMER_0                       0u
+#define MODEL_TIMER_1                       1u
+#define MODEL_TIMER_2                       2u
+#define MODEL_TIMER_3                       3u
+#define MODEL_TIMER_8BIT_PERIOD             256u
+#define MODEL_TIMER_16BIT_PERIOD            65536u
+/* compare modes of CCPxCON bits 3:0 */
+#define MODEL_CCP_MODE_MASK                 0x0Fu
+#define MODEL_CCP_COMPARE_TOGGLE            0x02u
+#define MODEL_CCP_COMPARE_SET               0x08u
+#define MODEL_CCP_COMPARE_CLEAR             0x09u
+#define MODEL_CCP_COMPARE_INTERRUPT         0x0Au
+#define MODEL_CCP_COMPARE_SPECIAL_EVENT     0x0Bu
+/* CCP1 output is RC2 and CCP2 output is RC1 */
+#define MODEL_CCP_PORT                      GPIO_PORTC
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/************************** StrTimer_registers_t *******************************/
+typedef struct{
+    uint16 u16control_address;
+    uint16 u16low_address;              /* TMRxL or TMR2 */
+    uint16 u16high_address;             /* SIM_NO_ADDRESS for timer 2 */
+    uint16 u16flag_address;
+    uint8  u8flag_bit;
+}StrTimer_registers_t;
+
+/**************************** StrTimer_model_t *********************************/
+typedef struct{
+    uint8  u8counting_flag;             /* TRUE if the timer counts instruction cycles */
+    uint8  u8buffered_flag;             /* TRUE if the high byte is read and written by buffer */
+    uint8  u8latch_flag;                /* TRUE if the low byte is read and its high byte is latched */
+    uint8  u8high_latch;
+    uint32 u32prescaler;
+    uint32 u32period;                   /* counts to overflow (PR2 + 1 for timer 2) */
+    uint32 u32postscaler;
+    uint32 u32postscaler_count;
+    uint32 u32base_count;               /* counter at base cycle */
+    uint64 u64base_cycle;               /* start of prescaler period */
+    uint64 u64event_cycle;              /* next overflow or SIM_NO_EVENT */
+}StrTimer_model_t;
+
+/*************************** StrCCP_registers_t ********************************/
+typedef struct{
+    uint16 u16control_address;
+    uint16 u16low_address;
+    uint16 u16high_address;
+    uint16 u16flag_address;
+    uint8  u8flag_bit;
+    uint8  u8pin;                       /* output pin of MODEL_CCP_PORT */
+}StrCCP_registers_t;
+
+/****************************** StrCCP_model_t *********************************/
+typedef struct{
+    uint8  u8timer;                     /* time base, timer 1 or timer 3 */
+    uint64 u64event_cycle;              /* next compare match or SIM_NO_EVENT */
+}StrCCP_model_t;
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+static const StrTimer_registers_t g_timers_registers_arr[MODEL_TIMERS_NUMBER] = {
+    {MODEL_TIMER_0_CONTROL_ADDRESS , MODEL_TIMER_0_LOW_ADDRESS , MODEL_TIMER_0_HIGH_ADDRESS ,
+            MODEL_INTERRUPT_CONTROL_1_ADDRESS , TIMER0_OVERFLOW_INTERRUPT_FLAG_BIT},
+    {MODEL_TIMER_1_CONTROL_ADDRESS , MODEL_TIMER_1_LOW_ADDRESS , MODEL_TIMER_1_HIGH_ADDRESS ,
+            MODEL_PERIPHERAL_FLAGS_1_ADDRESS , TIMER1_OVERFLOW_INTERRUPT_FLAG_BIT},
+    {MODEL_TIMER_2_CONTROL_ADDRESS , MODEL_TIMER_2_ADDRESS , SIM_NO_ADDRESS ,
+            MODEL_PERIPHERAL_FLAGS_1_ADDRESS , TIMER2_TO_PR2_MATCH_INTERRUPT_FLAG_BIT},
+    {MODEL_TIMER_3_CONTROL_ADDRESS , MODEL_TIMER_3_LOW_ADDRESS , MODEL_TIMER_3_HIGH_ADDRESS ,
+            MODEL_PERIPHERAL_FLAGS_2_ADDRESS , TIMER3_OVERFLOW_INTERRUPT_FLAG_BIT}
+};
+static const StrCCP_registers_t g_ccp_registers_arr[MODEL_CCP_NUMBER] = {
+    {MODEL_CCP_1_CONTROL_ADDRESS , MODEL_CCP_1_LOW_ADDRESS , MODEL_CCP_1_HIGH_ADDRESS ,
+            MODEL_PERIPHERAL_FLAGS_1_ADDRESS , CAPTURE_COMPARE_PWM_1_INTERRUPT_FLAG_BIT , GPIO_PIN2},
+    {MODEL_CCP_2_CONTROL_ADDRESS , MODEL_CCP_2_LOW_ADDRESS , MODEL_CCP_2_HIGH_ADDRESS ,
+            MODEL_PERIPHERAL_FLAGS_2_ADDRESS , CAPTURE_COMPARE_PWM_2_INTERRUPT_FLAG_BIT , GPIO_PIN1}
+};
+static StrTimer_model_t g_timers_arr[MODEL_TIMERS_NUMBER];
+static StrCCP_model_t g_ccp_arr[MODEL_CCP_NUMBER];
+/* pins of MODEL_CCP_PORT which are driven by compare outputs and their levels */
+static uint8 g_u8ccp_output_mask = 0;
+static uint8 g_u8ccp_output_levels = 0;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Timers_write_callback
+ *
+ * Description: 	reconfigure timer or CCP module or load timer counter
+ *                  when the firmware writes their registers.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *                  a_u8old_value     (uint8)
+ *                  a_u8new_value     (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Timers_write_callback(uint16 a_u16address , uint8 a_u8old_value , uint8 a_u8new_value);
+
+/*******************************************************************************
+ * Function Name:	Timers_read_callback
+ *
+ * Description: 	update timer counter registers from the virtual clock
+ *                  before the firmware reads them.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Timers_read_callback(uint16 a_u16address);
+
+/*******************************************************************************
+ * Function Name:	Timers_event_callback
+ *
+ * Description: 	set flags of timers overflows and CCP compare matches and
+ *                  drive compare outputs at their times.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Timers_event_callback(void);
+
+/*******************************************************************************
+ * Function Name:	Timers_configure
+ *
+ * Description: 	get clock source, prescaler and period of timer from its
+ *                  registers.
+ *
+ * Inputs:			a_u8timer         (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Timers_configure(uint8 a_u8timer);
+
+/*******************************************************************************
+ * Function Name:	Timers_get_count
+ *
+ * Description: 	calculate timer counter at the current virtual clock.
+ *
+ * Inputs:			a_u8timer         (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			counter value (uint32)
+ *******************************************************************************/
+static uint32 Timers_get_count(uint8 a_u8timer);
+
+/*******************************************************************************
+ * Function Name:	Timers_set_count
+ *
+ * Description: 	load timer counter, the prescaler (and timer 2 postscaler)
+ *                  is cleared as the hardware does on writing the counter.
+ *
+ * Inputs:			a_u8timer         (uint8)
+ *                  a_u32count        (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Timers_set_count(uint8 a_u8timer , uint32 a_u32count);
+
+/*******************************************************************************
+ * Function Name:	Timers_rebase
+ *
+ * Description: 	move base of timer to the current virtual clock with its
+ *                  current configuration before it is changed.
+ *
+ * Inputs:			a_u8timer         (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Timers_rebase(uint8 a_u8timer);
+
+/*******************************************************************************
+ * Function Name:	Timers_schedule
+ *
+ * Description: 	calculate the next overflow of every timer and the next
+ *                  match of every CCP module and set the nearest one as event
+ *                  of the model.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Timers_schedule(void);
+
+/* the model is attached to the register file by this structure */
+static const StrSim_peripheral_t g_timers_peripheral = {Timers_write_callback , Timers_read_callback ,
+                                                        Timers_event_callback};
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Timers_model_Initialization
+ *
+ * Description: 	reset timers and CCP models with their registers to power
+ *                  on values and attach them to the simulator register file.
+ *                  note: it should be called after Sim_Initialization.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Timers_model_Initialization(void)
+{
+    /* timer 0 is on with external clock and PR2 is 0xFF after reset */
+    Sim_write_register(MODEL_TIMER_0_CONTROL_ADDRESS , 0xFF);
+    Sim_write_register(MODEL_TIMER_2_PERIOD_ADDRESS , 0xFF);
+    for(uint8 u8timer = 0 ; u8timer < MODEL_TIMERS_NUMBER ; u8timer++)
+    {
+        g_timers_arr[u8timer].u32base_count = 0;
+        g_timers_arr[u8timer].u64base_cycle = Sim_get_cycles();
+        g_timers_arr[u8timer].u32postscaler_count = 0;
+        g_timers_arr[u8timer].u8latch_flag = FALSE;
+        g_timers_arr[u8timer].u64event_cycle = SIM_NO_EVENT;
+        Timers_configure(u8timer);
+    }
+    for(uint8 u8ccp = 0 ; u8ccp < MODEL_CCP_NUMBER ; u8ccp++)
+    {
+        g_ccp_arr[u8ccp].u8timer = MODEL_TIMER_1;
+        g_ccp_arr[u8ccp].u64event_cycle = SIM_NO_EVENT;
+    }
+    g_u8ccp_output_mask = 0;
+    g_u8ccp_output_levels = 0;
+    Sim_add_peripheral(&g_timers_peripheral);
+}
+
+/*******************************************************************************
+ * Function Name:	Timers_model_get_counter
+ *
+ * Description: 	get the current counter of timer without changing its
+ *                  registers (as TMR0H buffer).
+ *
+ * Inputs:			a_u8timer         (uint8) from 0 to 3
+ *
+ * Outputs:			NULL
+ *
+ * Return:			counter value (uint16)
+ *******************************************************************************/
+uint16 Timers_model_get_counter(uint8 a_u8timer)
+{
+    uint16 retVal = 0;
+    if(a_u8timer < MODEL_TIMERS_NUMBER)
+    {
+        retVal = (uint16)Timers_get_count(a_u8timer);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Timers_write_callback
+ *
+ * Description: 	reconfigure timer or CCP module or load timer counter
+ *                  when the firmware writes their registers.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *                  a_u8old_value     (uint8)
+ *                  a_u8new_value     (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Timers_write_callback(uint16 a_u16address , uint8 a_u8old_value , uint8 a_u8new_value)
+{
+    const StrTimer_registers_t * registers_ptr = NULL_PTR;
+    const StrCCP_registers_t * ccp_registers_ptr = NULL_PTR;
+    uint8 u8changed_flag = FALSE;
+    uint8 u8mode = 0;
+    uint32 u32count = 0;
+    for(uint8 u8timer = 0 ; u8timer < MODEL_TIMERS_NUMBER ; u8timer++)
+    {
+        registers_ptr = &g_timers_registers_arr[u8timer];
+        if(a_u16address == registers_ptr->u16control_address ||
+                (u8timer == MODEL_TIMER_2 && a_u16address == MODEL_TIMER_2_PERIOD_ADDRESS))
+        {
+            /* the counter keeps its value with the old configuration till now */
+            Timers_rebase(u8timer);
+            Timers_configure(u8timer);
+            u8changed_flag = TRUE;
+        }
+        else if(a_u16address == registers_ptr->u16low_address)
+        {
+            /* writing the low byte loads the high byte from its buffer */
+            g_timers_arr[u8timer].u8latch_flag = FALSE;
+            if(g_timers_arr[u8timer].u8buffered_flag == TRUE)
+            {
+                u32count = (uint32)Sim_read_register(registers_ptr->u16high_address) << 8;
+            }
+            else
+            {
+                u32count = Timers_get_count(u8timer) & 0xFF00;
+            }
+            Timers_set_count(u8timer , u32count | a_u8new_value);
+            u8changed_flag = TRUE;
+        }
+        else if(a_u16address == registers_ptr->u16high_address && g_timers_arr[u8timer].u8buffered_flag == FALSE)
+        {
+            /* 8 bits read/write mode of timers 1 and 3 writes the high byte directly */
+            Timers_set_count(u8timer , ((uint32)a_u8new_value << 8) | (Timers_get_count(u8timer) & 0xFF));
+            u8changed_flag = TRUE;
+        }
+        else if(a_u16address == registers_ptr->u16flag_address)
+        {
+            /* the overflow is scheduled again when the firmware clears the flag */
+            u8changed_flag = TRUE;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    for(uint8 u8ccp = 0 ; u8ccp < MODEL_CCP_NUMBER ; u8ccp++)
+    {
+        ccp_registers_ptr = &g_ccp_registers_arr[u8ccp];
+        if(a_u16address == ccp_registers_ptr->u16control_address)
+        {
+            /* compare modes take the output pin and initialize its level */
+            u8mode = a_u8new_value & MODEL_CCP_MODE_MASK;
+            if(u8mode == MODEL_CCP_COMPARE_SET)
+            {
+                CLEAR_BIT(g_u8ccp_output_levels , ccp_registers_ptr->u8pin);
+                SET_BIT(g_u8ccp_output_mask , ccp_registers_ptr->u8pin);
+            }
+            else if(u8mode == MODEL_CCP_COMPARE_CLEAR)
+            {
+                SET_BIT(g_u8ccp_output_levels , ccp_registers_ptr->u8pin);
+                SET_BIT(g_u8ccp_output_mask , ccp_registers_ptr->u8pin);
+            }
+            else if(u8mode == MODEL_CCP_COMPARE_TOGGLE)
+            {
+                g_u8ccp_output_levels &= ~(1 << ccp_registers_ptr->u8pin);
+                g_u8ccp_output_levels |= Sim_read_register(SIM_LATCH_ADDRESS(MODEL_CCP_PORT)) & (1 << ccp_registers_ptr->u8pin);
+                SET_BIT(g_u8ccp_output_mask , ccp_registers_ptr->u8pin);
+            }
+            else
+            {
+                CLEAR_BIT(g_u8ccp_output_mask , ccp_registers_ptr->u8pin);
+            }
+            Sim_set_output_override(MODEL_CCP_PORT , g_u8ccp_output_mask , g_u8ccp_output_levels);
+            u8changed_flag = TRUE;
+        }
+        else if(a_u16address == ccp_registers_ptr->u16low_address || a_u16address == ccp_registers_ptr->u16high_address)
+        {
+            u8changed_flag = TRUE;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    if(u8changed_flag == TRUE)
+    {
+        Timers_schedule();
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Timers_read_callback
+ *
+ * Description: 	update timer counter registers from the virtual clock
+ *                  before the firmware reads them.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Timers_read_callback(uint16 a_u16address)
+{
+    const StrTimer_registers_t * registers_ptr = NULL_PTR;
+    uint32 u32count = 0;
+    for(uint8 u8timer = 0 ; u8timer < MODEL_TIMERS_NUMBER ; u8timer++)
+    {
+        registers_ptr = &g_timers_registers_arr[u8timer];
+        if(a_u16address == registers_ptr->u16low_address)
+        {
+            /* reading the low byte latches the high byte in its buffer */
+            u32count = Timers_get_count(u8timer);
+            Sim_write_register(registers_ptr->u16low_address , (uint8)u32count);
+            g_timers_arr[u8timer].u8latch_flag = TRUE;
+            g_timers_arr[u8timer].u8high_latch = (uint8)(u32count >> 8);
+        }
+        else if(a_u16address == registers_ptr->u16high_address && g_timers_arr[u8timer].u8buffered_flag == FALSE)
+        {
+            Sim_write_register(registers_ptr->u16high_address , (uint8)(Timers_get_count(u8timer) >> 8));
+        }
+        else if(a_u16address == registers_ptr->u16high_address && g_timers_arr[u8timer].u8latch_flag == TRUE)
+        {
+            Sim_write_register(registers_ptr->u16high_address , g_timers_arr[u8timer].u8high_latch);
+            g_timers_arr[u8timer].u8latch_flag = FALSE;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Timers_event_callback
+ *
+ * Description: 	set flags of timers overflows and CCP compare matches and
+ *                  drive compare outputs at their times.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Timers_event_callback(void)
+{
+    uint64 u64cycles = Sim_get_cycles();
+    StrTimer_model_t * timer_ptr = NULL_PTR;
+    const StrTimer_registers_t * registers_ptr = NULL_PTR;
+    const StrCCP_registers_t * ccp_registers_ptr = NULL_PTR;
+    uint8 u8flag_set = FALSE;
+    for(uint8 u8timer = 0 ; u8timer < MODEL_TIMERS_NUMBER ; u8timer++)
+    {
+        timer_ptr = &g_timers_arr[u8timer];
+        registers_ptr = &g_timers_registers_arr[u8timer];
+        if(timer_ptr->u64event_cycle <= u64cycles)
+        {
+            if(u8timer != MODEL_TIMER_2)
+            {
+                u8flag_set = TRUE;
+            }
+            else if(timer_ptr->u32base_count < timer_ptr->u32period)
+            {
+                /* timer 2 flag is set after number of PR2 matches */
+                timer_ptr->u32postscaler_count++;
+                u8flag_set = (timer_ptr->u32postscaler_count >= timer_ptr->u32postscaler) ? TRUE : FALSE;
+            }
+            else
+            {
+                /* timer 2 above PR2 overflowed to zero without match */
+                u8flag_set = FALSE;
+            }
+            if(u8flag_set == TRUE)
+            {
+                timer_ptr->u32postscaler_count = 0;
+                Sim_write_register(registers_ptr->u16flag_address ,
+                        Sim_read_register(registers_ptr->u16flag_address) | (1 << registers_ptr->u8flag_bit));
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    for(uint8 u8ccp = 0 ; u8ccp < MODEL_CCP_NUMBER ; u8ccp++)
+    {
+        ccp_registers_ptr = &g_ccp_registers_arr[u8ccp];
+        if(g_ccp_arr[u8ccp].u64event_cycle <= u64cycles)
+        {
+            Sim_write_register(ccp_registers_ptr->u16flag_address ,
+                    Sim_read_register(ccp_registers_ptr->u16flag_address) | (1 << ccp_registers_ptr->u8flag_bit));
+            switch(Sim_read_register(ccp_registers_ptr->u16control_address) & MODEL_CCP_MODE_MASK)
+            {
+                case MODEL_CCP_COMPARE_TOGGLE:
+                    g_u8ccp_output_levels ^= 1 << ccp_registers_ptr->u8pin;
+                    break;
+                case MODEL_CCP_COMPARE_SET:
+                    SET_BIT(g_u8ccp_output_levels , ccp_registers_ptr->u8pin);
+                    break;
+                case MODEL_CCP_COMPARE_CLEAR:
+                    CLEAR_BIT(g_u8ccp_output_levels , ccp_registers_ptr->u8pin);
+                    break;
+                case MODEL_CCP_COMPARE_SPECIAL_EVENT:
+                    /* special event trigger resets the time base */
+                    Timers_set_count(g_ccp_arr[u8ccp].u8timer , 0);
+                    break;
+                default:
+                    /* Do nothing */
+                    break;
+            }
+            Sim_set_output_override(MODEL_CCP_PORT , g_u8ccp_output_mask , g_u8ccp_output_levels);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    Timers_schedule();
+}
+
+/*******************************************************************************
+ * Function Name:	Timers_configure
+ *
+ * Description: 	get clock source, prescaler and period of timer from its
+ *                  registers.
+ *
+ * Inputs:			a_u8timer         (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Timers_configure(uint8 a_u8timer)
+{
+    StrTimer_model_t * timer_ptr = &g_timers_arr[a_u8timer];
+    uint8 u8control = Sim_read_register(g_timers_registers_arr[a_u8timer].u16control_address);
+    /* external clocks (T0CKI and timer 1 oscillator) are not simulated */
+    switch(a_u8timer)
+    {
+        case MODEL_TIMER_0:
+            timer_ptr->u8counting_flag = (GET_BIT(u8control , TIMER_0_ON_OFF_BIT) &&
+                    !GET_BIT(u8control , TIMER_0_CLOCK_SOURCE_SELECT)) ? TRUE : FALSE;
+            /* PSA bit is set when the prescaler isn't assigned to timer 0 */
+            timer_ptr->u32prescaler = GET_BIT(u8control , TIMER_0_PRESCALER_ENABLE_BIT) ? 1 : 2u << (u8control & 0x07);
+            timer_ptr->u32period = GET_BIT(u8control , TIMER_0_8BIT_16BIT_SELECT) ?
+                    MODEL_TIMER_8BIT_PERIOD : MODEL_TIMER_16BIT_PERIOD;
+            timer_ptr->u8buffered_flag = TRUE;
+            break;
+        case MODEL_TIMER_2:
+            timer_ptr->u8counting_flag = GET_BIT(u8control , TIMER_2_ON_OFF_BIT) ? TRUE : FALSE;
+            timer_ptr->u32prescaler = ((u8control & 0x03) == 0) ? 1 : ((u8control & 0x03) == 1) ? 4 : 16;
+            timer_ptr->u32postscaler = ((u8control >> TIMER_2_POSTSCALER_SELECT_BIT_0) & 0x0F) + 1;
+            timer_ptr->u32period = (uint32)Sim_read_register(MODEL_TIMER_2_PERIOD_ADDRESS) + 1;
+            timer_ptr->u8buffered_flag = FALSE;
+            break;
+        default:
+            /* timers 1 and 3 have the same bits */
+            timer_ptr->u8counting_flag = (GET_BIT(u8control , TIMER_1_ON_OFF_BIT) &&
+                    !GET_BIT(u8control , TIMER_1_CLOCK_SOURCE_SELECT)) ? TRUE : FALSE;
+            timer_ptr->u32prescaler = 1u << ((u8control >> TIMER_1_PRESCALER_SELECT_BIT_0) & 0x03);
+            timer_ptr->u32period = MODEL_TIMER_16BIT_PERIOD;
+            timer_ptr->u8buffered_flag = GET_BIT(u8control , TIMER_1_8BIT_16BIT_SELECT) ? TRUE : FALSE;
+            break;
+    }
+    if(a_u8timer != MODEL_TIMER_2)
+    {
+        timer_ptr->u32base_count %= timer_ptr->u32period;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Timers_get_count
+ *
+ * Description: 	calculate timer counter at the current virtual clock.
+ *
+ * Inputs:			a_u8timer         (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			counter value (uint32)
+ *******************************************************************************/
+static uint32 Timers_get_count(uint8 a_u8timer)
+{
+    StrTimer_model_t * timer_ptr = &g_timers_arr[a_u8timer];
+    uint32 u32count = timer_ptr->u32base_count;
+    uint64 u64counts = 0;
+    if(timer_ptr->u8counting_flag == TRUE)
+    {
+        u64counts = (Sim_get_cycles() - timer_ptr->u64base_cycle) / timer_ptr->u32prescaler;
+        /* timer 2 above PR2 counts to its overflow before matching PR2 */
+        if(u32count >= timer_ptr->u32period && u32count + u64counts >= MODEL_TIMER_8BIT_PERIOD)
+        {
+            u64counts -= MODEL_TIMER_8BIT_PERIOD - u32count;
+            u32count = 0;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        if(u32count < timer_ptr->u32period)
+        {
+            u32count = (uint32)((u32count + u64counts) % timer_ptr->u32period);
+        }
+        else
+        {
+            u32count += (uint32)u64counts;
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return u32count;
+}
+
+/*******************************************************************************
+ * Function Name:	Timers_set_count
+ *
+ * Description: 	load timer counter, the prescaler (and timer 2 postscaler)
+ *                  is cleared as the hardware does on writing the counter.
+ *
+ * Inputs:			a_u8timer         (uint8)
+ *                  a_u32count        (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Timers_set_count(uint8 a_u8timer , uint32 a_u32count)
+{
+    StrTimer_model_t * timer_ptr = &g_timers_arr[a_u8timer];
+    timer_ptr->u32base_count = (a_u8timer == MODEL_TIMER_2) ? a_u32count & 0xFF : a_u32count % timer_ptr->u32period;
+    timer_ptr->u64base_cycle = Sim_get_cycles();
+    timer_ptr->u32postscaler_count = 0;
+}
+
+/*******************************************************************************
+ * Function Name:	Timers_rebase
+ *
+ * Description: 	move base of timer to the current virtual clock with its
+ *                  current configuration before it is changed.
+ *
+ * Inputs:			a_u8timer         (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Timers_rebase(uint8 a_u8timer)
+{
+    StrTimer_model_t * timer_ptr = &g_timers_arr[a_u8timer];
+    uint64 u64cycles = Sim_get_cycles();
+    timer_ptr->u32base_count = Timers_get_count(a_u8timer);
+    if(timer_ptr->u8counting_flag == TRUE)
+    {
+        /* the base stays at start of prescaler period to keep its phase */
+        timer_ptr->u64base_cycle = u64cycles - (u64cycles - timer_ptr->u64base_cycle) % timer_ptr->u32prescaler;
+    }
+    else
+    {
+        timer_ptr->u64base_cycle = u64cycles;
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Timers_schedule
+ *
+ * Description: 	calculate the next overflow of every timer and the next
+ *                  match of every CCP module and set the nearest one as event
+ *                  of the model.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Timers_schedule(void)
+{
+    StrTimer_model_t * timer_ptr = NULL_PTR;
+    const StrTimer_registers_t * registers_ptr = NULL_PTR;
+    const StrCCP_registers_t * ccp_registers_ptr = NULL_PTR;
+    StrCCP_model_t * ccp_ptr = NULL_PTR;
+    uint8 u8timer3_control = Sim_read_register(MODEL_TIMER_3_CONTROL_ADDRESS);
+    uint8 u8mode = 0;
+    uint32 u32counts = 0;
+    uint64 u64event_cycle = SIM_NO_EVENT;
+    for(uint8 u8timer = 0 ; u8timer < MODEL_TIMERS_NUMBER ; u8timer++)
+    {
+        timer_ptr = &g_timers_arr[u8timer];
+        registers_ptr = &g_timers_registers_arr[u8timer];
+        Timers_rebase(u8timer);
+        timer_ptr->u64event_cycle = SIM_NO_EVENT;
+        if(timer_ptr->u8counting_flag == TRUE &&
+                GET_BIT(Sim_read_register(registers_ptr->u16flag_address) , registers_ptr->u8flag_bit) == 0)
+        {
+            u32counts = (timer_ptr->u32base_count < timer_ptr->u32period) ?
+                    timer_ptr->u32period - timer_ptr->u32base_count :
+                    MODEL_TIMER_8BIT_PERIOD - timer_ptr->u32base_count;
+            timer_ptr->u64event_cycle = timer_ptr->u64base_cycle + (uint64)u32counts * timer_ptr->u32prescaler;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        u64event_cycle = (timer_ptr->u64event_cycle < u64event_cycle) ? timer_ptr->u64event_cycle : u64event_cycle;
+    }
+    /* T3CCP bits select timer 3 as time base of CCP2 or both CCP modules */
+    g_ccp_arr[0].u8timer = GET_BIT(u8timer3_control , TIMER_3_TIMER_1_CCP_ENABLE_BIT_2) ? MODEL_TIMER_3 : MODEL_TIMER_1;
+    g_ccp_arr[1].u8timer = (GET_BIT(u8timer3_control , TIMER_3_TIMER_1_CCP_ENABLE_BIT_2) ||
+            GET_BIT(u8timer3_control , TIMER_3_TIMER_1_CCP_ENABLE_BIT_1)) ? MODEL_TIMER_3 : MODEL_TIMER_1;
+    for(uint8 u8ccp = 0 ; u8ccp < MODEL_CCP_NUMBER ; u8ccp++)
+    {
+        ccp_ptr = &g_ccp_arr[u8ccp];
+        ccp_registers_ptr = &g_ccp_registers_arr[u8ccp];
+        timer_ptr = &g_timers_arr[ccp_ptr->u8timer];
+        u8mode = Sim_read_register(ccp_registers_ptr->u16control_address) & MODEL_CCP_MODE_MASK;
+        ccp_ptr->u64event_cycle = SIM_NO_EVENT;
+        /* matches of set, clear and interrupt modes change nothing while the flag is set */
+        if(timer_ptr->u8counting_flag == FALSE)
+        {
+            /* Do nothing */
+        }
+        else if(u8mode == MODEL_CCP_COMPARE_TOGGLE || u8mode == MODEL_CCP_COMPARE_SPECIAL_EVENT ||
+                ((u8mode == MODEL_CCP_COMPARE_SET || u8mode == MODEL_CCP_COMPARE_CLEAR ||
+                u8mode == MODEL_CCP_COMPARE_INTERRUPT) &&
+                GET_BIT(Sim_read_register(ccp_registers_ptr->u16flag_address) , ccp_registers_ptr->u8flag_bit) == 0))
+        {
+            u32counts = (((uint32)Sim_read_register(ccp_registers_ptr->u16high_address) << 8) |
+                    Sim_read_register(ccp_registers_ptr->u16low_address)) - timer_ptr->u32base_count;
+            u32counts &= MODEL_TIMER_16BIT_PERIOD - 1;
+            /* the counter at the match now matches again after full period */
+            u32counts = (u32counts == 0) ? MODEL_TIMER_16BIT_PERIOD : u32counts;
+            ccp_ptr->u64event_cycle = timer_ptr->u64base_cycle + (uint64)u32counts * timer_ptr->u32prescaler;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        u64event_cycle = (ccp_ptr->u64event_cycle < u64event_cycle) ? ccp_ptr->u64event_cycle : u64event_cycle;
+    }
+    Sim_schedule_event(&g_timers_peripheral , u64event_cycle);
+}
@@ -0,0 +1,69 @@
+/*******************************************************************************
+ *
+ * File:                timers_model.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes and definitions of
+ *                      simulated timers 0 to 3 and compare mode of CCP1 and
+ *                      CCP2 of PIC18F4520, the counters are calculated from
+ *                      the virtual clock when the firmware reads them and
+ *                      their overflows and compare matches are events of
+ *                      the simulator.
+ *
+ * Revision history:    14/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef TIMERS_MODEL_H
+#define	TIMERS_MODEL_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* timers 0 to 3 and CCP1, CCP2 modules */
+#define MODEL_TIMERS_NUMBER                 4u
+#define MODEL_CCP_NUMBER                    2u
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Timers_model_Initialization
+ *
+ * Description: 	reset timers and CCP models with their registers to power
+ *                  on values and attach them to the simulator register file.
+ *                  note: it should be called after Sim_Initialization.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Timers_model_Initialization(void);
+
+/*******************************************************************************
+ * Function Name:	Timers_model_get_counter
+ *
+ * Description: 	get the current counter of timer without changing its
+ *                  registers (as TMR0H buffer).
+ *
+ * Inputs:			a_u8timer         (uint8) from 0 to 3
+ *
+ * Outputs:			NULL
+ *
+ * Return:			counter value (uint16)
+ *******************************************************************************/
+extern uint16 Timers_model_get_counter(uint8 a_u8timer);
+
+#endif	/* TIMERS_MODEL_H */
+
@@ -0,0 +1,1008 @@
+/*******************************************************************************
+ *
+ * File:                vcd_model.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of recorder of
+ *                      pins activity, registers are recorded when the
+ *                      firmware changes them and pins when they or the
+ *                      external levels change, CCP1 PWM output is recorded
+ *                      by its configuration and its edges are generated when
+ *                      the file is written so long runs keep few changes.
+ *                      the oldest change is applied to the initial values
+ *                      when the ring buffer overwrites it.
+ *
+ * Revision history:    16/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "vcd_model.h"
+#include "simulator.h"
+#include "helped_macros.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* recorded registers of every port and CCP1 PWM output, signal of port
+ * register is (port * VCD_PORT_SIGNALS + register) */
+#define VCD_DIRECTION                       0u
+#define VCD_LATCH                           1u
+#define VCD_PINS                            2u
+#define VCD_PORT_SIGNALS                    3u
+#define VCD_PWM_SIGNAL                      (SIM_PORTS_NUMBER * VCD_PORT_SIGNALS)
+#define VCD_SIGNALS_NUMBER                  (VCD_PWM_SIGNAL + 1u)
+/* identifiers of VCD file are printable characters from '!', the signals
+ * are followed by one bit wires of the pins */
+#define VCD_FIRST_IDENTIFIER                '!'
+#define VCD_PIN_IDENTIFIER(PORT , PIN)      (VCD_FIRST_IDENTIFIER + VCD_SIGNALS_NUMBER + (PORT) * 8u + (PIN))
+/* PWM registers, its output pin is RC2 */
+#define VCD_CCP1_CONTROL_ADDRESS            0xFBDu
+#define VCD_CCP1_DUTY_ADDRESS               0xFBEu
+#define VCD_TIMER2_CONTROL_ADDRESS          0xFCAu
+#define VCD_TIMER2_PERIOD_ADDRESS           0xFCBu
+#define VCD_PWM_PORT                        GPIO_PORTC
+#define VCD_PWM_PIN                         2u
+#define VCD_CCP_PWM_MODE                    0x0Cu
+#define VCD_CCP_DUTY_LOW_BITS               0x30u
+#define VCD_TIMER2_ON_BIT                   2u
+/* PWM times are in oscillator periods (Tosc) which are written in ns */
+#define VCD_TOSC_PER_CYCLE                  4u
+#define VCD_NS_PER_TOSC                     (1000u / (SIM_CYCLES_PER_US * VCD_TOSC_PER_CYCLE))
+/* value of edge time of PWM output which is constant */
+#define VCD_NO_EDGE                         0xFFFFFFFFFFFFFFFFull
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/****************************** StrVcd_record_t ********************************/
+typedef struct{
+    uint64 u64cycle;                    /* virtual time of the change */
+    uint32 u32pwm_period;               /* PWM period in Tosc, 0 if it is stopped */
+    uint32 u32pwm_high;                 /* PWM high time in Tosc */
+    uint8  u8signal;
+    uint8  u8value;                     /* register value of port signal */
+}StrVcd_record_t;
+
+/****************************** StrVcd_state_t *********************************/
+typedef struct{
+    uint64 u64cycle;                    /* time of the last applied change */
+    uint64 u64pwm_start;                /* time of the last PWM configuration */
+    uint32 u32pwm_period;
+    uint32 u32pwm_high;
+    uint8  u8values_arr[VCD_SIGNALS_NUMBER];
+}StrVcd_state_t;
+
+/****************************** StrVcd_writer_t ********************************/
+typedef struct{
+    FILE * file_ptr;
+    uint64 u64time;                     /* last written time in Tosc */
+    uint64 u64pwm_rise;                 /* start of the current PWM period in Tosc */
+    uint32 u32pwm_period;
+    uint32 u32pwm_high;
+    uint8  u8pwm_level;
+    uint8  u8values_arr[VCD_SIGNALS_NUMBER];
+}StrVcd_writer_t;
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* ring buffer of the changes */
+static StrVcd_record_t * g_records_ptr = NULL_PTR;
+static uint32 g_u32records_size = 0;
+static uint32 g_u32first_record = 0;
+static uint32 g_u32records_number = 0;
+static uint64 g_u64dropped_records = 0;
+static uint8 g_u8ports_mask = 0;
+/* values at the oldest kept change and after the last one */
+static StrVcd_state_t g_base_state;
+static StrVcd_state_t g_current_state;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Vcd_write_callback
+ *
+ * Description: 	record port and PWM registers after every register change
+ *                  of the firmware.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *                  a_u8old_value     (uint8)
+ *                  a_u8new_value     (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_write_callback(uint16 a_u16address , uint8 a_u8old_value , uint8 a_u8new_value);
+
+/*******************************************************************************
+ * Function Name:	Vcd_update_port
+ *
+ * Description: 	record direction, latch and pins of port which are
+ *                  changed from the last record, it is the pins function of
+ *                  the simulator too.
+ *
+ * Inputs:			a_u8port          (uint8) GPIO_PORTA to GPIO_PORTE
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_update_port(uint8 a_u8port);
+
+/*******************************************************************************
+ * Function Name:	Vcd_update_pwm
+ *
+ * Description: 	record PWM period and high time if they are changed.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_update_pwm(void);
+
+/*******************************************************************************
+ * Function Name:	Vcd_get_pwm
+ *
+ * Description: 	get PWM period and high time from CCP1 and timer 2
+ *                  registers, the period is 0 if PWM doesn't drive its pin.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u32period_ptr   (uint32*) period in Tosc
+ *                  a_u32high_ptr     (uint32*) high time in Tosc
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_get_pwm(uint32 * a_u32period_ptr , uint32 * a_u32high_ptr);
+
+/*******************************************************************************
+ * Function Name:	Vcd_add_record
+ *
+ * Description: 	add change at the current virtual time to the ring buffer,
+ *                  the oldest change is applied to the base state when the
+ *                  buffer is full.
+ *
+ * Inputs:			a_u8signal        (uint8)
+ *                  a_u8value         (uint8)
+ *                  a_u32pwm_period   (uint32)
+ *                  a_u32pwm_high     (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_add_record(uint8 a_u8signal , uint8 a_u8value , uint32 a_u32pwm_period , uint32 a_u32pwm_high);
+
+/*******************************************************************************
+ * Function Name:	Vcd_apply_record
+ *
+ * Description: 	apply change to state.
+ *
+ * Inputs:			a_record_ptr      (const StrVcd_record_t*)
+ *
+ * Outputs:			a_state_ptr       (StrVcd_state_t*)
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_apply_record(StrVcd_state_t * a_state_ptr , const StrVcd_record_t * a_record_ptr);
+
+/*******************************************************************************
+ * Function Name:	Vcd_get_window_start
+ *
+ * Description: 	get start time of the written file, the changes and PWM
+ *                  edges after it fit in the size of the ring buffer so the
+ *                  generated edges of long run don't make big file.
+ *
+ * Inputs:			a_u64end          (uint64) end of the file in Tosc
+ *
+ * Outputs:			NULL
+ *
+ * Return:			start time in Tosc (uint64)
+ *******************************************************************************/
+static uint64 Vcd_get_window_start(uint64 a_u64end);
+
+/*******************************************************************************
+ * Function Name:	Vcd_count_pwm_edges
+ *
+ * Description: 	get approximated number of PWM edges in time interval.
+ *
+ * Inputs:			a_u32period       (uint32) period in Tosc
+ *                  a_u32high         (uint32) high time in Tosc
+ *                  a_u64start        (uint64) start of the interval in Tosc
+ *                  a_u64end          (uint64) end of the interval in Tosc
+ *
+ * Outputs:			NULL
+ *
+ * Return:			edges (uint64)
+ *******************************************************************************/
+static uint64 Vcd_count_pwm_edges(uint32 a_u32period , uint32 a_u32high , uint64 a_u64start , uint64 a_u64end);
+
+/*******************************************************************************
+ * Function Name:	Vcd_write_time
+ *
+ * Description: 	write time of the next values if it is after the last
+ *                  written time.
+ *
+ * Inputs:			a_writer_ptr      (StrVcd_writer_t*)
+ *                  a_u64time         (uint64) time in Tosc
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_write_time(StrVcd_writer_t * a_writer_ptr , uint64 a_u64time);
+
+/*******************************************************************************
+ * Function Name:	Vcd_write_value
+ *
+ * Description: 	write value of signal, pins signal writes its changed pins
+ *                  wires too.
+ *
+ * Inputs:			a_writer_ptr      (StrVcd_writer_t*)
+ *                  a_u8signal        (uint8)
+ *                  a_u8value         (uint8)
+ *                  a_u8all           (uint8) TRUE to write all pins wires
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_write_value(StrVcd_writer_t * a_writer_ptr , uint8 a_u8signal , uint8 a_u8value , uint8 a_u8all);
+
+/*******************************************************************************
+ * Function Name:	Vcd_start_pwm
+ *
+ * Description: 	set PWM configuration of the writer and its level at time.
+ *
+ * Inputs:			a_writer_ptr      (StrVcd_writer_t*)
+ *                  a_u32period       (uint32) period in Tosc
+ *                  a_u32high         (uint32) high time in Tosc
+ *                  a_u64start        (uint64) start of the first period in Tosc
+ *                  a_u64time         (uint64) time of the level in Tosc
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_start_pwm(StrVcd_writer_t * a_writer_ptr , uint32 a_u32period , uint32 a_u32high ,
+        uint64 a_u64start , uint64 a_u64time);
+
+/*******************************************************************************
+ * Function Name:	Vcd_write_pwm_edges
+ *
+ * Description: 	write edges of PWM output before time.
+ *
+ * Inputs:			a_writer_ptr      (StrVcd_writer_t*)
+ *                  a_u64time         (uint64) time in Tosc
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_write_pwm_edges(StrVcd_writer_t * a_writer_ptr , uint64 a_u64time);
+
+/* the model is attached to the register file by this structure */
+static const StrSim_peripheral_t g_vcd_peripheral = {Vcd_write_callback , NULL_PTR};
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Vcd_model_Initialization
+ *
+ * Description: 	allocate the ring buffer, take the current pins as initial
+ *                  values and attach the recorder to the simulator register
+ *                  file.
+ *                  note: it should be called after Sim_Initialization and
+ *                        it replaces the pins function of the simulator.
+ *
+ * Inputs:			a_u8ports_mask    (uint8) recorded ports, bit 0 is GPIO_PORTA
+ *                  a_u32records      (uint32) size of the ring buffer in changes
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the recorder is attached, FALSE otherwise (uint8)
+ *******************************************************************************/
+uint8 Vcd_model_Initialization(uint8 a_u8ports_mask , uint32 a_u32records)
+{
+    uint8 retVal = FALSE;
+    free(g_records_ptr);
+    g_records_ptr = (a_u32records > 0) ? (StrVcd_record_t *)malloc(a_u32records * sizeof(StrVcd_record_t)) : NULL_PTR;
+    if(g_records_ptr != NULL_PTR)
+    {
+        g_u32records_size = a_u32records;
+        g_u32first_record = 0;
+        g_u32records_number = 0;
+        g_u64dropped_records = 0;
+        g_u8ports_mask = a_u8ports_mask & VCD_ALL_PORTS;
+        for(uint8 u8port = GPIO_PORTA ; u8port < SIM_PORTS_NUMBER ; u8port++)
+        {
+            g_base_state.u8values_arr[u8port * VCD_PORT_SIGNALS + VCD_DIRECTION] = Sim_read_register(SIM_DIRECTION_ADDRESS(u8port));
+            g_base_state.u8values_arr[u8port * VCD_PORT_SIGNALS + VCD_LATCH] = Sim_read_register(SIM_LATCH_ADDRESS(u8port));
+            g_base_state.u8values_arr[u8port * VCD_PORT_SIGNALS + VCD_PINS] = Sim_get_pin_levels(u8port);
+        }
+        Vcd_get_pwm(&g_base_state.u32pwm_period , &g_base_state.u32pwm_high);
+        g_base_state.u8values_arr[VCD_PWM_SIGNAL] = 0;
+        g_base_state.u64cycle = Sim_get_cycles();
+        g_base_state.u64pwm_start = g_base_state.u64cycle;
+        g_current_state = g_base_state;
+        Sim_set_pins_function(Vcd_update_port);
+        retVal = Sim_add_peripheral(&g_vcd_peripheral);
+    }
+    else
+    {
+        g_u32records_size = 0;
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Vcd_model_write
+ *
+ * Description: 	write the recorded changes from the oldest one in the ring
+ *                  buffer to the current virtual time as VCD file.
+ *
+ * Inputs:			a_file_name_ptr   (const char*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the file is written, FALSE otherwise (uint8)
+ *******************************************************************************/
+uint8 Vcd_model_write(const char * a_file_name_ptr)
+{
+    uint8 retVal = FALSE;
+    StrVcd_writer_t writer;
+    StrVcd_state_t state = g_base_state;
+    const StrVcd_record_t * record_ptr = NULL_PTR;
+    uint64 u64end = Sim_get_cycles() * VCD_TOSC_PER_CYCLE;
+    uint64 u64time = 0;
+    uint32 u32counter = 0;
+    writer.file_ptr = (g_records_ptr != NULL_PTR) ? fopen(a_file_name_ptr , "w") : NULL_PTR;
+    if(writer.file_ptr != NULL_PTR)
+    {
+        fprintf(writer.file_ptr , "$version microwave simulator $end\n$timescale 1ns $end\n$scope module microwave $end\n");
+        for(uint8 u8port = GPIO_PORTA ; u8port < SIM_PORTS_NUMBER ; u8port++)
+        {
+            if(GET_BIT(g_u8ports_mask , u8port))
+            {
+                fprintf(writer.file_ptr , "$var wire 8 %c tris%c $end\n" ,
+                        VCD_FIRST_IDENTIFIER + u8port * VCD_PORT_SIGNALS + VCD_DIRECTION , 'a' + u8port);
+                fprintf(writer.file_ptr , "$var wire 8 %c lat%c $end\n" ,
+                        VCD_FIRST_IDENTIFIER + u8port * VCD_PORT_SIGNALS + VCD_LATCH , 'a' + u8port);
+                fprintf(writer.file_ptr , "$var wire 8 %c port%c $end\n" ,
+                        VCD_FIRST_IDENTIFIER + u8port * VCD_PORT_SIGNALS + VCD_PINS , 'a' + u8port);
+                for(uint8 u8pin = 0 ; u8pin < 8 ; u8pin++)
+                {
+                    fprintf(writer.file_ptr , "$var wire 1 %c r%c%u $end\n" ,
+                            VCD_PIN_IDENTIFIER(u8port , u8pin) , 'a' + u8port , u8pin);
+                }
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        if(GET_BIT(g_u8ports_mask , VCD_PWM_PORT))
+        {
+            fprintf(writer.file_ptr , "$var wire 1 %c ccp1_pwm $end\n" , VCD_FIRST_IDENTIFIER + VCD_PWM_SIGNAL);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        fprintf(writer.file_ptr , "$upscope $end\n$enddefinitions $end\n");
+        /* initial values are the base state with the changes before the window */
+        writer.u64time = Vcd_get_window_start(u64end);
+        while(u32counter < g_u32records_number &&
+                g_records_ptr[(g_u32first_record + u32counter) % g_u32records_size].u64cycle * VCD_TOSC_PER_CYCLE < writer.u64time)
+        {
+            Vcd_apply_record(&state , &g_records_ptr[(g_u32first_record + u32counter) % g_u32records_size]);
+            u32counter++;
+        }
+        fprintf(writer.file_ptr , "#%llu\n$dumpvars\n" , (unsigned long long)(writer.u64time * VCD_NS_PER_TOSC));
+        for(uint8 u8signal = 0 ; u8signal < VCD_PWM_SIGNAL ; u8signal++)
+        {
+            Vcd_write_value(&writer , u8signal , state.u8values_arr[u8signal] , TRUE);
+        }
+        Vcd_start_pwm(&writer , state.u32pwm_period , state.u32pwm_high ,
+                state.u64pwm_start * VCD_TOSC_PER_CYCLE , writer.u64time);
+        Vcd_write_value(&writer , VCD_PWM_SIGNAL , writer.u8pwm_level , TRUE);
+        fprintf(writer.file_ptr , "$end\n");
+        for( ; u32counter < g_u32records_number ; u32counter++)
+        {
+            record_ptr = &g_records_ptr[(g_u32first_record + u32counter) % g_u32records_size];
+            u64time = record_ptr->u64cycle * VCD_TOSC_PER_CYCLE;
+            Vcd_write_pwm_edges(&writer , u64time);
+            if(record_ptr->u8signal == VCD_PWM_SIGNAL)
+            {
+                Vcd_start_pwm(&writer , record_ptr->u32pwm_period , record_ptr->u32pwm_high , u64time , u64time);
+                Vcd_write_time(&writer , u64time);
+                Vcd_write_value(&writer , VCD_PWM_SIGNAL , writer.u8pwm_level , FALSE);
+            }
+            else
+            {
+                Vcd_write_time(&writer , u64time);
+                Vcd_write_value(&writer , record_ptr->u8signal , record_ptr->u8value , FALSE);
+            }
+        }
+        /* the waveforms continue to the current time */
+        Vcd_write_pwm_edges(&writer , u64end);
+        Vcd_write_time(&writer , u64end);
+        retVal = (fclose(writer.file_ptr) == 0) ? TRUE : FALSE;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Vcd_model_get_dropped
+ *
+ * Description: 	get number of old changes which are overwritten in the
+ *                  ring buffer.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			dropped changes (uint64)
+ *******************************************************************************/
+uint64 Vcd_model_get_dropped(void)
+{
+    return g_u64dropped_records;
+}
+
+/*******************************************************************************
+ * Function Name:	Vcd_model_get_ports_mask
+ *
+ * Description: 	convert ports letters (as "ace" or "ACE") to ports mask,
+ *                  other characters are ignored.
+ *
+ * Inputs:			a_letters_ptr     (const char*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			ports mask, bit 0 is GPIO_PORTA (uint8)
+ *******************************************************************************/
+uint8 Vcd_model_get_ports_mask(const char * a_letters_ptr)
+{
+    uint8 retVal = 0;
+    for(const char * letter_ptr = a_letters_ptr ; *letter_ptr != '\0' ; letter_ptr++)
+    {
+        if(*letter_ptr >= 'a' && *letter_ptr < 'a' + SIM_PORTS_NUMBER)
+        {
+            SET_BIT(retVal , (*letter_ptr - 'a'));
+        }
+        else if(*letter_ptr >= 'A' && *letter_ptr < 'A' + SIM_PORTS_NUMBER)
+        {
+            SET_BIT(retVal , (*letter_ptr - 'A'));
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Vcd_model_close
+ *
+ * Description: 	free the ring buffer, the simulator should be initialized
+ *                  again before the next run.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Vcd_model_close(void)
+{
+    Sim_set_pins_function(NULL_PTR);
+    free(g_records_ptr);
+    g_records_ptr = NULL_PTR;
+    g_u32records_size = 0;
+    g_u32records_number = 0;
+}
+
+/*******************************************************************************
+ * Function Name:	Vcd_write_callback
+ *
+ * Description: 	record port and PWM registers after every register change
+ *                  of the firmware.
+ *
+ * Inputs:			a_u16address      (uint16)
+ *                  a_u8old_value     (uint8)
+ *                  a_u8new_value     (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_write_callback(uint16 a_u16address , uint8 a_u8old_value , uint8 a_u8new_value)
+{
+    if(g_records_ptr == NULL_PTR)
+    {
+        /* Do nothing */
+    }
+    else if(a_u16address >= SIM_LATCH_ADDRESS(GPIO_PORTA) && a_u16address <= SIM_LATCH_ADDRESS(GPIO_PORTE))
+    {
+        Vcd_update_port((uint8)(a_u16address - SIM_LATCH_ADDRESS(GPIO_PORTA)));
+    }
+    else if(a_u16address >= SIM_DIRECTION_ADDRESS(GPIO_PORTA) && a_u16address <= SIM_DIRECTION_ADDRESS(GPIO_PORTE))
+    {
+        Vcd_update_port((uint8)(a_u16address - SIM_DIRECTION_ADDRESS(GPIO_PORTA)));
+        if(a_u16address == SIM_DIRECTION_ADDRESS(VCD_PWM_PORT))
+        {
+            Vcd_update_pwm();
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else if(a_u16address == VCD_CCP1_CONTROL_ADDRESS || a_u16address == VCD_CCP1_DUTY_ADDRESS ||
+            a_u16address == VCD_TIMER2_CONTROL_ADDRESS || a_u16address == VCD_TIMER2_PERIOD_ADDRESS)
+    {
+        Vcd_update_pwm();
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Vcd_update_port
+ *
+ * Description: 	record direction, latch and pins of port which are
+ *                  changed from the last record, it is the pins function of
+ *                  the simulator too.
+ *
+ * Inputs:			a_u8port          (uint8) GPIO_PORTA to GPIO_PORTE
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_update_port(uint8 a_u8port)
+{
+    uint8 u8values_arr[VCD_PORT_SIGNALS];
+    uint8 u8signal = a_u8port * VCD_PORT_SIGNALS;
+    if(GET_BIT(g_u8ports_mask , a_u8port))
+    {
+        u8values_arr[VCD_DIRECTION] = Sim_read_register(SIM_DIRECTION_ADDRESS(a_u8port));
+        u8values_arr[VCD_LATCH] = Sim_read_register(SIM_LATCH_ADDRESS(a_u8port));
+        u8values_arr[VCD_PINS] = Sim_get_pin_levels(a_u8port);
+        for(uint8 u8counter = 0 ; u8counter < VCD_PORT_SIGNALS ; u8counter++)
+        {
+            if(u8values_arr[u8counter] != g_current_state.u8values_arr[u8signal + u8counter])
+            {
+                Vcd_add_record(u8signal + u8counter , u8values_arr[u8counter] , 0 , 0);
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Vcd_update_pwm
+ *
+ * Description: 	record PWM period and high time if they are changed.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_update_pwm(void)
+{
+    uint32 u32period = 0;
+    uint32 u32high = 0;
+    Vcd_get_pwm(&u32period , &u32high);
+    if(GET_BIT(g_u8ports_mask , VCD_PWM_PORT) &&
+            (u32period != g_current_state.u32pwm_period || u32high != g_current_state.u32pwm_high))
+    {
+        Vcd_add_record(VCD_PWM_SIGNAL , 0 , u32period , u32high);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Vcd_get_pwm
+ *
+ * Description: 	get PWM period and high time from CCP1 and timer 2
+ *                  registers, the period is 0 if PWM doesn't drive its pin.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u32period_ptr   (uint32*) period in Tosc
+ *                  a_u32high_ptr     (uint32*) high time in Tosc
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_get_pwm(uint32 * a_u32period_ptr , uint32 * a_u32high_ptr)
+{
+    uint8 u8control = Sim_read_register(VCD_CCP1_CONTROL_ADDRESS);
+    uint8 u8timer_control = Sim_read_register(VCD_TIMER2_CONTROL_ADDRESS);
+    uint32 u32prescaler = ((u8timer_control & 0x03) == 0) ? 1 : ((u8timer_control & 0x03) == 1) ? 4 : 16;
+    if((u8control & VCD_CCP_PWM_MODE) == VCD_CCP_PWM_MODE && GET_BIT(u8timer_control , VCD_TIMER2_ON_BIT) &&
+            GET_BIT(Sim_read_register(SIM_DIRECTION_ADDRESS(VCD_PWM_PORT)) , VCD_PWM_PIN) == 0)
+    {
+        /* period is (PR2 + 1) * 4 * prescaler and high time is 10 bits duty * prescaler */
+        *a_u32period_ptr = ((uint32)Sim_read_register(VCD_TIMER2_PERIOD_ADDRESS) + 1) * 4u * u32prescaler;
+        *a_u32high_ptr = (((uint32)Sim_read_register(VCD_CCP1_DUTY_ADDRESS) << 2) |
+                ((u8control & VCD_CCP_DUTY_LOW_BITS) >> 4)) * u32prescaler;
+    }
+    else
+    {
+        *a_u32period_ptr = 0;
+        *a_u32high_ptr = 0;
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Vcd_add_record
+ *
+ * Description: 	add change at the current virtual time to the ring buffer,
+ *                  the oldest change is applied to the base state when the
+ *                  buffer is full.
+ *
+ * Inputs:			a_u8signal        (uint8)
+ *                  a_u8value         (uint8)
+ *                  a_u32pwm_period   (uint32)
+ *                  a_u32pwm_high     (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_add_record(uint8 a_u8signal , uint8 a_u8value , uint32 a_u32pwm_period , uint32 a_u32pwm_high)
+{
+    StrVcd_record_t * record_ptr = NULL_PTR;
+    if(g_u32records_number == g_u32records_size)
+    {
+        Vcd_apply_record(&g_base_state , &g_records_ptr[g_u32first_record]);
+        g_u32first_record = (g_u32first_record + 1) % g_u32records_size;
+        g_u32records_number--;
+        g_u64dropped_records++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    record_ptr = &g_records_ptr[(g_u32first_record + g_u32records_number) % g_u32records_size];
+    record_ptr->u64cycle = Sim_get_cycles();
+    record_ptr->u32pwm_period = a_u32pwm_period;
+    record_ptr->u32pwm_high = a_u32pwm_high;
+    record_ptr->u8signal = a_u8signal;
+    record_ptr->u8value = a_u8value;
+    g_u32records_number++;
+    Vcd_apply_record(&g_current_state , record_ptr);
+}
+
+/*******************************************************************************
+ * Function Name:	Vcd_apply_record
+ *
+ * Description: 	apply change to state.
+ *
+ * Inputs:			a_record_ptr      (const StrVcd_record_t*)
+ *
+ * Outputs:			a_state_ptr       (StrVcd_state_t*)
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_apply_record(StrVcd_state_t * a_state_ptr , const StrVcd_record_t * a_record_ptr)
+{
+    a_state_ptr->u64cycle = a_record_ptr->u64cycle;
+    if(a_record_ptr->u8signal == VCD_PWM_SIGNAL)
+    {
+        a_state_ptr->u64pwm_start = a_record_ptr->u64cycle;
+        a_state_ptr->u32pwm_period = a_record_ptr->u32pwm_period;
+        a_state_ptr->u32pwm_high = a_record_ptr->u32pwm_high;
+    }
+    else
+    {
+        a_state_ptr->u8values_arr[a_record_ptr->u8signal] = a_record_ptr->u8value;
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Vcd_get_window_start
+ *
+ * Description: 	get start time of the written file, the changes and PWM
+ *                  edges after it fit in the size of the ring buffer so the
+ *                  generated edges of long run don't make big file.
+ *
+ * Inputs:			a_u64end          (uint64) end of the file in Tosc
+ *
+ * Outputs:			NULL
+ *
+ * Return:			start time in Tosc (uint64)
+ *******************************************************************************/
+static uint64 Vcd_get_window_start(uint64 a_u64end)
+{
+    uint64 retVal = g_base_state.u64cycle * VCD_TOSC_PER_CYCLE;
+    uint64 u64changes = g_u32records_number;
+    uint64 u64excess = 0;
+    uint64 u64edges = 0;
+    uint64 u64start = retVal;
+    uint64 u64time = 0;
+    uint32 u32period = g_base_state.u32pwm_period;
+    uint32 u32high = g_base_state.u32pwm_high;
+    const StrVcd_record_t * record_ptr = NULL_PTR;
+    /* the first pass counts the changes and the second one skips the excess
+     * of them from the start, the last interval ends at the end of the file */
+    for(uint8 u8pass = 0 ; u8pass < 2 ; u8pass++)
+    {
+        u64start = g_base_state.u64cycle * VCD_TOSC_PER_CYCLE;
+        u32period = g_base_state.u32pwm_period;
+        u32high = g_base_state.u32pwm_high;
+        for(uint32 u32counter = 0 ; u32counter <= g_u32records_number ; u32counter++)
+        {
+            record_ptr = (u32counter < g_u32records_number) ?
+                    &g_records_ptr[(g_u32first_record + u32counter) % g_u32records_size] : NULL_PTR;
+            u64time = (record_ptr != NULL_PTR) ? record_ptr->u64cycle * VCD_TOSC_PER_CYCLE : a_u64end;
+            u64edges = Vcd_count_pwm_edges(u32period , u32high , u64start , u64time);
+            if(u8pass == 0)
+            {
+                u64changes += u64edges;
+            }
+            else if(u64excess <= u64edges)
+            {
+                /* the window starts between the edges of the interval */
+                retVal = (u64edges > 0) ? u64start + (uint64)((double)(u64time - u64start) * u64excess / u64edges) : u64start;
+                break;
+            }
+            else
+            {
+                /* the change at the end of the interval is skipped too */
+                u64excess -= u64edges + 1;
+                retVal = u64time;
+            }
+            if(record_ptr != NULL_PTR && record_ptr->u8signal == VCD_PWM_SIGNAL)
+            {
+                u32period = record_ptr->u32pwm_period;
+                u32high = record_ptr->u32pwm_high;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            u64start = u64time;
+        }
+        if(u64changes <= g_u32records_size)
+        {
+            break;
+        }
+        else
+        {
+            u64excess = u64changes - g_u32records_size;
+        }
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Vcd_count_pwm_edges
+ *
+ * Description: 	get approximated number of PWM edges in time interval.
+ *
+ * Inputs:			a_u32period       (uint32) period in Tosc
+ *                  a_u32high         (uint32) high time in Tosc
+ *                  a_u64start        (uint64) start of the interval in Tosc
+ *                  a_u64end          (uint64) end of the interval in Tosc
+ *
+ * Outputs:			NULL
+ *
+ * Return:			edges (uint64)
+ *******************************************************************************/
+static uint64 Vcd_count_pwm_edges(uint32 a_u32period , uint32 a_u32high , uint64 a_u64start , uint64 a_u64end)
+{
+    uint64 retVal = 0;
+    if(a_u32high > 0 && a_u32high < a_u32period && a_u64end > a_u64start)
+    {
+        retVal = 2u * ((a_u64end - a_u64start) / a_u32period);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Vcd_write_time
+ *
+ * Description: 	write time of the next values if it is after the last
+ *                  written time.
+ *
+ * Inputs:			a_writer_ptr      (StrVcd_writer_t*)
+ *                  a_u64time         (uint64) time in Tosc
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_write_time(StrVcd_writer_t * a_writer_ptr , uint64 a_u64time)
+{
+    if(a_u64time > a_writer_ptr->u64time)
+    {
+        a_writer_ptr->u64time = a_u64time;
+        fprintf(a_writer_ptr->file_ptr , "#%llu\n" , (unsigned long long)(a_u64time * VCD_NS_PER_TOSC));
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Vcd_write_value
+ *
+ * Description: 	write value of signal, pins signal writes its changed pins
+ *                  wires too.
+ *
+ * Inputs:			a_writer_ptr      (StrVcd_writer_t*)
+ *                  a_u8signal        (uint8)
+ *                  a_u8value         (uint8)
+ *                  a_u8all           (uint8) TRUE to write all pins wires
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_write_value(StrVcd_writer_t * a_writer_ptr , uint8 a_u8signal , uint8 a_u8value , uint8 a_u8all)
+{
+    uint8 u8port = a_u8signal / VCD_PORT_SIGNALS;
+    uint8 u8changed = (a_u8all == TRUE) ? 0xFF : a_u8value ^ a_writer_ptr->u8values_arr[a_u8signal];
+    char bits_arr[9];
+    if(a_u8signal == VCD_PWM_SIGNAL)
+    {
+        if(GET_BIT(g_u8ports_mask , VCD_PWM_PORT))
+        {
+            fprintf(a_writer_ptr->file_ptr , "%u%c\n" , a_u8value , VCD_FIRST_IDENTIFIER + VCD_PWM_SIGNAL);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else if(GET_BIT(g_u8ports_mask , u8port))
+    {
+        for(uint8 u8bit = 0 ; u8bit < 8 ; u8bit++)
+        {
+            bits_arr[u8bit] = GET_BIT(a_u8value , (7 - u8bit)) ? '1' : '0';
+        }
+        bits_arr[8] = '\0';
+        fprintf(a_writer_ptr->file_ptr , "b%s %c\n" , bits_arr , VCD_FIRST_IDENTIFIER + a_u8signal);
+        for(uint8 u8pin = 0 ; u8pin < 8 && a_u8signal % VCD_PORT_SIGNALS == VCD_PINS ; u8pin++)
+        {
+            if(GET_BIT(u8changed , u8pin))
+            {
+                fprintf(a_writer_ptr->file_ptr , "%u%c\n" , GET_BIT(a_u8value , u8pin) ? 1 : 0 ,
+                        VCD_PIN_IDENTIFIER(u8port , u8pin));
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    a_writer_ptr->u8values_arr[a_u8signal] = a_u8value;
+}
+
+/*******************************************************************************
+ * Function Name:	Vcd_start_pwm
+ *
+ * Description: 	set PWM configuration of the writer and its level at time.
+ *
+ * Inputs:			a_writer_ptr      (StrVcd_writer_t*)
+ *                  a_u32period       (uint32) period in Tosc
+ *                  a_u32high         (uint32) high time in Tosc
+ *                  a_u64start        (uint64) start of the first period in Tosc
+ *                  a_u64time         (uint64) time of the level in Tosc
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_start_pwm(StrVcd_writer_t * a_writer_ptr , uint32 a_u32period , uint32 a_u32high ,
+        uint64 a_u64start , uint64 a_u64time)
+{
+    a_writer_ptr->u32pwm_period = a_u32period;
+    a_writer_ptr->u32pwm_high = a_u32high;
+    if(a_u32period > 0)
+    {
+        /* the phase starts from the configuration change */
+        a_writer_ptr->u64pwm_rise = a_u64start + (a_u64time - a_u64start) / a_u32period * a_u32period;
+        a_writer_ptr->u8pwm_level = (a_u64time - a_writer_ptr->u64pwm_rise < a_u32high) ? HIGH : LOW;
+    }
+    else
+    {
+        a_writer_ptr->u64pwm_rise = a_u64start;
+        a_writer_ptr->u8pwm_level = LOW;
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Vcd_write_pwm_edges
+ *
+ * Description: 	write edges of PWM output before time.
+ *
+ * Inputs:			a_writer_ptr      (StrVcd_writer_t*)
+ *                  a_u64time         (uint64) time in Tosc
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Vcd_write_pwm_edges(StrVcd_writer_t * a_writer_ptr , uint64 a_u64time)
+{
+    uint64 u64edge = VCD_NO_EDGE;
+    do
+    {
+        /* output with 0% or 100% duty has no edges */
+        if(a_writer_ptr->u32pwm_high == 0 || a_writer_ptr->u32pwm_high >= a_writer_ptr->u32pwm_period)
+        {
+            u64edge = VCD_NO_EDGE;
+        }
+        else if(a_writer_ptr->u8pwm_level == HIGH)
+        {
+            u64edge = a_writer_ptr->u64pwm_rise + a_writer_ptr->u32pwm_high;
+        }
+        else
+        {
+            u64edge = a_writer_ptr->u64pwm_rise + a_writer_ptr->u32pwm_period;
+        }
+        if(u64edge < a_u64time)
+        {
+            if(a_writer_ptr->u8pwm_level == HIGH)
+            {
+                a_writer_ptr->u8pwm_level = LOW;
+            }
+            else
+            {
+                a_writer_ptr->u8pwm_level = HIGH;
+                a_writer_ptr->u64pwm_rise = u64edge;
+            }
+            Vcd_write_time(a_writer_ptr , u64edge);
+            Vcd_write_value(a_writer_ptr , VCD_PWM_SIGNAL , a_writer_ptr->u8pwm_level , FALSE);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }while(u64edge < a_u64time);
+}
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ *
+ * File:                vcd_model.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes and definitions of
+ *                      recorder of pins activity which writes the changes of
+ *                      TRIS, LAT and PORT registers and CCP1 PWM output as
+ *                      Value Change Dump file with the virtual time, so the
+ *                      waveforms are measured by viewer as GTKWave.
+ *                      the changes are kept in ring buffer so the file of
+ *                      long run has the last part of it only.
+ *
+ * Revision history:    16/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef VCD_MODEL_H
+#define	VCD_MODEL_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* ports mask of all ports, bit 0 is GPIO_PORTA */
+#define VCD_ALL_PORTS                       0x1Fu
+/* default size of the ring buffer in changes */
+#define VCD_DEFAULT_RECORDS                 200000u
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Vcd_model_Initialization
+ *
+ * Description: 	allocate the ring buffer, take the current pins as initial
+ *                  values and attach the recorder to the simulator register
+ *                  file.
+ *                  note: it should be called after Sim_Initialization and
+ *                        it replaces the pins function of the simulator.
+ *
+ * Inputs:			a_u8ports_mask    (uint8) recorded ports, bit 0 is GPIO_PORTA
+ *                  a_u32records      (uint32) size of the ring buffer in changes
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the recorder is attached, FALSE otherwise (uint8)
+ *******************************************************************************/
+extern uint8 Vcd_model_Initialization(uint8 a_u8ports_mask , uint32 a_u32records);
+
+/*******************************************************************************
+ * Function Name:	Vcd_model_write
+ *
+ * Description: 	write the recorded changes from the oldest one in the ring
+ *                  buffer to the current virtual time as VCD file.
+ *
+ * Inputs:			a_file_name_ptr   (const char*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the file is written, FALSE otherwise (uint8)
+ *******************************************************************************/
+extern uint8 Vcd_model_write(const char * a_file_name_ptr);
+
+/*******************************************************************************
+ * Function Name:	Vcd_model_get_dropped
+ *
+ * Description: 	get number of old changes which are overwritten in the
+ *                  ring buffer.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			dropped changes (uint64)
+ *******************************************************************************/
+extern uint64 Vcd_model_get_dropped(void);
+
+/*******************************************************************************
+ * Function Name:	Vcd_model_get_ports_mask
+ *
+ * Description: 	convert ports letters (as "ace" or "ACE") to ports mask,
+ *                  other characters are ignored.
+ *
+ * Inputs:			a_letters_ptr     (const char*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			ports mask, bit 0 is GPIO_PORTA (uint8)
+ *******************************************************************************/
+extern uint8 Vcd_model_get_ports_mask(const char * a_letters_ptr);
+
+/*******************************************************************************
+ * Function Name:	Vcd_model_close
+ *
+ * Description: 	free the ring buffer, the simulator should be initialized
+ *                  again before the next run.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Vcd_model_close(void);
+
+#endif	/* VCD_MODEL_H */
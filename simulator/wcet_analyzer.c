@@ -0,0 +1,2223 @@
+/*******************************************************************************
+ *
+ * File:                wcet_analyzer.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            host application that computes worst case execution
+ *                      time of every function of the listing file of XC8
+ *                      without running the code, instructions cycles are of
+ *                      the datasheet and the longest path of every function
+ *                      includes its called functions, the indirect calls
+ *                      are the functions of "This function calls" of the
+ *                      listing which aren't called directly.
+ *                      expansions of _delay are run by small interpreter to
+ *                      get their exact cycles, loops which count down file
+ *                      register loaded by constant get their bounds from it
+ *                      and the other loops get their bounds from the
+ *                      configuration file with the budgets of the roots
+ *                      (interrupt functions and main loop handlers):
+ *                          loop   file.c:line  max. iterations
+ *                          budget function     max. time in us
+ *                      usage: wcet_analyzer [-l lst] [-c configuration] [-v]
+ *
+ * Revision history:    16/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <unistd.h>
+#include "stdtypes.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+#define WCET_DEFAULT_LST                    "../dist/default/production/SwiftAct_Project_event_trigger.X.production.lst"
+#define WCET_DEFAULT_CONFIGURATION          "wcet.cfg"
+#define WCET_MAX_INSTRUCTIONS               16384u
+#define WCET_MAX_LABELS                     8192u
+#define WCET_MAX_FUNCTIONS                  256u
+#define WCET_MAX_CALLEES                    32u
+#define WCET_MAX_LOOPS                      512u
+#define WCET_MAX_BOUNDS                     128u
+#define WCET_MAX_BUDGETS                    64u
+#define WCET_MAX_CHAIN                      32u
+#define WCET_LINE_SIZE                      1024u
+#define WCET_NAME_SIZE                      64u
+#define WCET_MNEMONIC_SIZE                  12u
+#define WCET_LOCATION_SIZE                  128u
+#define WCET_REASON_SIZE                    192u
+/* instruction cycle is Fosc/4 = 2MHz and interrupt latency is 3 cycles */
+#define WCET_CYCLES_PER_US                  2u
+#define WCET_INTERRUPT_LATENCY              3u
+/* special values of path cycles, unbounded is added without overflow */
+#define WCET_IMPOSSIBLE                     (-1ll)
+#define WCET_UNBOUNDED                      0x3FFFFFFFFFFFFFFFll
+/* successor of return instruction which ends the function */
+#define WCET_RETURN_TARGET                  (-2)
+#define WCET_NO_INDEX                       (-1)
+/* max. instructions of expansion of _delay which are interpreted */
+#define WCET_DELAY_MAX_STEPS                100000000u
+#define WCET_DELAY_MAX_REGISTERS            8u
+/* instructions before loop which are searched for its counter load */
+#define WCET_COUNTER_SEARCH                 8u
+/* longest path modes: to the return of function, to the back edge of loop
+ * (iteration) and to the exit of loop */
+#define WCET_MODE_RETURN                    0u
+#define WCET_MODE_ITERATION                 1u
+#define WCET_MODE_EXIT                      2u
+/* computation states of functions and loops */
+#define WCET_NOT_COMPUTED                   0u
+#define WCET_COMPUTING                      1u
+#define WCET_COMPUTED                       2u
+/* sources of loop bounds */
+#define WCET_BOUND_UNKNOWN                  0u
+#define WCET_BOUND_CONFIGURATION            1u
+#define WCET_BOUND_COUNTER                  2u
+#define WCET_BOUND_REGISTER                 3u
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/*************************** StrWcet_instruction_t *****************************/
+typedef struct{
+    uint32 u32address;
+    uint8  u8words;
+    char   mnemonic_arr[WCET_MNEMONIC_SIZE];
+    char   operand_arr[WCET_NAME_SIZE];   /* first operand without bank and destination */
+    char   destination;                   /* 'f', 'w' or 0 */
+    char   location_arr[WCET_LOCATION_SIZE]; /* file:line of the source statement or
+                                             function:label of library code */
+    uint8  u8statement;                   /* TRUE if it is the first instruction of statement */
+    uint8  u8delay;                       /* TRUE if it is the first instruction of _delay */
+    uint8  u8indirect;                    /* TRUE if it is return which jumps to function pointer */
+    uint8  u8unknown;                     /* TRUE if it jumps or calls out of the listing functions */
+    uint8  u8successors;
+    sint32 s32successors_arr[2];          /* function index of instruction or WCET_RETURN_TARGET */
+    sint64 s64costs_arr[2];
+    sint32 s32callee;                     /* called function or WCET_NO_INDEX */
+    sint32 s32local_call;                 /* called instruction of the same function or WCET_NO_INDEX */
+    sint32 s32loop;                       /* innermost loop or WCET_NO_INDEX */
+    uint8  u8reachable;
+}StrWcet_instruction_t;
+
+/****************************** StrWcet_label_t ********************************/
+typedef struct{
+    char   name_arr[WCET_NAME_SIZE];
+    uint32 u32function;
+    uint32 u32instruction;                /* index in the function */
+}StrWcet_label_t;
+
+/**************************** StrWcet_function_t *******************************/
+typedef struct{
+    char   name_arr[WCET_NAME_SIZE];
+    uint32 u32first;                      /* index of the first instruction */
+    uint32 u32instructions;
+    char   callees_arr[WCET_MAX_CALLEES][WCET_NAME_SIZE]; /* "This function calls" names */
+    uint32 u32callees;
+    uint8  u8interrupt;                   /* TRUE if it is called by interrupt level */
+    uint8  u8state;
+    sint64 s64cycles;
+    char   reason_arr[WCET_REASON_SIZE];  /* first cause of unbounded time */
+}StrWcet_function_t;
+
+/****************************** StrWcet_loop_t *********************************/
+typedef struct{
+    uint32 u32function;
+    uint32 u32header;                     /* index in the function */
+    uint32 u32size;                       /* instructions in the body */
+    uint32 u32back_edges;
+    uint32 u32back_source;                /* source of the last back edge */
+    uint8 * u8body_ptr;                   /* TRUE for instructions of the body */
+    sint32 s32parent;
+    uint32 u32bound;                      /* max. executions of the header */
+    uint8  u8bound_source;
+    uint8  u8state;
+    sint64 s64cycles;
+}StrWcet_loop_t;
+
+/****************************** StrWcet_bound_t ********************************/
+typedef struct{
+    char   location_arr[WCET_LOCATION_SIZE];
+    uint32 u32bound;
+    uint8  u8used;
+}StrWcet_bound_t;
+
+/***************************** StrWcet_budget_t ********************************/
+typedef struct{
+    char   name_arr[WCET_NAME_SIZE];
+    uint32 u32time;                       /* in us */
+}StrWcet_budget_t;
+
+/***************************** StrWcet_context_t *******************************/
+typedef struct{
+    uint32 u32function;
+    sint32 s32region;                     /* loop or WCET_NO_INDEX for the function */
+    uint8  u8mode;
+    sint64 * s64paths_ptr;                /* longest path of every instruction */
+    uint8 * u8states_ptr;
+}StrWcet_context_t;
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+static StrWcet_instruction_t g_instructions_arr[WCET_MAX_INSTRUCTIONS];
+static uint32 g_u32instructions_number = 0;
+static StrWcet_label_t g_labels_arr[WCET_MAX_LABELS];
+static uint32 g_u32labels_number = 0;
+static StrWcet_function_t g_functions_arr[WCET_MAX_FUNCTIONS];
+static uint32 g_u32functions_number = 0;
+static StrWcet_loop_t g_loops_arr[WCET_MAX_LOOPS];
+static uint32 g_u32loops_number = 0;
+static StrWcet_bound_t g_bounds_arr[WCET_MAX_BOUNDS];
+static uint32 g_u32bounds_number = 0;
+static StrWcet_budget_t g_budgets_arr[WCET_MAX_BUDGETS];
+static uint32 g_u32budgets_number = 0;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Wcet_load_listing
+ *
+ * Description: 	load functions, their instructions, labels and call graph
+ *                  from listing file of XC8.
+ *
+ * Inputs:			a_file_name_ptr   (const char*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the file is loaded, FALSE otherwise (uint8)
+ *******************************************************************************/
+static uint8 Wcet_load_listing(const char * a_file_name_ptr);
+
+/*******************************************************************************
+ * Function Name:	Wcet_load_configuration
+ *
+ * Description: 	load loop bounds and budgets, missing file has none of them.
+ *
+ * Inputs:			a_file_name_ptr   (const char*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the file is valid or missing, FALSE otherwise (uint8)
+ *******************************************************************************/
+static uint8 Wcet_load_configuration(const char * a_file_name_ptr);
+
+/*******************************************************************************
+ * Function Name:	Wcet_add_instruction
+ *
+ * Description: 	add instruction of listing line to the current function.
+ *
+ * Inputs:			a_u32address      (uint32)
+ *                  a_u8words         (uint8)
+ *                  a_text_ptr        (const char*) mnemonic, operands and comment
+ *                  a_location_ptr    (const char*) source statement
+ *                  a_u8statement     (uint8)
+ *                  a_u8delay         (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Wcet_add_instruction(uint32 a_u32address , uint8 a_u8words , const char * a_text_ptr ,
+        const char * a_location_ptr , uint8 a_u8statement , uint8 a_u8delay);
+
+/*******************************************************************************
+ * Function Name:	Wcet_build_graph
+ *
+ * Description: 	set successors and their cycles of every instruction of
+ *                  function, expansions of _delay have one successor after
+ *                  them with their interpreted cycles.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Wcet_build_graph(uint32 a_u32function);
+
+/*******************************************************************************
+ * Function Name:	Wcet_find_loops
+ *
+ * Description: 	find natural loops of function from back edges of depth
+ *                  first search, their nesting and their bounds.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Wcet_find_loops(uint32 a_u32function);
+
+/*******************************************************************************
+ * Function Name:	Wcet_run_delay
+ *
+ * Description: 	interpret expansion of _delay (movlw, movwf, decfsz, bra,
+ *                  goto and nop) until the first other instruction or the
+ *                  next statement.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *                  a_u32start        (uint32) index in the function
+ *
+ * Outputs:			a_u32end_ptr      (uint32*) index after the expansion
+ *
+ * Return:			cycles or WCET_IMPOSSIBLE if it isn't simple expansion (sint64)
+ *******************************************************************************/
+static sint64 Wcet_run_delay(uint32 a_u32function , uint32 a_u32start , uint32 * a_u32end_ptr);
+
+/*******************************************************************************
+ * Function Name:	Wcet_get_counter_bound
+ *
+ * Description: 	get bound of loop which is counted by decfsz of register,
+ *                  the decfsz is the header or it is before the only back
+ *                  edge, the register isn't written by other instructions of
+ *                  the body so the bound is the literal which is loaded to it
+ *                  before the loop or 256 of the 8 bits register.
+ *
+ * Inputs:			a_loop_ptr        (const StrWcet_loop_t*)
+ *
+ * Outputs:			a_u8source_ptr    (uint8*) WCET_BOUND_COUNTER or
+ *                                    WCET_BOUND_REGISTER
+ *
+ * Return:			max. executions of the header or 0 if unknown (uint32)
+ *******************************************************************************/
+static uint32 Wcet_get_counter_bound(const StrWcet_loop_t * a_loop_ptr , uint8 * a_u8source_ptr);
+
+/*******************************************************************************
+ * Function Name:	Wcet_get_function_cycles
+ *
+ * Description: 	get worst case cycles of function from its call to the end
+ *                  of its return.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles or WCET_UNBOUNDED (sint64)
+ *******************************************************************************/
+static sint64 Wcet_get_function_cycles(uint32 a_u32function);
+
+/*******************************************************************************
+ * Function Name:	Wcet_get_loop_cycles
+ *
+ * Description: 	get worst case cycles of loop from its header to its exit,
+ *                  it is (bound - 1) longest iterations and the longest exit.
+ *
+ * Inputs:			a_u32loop         (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles or WCET_UNBOUNDED (sint64)
+ *******************************************************************************/
+static sint64 Wcet_get_loop_cycles(uint32 a_u32loop);
+
+/*******************************************************************************
+ * Function Name:	Wcet_get_path
+ *
+ * Description: 	get longest path from instruction of function, region or
+ *                  loop, to the end of the context mode.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *                  a_s32region       (sint32) loop or WCET_NO_INDEX
+ *                  a_u8mode          (uint8) WCET_MODE_RETURN, WCET_MODE_ITERATION
+ *                                    or WCET_MODE_EXIT
+ *                  a_u32start        (uint32) index in the function
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles, WCET_IMPOSSIBLE or WCET_UNBOUNDED (sint64)
+ *******************************************************************************/
+static sint64 Wcet_get_path(uint32 a_u32function , sint32 a_s32region , uint8 a_u8mode , uint32 a_u32start);
+
+/*******************************************************************************
+ * Function Name:	Wcet_get_longest
+ *
+ * Description: 	get longest path from instruction in context.
+ *
+ * Inputs:			a_context_ptr     (StrWcet_context_t*)
+ *                  a_u32index        (uint32) index in the function
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles, WCET_IMPOSSIBLE or WCET_UNBOUNDED (sint64)
+ *******************************************************************************/
+static sint64 Wcet_get_longest(StrWcet_context_t * a_context_ptr , uint32 a_u32index);
+
+/*******************************************************************************
+ * Function Name:	Wcet_get_target
+ *
+ * Description: 	get longest path from successor in context, the back edge
+ *                  and the exit of the region end the path depend on the
+ *                  mode and the inner loops are passed by their cycles.
+ *
+ * Inputs:			a_context_ptr     (StrWcet_context_t*)
+ *                  a_s32target       (sint32) index in the function or
+ *                                    WCET_RETURN_TARGET
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles, WCET_IMPOSSIBLE or WCET_UNBOUNDED (sint64)
+ *******************************************************************************/
+static sint64 Wcet_get_target(StrWcet_context_t * a_context_ptr , sint32 a_s32target);
+
+/*******************************************************************************
+ * Function Name:	Wcet_get_call_cycles
+ *
+ * Description: 	get cycles of called code of instruction, the direct call,
+ *                  the call of label of the same function or the indirect
+ *                  jump of return, the jump out of the listing functions is
+ *                  unbounded.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *                  a_u32index        (uint32) index in the function
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles or WCET_UNBOUNDED (sint64)
+ *******************************************************************************/
+static sint64 Wcet_get_call_cycles(uint32 a_u32function , uint32 a_u32index);
+
+/*******************************************************************************
+ * Function Name:	Wcet_add
+ *
+ * Description: 	add cycles, unbounded cycles stay unbounded.
+ *
+ * Inputs:			a_s64first        (sint64)
+ *                  a_s64second       (sint64)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles (sint64)
+ *******************************************************************************/
+static sint64 Wcet_add(sint64 a_s64first , sint64 a_s64second);
+
+/*******************************************************************************
+ * Function Name:	Wcet_set_reason
+ *
+ * Description: 	keep the first cause of unbounded time of function.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *                  a_reason_ptr      (const char*)
+ *                  a_detail_ptr      (const char*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Wcet_set_reason(uint32 a_u32function , const char * a_reason_ptr , const char * a_detail_ptr);
+
+/*******************************************************************************
+ * Function Name:	Wcet_find_function
+ *
+ * Description: 	find function by its name.
+ *
+ * Inputs:			a_name_ptr        (const char*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			function index or WCET_NO_INDEX (sint32)
+ *******************************************************************************/
+static sint32 Wcet_find_function(const char * a_name_ptr);
+
+/*******************************************************************************
+ * Function Name:	Wcet_find_label
+ *
+ * Description: 	find label of function by its name.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *                  a_name_ptr        (const char*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			instruction index in the function or WCET_NO_INDEX (sint32)
+ *******************************************************************************/
+static sint32 Wcet_find_label(uint32 a_u32function , const char * a_name_ptr);
+
+/*******************************************************************************
+ * Function Name:	Wcet_find_label_of
+ *
+ * Description: 	check if instruction of function has label so it may be
+ *                  reached by jump.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *                  a_u32instruction  (uint32) index in the function
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE or FALSE (uint8)
+ *******************************************************************************/
+static uint8 Wcet_find_label_of(uint32 a_u32function , uint32 a_u32instruction);
+
+/*******************************************************************************
+ * Function Name:	Wcet_is_written
+ *
+ * Description: 	check if instruction may write register, call writes all
+ *                  registers.
+ *
+ * Inputs:			a_instruction_ptr (const StrWcet_instruction_t*)
+ *                  a_name_ptr        (const char*) register operand or "wreg"
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE or FALSE (uint8)
+ *******************************************************************************/
+static uint8 Wcet_is_written(const StrWcet_instruction_t * a_instruction_ptr , const char * a_name_ptr);
+
+/*******************************************************************************
+ * Function Name:	Wcet_is_indirect_callee
+ *
+ * Description: 	check if function of the call graph of the listing isn't
+ *                  called directly by the caller so it is called by pointer.
+ *
+ * Inputs:			a_u32caller       (uint32)
+ *                  a_u32callee       (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE or FALSE (uint8)
+ *******************************************************************************/
+static uint8 Wcet_is_indirect_callee(uint32 a_u32caller , uint32 a_u32callee);
+
+/*******************************************************************************
+ * Function Name:	Wcet_print_chain
+ *
+ * Description: 	print the chain of the heaviest called functions.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Wcet_print_chain(uint32 a_u32function);
+
+/* host application */
+int main(int argc , char * argv[])
+{
+    const char * lst_file_ptr = WCET_DEFAULT_LST;
+    const char * configuration_file_ptr = WCET_DEFAULT_CONFIGURATION;
+    uint8 u8verbose = FALSE;
+    uint32 u32failed = 0;
+    sint32 s32option = 0;
+    sint32 s32function = 0;
+    sint64 s64cycles = 0;
+    StrWcet_function_t * function_ptr = NULL_PTR;
+    StrWcet_loop_t * loop_ptr = NULL_PTR;
+    while((s32option = getopt(argc , argv , "l:c:v")) != -1)
+    {
+        if(s32option == 'l')
+        {
+            lst_file_ptr = optarg;
+        }
+        else if(s32option == 'c')
+        {
+            configuration_file_ptr = optarg;
+        }
+        else if(s32option == 'v')
+        {
+            u8verbose = TRUE;
+        }
+        else
+        {
+            fprintf(stderr , "usage: %s [-l lst] [-c configuration] [-v]\n" , argv[0]);
+            return 2;
+        }
+    }
+    if(Wcet_load_listing(lst_file_ptr) == FALSE)
+    {
+        fprintf(stderr , "%s: can't load listing file\n" , lst_file_ptr);
+        return 2;
+    }
+    else if(Wcet_load_configuration(configuration_file_ptr) == FALSE)
+    {
+        return 2;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    for(uint32 u32function = 0 ; u32function < g_u32functions_number ; u32function++)
+    {
+        Wcet_build_graph(u32function);
+        Wcet_find_loops(u32function);
+    }
+    printf("%-36s %12s %12s  %s\n" , "function" , "cycles" , "us" , "notes");
+    for(uint32 u32function = 0 ; u32function < g_u32functions_number ; u32function++)
+    {
+        function_ptr = &g_functions_arr[u32function];
+        s64cycles = Wcet_get_function_cycles(u32function);
+        if(s64cycles >= WCET_UNBOUNDED)
+        {
+            printf("%-36s %12s %12s  %s\n" , function_ptr->name_arr , "unbounded" , "-" , function_ptr->reason_arr);
+        }
+        else
+        {
+            printf("%-36s %12lld %12.1f  %s\n" , function_ptr->name_arr , s64cycles ,
+                    (double)s64cycles / WCET_CYCLES_PER_US , (function_ptr->u8interrupt == TRUE) ? "interrupt" : "");
+        }
+    }
+    if(u8verbose == TRUE)
+    {
+        printf("\n%-36s %-28s %8s %12s\n" , "loop of function" , "header" , "bound" , "cycles");
+        for(uint32 u32loop = 0 ; u32loop < g_u32loops_number ; u32loop++)
+        {
+            loop_ptr = &g_loops_arr[u32loop];
+            s64cycles = Wcet_get_loop_cycles(u32loop);
+            printf("%-36s %-28s %8u %12s %s\n" , g_functions_arr[loop_ptr->u32function].name_arr ,
+                    g_instructions_arr[g_functions_arr[loop_ptr->u32function].u32first + loop_ptr->u32header].location_arr ,
+                    loop_ptr->u32bound , (s64cycles >= WCET_UNBOUNDED) ? "unbounded" : "" ,
+                    (loop_ptr->u8bound_source == WCET_BOUND_COUNTER) ? "counter" :
+                    (loop_ptr->u8bound_source == WCET_BOUND_REGISTER) ? "8 bits counter" :
+                    (loop_ptr->u8bound_source == WCET_BOUND_CONFIGURATION) ? "configuration" : "unknown");
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    for(uint32 u32bound = 0 ; u32bound < g_u32bounds_number ; u32bound++)
+    {
+        if(g_bounds_arr[u32bound].u8used == FALSE)
+        {
+            printf("warning: loop %s of the configuration isn't found\n" , g_bounds_arr[u32bound].location_arr);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    printf("\n");
+    for(uint32 u32budget = 0 ; u32budget < g_u32budgets_number ; u32budget++)
+    {
+        s32function = Wcet_find_function(g_budgets_arr[u32budget].name_arr);
+        if(s32function == WCET_NO_INDEX)
+        {
+            printf("FAIL %-32s function isn't found\n" , g_budgets_arr[u32budget].name_arr);
+            u32failed++;
+            continue;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        function_ptr = &g_functions_arr[s32function];
+        s64cycles = Wcet_get_function_cycles((uint32)s32function);
+        /* interrupt path starts from the interrupt request */
+        s64cycles = Wcet_add(s64cycles , (function_ptr->u8interrupt == TRUE) ? WCET_INTERRUPT_LATENCY : 0);
+        if(s64cycles >= WCET_UNBOUNDED)
+        {
+            printf("FAIL %-32s unbounded (%s), budget %u us\n" , function_ptr->name_arr ,
+                    function_ptr->reason_arr , g_budgets_arr[u32budget].u32time);
+            u32failed++;
+        }
+        else if(s64cycles > (sint64)g_budgets_arr[u32budget].u32time * WCET_CYCLES_PER_US)
+        {
+            printf("FAIL %-32s %10lld cycles %10.1f us > budget %u us\n" , function_ptr->name_arr ,
+                    s64cycles , (double)s64cycles / WCET_CYCLES_PER_US , g_budgets_arr[u32budget].u32time);
+            u32failed++;
+        }
+        else
+        {
+            printf("PASS %-32s %10lld cycles %10.1f us <= budget %u us\n" , function_ptr->name_arr ,
+                    s64cycles , (double)s64cycles / WCET_CYCLES_PER_US , g_budgets_arr[u32budget].u32time);
+        }
+        if(s64cycles > (sint64)g_budgets_arr[u32budget].u32time * WCET_CYCLES_PER_US || u8verbose == TRUE)
+        {
+            Wcet_print_chain((uint32)s32function);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    printf("%u functions, %u loops, %u budgets, %u failed\n" , g_u32functions_number , g_u32loops_number ,
+            g_u32budgets_number , u32failed);
+    return (u32failed > 0) ? 1 : 0;
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_load_listing
+ *
+ * Description: 	load functions, their instructions, labels and call graph
+ *                  from listing file of XC8.
+ *
+ * Inputs:			a_file_name_ptr   (const char*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the file is loaded, FALSE otherwise (uint8)
+ *******************************************************************************/
+static uint8 Wcet_load_listing(const char * a_file_name_ptr)
+{
+    FILE * file_ptr = fopen(a_file_name_ptr , "r");
+    char line_arr[WCET_LINE_SIZE];
+    char location_arr[WCET_LOCATION_SIZE] = "";
+    char name_arr[WCET_NAME_SIZE];
+    char * text_ptr = NULL_PTR;
+    char * comment_ptr = NULL_PTR;
+    char * token_ptr = NULL_PTR;
+    char * end_ptr = NULL_PTR;
+    sint32 s32function = WCET_NO_INDEX;
+    StrWcet_function_t * function_ptr = NULL_PTR;
+    uint8 u8calls_flag = FALSE;
+    uint8 u8called_flag = FALSE;
+    uint8 u8statement = FALSE;
+    uint8 u8delay = FALSE;
+    uint8 u8source = FALSE;
+    uint8 u8words = 0;
+    uint32 u32address = 0;
+    if(file_ptr == NULL_PTR)
+    {
+        return FALSE;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    while(fgets(line_arr , sizeof(line_arr) , file_ptr) != NULL_PTR)
+    {
+        line_arr[strcspn(line_arr , "\r\n")] = '\0';
+        /* lines start with optional line number of the listing */
+        text_ptr = line_arr;
+        while(isspace((unsigned char)*text_ptr))
+        {
+            text_ptr++;
+        }
+        token_ptr = text_ptr;
+        while(isdigit((unsigned char)*token_ptr))
+        {
+            token_ptr++;
+        }
+        if(token_ptr > text_ptr && isspace((unsigned char)*token_ptr) && strspn(token_ptr + strspn(token_ptr , " \t") ,
+                "0123456789ABCDEF") == 6)
+        {
+            text_ptr = token_ptr + strspn(token_ptr , " \t");
+        }
+        else if(token_ptr > text_ptr && *(token_ptr + strspn(token_ptr , " \t")) == ';')
+        {
+            text_ptr = token_ptr + strspn(token_ptr , " \t");
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        if(strncmp(text_ptr , ";; *************** function _" , 29) == 0 && g_u32functions_number < WCET_MAX_FUNCTIONS)
+        {
+            s32function = (sint32)g_u32functions_number;
+            function_ptr = &g_functions_arr[g_u32functions_number++];
+            memset(function_ptr , 0 , sizeof(StrWcet_function_t));
+            sscanf(text_ptr + 29 , "%63s" , function_ptr->name_arr);
+            function_ptr->u32first = g_u32instructions_number;
+            u8calls_flag = FALSE;
+            u8called_flag = FALSE;
+            u8source = FALSE;
+            location_arr[0] = '\0';
+        }
+        else if(strncmp(text_ptr , ";; This function calls:" , 23) == 0)
+        {
+            u8calls_flag = TRUE;
+        }
+        else if(strncmp(text_ptr , ";; This function is called by:" , 30) == 0)
+        {
+            u8calls_flag = FALSE;
+            u8called_flag = TRUE;
+        }
+        else if(strncmp(text_ptr , ";;\t\t" , 4) == 0 && function_ptr != NULL_PTR)
+        {
+            if(u8calls_flag == TRUE && text_ptr[4] == '_' && function_ptr->u32callees < WCET_MAX_CALLEES)
+            {
+                sscanf(text_ptr + 5 , "%63s" , function_ptr->callees_arr[function_ptr->u32callees++]);
+            }
+            else if(u8called_flag == TRUE && strstr(text_ptr , "Interrupt level") != NULL_PTR)
+            {
+                function_ptr->u8interrupt = TRUE;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else if(text_ptr[0] == ';')
+        {
+            u8calls_flag = FALSE;
+            u8called_flag = FALSE;
+            /* source statement comment, the last one of joined comments is used */
+            comment_ptr = NULL_PTR;
+            for(token_ptr = strstr(text_ptr , ".c: ") ; token_ptr != NULL_PTR ; token_ptr = strstr(token_ptr + 1 , ".c: "))
+            {
+                comment_ptr = token_ptr;
+            }
+            if(comment_ptr != NULL_PTR)
+            {
+                token_ptr = comment_ptr;
+                while(token_ptr > text_ptr && *(token_ptr - 1) != ';')
+                {
+                    token_ptr--;
+                }
+                snprintf(location_arr , sizeof(location_arr) , "%.*s:%ld" , (int)(comment_ptr + 2 - token_ptr) ,
+                        token_ptr , strtol(comment_ptr + 4 , NULL_PTR , 10));
+                u8statement = TRUE;
+                u8source = TRUE;
+                u8delay = (strstr(text_ptr , "_delay(") != NULL_PTR) ? TRUE : FALSE;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else if(strspn(text_ptr , "0123456789ABCDEF") == 6 && isspace((unsigned char)text_ptr[6]) && s32function != WCET_NO_INDEX)
+        {
+            u32address = (uint32)strtoul(text_ptr , &end_ptr , 16);
+            text_ptr = end_ptr + strspn(end_ptr , " \t");
+            if(sscanf(text_ptr , "%63[^: \t]" , name_arr) == 1 && text_ptr[strlen(name_arr)] == ':')
+            {
+                /* label, the end of function is __end_of_name label */
+                if(strncmp(name_arr , "__end_of_" , 9) == 0 && strcmp(name_arr + 9 , function_ptr->name_arr) == 0)
+                {
+                    function_ptr->u32instructions = g_u32instructions_number - function_ptr->u32first;
+                    s32function = WCET_NO_INDEX;
+                }
+                else if(g_u32labels_number < WCET_MAX_LABELS)
+                {
+                    /* library code hasn't source comments so its labels are the locations */
+                    if(u8source == FALSE)
+                    {
+                        snprintf(location_arr , sizeof(location_arr) , "%s:%s" , function_ptr->name_arr , name_arr);
+                    }
+                    else
+                    {
+                        /* Do nothing */
+                    }
+                    strcpy(g_labels_arr[g_u32labels_number].name_arr , name_arr);
+                    g_labels_arr[g_u32labels_number].u32function = (uint32)s32function;
+                    g_labels_arr[g_u32labels_number].u32instruction = g_u32instructions_number - function_ptr->u32first;
+                    g_u32labels_number++;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+            else
+            {
+                /* opcode words are 4 upper case hex digits */
+                u8words = 0;
+                while(strspn(text_ptr , "0123456789ABCDEF") == 4 && isspace((unsigned char)text_ptr[4]))
+                {
+                    u8words++;
+                    text_ptr += 4;
+                    text_ptr += strspn(text_ptr , " \t");
+                }
+                if(u8words > 0 && islower((unsigned char)text_ptr[0]) && g_u32instructions_number < WCET_MAX_INSTRUCTIONS)
+                {
+                    Wcet_add_instruction(u32address , u8words , text_ptr , location_arr , u8statement , u8delay);
+                    u8statement = FALSE;
+                    u8delay = FALSE;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    fclose(file_ptr);
+    return (g_u32functions_number > 0) ? TRUE : FALSE;
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_load_configuration
+ *
+ * Description: 	load loop bounds and budgets, missing file has none of them.
+ *
+ * Inputs:			a_file_name_ptr   (const char*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE if the file is valid or missing, FALSE otherwise (uint8)
+ *******************************************************************************/
+static uint8 Wcet_load_configuration(const char * a_file_name_ptr)
+{
+    FILE * file_ptr = fopen(a_file_name_ptr , "r");
+    char line_arr[WCET_LINE_SIZE];
+    char keyword_arr[WCET_NAME_SIZE];
+    char name_arr[WCET_LOCATION_SIZE];
+    uint32 u32value = 0;
+    uint32 u32line = 0;
+    sint32 s32fields = 0;
+    uint8 retVal = TRUE;
+    if(file_ptr == NULL_PTR)
+    {
+        return TRUE;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    while(fgets(line_arr , sizeof(line_arr) , file_ptr) != NULL_PTR)
+    {
+        u32line++;
+        line_arr[strcspn(line_arr , "#\r\n")] = '\0';
+        s32fields = sscanf(line_arr , "%63s %127s %u" , keyword_arr , name_arr , &u32value);
+        if(s32fields <= 0)
+        {
+            /* Do nothing */
+        }
+        else if(s32fields == 3 && strcmp(keyword_arr , "loop") == 0 && u32value > 0 && g_u32bounds_number < WCET_MAX_BOUNDS)
+        {
+            strcpy(g_bounds_arr[g_u32bounds_number].location_arr , name_arr);
+            g_bounds_arr[g_u32bounds_number].u32bound = u32value;
+            g_bounds_arr[g_u32bounds_number].u8used = FALSE;
+            g_u32bounds_number++;
+        }
+        else if(s32fields == 3 && strcmp(keyword_arr , "budget") == 0 && g_u32budgets_number < WCET_MAX_BUDGETS)
+        {
+            strcpy(g_budgets_arr[g_u32budgets_number].name_arr , name_arr);
+            g_budgets_arr[g_u32budgets_number].u32time = u32value;
+            g_u32budgets_number++;
+        }
+        else
+        {
+            fprintf(stderr , "%s:%u: invalid line\n" , a_file_name_ptr , u32line);
+            retVal = FALSE;
+        }
+    }
+    fclose(file_ptr);
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_add_instruction
+ *
+ * Description: 	add instruction of listing line to the current function.
+ *
+ * Inputs:			a_u32address      (uint32)
+ *                  a_u8words         (uint8)
+ *                  a_text_ptr        (const char*) mnemonic, operands and comment
+ *                  a_location_ptr    (const char*) source statement
+ *                  a_u8statement     (uint8)
+ *                  a_u8delay         (uint8)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Wcet_add_instruction(uint32 a_u32address , uint8 a_u8words , const char * a_text_ptr ,
+        const char * a_location_ptr , uint8 a_u8statement , uint8 a_u8delay)
+{
+    StrWcet_instruction_t * instruction_ptr = &g_instructions_arr[g_u32instructions_number++];
+    const char * operand_ptr = NULL_PTR;
+    char * bank_ptr = NULL_PTR;
+    size_t size = 0;
+    memset(instruction_ptr , 0 , sizeof(StrWcet_instruction_t));
+    instruction_ptr->u32address = a_u32address;
+    instruction_ptr->u8words = a_u8words;
+    instruction_ptr->u8statement = a_u8statement;
+    instruction_ptr->u8delay = a_u8delay;
+    instruction_ptr->s32callee = WCET_NO_INDEX;
+    instruction_ptr->s32local_call = WCET_NO_INDEX;
+    instruction_ptr->s32loop = WCET_NO_INDEX;
+    snprintf(instruction_ptr->location_arr , WCET_LOCATION_SIZE , "%s" , a_location_ptr);
+    size = strcspn(a_text_ptr , " \t;");
+    snprintf(instruction_ptr->mnemonic_arr , WCET_MNEMONIC_SIZE , "%.*s" , (int)size , a_text_ptr);
+    /* first operand is before the comma of destination and access bank */
+    operand_ptr = a_text_ptr + size;
+    operand_ptr += strspn(operand_ptr , " \t");
+    if(*operand_ptr != ';')
+    {
+        size = strcspn(operand_ptr , ",;\t");
+        snprintf(instruction_ptr->operand_arr , WCET_NAME_SIZE , "%.*s" , (int)size , operand_ptr);
+        while(size > 0 && instruction_ptr->operand_arr[size - 1] == ' ')
+        {
+            instruction_ptr->operand_arr[--size] = '\0';
+        }
+        bank_ptr = strstr(instruction_ptr->operand_arr , "^0");
+        if(bank_ptr != NULL_PTR)
+        {
+            *bank_ptr = '\0';
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        if(operand_ptr[size] == ',' && (operand_ptr[size + 1] == 'f' || operand_ptr[size + 1] == 'w') &&
+                (operand_ptr[size + 2] == ',' || isspace((unsigned char)operand_ptr[size + 2]) || operand_ptr[size + 2] == '\0'))
+        {
+            instruction_ptr->destination = operand_ptr[size + 1];
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    instruction_ptr->u8indirect = (strstr(a_text_ptr , ";indir") != NULL_PTR) ? TRUE : FALSE;
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_build_graph
+ *
+ * Description: 	set successors and their cycles of every instruction of
+ *                  function, expansions of _delay have one successor after
+ *                  them with their interpreted cycles.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Wcet_build_graph(uint32 a_u32function)
+{
+    StrWcet_function_t * function_ptr = &g_functions_arr[a_u32function];
+    StrWcet_instruction_t * instruction_ptr = NULL_PTR;
+    const char * mnemonic_ptr = NULL_PTR;
+    sint32 s32next = 0;
+    sint32 s32skip = 0;
+    sint32 s32target = 0;
+    sint64 s64delay = 0;
+    uint32 u32end = 0;
+    for(uint32 u32index = 0 ; u32index < function_ptr->u32instructions ; u32index++)
+    {
+        instruction_ptr = &g_instructions_arr[function_ptr->u32first + u32index];
+        mnemonic_ptr = instruction_ptr->mnemonic_arr;
+        /* the next instruction in the listing is the next one in the memory
+         * except the end of psect as the start of interrupt function */
+        s32next = (u32index + 1 < function_ptr->u32instructions &&
+                g_instructions_arr[function_ptr->u32first + u32index + 1].u32address ==
+                instruction_ptr->u32address + 2u * instruction_ptr->u8words) ? (sint32)(u32index + 1) : WCET_NO_INDEX;
+        s32skip = (s32next != WCET_NO_INDEX && (uint32)s32next + 1 < function_ptr->u32instructions) ? s32next + 1 : WCET_NO_INDEX;
+        s32target = Wcet_find_label(a_u32function , instruction_ptr->operand_arr);
+        instruction_ptr->u8successors = 0;
+        s64delay = (instruction_ptr->u8delay == TRUE) ? Wcet_run_delay(a_u32function , u32index , &u32end) : WCET_IMPOSSIBLE;
+        if(s64delay != WCET_IMPOSSIBLE)
+        {
+            instruction_ptr->s32successors_arr[0] = (u32end < function_ptr->u32instructions) ? (sint32)u32end : WCET_RETURN_TARGET;
+            instruction_ptr->s64costs_arr[0] = s64delay;
+            instruction_ptr->u8successors = 1;
+        }
+        else if(strcmp(mnemonic_ptr , "return") == 0 || strcmp(mnemonic_ptr , "retlw") == 0 ||
+                strcmp(mnemonic_ptr , "retfie") == 0)
+        {
+            instruction_ptr->s32successors_arr[0] = WCET_RETURN_TARGET;
+            instruction_ptr->s64costs_arr[0] = 2;
+            instruction_ptr->u8successors = 1;
+        }
+        else if(strcmp(mnemonic_ptr , "call") == 0 || strcmp(mnemonic_ptr , "rcall") == 0)
+        {
+            /* call of label of the same function is part of it (as pointer call
+             * or interrupt shadow registers refresh) */
+            instruction_ptr->s32local_call = s32target;
+            instruction_ptr->s32callee = (s32target == WCET_NO_INDEX) ?
+                    Wcet_find_function(instruction_ptr->operand_arr + 1) : WCET_NO_INDEX;
+            instruction_ptr->u8unknown = (s32target == WCET_NO_INDEX && instruction_ptr->s32callee == WCET_NO_INDEX) ? TRUE : FALSE;
+            instruction_ptr->s32successors_arr[0] = (s32next != WCET_NO_INDEX) ? s32next : WCET_RETURN_TARGET;
+            instruction_ptr->s64costs_arr[0] = 2;
+            instruction_ptr->u8successors = 1;
+        }
+        else if(strcmp(mnemonic_ptr , "bra") == 0 || strcmp(mnemonic_ptr , "goto") == 0)
+        {
+            if(s32target == WCET_NO_INDEX)
+            {
+                /* jump out of the function is tail call */
+                instruction_ptr->s32callee = Wcet_find_function(instruction_ptr->operand_arr + 1);
+                instruction_ptr->u8unknown = (instruction_ptr->s32callee == WCET_NO_INDEX) ? TRUE : FALSE;
+                s32target = WCET_RETURN_TARGET;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            instruction_ptr->s32successors_arr[0] = s32target;
+            instruction_ptr->s64costs_arr[0] = 2;
+            instruction_ptr->u8successors = 1;
+        }
+        else if(strcmp(mnemonic_ptr , "nop2") == 0)
+        {
+            /* bra to the next instruction */
+            instruction_ptr->s32successors_arr[0] = (s32next != WCET_NO_INDEX) ? s32next : WCET_RETURN_TARGET;
+            instruction_ptr->s64costs_arr[0] = 2;
+            instruction_ptr->u8successors = 1;
+        }
+        else if(mnemonic_ptr[0] == 'b' && strlen(mnemonic_ptr) <= 4 && strcmp(mnemonic_ptr , "bsf") != 0 &&
+                strcmp(mnemonic_ptr , "bcf") != 0 && strcmp(mnemonic_ptr , "btg") != 0)
+        {
+            /* conditional branch: bc, bn, bnc, bnn, bnov, bnz, bov and bz */
+            instruction_ptr->s32successors_arr[0] = (s32next != WCET_NO_INDEX) ? s32next : WCET_RETURN_TARGET;
+            instruction_ptr->s64costs_arr[0] = 1;
+            instruction_ptr->s32successors_arr[1] = s32target;
+            instruction_ptr->s64costs_arr[1] = 2;
+            instruction_ptr->u8successors = 2;
+            if(s32target == WCET_NO_INDEX)
+            {
+                instruction_ptr->u8unknown = TRUE;
+                instruction_ptr->u8successors = 1;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else if(strncmp(mnemonic_ptr , "cpfs" , 4) == 0 || strcmp(mnemonic_ptr , "decfsz") == 0 ||
+                strcmp(mnemonic_ptr , "dcfsnz") == 0 || strcmp(mnemonic_ptr , "incfsz") == 0 ||
+                strcmp(mnemonic_ptr , "infsnz") == 0 || strcmp(mnemonic_ptr , "btfsc") == 0 ||
+                strcmp(mnemonic_ptr , "btfss") == 0 || strcmp(mnemonic_ptr , "tstfsz") == 0)
+        {
+            /* skip of two words instruction takes one more cycle */
+            instruction_ptr->s32successors_arr[0] = (s32next != WCET_NO_INDEX) ? s32next : WCET_RETURN_TARGET;
+            instruction_ptr->s64costs_arr[0] = 1;
+            instruction_ptr->s32successors_arr[1] = (s32skip != WCET_NO_INDEX) ? s32skip : WCET_RETURN_TARGET;
+            instruction_ptr->s64costs_arr[1] = (s32next != WCET_NO_INDEX) ?
+                    1 + g_instructions_arr[function_ptr->u32first + s32next].u8words : 2;
+            instruction_ptr->u8successors = 2;
+        }
+        else
+        {
+            /* two words instructions (movff and lfsr) and table access take 2 cycles */
+            instruction_ptr->s32successors_arr[0] = (s32next != WCET_NO_INDEX) ? s32next : WCET_RETURN_TARGET;
+            instruction_ptr->s64costs_arr[0] = (instruction_ptr->u8words == 2 || strncmp(mnemonic_ptr , "tbl" , 3) == 0) ? 2 : 1;
+            instruction_ptr->u8successors = 1;
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_find_loops
+ *
+ * Description: 	find natural loops of function from back edges of depth
+ *                  first search, their nesting and their bounds.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Wcet_find_loops(uint32 a_u32function)
+{
+    StrWcet_function_t * function_ptr = &g_functions_arr[a_u32function];
+    StrWcet_instruction_t * instructions_ptr = &g_instructions_arr[function_ptr->u32first];
+    uint32 u32count = function_ptr->u32instructions;
+    uint32 u32first_loop = g_u32loops_number;
+    /* depth first search by explicit stack of instructions and next successor */
+    uint32 * u32stack_ptr = (uint32 *)malloc((u32count + 1) * sizeof(uint32));
+    uint8 * u8successor_ptr = (uint8 *)calloc(u32count + 1 , 1);
+    uint8 * u8colors_ptr = (uint8 *)calloc(u32count + 1 , 1);
+    uint32 u32depth = 0;
+    uint32 u32node = 0;
+    sint32 s32target = 0;
+    uint8 u8changed = TRUE;
+    StrWcet_loop_t * loop_ptr = NULL_PTR;
+    StrWcet_loop_t * outer_ptr = NULL_PTR;
+    if(u32stack_ptr == NULL_PTR || u8successor_ptr == NULL_PTR || u8colors_ptr == NULL_PTR || u32count == 0)
+    {
+        free(u32stack_ptr);
+        free(u8successor_ptr);
+        free(u8colors_ptr);
+        return;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* roots are the entry and the calls of labels of the function */
+    for(uint32 u32root = 0 ; u32root < u32count ; u32root++)
+    {
+        if(u32root != 0 && instructions_ptr[u32root].s32local_call == WCET_NO_INDEX)
+        {
+            continue;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        u32node = (u32root == 0) ? 0 : (uint32)instructions_ptr[u32root].s32local_call;
+        if(u8colors_ptr[u32node] != 0)
+        {
+            continue;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        u32depth = 0;
+        u32stack_ptr[u32depth++] = u32node;
+        u8colors_ptr[u32node] = 1;
+        u8successor_ptr[u32node] = 0;
+        while(u32depth > 0)
+        {
+            u32node = u32stack_ptr[u32depth - 1];
+            instructions_ptr[u32node].u8reachable = TRUE;
+            if(u8successor_ptr[u32node] < instructions_ptr[u32node].u8successors)
+            {
+                s32target = instructions_ptr[u32node].s32successors_arr[u8successor_ptr[u32node]++];
+                if(s32target < 0)
+                {
+                    /* Do nothing */
+                }
+                else if(u8colors_ptr[s32target] == 0)
+                {
+                    u8colors_ptr[s32target] = 1;
+                    u8successor_ptr[s32target] = 0;
+                    u32stack_ptr[u32depth++] = (uint32)s32target;
+                }
+                else if(u8colors_ptr[s32target] == 1)
+                {
+                    /* back edge, loops of the same header are one loop */
+                    loop_ptr = NULL_PTR;
+                    for(uint32 u32loop = u32first_loop ; u32loop < g_u32loops_number ; u32loop++)
+                    {
+                        if(g_loops_arr[u32loop].u32header == (uint32)s32target)
+                        {
+                            loop_ptr = &g_loops_arr[u32loop];
+                        }
+                        else
+                        {
+                            /* Do nothing */
+                        }
+                    }
+                    if(loop_ptr == NULL_PTR && g_u32loops_number < WCET_MAX_LOOPS)
+                    {
+                        loop_ptr = &g_loops_arr[g_u32loops_number++];
+                        memset(loop_ptr , 0 , sizeof(StrWcet_loop_t));
+                        loop_ptr->u32function = a_u32function;
+                        loop_ptr->u32header = (uint32)s32target;
+                        loop_ptr->u8body_ptr = (uint8 *)calloc(u32count , 1);
+                        loop_ptr->u8body_ptr[s32target] = TRUE;
+                        loop_ptr->s32parent = WCET_NO_INDEX;
+                    }
+                    else
+                    {
+                        /* Do nothing */
+                    }
+                    if(loop_ptr != NULL_PTR)
+                    {
+                        loop_ptr->u32back_edges++;
+                        loop_ptr->u32back_source = u32node;
+                        loop_ptr->u8body_ptr[u32node] = TRUE;
+                    }
+                    else
+                    {
+                        /* Do nothing */
+                    }
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+            else
+            {
+                u8colors_ptr[u32node] = 2;
+                u32depth--;
+            }
+        }
+    }
+    /* body is the header and the reachable instructions which reach the
+     * sources of the back edges without passing the header */
+    for(uint32 u32loop = u32first_loop ; u32loop < g_u32loops_number ; u32loop++)
+    {
+        loop_ptr = &g_loops_arr[u32loop];
+        u8changed = TRUE;
+        while(u8changed == TRUE)
+        {
+            u8changed = FALSE;
+            for(uint32 u32index = 0 ; u32index < u32count ; u32index++)
+            {
+                for(uint8 u8successor = 0 ; u8successor < instructions_ptr[u32index].u8successors &&
+                        loop_ptr->u8body_ptr[u32index] == FALSE && instructions_ptr[u32index].u8reachable == TRUE ; u8successor++)
+                {
+                    s32target = instructions_ptr[u32index].s32successors_arr[u8successor];
+                    if(s32target >= 0 && (uint32)s32target != loop_ptr->u32header && loop_ptr->u8body_ptr[s32target] == TRUE)
+                    {
+                        loop_ptr->u8body_ptr[u32index] = TRUE;
+                        u8changed = TRUE;
+                    }
+                    else
+                    {
+                        /* Do nothing */
+                    }
+                }
+            }
+        }
+        for(uint32 u32index = 0 ; u32index < u32count ; u32index++)
+        {
+            loop_ptr->u32size += loop_ptr->u8body_ptr[u32index];
+        }
+    }
+    /* parent is the smallest loop which contains the loop, innermost loop of
+     * instruction is the smallest loop which contains it */
+    for(uint32 u32loop = u32first_loop ; u32loop < g_u32loops_number ; u32loop++)
+    {
+        loop_ptr = &g_loops_arr[u32loop];
+        for(uint32 u32outer = u32first_loop ; u32outer < g_u32loops_number ; u32outer++)
+        {
+            outer_ptr = &g_loops_arr[u32outer];
+            if(u32outer != u32loop && outer_ptr->u8body_ptr[loop_ptr->u32header] == TRUE && outer_ptr->u32size > loop_ptr->u32size &&
+                    (loop_ptr->s32parent == WCET_NO_INDEX || outer_ptr->u32size < g_loops_arr[loop_ptr->s32parent].u32size))
+            {
+                loop_ptr->s32parent = (sint32)u32outer;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        for(uint32 u32index = 0 ; u32index < u32count ; u32index++)
+        {
+            if(loop_ptr->u8body_ptr[u32index] == TRUE && (instructions_ptr[u32index].s32loop == WCET_NO_INDEX ||
+                    g_loops_arr[instructions_ptr[u32index].s32loop].u32size > loop_ptr->u32size))
+            {
+                instructions_ptr[u32index].s32loop = (sint32)u32loop;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        /* bound of the configuration replaces the counter one */
+        loop_ptr->u32bound = Wcet_get_counter_bound(loop_ptr , &loop_ptr->u8bound_source);
+        loop_ptr->u8bound_source = (loop_ptr->u32bound > 0) ? loop_ptr->u8bound_source : WCET_BOUND_UNKNOWN;
+        for(uint32 u32bound = 0 ; u32bound < g_u32bounds_number ; u32bound++)
+        {
+            if(strcmp(g_bounds_arr[u32bound].location_arr , instructions_ptr[loop_ptr->u32header].location_arr) == 0)
+            {
+                loop_ptr->u32bound = g_bounds_arr[u32bound].u32bound;
+                loop_ptr->u8bound_source = WCET_BOUND_CONFIGURATION;
+                g_bounds_arr[u32bound].u8used = TRUE;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+    }
+    free(u32stack_ptr);
+    free(u8successor_ptr);
+    free(u8colors_ptr);
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_run_delay
+ *
+ * Description: 	interpret expansion of _delay (movlw, movwf, decfsz, bra,
+ *                  goto and nop) until the first other instruction or the
+ *                  next statement.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *                  a_u32start        (uint32) index in the function
+ *
+ * Outputs:			a_u32end_ptr      (uint32*) index after the expansion
+ *
+ * Return:			cycles or WCET_IMPOSSIBLE if it isn't simple expansion (sint64)
+ *******************************************************************************/
+static sint64 Wcet_run_delay(uint32 a_u32function , uint32 a_u32start , uint32 * a_u32end_ptr)
+{
+    StrWcet_function_t * function_ptr = &g_functions_arr[a_u32function];
+    StrWcet_instruction_t * instruction_ptr = NULL_PTR;
+    const char * names_arr[WCET_DELAY_MAX_REGISTERS];
+    uint8 u8values_arr[WCET_DELAY_MAX_REGISTERS];
+    uint32 u32registers = 0;
+    uint32 u32register = 0;
+    uint32 u32end = a_u32start + 1;
+    uint32 u32index = a_u32start;
+    uint8 u8working = 0;
+    uint8 * u8value_ptr = NULL_PTR;
+    sint32 s32target = 0;
+    sint64 retVal = 0;
+    char * end_ptr = NULL_PTR;
+    /* the expansion ends at the next statement or unsupported instruction */
+    while(u32end < function_ptr->u32instructions && g_instructions_arr[function_ptr->u32first + u32end].u8statement == FALSE &&
+            (strcmp(g_instructions_arr[function_ptr->u32first + u32end].mnemonic_arr , "movlw") == 0 ||
+             strcmp(g_instructions_arr[function_ptr->u32first + u32end].mnemonic_arr , "movwf") == 0 ||
+             strcmp(g_instructions_arr[function_ptr->u32first + u32end].mnemonic_arr , "decfsz") == 0 ||
+             strcmp(g_instructions_arr[function_ptr->u32first + u32end].mnemonic_arr , "bra") == 0 ||
+             strcmp(g_instructions_arr[function_ptr->u32first + u32end].mnemonic_arr , "goto") == 0 ||
+             strncmp(g_instructions_arr[function_ptr->u32first + u32end].mnemonic_arr , "nop" , 3) == 0))
+    {
+        u32end++;
+    }
+    /* loads of the next statement arguments after the expansion aren't part of it */
+    while(u32end > a_u32start + 1 && (strcmp(g_instructions_arr[function_ptr->u32first + u32end - 1].mnemonic_arr , "movlw") == 0 ||
+            strcmp(g_instructions_arr[function_ptr->u32first + u32end - 1].mnemonic_arr , "movwf") == 0))
+    {
+        u32end--;
+    }
+    for(uint32 u32steps = 0 ; u32index < u32end ; u32steps++)
+    {
+        instruction_ptr = &g_instructions_arr[function_ptr->u32first + u32index];
+        u8value_ptr = NULL_PTR;
+        if(strcmp(instruction_ptr->operand_arr , "wreg") == 0)
+        {
+            u8value_ptr = &u8working;
+        }
+        else
+        {
+            for(u32register = 0 ; u32register < u32registers ; u32register++)
+            {
+                if(strcmp(names_arr[u32register] , instruction_ptr->operand_arr) == 0)
+                {
+                    u8value_ptr = &u8values_arr[u32register];
+                    break;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+        }
+        if(u32steps > WCET_DELAY_MAX_STEPS)
+        {
+            return WCET_IMPOSSIBLE;
+        }
+        else if(strcmp(instruction_ptr->mnemonic_arr , "movlw") == 0)
+        {
+            u8working = (uint8)strtol(instruction_ptr->operand_arr , &end_ptr , 0);
+            if(*end_ptr != '\0')
+            {
+                return WCET_IMPOSSIBLE;
+            }
+            else
+            {
+                retVal++;
+                u32index++;
+            }
+        }
+        else if(strcmp(instruction_ptr->mnemonic_arr , "movwf") == 0)
+        {
+            if(u8value_ptr == NULL_PTR && u32registers < WCET_DELAY_MAX_REGISTERS)
+            {
+                names_arr[u32registers] = instruction_ptr->operand_arr;
+                u8value_ptr = &u8values_arr[u32registers++];
+            }
+            else if(u8value_ptr == NULL_PTR)
+            {
+                return WCET_IMPOSSIBLE;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            *u8value_ptr = u8working;
+            retVal++;
+            u32index++;
+        }
+        else if(strcmp(instruction_ptr->mnemonic_arr , "decfsz") == 0)
+        {
+            if(u8value_ptr == NULL_PTR)
+            {
+                return WCET_IMPOSSIBLE;
+            }
+            else
+            {
+                (*u8value_ptr)--;
+            }
+            if(*u8value_ptr == 0)
+            {
+                retVal += instruction_ptr->s64costs_arr[1];
+                u32index += 2;
+            }
+            else
+            {
+                retVal++;
+                u32index++;
+            }
+        }
+        else if(strcmp(instruction_ptr->mnemonic_arr , "bra") == 0 || strcmp(instruction_ptr->mnemonic_arr , "goto") == 0)
+        {
+            s32target = Wcet_find_label(a_u32function , instruction_ptr->operand_arr);
+            if(s32target == WCET_NO_INDEX || (uint32)s32target < a_u32start || (uint32)s32target > u32end)
+            {
+                return WCET_IMPOSSIBLE;
+            }
+            else
+            {
+                retVal += 2;
+                u32index = (uint32)s32target;
+            }
+        }
+        else
+        {
+            /* nop takes 1 cycle and nop2 (bra to the next instruction) takes 2 */
+            retVal += (strcmp(instruction_ptr->mnemonic_arr , "nop2") == 0) ? 2 : 1;
+            u32index++;
+        }
+    }
+    *a_u32end_ptr = u32index;
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_get_counter_bound
+ *
+ * Description: 	get bound of loop which is counted by decfsz of register,
+ *                  the decfsz is the header or it is before the only back
+ *                  edge, the register isn't written by other instructions of
+ *                  the body so the bound is the literal which is loaded to it
+ *                  before the loop or 256 of the 8 bits register.
+ *
+ * Inputs:			a_loop_ptr        (const StrWcet_loop_t*)
+ *
+ * Outputs:			a_u8source_ptr    (uint8*) WCET_BOUND_COUNTER or
+ *                                    WCET_BOUND_REGISTER
+ *
+ * Return:			max. executions of the header or 0 if unknown (uint32)
+ *******************************************************************************/
+static uint32 Wcet_get_counter_bound(const StrWcet_loop_t * a_loop_ptr , uint8 * a_u8source_ptr)
+{
+    StrWcet_function_t * function_ptr = &g_functions_arr[a_loop_ptr->u32function];
+    StrWcet_instruction_t * instructions_ptr = &g_instructions_arr[function_ptr->u32first];
+    const StrWcet_instruction_t * counter_ptr = NULL_PTR;
+    const StrWcet_instruction_t * literal_ptr = NULL_PTR;
+    const char * mnemonic_ptr = NULL_PTR;
+    uint32 retVal = 256u;
+    uint32 u32source = a_loop_ptr->u32back_source;
+    uint32 u32first = a_loop_ptr->u32header;
+    sint32 s32skip = 0;
+    char * end_ptr = NULL_PTR;
+    *a_u8source_ptr = WCET_BOUND_REGISTER;
+    if(strcmp(instructions_ptr[a_loop_ptr->u32header].mnemonic_arr , "decfsz") == 0)
+    {
+        /* decfsz of the header exits the loop by its skip */
+        counter_ptr = &instructions_ptr[a_loop_ptr->u32header];
+        s32skip = counter_ptr->s32successors_arr[1];
+        counter_ptr = (s32skip == WCET_RETURN_TARGET || (s32skip >= 0 && a_loop_ptr->u8body_ptr[s32skip] == FALSE)) ? counter_ptr : NULL_PTR;
+    }
+    else if(a_loop_ptr->u32back_edges == 1 && u32source > 0 && Wcet_find_label_of(a_loop_ptr->u32function , u32source) == FALSE &&
+            (strcmp(instructions_ptr[u32source].mnemonic_arr , "bra") == 0 || strcmp(instructions_ptr[u32source].mnemonic_arr , "goto") == 0) &&
+            strcmp(instructions_ptr[u32source - 1].mnemonic_arr , "decfsz") == 0)
+    {
+        /* jump of the only back edge is reached by the decfsz only */
+        counter_ptr = &instructions_ptr[u32source - 1];
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    if(counter_ptr == NULL_PTR)
+    {
+        return 0;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    /* the counter isn't written by other instructions of the body */
+    for(uint32 u32index = 0 ; u32index < function_ptr->u32instructions ; u32index++)
+    {
+        if(a_loop_ptr->u8body_ptr[u32index] == TRUE && &instructions_ptr[u32index] != counter_ptr &&
+                Wcet_is_written(&instructions_ptr[u32index] , counter_ptr->operand_arr) == TRUE)
+        {
+            return 0;
+        }
+        else if(a_loop_ptr->u8body_ptr[u32index] == TRUE && u32index < u32first)
+        {
+            u32first = u32index;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    /* movlw and movwf of the counter (or movlw of wreg) before the loop,
+     * the jump to the header just before the body is skipped */
+    if(u32first > 0 && (strcmp(instructions_ptr[u32first - 1].mnemonic_arr , "bra") == 0 ||
+            strcmp(instructions_ptr[u32first - 1].mnemonic_arr , "goto") == 0) && instructions_ptr[u32first - 1].s32successors_arr[0] >= 0 &&
+            a_loop_ptr->u8body_ptr[instructions_ptr[u32first - 1].s32successors_arr[0]] == TRUE)
+    {
+        u32first--;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    for(uint32 u32index = u32first ; u32index > 1 && u32first - u32index < WCET_COUNTER_SEARCH ; u32index--)
+    {
+        mnemonic_ptr = instructions_ptr[u32index - 1].mnemonic_arr;
+        literal_ptr = NULL_PTR;
+        if(strcmp(mnemonic_ptr , "movlw") == 0 && strcmp(counter_ptr->operand_arr , "wreg") == 0)
+        {
+            literal_ptr = &instructions_ptr[u32index - 1];
+        }
+        else if(strcmp(mnemonic_ptr , "movwf") == 0 && strcmp(instructions_ptr[u32index - 1].operand_arr , counter_ptr->operand_arr) == 0 &&
+                strcmp(instructions_ptr[u32index - 2].mnemonic_arr , "movlw") == 0 &&
+                Wcet_find_label_of(a_loop_ptr->u32function , u32index - 1) == FALSE)
+        {
+            literal_ptr = &instructions_ptr[u32index - 2];
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        if(Wcet_is_written(&instructions_ptr[u32index - 1] , counter_ptr->operand_arr) == TRUE)
+        {
+            if(literal_ptr != NULL_PTR)
+            {
+                retVal = (uint32)strtoul(literal_ptr->operand_arr , &end_ptr , 0);
+                retVal = (*end_ptr != '\0') ? 256u : (retVal == 0) ? 256u : retVal;
+                *a_u8source_ptr = (*end_ptr != '\0') ? WCET_BOUND_REGISTER : WCET_BOUND_COUNTER;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+            break;
+        }
+        else if(instructions_ptr[u32index - 1].u8successors != 1 || strcmp(mnemonic_ptr , "bra") == 0 ||
+                strcmp(mnemonic_ptr , "goto") == 0 || Wcet_find_label_of(a_loop_ptr->u32function , u32index - 1) == TRUE)
+        {
+            break;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_get_function_cycles
+ *
+ * Description: 	get worst case cycles of function from its call to the end
+ *                  of its return.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles or WCET_UNBOUNDED (sint64)
+ *******************************************************************************/
+static sint64 Wcet_get_function_cycles(uint32 a_u32function)
+{
+    StrWcet_function_t * function_ptr = &g_functions_arr[a_u32function];
+    if(function_ptr->u8state == WCET_COMPUTED)
+    {
+        /* Do nothing */
+    }
+    else if(function_ptr->u8state == WCET_COMPUTING)
+    {
+        Wcet_set_reason(a_u32function , "recursion" , "");
+        return WCET_UNBOUNDED;
+    }
+    else if(function_ptr->u32instructions == 0)
+    {
+        Wcet_set_reason(a_u32function , "no instructions" , "");
+        function_ptr->s64cycles = WCET_UNBOUNDED;
+        function_ptr->u8state = WCET_COMPUTED;
+    }
+    else
+    {
+        function_ptr->u8state = WCET_COMPUTING;
+        function_ptr->s64cycles = Wcet_get_path(a_u32function , WCET_NO_INDEX , WCET_MODE_RETURN , 0);
+        if(function_ptr->s64cycles == WCET_IMPOSSIBLE)
+        {
+            /* function without return as main */
+            Wcet_set_reason(a_u32function , "no return" , "");
+            function_ptr->s64cycles = WCET_UNBOUNDED;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        function_ptr->u8state = WCET_COMPUTED;
+    }
+    return function_ptr->s64cycles;
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_get_loop_cycles
+ *
+ * Description: 	get worst case cycles of loop from its header to its exit,
+ *                  it is (bound - 1) longest iterations and the longest exit.
+ *
+ * Inputs:			a_u32loop         (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles or WCET_UNBOUNDED (sint64)
+ *******************************************************************************/
+static sint64 Wcet_get_loop_cycles(uint32 a_u32loop)
+{
+    StrWcet_loop_t * loop_ptr = &g_loops_arr[a_u32loop];
+    sint64 s64iteration = 0;
+    sint64 s64exit = 0;
+    const char * location_ptr = g_instructions_arr[g_functions_arr[loop_ptr->u32function].u32first + loop_ptr->u32header].location_arr;
+    if(loop_ptr->u8state == WCET_COMPUTED)
+    {
+        /* Do nothing */
+    }
+    else if(loop_ptr->u8state == WCET_COMPUTING)
+    {
+        return WCET_UNBOUNDED;
+    }
+    else
+    {
+        loop_ptr->u8state = WCET_COMPUTING;
+        s64iteration = Wcet_get_path(loop_ptr->u32function , (sint32)a_u32loop , WCET_MODE_ITERATION , loop_ptr->u32header);
+        s64exit = Wcet_get_path(loop_ptr->u32function , (sint32)a_u32loop , WCET_MODE_EXIT , loop_ptr->u32header);
+        if(s64exit == WCET_IMPOSSIBLE)
+        {
+            Wcet_set_reason(loop_ptr->u32function , "endless loop at " , location_ptr);
+            loop_ptr->s64cycles = WCET_UNBOUNDED;
+        }
+        else if(loop_ptr->u32bound == 0)
+        {
+            Wcet_set_reason(loop_ptr->u32function , "no bound of loop at " , location_ptr);
+            loop_ptr->s64cycles = WCET_UNBOUNDED;
+        }
+        else if(s64iteration >= WCET_UNBOUNDED || s64exit >= WCET_UNBOUNDED)
+        {
+            loop_ptr->s64cycles = WCET_UNBOUNDED;
+        }
+        else
+        {
+            loop_ptr->s64cycles = (sint64)(loop_ptr->u32bound - 1) * ((s64iteration > 0) ? s64iteration : 0) + s64exit;
+        }
+        loop_ptr->u8state = WCET_COMPUTED;
+    }
+    return loop_ptr->s64cycles;
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_get_path
+ *
+ * Description: 	get longest path from instruction of function, region or
+ *                  loop, to the end of the context mode.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *                  a_s32region       (sint32) loop or WCET_NO_INDEX
+ *                  a_u8mode          (uint8) WCET_MODE_RETURN, WCET_MODE_ITERATION
+ *                                    or WCET_MODE_EXIT
+ *                  a_u32start        (uint32) index in the function
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles, WCET_IMPOSSIBLE or WCET_UNBOUNDED (sint64)
+ *******************************************************************************/
+static sint64 Wcet_get_path(uint32 a_u32function , sint32 a_s32region , uint8 a_u8mode , uint32 a_u32start)
+{
+    StrWcet_context_t context;
+    sint64 retVal = WCET_UNBOUNDED;
+    uint32 u32count = g_functions_arr[a_u32function].u32instructions;
+    context.u32function = a_u32function;
+    context.s32region = a_s32region;
+    context.u8mode = a_u8mode;
+    context.s64paths_ptr = (sint64 *)malloc(u32count * sizeof(sint64));
+    context.u8states_ptr = (uint8 *)calloc(u32count , 1);
+    if(context.s64paths_ptr == NULL_PTR || context.u8states_ptr == NULL_PTR)
+    {
+        /* Do nothing */
+    }
+    else if(a_s32region != WCET_NO_INDEX && g_loops_arr[a_s32region].u32header == a_u32start)
+    {
+        retVal = Wcet_get_longest(&context , a_u32start);
+    }
+    else
+    {
+        /* start may be header of loop as the entry of function */
+        retVal = Wcet_get_target(&context , (sint32)a_u32start);
+    }
+    free(context.s64paths_ptr);
+    free(context.u8states_ptr);
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_get_longest
+ *
+ * Description: 	get longest path from instruction in context.
+ *
+ * Inputs:			a_context_ptr     (StrWcet_context_t*)
+ *                  a_u32index        (uint32) index in the function
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles, WCET_IMPOSSIBLE or WCET_UNBOUNDED (sint64)
+ *******************************************************************************/
+static sint64 Wcet_get_longest(StrWcet_context_t * a_context_ptr , uint32 a_u32index)
+{
+    StrWcet_instruction_t * instruction_ptr = &g_instructions_arr[g_functions_arr[a_context_ptr->u32function].u32first + a_u32index];
+    sint64 retVal = WCET_IMPOSSIBLE;
+    sint64 s64call = 0;
+    sint64 s64path = 0;
+    if(a_context_ptr->u8states_ptr[a_u32index] == WCET_COMPUTED)
+    {
+        return a_context_ptr->s64paths_ptr[a_u32index];
+    }
+    else if(a_context_ptr->u8states_ptr[a_u32index] == WCET_COMPUTING)
+    {
+        /* cycle which isn't natural loop */
+        Wcet_set_reason(a_context_ptr->u32function , "irreducible loop at " , instruction_ptr->location_arr);
+        return WCET_UNBOUNDED;
+    }
+    else
+    {
+        a_context_ptr->u8states_ptr[a_u32index] = WCET_COMPUTING;
+    }
+    s64call = Wcet_get_call_cycles(a_context_ptr->u32function , a_u32index);
+    for(uint8 u8successor = 0 ; u8successor < instruction_ptr->u8successors ; u8successor++)
+    {
+        s64path = Wcet_get_target(a_context_ptr , instruction_ptr->s32successors_arr[u8successor]);
+        if(s64path != WCET_IMPOSSIBLE)
+        {
+            s64path = Wcet_add(Wcet_add(s64path , instruction_ptr->s64costs_arr[u8successor]) , s64call);
+            retVal = (s64path > retVal) ? s64path : retVal;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    a_context_ptr->s64paths_ptr[a_u32index] = retVal;
+    a_context_ptr->u8states_ptr[a_u32index] = WCET_COMPUTED;
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_get_target
+ *
+ * Description: 	get longest path from successor in context, the back edge
+ *                  and the exit of the region end the path depend on the
+ *                  mode and the inner loops are passed by their cycles.
+ *
+ * Inputs:			a_context_ptr     (StrWcet_context_t*)
+ *                  a_s32target       (sint32) index in the function or
+ *                                    WCET_RETURN_TARGET
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles, WCET_IMPOSSIBLE or WCET_UNBOUNDED (sint64)
+ *******************************************************************************/
+static sint64 Wcet_get_target(StrWcet_context_t * a_context_ptr , sint32 a_s32target)
+{
+    StrWcet_function_t * function_ptr = &g_functions_arr[a_context_ptr->u32function];
+    StrWcet_instruction_t * instructions_ptr = &g_instructions_arr[function_ptr->u32first];
+    StrWcet_loop_t * region_ptr = (a_context_ptr->s32region != WCET_NO_INDEX) ? &g_loops_arr[a_context_ptr->s32region] : NULL_PTR;
+    StrWcet_loop_t * loop_ptr = NULL_PTR;
+    sint32 s32loop = WCET_NO_INDEX;
+    sint32 s32exit = 0;
+    sint64 s64loop = 0;
+    sint64 s64path = 0;
+    sint64 retVal = WCET_IMPOSSIBLE;
+    if(a_s32target == WCET_RETURN_TARGET)
+    {
+        /* return ends the function and exits the loops */
+        retVal = (a_context_ptr->u8mode != WCET_MODE_ITERATION) ? 0 : WCET_IMPOSSIBLE;
+    }
+    else if(region_ptr != NULL_PTR && (uint32)a_s32target == region_ptr->u32header)
+    {
+        retVal = (a_context_ptr->u8mode == WCET_MODE_ITERATION) ? 0 : WCET_IMPOSSIBLE;
+    }
+    else if(region_ptr != NULL_PTR && region_ptr->u8body_ptr[a_s32target] == FALSE)
+    {
+        retVal = (a_context_ptr->u8mode == WCET_MODE_EXIT) ? 0 : WCET_IMPOSSIBLE;
+    }
+    else
+    {
+        /* inner loop of the region which contains the target */
+        s32loop = instructions_ptr[a_s32target].s32loop;
+        while(s32loop != WCET_NO_INDEX && g_loops_arr[s32loop].s32parent != a_context_ptr->s32region)
+        {
+            s32loop = g_loops_arr[s32loop].s32parent;
+        }
+        if(s32loop == a_context_ptr->s32region)
+        {
+            s32loop = WCET_NO_INDEX;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        if(s32loop == WCET_NO_INDEX)
+        {
+            retVal = Wcet_get_longest(a_context_ptr , (uint32)a_s32target);
+        }
+        else if(g_loops_arr[s32loop].u32header != (uint32)a_s32target)
+        {
+            Wcet_set_reason(a_context_ptr->u32function , "irreducible loop at " , instructions_ptr[a_s32target].location_arr);
+            retVal = WCET_UNBOUNDED;
+        }
+        else
+        {
+            /* the loop is passed to its exits, the longest exit is in its cycles */
+            loop_ptr = &g_loops_arr[s32loop];
+            s64loop = Wcet_get_loop_cycles((uint32)s32loop);
+            for(uint32 u32index = 0 ; u32index < function_ptr->u32instructions ; u32index++)
+            {
+                for(uint8 u8successor = 0 ; u8successor < instructions_ptr[u32index].u8successors &&
+                        loop_ptr->u8body_ptr[u32index] == TRUE ; u8successor++)
+                {
+                    s32exit = instructions_ptr[u32index].s32successors_arr[u8successor];
+                    if(s32exit == WCET_RETURN_TARGET || (s32exit >= 0 && loop_ptr->u8body_ptr[s32exit] == FALSE))
+                    {
+                        s64path = Wcet_get_target(a_context_ptr , s32exit);
+                        retVal = (s64path > retVal) ? s64path : retVal;
+                    }
+                    else
+                    {
+                        /* Do nothing */
+                    }
+                }
+            }
+            retVal = (retVal == WCET_IMPOSSIBLE) ? WCET_IMPOSSIBLE : Wcet_add(retVal , s64loop);
+        }
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_get_call_cycles
+ *
+ * Description: 	get cycles of called code of instruction, the direct call,
+ *                  the call of label of the same function or the indirect
+ *                  jump of return, the jump out of the listing functions is
+ *                  unbounded.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *                  a_u32index        (uint32) index in the function
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles or WCET_UNBOUNDED (sint64)
+ *******************************************************************************/
+static sint64 Wcet_get_call_cycles(uint32 a_u32function , uint32 a_u32index)
+{
+    StrWcet_function_t * function_ptr = &g_functions_arr[a_u32function];
+    StrWcet_instruction_t * instruction_ptr = &g_instructions_arr[function_ptr->u32first + a_u32index];
+    sint32 s32callee = WCET_NO_INDEX;
+    sint64 s64cycles = 0;
+    sint64 retVal = 0;
+    if(instruction_ptr->u8unknown == TRUE)
+    {
+        Wcet_set_reason(a_u32function , "unknown target " , instruction_ptr->operand_arr);
+        retVal = WCET_UNBOUNDED;
+    }
+    else if(instruction_ptr->s32callee != WCET_NO_INDEX)
+    {
+        retVal = Wcet_get_function_cycles((uint32)instruction_ptr->s32callee);
+        if(retVal >= WCET_UNBOUNDED)
+        {
+            Wcet_set_reason(a_u32function , "calls " , g_functions_arr[instruction_ptr->s32callee].name_arr);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else if(instruction_ptr->s32local_call != WCET_NO_INDEX)
+    {
+        retVal = Wcet_get_path(a_u32function , WCET_NO_INDEX , WCET_MODE_RETURN , (uint32)instruction_ptr->s32local_call);
+        retVal = (retVal == WCET_IMPOSSIBLE) ? WCET_UNBOUNDED : retVal;
+    }
+    else if(instruction_ptr->u8indirect == TRUE)
+    {
+        /* the longest function which is called by pointer */
+        for(uint32 u32callee = 0 ; u32callee < function_ptr->u32callees ; u32callee++)
+        {
+            s32callee = Wcet_find_function(function_ptr->callees_arr[u32callee]);
+            if(s32callee != WCET_NO_INDEX && Wcet_is_indirect_callee(a_u32function , (uint32)s32callee) == TRUE)
+            {
+                s64cycles = Wcet_get_function_cycles((uint32)s32callee);
+                retVal = (s64cycles > retVal) ? s64cycles : retVal;
+                if(s64cycles >= WCET_UNBOUNDED)
+                {
+                    Wcet_set_reason(a_u32function , "calls " , g_functions_arr[s32callee].name_arr);
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_add
+ *
+ * Description: 	add cycles, unbounded cycles stay unbounded.
+ *
+ * Inputs:			a_s64first        (sint64)
+ *                  a_s64second       (sint64)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			cycles (sint64)
+ *******************************************************************************/
+static sint64 Wcet_add(sint64 a_s64first , sint64 a_s64second)
+{
+    return (a_s64first >= WCET_UNBOUNDED || a_s64second >= WCET_UNBOUNDED) ? WCET_UNBOUNDED : a_s64first + a_s64second;
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_set_reason
+ *
+ * Description: 	keep the first cause of unbounded time of function.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *                  a_reason_ptr      (const char*)
+ *                  a_detail_ptr      (const char*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Wcet_set_reason(uint32 a_u32function , const char * a_reason_ptr , const char * a_detail_ptr)
+{
+    char reason_arr[WCET_REASON_SIZE];
+    if(g_functions_arr[a_u32function].reason_arr[0] == '\0')
+    {
+        /* detail may be name of function of the same array */
+        snprintf(reason_arr , sizeof(reason_arr) , "%s%s" , a_reason_ptr , a_detail_ptr);
+        strcpy(g_functions_arr[a_u32function].reason_arr , reason_arr);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_find_function
+ *
+ * Description: 	find function by its name.
+ *
+ * Inputs:			a_name_ptr        (const char*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			function index or WCET_NO_INDEX (sint32)
+ *******************************************************************************/
+static sint32 Wcet_find_function(const char * a_name_ptr)
+{
+    sint32 retVal = WCET_NO_INDEX;
+    for(uint32 u32function = 0 ; u32function < g_u32functions_number ; u32function++)
+    {
+        if(strcmp(g_functions_arr[u32function].name_arr , a_name_ptr) == 0)
+        {
+            retVal = (sint32)u32function;
+            break;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_find_label
+ *
+ * Description: 	find label of function by its name.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *                  a_name_ptr        (const char*)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			instruction index in the function or WCET_NO_INDEX (sint32)
+ *******************************************************************************/
+static sint32 Wcet_find_label(uint32 a_u32function , const char * a_name_ptr)
+{
+    sint32 retVal = WCET_NO_INDEX;
+    for(uint32 u32label = 0 ; u32label < g_u32labels_number ; u32label++)
+    {
+        if(g_labels_arr[u32label].u32function == a_u32function && strcmp(g_labels_arr[u32label].name_arr , a_name_ptr) == 0 &&
+                g_labels_arr[u32label].u32instruction < g_functions_arr[a_u32function].u32instructions)
+        {
+            retVal = (sint32)g_labels_arr[u32label].u32instruction;
+            break;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_find_label_of
+ *
+ * Description: 	check if instruction of function has label so it may be
+ *                  reached by jump.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *                  a_u32instruction  (uint32) index in the function
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE or FALSE (uint8)
+ *******************************************************************************/
+static uint8 Wcet_find_label_of(uint32 a_u32function , uint32 a_u32instruction)
+{
+    uint8 retVal = FALSE;
+    for(uint32 u32label = 0 ; u32label < g_u32labels_number ; u32label++)
+    {
+        if(g_labels_arr[u32label].u32function == a_u32function && g_labels_arr[u32label].u32instruction == a_u32instruction)
+        {
+            retVal = TRUE;
+            break;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_is_written
+ *
+ * Description: 	check if instruction may write register, call writes all
+ *                  registers.
+ *
+ * Inputs:			a_instruction_ptr (const StrWcet_instruction_t*)
+ *                  a_name_ptr        (const char*) register operand or "wreg"
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE or FALSE (uint8)
+ *******************************************************************************/
+static uint8 Wcet_is_written(const StrWcet_instruction_t * a_instruction_ptr , const char * a_name_ptr)
+{
+    const char * mnemonic_ptr = a_instruction_ptr->mnemonic_arr;
+    size_t size = strlen(mnemonic_ptr);
+    uint8 retVal = FALSE;
+    if(strcmp(mnemonic_ptr , "call") == 0 || strcmp(mnemonic_ptr , "rcall") == 0)
+    {
+        retVal = TRUE;
+    }
+    else if(strcmp(a_name_ptr , "wreg") == 0 && (a_instruction_ptr->destination == 'w' ||
+            (size > 2 && strcmp(mnemonic_ptr + size - 2 , "lw") == 0 && strcmp(mnemonic_ptr , "mullw") != 0)))
+    {
+        /* movlw, addlw, andlw, iorlw, sublw, xorlw and retlw */
+        retVal = TRUE;
+    }
+    else if(strcmp(a_instruction_ptr->operand_arr , a_name_ptr) == 0 && (a_instruction_ptr->destination == 'f' ||
+            strcmp(mnemonic_ptr , "movwf") == 0 || strcmp(mnemonic_ptr , "clrf") == 0 ||
+            strcmp(mnemonic_ptr , "setf") == 0 || strcmp(mnemonic_ptr , "negf") == 0 ||
+            strcmp(mnemonic_ptr , "bsf") == 0 || strcmp(mnemonic_ptr , "bcf") == 0 ||
+            strcmp(mnemonic_ptr , "btg") == 0 || strcmp(mnemonic_ptr , "movff") == 0))
+    {
+        retVal = TRUE;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_is_indirect_callee
+ *
+ * Description: 	check if function of the call graph of the listing isn't
+ *                  called directly by the caller so it is called by pointer.
+ *
+ * Inputs:			a_u32caller       (uint32)
+ *                  a_u32callee       (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE or FALSE (uint8)
+ *******************************************************************************/
+static uint8 Wcet_is_indirect_callee(uint32 a_u32caller , uint32 a_u32callee)
+{
+    StrWcet_function_t * function_ptr = &g_functions_arr[a_u32caller];
+    uint8 retVal = TRUE;
+    for(uint32 u32index = 0 ; u32index < function_ptr->u32instructions ; u32index++)
+    {
+        if(g_instructions_arr[function_ptr->u32first + u32index].s32callee == (sint32)a_u32callee)
+        {
+            retVal = FALSE;
+            break;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Wcet_print_chain
+ *
+ * Description: 	print the chain of the heaviest called functions.
+ *
+ * Inputs:			a_u32function     (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Wcet_print_chain(uint32 a_u32function)
+{
+    StrWcet_function_t * function_ptr = NULL_PTR;
+    sint32 s32function = (sint32)a_u32function;
+    sint32 s32heaviest = WCET_NO_INDEX;
+    sint32 s32callee = WCET_NO_INDEX;
+    sint64 s64cycles = 0;
+    printf("     heaviest calls:");
+    for(uint32 u32depth = 0 ; u32depth < WCET_MAX_CHAIN && s32function != WCET_NO_INDEX ; u32depth++)
+    {
+        function_ptr = &g_functions_arr[s32function];
+        s64cycles = Wcet_get_function_cycles((uint32)s32function);
+        if(s64cycles >= WCET_UNBOUNDED)
+        {
+            printf("%s %s (unbounded)" , (u32depth > 0) ? " ->" : "" , function_ptr->name_arr);
+        }
+        else
+        {
+            printf("%s %s (%lld)" , (u32depth > 0) ? " ->" : "" , function_ptr->name_arr , s64cycles);
+        }
+        /* direct and indirect callees are in the call graph of the listing */
+        s32heaviest = WCET_NO_INDEX;
+        for(uint32 u32callee = 0 ; u32callee < function_ptr->u32callees ; u32callee++)
+        {
+            s32callee = Wcet_find_function(function_ptr->callees_arr[u32callee]);
+            if(s32callee != WCET_NO_INDEX && s32callee != s32function && (s32heaviest == WCET_NO_INDEX ||
+                    Wcet_get_function_cycles((uint32)s32callee) > Wcet_get_function_cycles((uint32)s32heaviest)))
+            {
+                s32heaviest = s32callee;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        s32function = s32heaviest;
+    }
+    printf("\n");
+}
@@ -0,0 +1,44 @@
+/*******************************************************************************
+ *
+ * File:                xc.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            host replacement of XC8 compiler header, it is found
+ *                      before the compiler header only in simulator build to
+ *                      map compiler built-ins to the simulator.
+ *
+ * Revision history:    8/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef SIM_XC_H
+#define	SIM_XC_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* delays advance the virtual clock of the simulator without waiting */
+#define __delay_us(TIME)        Sim_delay_us((uint32)(TIME))
+#define __delay_ms(TIME)        Sim_delay_us((uint32)(TIME) * 1000u)
+/* interrupt qualifier, the simulator calls the ISR by its name */
+#define __interrupt(...)
+#define NOP()                   Sim_delay_us(0)
+/* the CPU waits for the next interrupt in Idle mode */
+#define SLEEP()                 Sim_sleep()
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+extern void Sim_delay_us(uint32 a_u32time);
+extern void Sim_sleep(void);
+
+#endif	/* SIM_XC_H */
+
@@ -53,10 +53,27 @@ typedef unsigned char           uint8;
 typedef signed char             sint8;
 typedef unsigned short int      uint16;
 typedef signed short int        sint16;
+/* long is 64 bits on the host so the simulator build keeps 32 bits by int */
+#ifdef HOST_SIMULATION
+typedef unsigned int            uint32;
+typedef signed int              sint32;
+#else
 typedef unsigned long int       uint32;
 typedef signed long int         sint32;
+#endif
 typedef unsigned long long int  uint64;
 typedef signed long long int    sint64;
 
+/*registers access*/
+/* special function registers are accessed by their addresses in the
+ * microcontroller, in the host simulator they are mapped to the simulated
+ * register file which checks every access to run peripherals models */
+#ifdef HOST_SIMULATION
+extern volatile uint8 * Sim_register_access(uint16 a_u16address);
+#define REGISTER_8BIT(ADDRESS)  (*Sim_register_access(ADDRESS))
+#else
+#define REGISTER_8BIT(ADDRESS)  (*(volatile uint8*)(ADDRESS))
+#endif
+
 #endif	/* STDTYPES_H */
 
@@ -0,0 +1,337 @@
+/*******************************************************************************
+ *
+ * File:                timebase.c
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions implementation of monotonic time
+ *                      base module, the 16 bits counter of timer 3 is extended
+ *                      by its overflows which are counted in its interrupt.
+ *                      the time is read without disabling interrupts, the read
+ *                      is repeated if the overflow interrupt changed the time
+ *                      during it.
+ *
+ * Revision history:    27/3/2020
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "timebase.h"
+#include "timers.h"
+#include "interrupt.h"
+#include "interrupt_MemMap.h"
+#include "helped_macros.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* one overflow of timer 3 is 65536 ticks = 32768 us = 32 ms + 768 us */
+#define TIMEBASE_US_SHIFT               15u
+#define TIMEBASE_OVERFLOW_MS            32u
+#define TIMEBASE_OVERFLOW_US            768u
+/* counter value which is before the middle of the timer period */
+#define TIMEBASE_HALF_PERIOD            0x8000u
+/* x / 1000 = (x * 33555) >> 25 for all x less than 40000 */
+#define TIMEBASE_MS_RECIPROCAL          33555u
+#define TIMEBASE_MS_SHIFT               25u
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* overflows of timer 3 and the same time in milliseconds and microseconds
+ * over the milliseconds, they are changed in the interrupt only */
+static volatile uint32 g_u32overflows = 0;
+static volatile uint32 g_u32overflows_ms = 0;
+static volatile uint16 g_u16overflows_us = 0;
+/* it changes after every update of the time, its one byte is read in one
+ * instruction so it shows the time changed during reading its bytes */
+static volatile uint8 g_u8sequence = 0;
+
+/*******************************************************************************
+ *                           Static Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Timebase_overflow_ISR
+ *
+ * Description: 	count overflow of timer 3 and add its time.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Timebase_overflow_ISR(void);
+
+/*******************************************************************************
+ * Function Name:	Timebase_read
+ *
+ * Description: 	read the overflows and the counter of timer 3 as one time,
+ *                  the overflow which is pending because interrupts are
+ *                  disabled or the caller is interrupt is added to it.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u32overflows_ptr (uint32*) overflows of timer 3
+ *                  a_u16counter_ptr   (uint16*) counter of timer 3
+ *                  a_u32ms_ptr        (uint32*) milliseconds of the overflows
+ *                  a_u16us_ptr        (uint16*) microseconds over the milliseconds
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Timebase_read(uint32 * a_u32overflows_ptr , uint16 * a_u16counter_ptr ,
+                          uint32 * a_u32ms_ptr , uint16 * a_u16us_ptr);
+
+/*******************************************************************************
+ *                      Functions implementation                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Timebase_Initialization
+ *
+ * Description: 	start timer 3 as free running timer and count its overflows
+ *                  by its interrupt.
+ *                  note: timer 3 is the time base of CCP2 too, so its counter
+ *                        must not be written.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+void Timebase_Initialization(void)
+{
+    g_u32overflows = 0;
+    g_u32overflows_ms = 0;
+    g_u16overflows_us = 0;
+    Timer3_Initialization();
+    Timer3_set_callback_function(Timebase_overflow_ISR);
+    Timer3_enable_overflow_interrupt();
+    Timer3_enable();
+}
+
+/*******************************************************************************
+ * Function Name:	Timebase_now_ticks
+ *
+ * Description: 	get time since initialization in ticks, it wraps every
+ *                  35.8 minutes.
+ *                  note: it can be called from interrupts and from the main
+ *                        loop without disabling interrupts.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			time in ticks (uint32)
+ *******************************************************************************/
+uint32 Timebase_now_ticks(void)
+{
+    uint32 u32overflows = 0;
+    uint16 u16counter = 0;
+    uint32 u32ms = 0;
+    uint16 u16us = 0;
+    Timebase_read(&u32overflows , &u16counter , &u32ms , &u16us);
+    return (u32overflows << 16) | u16counter;
+}
+
+/*******************************************************************************
+ * Function Name:	Timebase_now_us
+ *
+ * Description: 	get time since initialization in microseconds, it wraps
+ *                  every 71.6 minutes.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			time in microseconds (uint32)
+ *******************************************************************************/
+uint32 Timebase_now_us(void)
+{
+    uint32 u32overflows = 0;
+    uint16 u16counter = 0;
+    uint32 u32ms = 0;
+    uint16 u16us = 0;
+    Timebase_read(&u32overflows , &u16counter , &u32ms , &u16us);
+    return (u32overflows << TIMEBASE_US_SHIFT) | (u16counter / TIMEBASE_TICKS_PER_US);
+}
+
+/*******************************************************************************
+ * Function Name:	Timebase_now_ms
+ *
+ * Description: 	get time since initialization in milliseconds, it wraps
+ *                  every 49.7 days.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			time in milliseconds (uint32)
+ *******************************************************************************/
+uint32 Timebase_now_ms(void)
+{
+    uint32 u32overflows = 0;
+    uint16 u16counter = 0;
+    uint32 u32ms = 0;
+    uint16 u16us = 0;
+    Timebase_read(&u32overflows , &u16counter , &u32ms , &u16us);
+    /* microseconds over the milliseconds are less than 40000 */
+    return u32ms + (((uint32)u16us * TIMEBASE_MS_RECIPROCAL) >> TIMEBASE_MS_SHIFT);
+}
+
+/*******************************************************************************
+ * Function Name:	Timebase_elapsed_us
+ *
+ * Description: 	get microseconds since time which is taken by
+ *                  Timebase_now_us, it is right over the wrap of the time.
+ *
+ * Inputs:			a_u32start_us     (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			elapsed microseconds (uint32)
+ *******************************************************************************/
+uint32 Timebase_elapsed_us(uint32 a_u32start_us)
+{
+    return Timebase_now_us() - a_u32start_us;
+}
+
+/*******************************************************************************
+ * Function Name:	Timebase_elapsed_ms
+ *
+ * Description: 	get milliseconds since time which is taken by
+ *                  Timebase_now_ms, it is right over the wrap of the time.
+ *
+ * Inputs:			a_u32start_ms     (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			elapsed milliseconds (uint32)
+ *******************************************************************************/
+uint32 Timebase_elapsed_ms(uint32 a_u32start_ms)
+{
+    return Timebase_now_ms() - a_u32start_ms;
+}
+
+/*******************************************************************************
+ * Function Name:	Timebase_deadline_ms
+ *
+ * Description: 	get deadline after timeout from now to check it later by
+ *                  Timebase_is_expired_ms.
+ *
+ * Inputs:			a_u32timeout_ms   (uint32) less than 24.8 days
+ *
+ * Outputs:			NULL
+ *
+ * Return:			deadline in milliseconds (uint32)
+ *******************************************************************************/
+uint32 Timebase_deadline_ms(uint32 a_u32timeout_ms)
+{
+    return Timebase_now_ms() + a_u32timeout_ms;
+}
+
+/*******************************************************************************
+ * Function Name:	Timebase_is_expired_ms
+ *
+ * Description: 	check if the time reached deadline which is taken by
+ *                  Timebase_deadline_ms.
+ *
+ * Inputs:			a_u32deadline_ms  (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE or FALSE (uint8)
+ *******************************************************************************/
+uint8 Timebase_is_expired_ms(uint32 a_u32deadline_ms)
+{
+    uint8 retVal = FALSE;
+    /* the difference is signed, so the deadline is right over the wrap */
+    if((sint32)(Timebase_now_ms() - a_u32deadline_ms) >= 0)
+    {
+        retVal = TRUE;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+ * Function Name:	Timebase_overflow_ISR
+ *
+ * Description: 	count overflow of timer 3 and add its time.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Timebase_overflow_ISR(void)
+{
+    g_u32overflows++;
+    g_u32overflows_ms += TIMEBASE_OVERFLOW_MS;
+    g_u16overflows_us += TIMEBASE_OVERFLOW_US;
+    if(g_u16overflows_us >= 1000u)
+    {
+        g_u16overflows_us -= 1000u;
+        g_u32overflows_ms++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    g_u8sequence++;
+}
+
+/*******************************************************************************
+ * Function Name:	Timebase_read
+ *
+ * Description: 	read the overflows and the counter of timer 3 as one time,
+ *                  the overflow which is pending because interrupts are
+ *                  disabled or the caller is interrupt is added to it.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			a_u32overflows_ptr (uint32*) overflows of timer 3
+ *                  a_u16counter_ptr   (uint16*) counter of timer 3
+ *                  a_u32ms_ptr        (uint32*) milliseconds of the overflows
+ *                  a_u16us_ptr        (uint16*) microseconds over the milliseconds
+ *
+ * Return:			NULL
+ *******************************************************************************/
+static void Timebase_read(uint32 * a_u32overflows_ptr , uint16 * a_u16counter_ptr ,
+                          uint32 * a_u32ms_ptr , uint16 * a_u16us_ptr)
+{
+    /* sequence of the time before reading it */
+    uint8 u8sequence = 0;
+    /* flag of overflow which isn't counted yet */
+    uint8 u8pending_flag = 0;
+    do
+    {
+        u8sequence = g_u8sequence;
+        *a_u32overflows_ptr = g_u32overflows;
+        *a_u32ms_ptr = g_u32overflows_ms;
+        *a_u16us_ptr = g_u16overflows_us;
+        *a_u16counter_ptr = Timer3_read_counter();
+        /* the flag is read after the counter, so the counter before the
+         * middle of the period is after this overflow */
+        u8pending_flag = GET_BIT(INTERRUPT_PERIPHERAL_FLAGS_2 , TIMER3_OVERFLOW_INTERRUPT_FLAG_BIT);
+    }while(u8sequence != g_u8sequence);
+    if(u8pending_flag != 0 && *a_u16counter_ptr < TIMEBASE_HALF_PERIOD)
+    {
+        (*a_u32overflows_ptr)++;
+        *a_u32ms_ptr += TIMEBASE_OVERFLOW_MS;
+        *a_u16us_ptr += TIMEBASE_OVERFLOW_US;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    *a_u16us_ptr += *a_u16counter_ptr / TIMEBASE_TICKS_PER_US;
+}
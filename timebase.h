@@ -0,0 +1,150 @@
+/*******************************************************************************
+ *
+ * File:                timebase.h
+ *
+ * Author:              Ahmed Eldakhly
+ *
+ * Comments:            it contains functions prototypes and definitions of
+ *                      monotonic time base module.
+ *
+ * Revision history:    27/3/2020
+ *
+ ******************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef TIMEBASE_H
+#define	TIMEBASE_H
+
+/*******************************************************************************
+ *                       	Included Libraries                                 *
+ *******************************************************************************/
+#include "stdtypes.h"
+
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+/* tick of the time base is count of timer 3 (Fosc / 4 without prescaler) */
+#define TIMEBASE_TICKS_PER_US           2u
+
+/*******************************************************************************
+ *                            Functions Prototype                              *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Function Name:	Timebase_Initialization
+ *
+ * Description: 	start timer 3 as free running timer and count its overflows
+ *                  by its interrupt.
+ *                  note: timer 3 is the time base of CCP2 too, so its counter
+ *                        must not be written.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Timebase_Initialization(void);
+
+/*******************************************************************************
+ * Function Name:	Timebase_now_ticks
+ *
+ * Description: 	get time since initialization in ticks, it wraps every
+ *                  35.8 minutes.
+ *                  note: it can be called from interrupts and from the main
+ *                        loop without disabling interrupts.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			time in ticks (uint32)
+ *******************************************************************************/
+extern uint32 Timebase_now_ticks(void);
+
+/*******************************************************************************
+ * Function Name:	Timebase_now_us
+ *
+ * Description: 	get time since initialization in microseconds, it wraps
+ *                  every 71.6 minutes.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			time in microseconds (uint32)
+ *******************************************************************************/
+extern uint32 Timebase_now_us(void);
+
+/*******************************************************************************
+ * Function Name:	Timebase_now_ms
+ *
+ * Description: 	get time since initialization in milliseconds, it wraps
+ *                  every 49.7 days.
+ *
+ * Inputs:			NULL
+ *
+ * Outputs:			NULL
+ *
+ * Return:			time in milliseconds (uint32)
+ *******************************************************************************/
+extern uint32 Timebase_now_ms(void);
+
+/*******************************************************************************
+ * Function Name:	Timebase_elapsed_us
+ *
+ * Description: 	get microseconds since time which is taken by
+ *                  Timebase_now_us, it is right over the wrap of the time.
+ *
+ * Inputs:			a_u32start_us     (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			elapsed microseconds (uint32)
+ *******************************************************************************/
+extern uint32 Timebase_elapsed_us(uint32 a_u32start_us);
+
+/*******************************************************************************
+ * Function Name:	Timebase_elapsed_ms
+ *
+ * Description: 	get milliseconds since time which is taken by
+ *                  Timebase_now_ms, it is right over the wrap of the time.
+ *
+ * Inputs:			a_u32start_ms     (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			elapsed milliseconds (uint32)
+ *******************************************************************************/
+extern uint32 Timebase_elapsed_ms(uint32 a_u32start_ms);
+
+/*******************************************************************************
+ * Function Name:	Timebase_deadline_ms
+ *
+ * Description: 	get deadline after timeout from now to check it later by
+ *                  Timebase_is_expired_ms.
+ *
+ * Inputs:			a_u32timeout_ms   (uint32) less than 24.8 days
+ *
+ * Outputs:			NULL
+ *
+ * Return:			deadline in milliseconds (uint32)
+ *******************************************************************************/
+extern uint32 Timebase_deadline_ms(uint32 a_u32timeout_ms);
+
+/*******************************************************************************
+ * Function Name:	Timebase_is_expired_ms
+ *
+ * Description: 	check if the time reached deadline which is taken by
+ *                  Timebase_deadline_ms.
+ *
+ * Inputs:			a_u32deadline_ms  (uint32)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			TRUE or FALSE (uint8)
+ *******************************************************************************/
+extern uint8 Timebase_is_expired_ms(uint32 a_u32deadline_ms);
+
+#endif	/* TIMEBASE_H */
@@ -5,7 +5,8 @@
  * Author:              Ahmed Eldakhly
  * 
  * Comments:            it contains functions implementation of all timers
- *                      peripherals.
+ *                      peripherals, the common functions of timers work by
+ *                      the constant descriptors table of their registers.
  * 
  * Revision history:    25/2/2020
  * 
@@ -18,306 +19,207 @@
 #include "timers_MemMap.h"
 #include "helped_macros.h"
 
-/********************************************************************************
- *                          Functions implementation							*
+/*******************************************************************************
+ *                              Definitions                                    *
  *******************************************************************************/
-/* check if timer 0 will used */
+/* bits of control register which are set by the configuration of the timer,
+ * their values, and the address of high byte which is zero if the counter
+ * is used as 8 bits, they are computed at build time */
 #if TIMER0 == TIMER_ENABLE
+#define TIMER0_CONTROL_MASK         0x7Fu
+#define TIMER0_CONTROL_VALUE        (((TIMER0_SIZE == TIMER_8BIT_SIZE) ? (1u << TIMER_0_8BIT_16BIT_SELECT) : 0u) | \
+        ((TIMER0_CLOCK_SOURCE != TIMER_INTERNAL_CLOCK) ? (1u << TIMER_0_CLOCK_SOURCE_SELECT) : 0u) | \
+        ((TIMER0_EDGE_TYPE_ON_TCKI == TIMER0_FALLING_EDGE_CLOCK_ON_TCKI) ? (1u << TIMER_0_SOURCE_EDGE_SELECT) : 0u) | \
+        ((TIMER0_PRESCALER == TIMER0_NO_PRESCALER) ? (1u << TIMER_0_PRESCALER_ENABLE_BIT) : (uint8)TIMER0_PRESCALER))
+#define TIMER0_HIGH_ADDRESS         ((TIMER0_SIZE == TIMER_16BIT_SIZE) ? TIMER_0_HIGH_ADDRESS : 0u)
+#else
+#define TIMER0_CONTROL_MASK         0u
+#define TIMER0_CONTROL_VALUE        0u
+#define TIMER0_HIGH_ADDRESS         0u
+#endif
 
-/********************************************************************************
- * Function Name:	Timer0_Initialization
- *
- * Description: 	Initialize timer 0 with specified configuration in 
- *                  configuration structure. 
- *
- * Inputs:			NULL
- *
- * Outputs:			NULL
- *
- * Return:			NULL
- *******************************************************************************/
-void Timer0_Initialization(void)
-{   /* select the timer counter will be 8 bits or 16 bits */
-    if(Timer0_config_t.timer_size_t == TIMER_8BIT_SIZE)
-    {
-        SET_BIT(TIMER_0_CONTROL_REG , TIMER_0_8BIT_16BIT_SELECT);
-    }
-    else
-    {
-        CLEAR_BIT(TIMER_0_CONTROL_REG , TIMER_0_8BIT_16BIT_SELECT);
-    }
-    /* select the timer clock source will be internal from micro_controller or input to T0CKI pin */
-    if(Timer0_config_t.timer_clock_source_t == TIMER_INTERNAL_CLOCK)
-    {
-        CLEAR_BIT(TIMER_0_CONTROL_REG , TIMER_0_CLOCK_SOURCE_SELECT);
-    }
-    else
-    {
-        SET_BIT(TIMER_0_CONTROL_REG , TIMER_0_CLOCK_SOURCE_SELECT);
-    }
-    /* select the edge of new count of timer when the timer clock is input pulses on T0CKI */
-    if(Timer0_config_t.timer_clock_source_t != TIMER_INTERNAL_CLOCK)
-    {
-        TIMER_0_CONTROL_REG &= 0xEF;
-        TIMER_0_CONTROL_REG |= Timer0_config_t.timer_edge_type_on_TCKI_t << 4;
-    }
-    else
-    {
-        /*Do nothing*/;
-    }
-    /* select timer pre scaler */
-    if(Timer0_config_t.timer_prescaler_t != TIMER0_NO_PRESCALER)
-    {
-        TIMER_0_CONTROL_REG &= 0xF0;
-        TIMER_0_CONTROL_REG |= Timer0_config_t.timer_prescaler_t;
-    }
-    else
-    {
-        TIMER_0_CONTROL_REG |= 0x08;
-    }
-}
+#if TIMER1 == TIMER_ENABLE
+#define TIMER1_CONTROL_MASK         ((1u << TIMER_1_8BIT_16BIT_SELECT) | (3u << TIMER_1_PRESCALER_SELECT_BIT_0) | \
+        (1u << TIMER_1_EXTERNAL_CLOCK_SYNC_BIT_ACTIVE_LOW) | (1u << TIMER_1_CLOCK_SOURCE_SELECT))
+#define TIMER1_CONTROL_VALUE        (((TIMER1_SIZE == TIMER_8BIT_SIZE) ? (1u << TIMER_1_8BIT_16BIT_SELECT) : 0u) | \
+        ((uint8)TIMER1_PRESCALER << TIMER_1_PRESCALER_SELECT_BIT_0) | \
+        ((TIMER1_EXTERNAL_CLOCK_SYNC == TIMER1_NOT_SYNC_WITH_EXTERNAL_CLOCK) ? (1u << TIMER_1_EXTERNAL_CLOCK_SYNC_BIT_ACTIVE_LOW) : 0u) | \
+        ((TIMER1_CLOCK_SOURCE != TIMER_INTERNAL_CLOCK) ? (1u << TIMER_1_CLOCK_SOURCE_SELECT) : 0u))
+#define TIMER1_HIGH_ADDRESS         ((TIMER1_SIZE == TIMER_16BIT_SIZE) ? TIMER_1_HIGH_ADDRESS : 0u)
+#else
+#define TIMER1_CONTROL_MASK         0u
+#define TIMER1_CONTROL_VALUE        0u
+#define TIMER1_HIGH_ADDRESS         0u
+#endif
 
-/********************************************************************************
- * Function Name:	Timer0_enable
- *
- * Description: 	enable timer 0 to start counting. 
- *
- * Inputs:			NULL
- *
- * Outputs:			NULL
- *
- * Return:			NULL
- *******************************************************************************/
-void Timer0_enable(void)
-{
-    SET_BIT(TIMER_0_CONTROL_REG , TIMER_0_ON_OFF_BIT);
-}
+#if TIMER3 == TIMER_ENABLE
+#define TIMER3_CONTROL_MASK         ((1u << TIMER_3_8BIT_16BIT_SELECT) | (3u << TIMER_3_PRESCALER_SELECT_BIT_0) | \
+        (1u << TIMER_3_EXTERNAL_CLOCK_SYNC_BIT_ACTIVE_LOW) | (1u << TIMER_3_CLOCK_SOURCE_SELECT))
+#define TIMER3_CONTROL_VALUE        (((TIMER3_SIZE == TIMER_8BIT_SIZE) ? (1u << TIMER_3_8BIT_16BIT_SELECT) : 0u) | \
+        ((uint8)TIMER3_PRESCALER << TIMER_3_PRESCALER_SELECT_BIT_0) | \
+        ((TIMER3_EXTERNAL_CLOCK_SYNC == TIMER3_NOT_SYNC_WITH_EXTERNAL_CLOCK) ? (1u << TIMER_3_EXTERNAL_CLOCK_SYNC_BIT_ACTIVE_LOW) : 0u) | \
+        ((TIMER3_CLOCK_SOURCE != TIMER_INTERNAL_CLOCK) ? (1u << TIMER_3_CLOCK_SOURCE_SELECT) : 0u))
+#define TIMER3_HIGH_ADDRESS         ((TIMER3_SIZE == TIMER_16BIT_SIZE) ? TIMER_3_HIGH_ADDRESS : 0u)
+#else
+#define TIMER3_CONTROL_MASK         0u
+#define TIMER3_CONTROL_VALUE        0u
+#define TIMER3_HIGH_ADDRESS         0u
+#endif
 
-/********************************************************************************
- * Function Name:	Timer0_disable
- *
- * Description: 	disable timer 0 to stop counting. 
- *
- * Inputs:			NULL
- *
- * Outputs:			NULL
- *
- * Return:			NULL
+/*******************************************************************************
+ *                              Types Declaration                              *
  *******************************************************************************/
-void Timer0_disable(void)
-{
-    CLEAR_BIT(TIMER_0_CONTROL_REG , TIMER_0_ON_OFF_BIT);
-}
 
-/********************************************************************************
- * Function Name:	Timer0_read_counter
- *
- * Description: 	read the number has been counted from zero by timer 0. 
- *
- * Inputs:			NULL
- *
- * Outputs:			NULL
- *
- * Return:			uint16       number of counts
- *******************************************************************************/
-uint16 Timer0_read_counter(void)
-{
-    uint16 retVal;
-    /* check if timer counter size 8 bits or 16 bits */
-    if(Timer0_config_t.timer_size_t == TIMER_8BIT_SIZE)
-    {
-        retVal = TIMER_0_LOW_REG;
-    }
-    else
-    {
-        retVal = TIMER_0_LOW_REG;
-        retVal |= ((uint16)TIMER_0_HIGH_REG) << 8;
-    }
-    return retVal;
-}
+/*************************** StrTimer_descriptor_t *****************************/
+typedef struct{
+    uint16 u16control_address;
+    uint16 u16low_address;
+    uint16 u16high_address;             /* zero if the counter is used as 8 bits */
+    uint8  u8on_bit;
+    uint8  u8control_mask;              /* bits which are set by Timer_Initialization */
+    uint8  u8control_value;
+}StrTimer_descriptor_t;
+
+/*******************************************************************************
+ *                           Static Variables                                  *
+ *******************************************************************************/
+/* registers of timers which is ordered by EnumTimer_id_t, it is stored in
+ * program flash to not waste RAM */
+static const StrTimer_descriptor_t g_timers_arr[] = {
+    {TIMER_0_CONTROL_ADDRESS , TIMER_0_LOW_ADDRESS , TIMER0_HIGH_ADDRESS , TIMER_0_ON_OFF_BIT ,
+            TIMER0_CONTROL_MASK , TIMER0_CONTROL_VALUE},
+    {TIMER_1_CONTROL_ADDRESS , TIMER_1_LOW_ADDRESS , TIMER1_HIGH_ADDRESS , TIMER_1_ON_OFF_BIT ,
+            TIMER1_CONTROL_MASK , TIMER1_CONTROL_VALUE},
+    /* configuration of timer 2 is changed by PWM module so it's set by Timer2_Initialization */
+    {TIMER_2_CONTROL_ADDRESS , TIMER_2_COUNTER_ADDRESS , 0u , TIMER_2_ON_OFF_BIT ,
+            0u , 0u},
+    {TIMER_3_CONTROL_ADDRESS , TIMER_3_LOW_ADDRESS , TIMER3_HIGH_ADDRESS , TIMER_3_ON_OFF_BIT ,
+            TIMER3_CONTROL_MASK , TIMER3_CONTROL_VALUE}
+};
 
 /********************************************************************************
- * Function Name:	Timer0_write_counter
- *
- * Description: 	write user value in timer 0 counter to start count from this
- *                  number. 
- *
- * Inputs:			uint16       user number to put in timer counter
- *
- * Outputs:			NULL
- *
- * Return:			NULL
+ *                          Functions implementation							*
  *******************************************************************************/
-void Timer0_write_counter(uint16 a_u16init_value_for_timer)
-{
-    /* check if timer counter size 8 bits or 16 bits */
-    if(Timer0_config_t.timer_size_t == TIMER_8BIT_SIZE)
-    {
-        TIMER_0_LOW_REG = (uint8)a_u16init_value_for_timer;
-    }
-    else
-    {
-        TIMER_0_HIGH_REG = a_u16init_value_for_timer >> 8;
-        TIMER_0_LOW_REG = (uint8)a_u16init_value_for_timer;
-    }
-}
-#endif
-
-/* check if timer 1 will used */
-#if TIMER1 == TIMER_ENABLE
 
 /********************************************************************************
- * Function Name:	Timer1_Initialization
+ * Function Name:	Timer_Initialization
  *
- * Description: 	Initialize timer 1 with specified configuration in 
- *                  configuration structure. 
+ * Description: 	Initialize timer with its configuration in timers_config.h,
+ *                  the other bits of its control register aren't changed. 
  *
- * Inputs:			NULL
+ * Inputs:			a_timer_id        (EnumTimer_id_t)
  *
  * Outputs:			NULL
  *
  * Return:			NULL
  *******************************************************************************/
-void Timer1_Initialization(void)
+void Timer_Initialization(EnumTimer_id_t a_timer_id)
 {
-    /* select the timer counter will be 8 bits or 16 bits */
-    if(Timer1_config_t.timer_size_t == TIMER_8BIT_SIZE)
-    {
-        SET_BIT(TIMER_1_CONTROL_REG , TIMER_1_8BIT_16BIT_SELECT);
-    }
-    else
-    {
-        CLEAR_BIT(TIMER_1_CONTROL_REG , TIMER_1_8BIT_16BIT_SELECT);
-    }
-    /* select the timer clock source will be internal from micro_controller or input to T13CKI pin */
-    if(Timer1_config_t.timer_clock_source_t == TIMER_INTERNAL_CLOCK)
-    {
-        CLEAR_BIT(TIMER_1_CONTROL_REG , TIMER_1_CLOCK_SOURCE_SELECT);
-    }
-    else
-    {
-        SET_BIT(TIMER_1_CONTROL_REG , TIMER_1_CLOCK_SOURCE_SELECT);
-    }
-    /* choose if the clock will Synchronize or not when the timer clock is input pulses on T13CKI */
-    if(Timer1_config_t.timer_clock_source_t != TIMER_INTERNAL_CLOCK)
-    {
-        TIMER_1_CONTROL_REG &= 0xFB;
-        TIMER_1_CONTROL_REG |= Timer1_config_t.timer_sync_with_external_clock << 2;
-    }
-    else
-    {
-        /*Do nothing*/;
-    }
-    /* select timer pre scaler */
-    switch(Timer1_config_t.timer_prescaler_t)
-    {
-        case TIMER1_NO_PRESCALER:
-            CLEAR_BIT(TIMER_1_CONTROL_REG , TIMER_1_PRESCALER_SELECT_BIT_1);
-            CLEAR_BIT(TIMER_1_CONTROL_REG , TIMER_1_PRESCALER_SELECT_BIT_0);
-            break;
-        case TIMER1_PRESCALER_2:
-            CLEAR_BIT(TIMER_1_CONTROL_REG , TIMER_1_PRESCALER_SELECT_BIT_1);
-            SET_BIT(TIMER_1_CONTROL_REG , TIMER_1_PRESCALER_SELECT_BIT_0);
-            break;
-        case TIMER1_PRESCALER_4:
-            SET_BIT(TIMER_1_CONTROL_REG , TIMER_1_PRESCALER_SELECT_BIT_1);
-            CLEAR_BIT(TIMER_1_CONTROL_REG , TIMER_1_PRESCALER_SELECT_BIT_0);
-            break;
-        case TIMER1_PRESCALER_8:
-            SET_BIT(TIMER_1_CONTROL_REG , TIMER_1_PRESCALER_SELECT_BIT_1);
-            SET_BIT(TIMER_1_CONTROL_REG , TIMER_1_PRESCALER_SELECT_BIT_0);
-            break;
-        default:
-            /*Do nothing*/
-            break;
-    }
+    const StrTimer_descriptor_t * timer_ptr = &g_timers_arr[a_timer_id];
+    REGISTER_8BIT(timer_ptr->u16control_address) =
+            (REGISTER_8BIT(timer_ptr->u16control_address) & (uint8)~timer_ptr->u8control_mask) |
+            timer_ptr->u8control_value;
 }
 
 /********************************************************************************
- * Function Name:	Timer1_enable
+ * Function Name:	Timer_enable
  *
- * Description: 	enable timer 1 to start counting. 
+ * Description: 	enable timer to start counting. 
  *
- * Inputs:			NULL
+ * Inputs:			a_timer_id        (EnumTimer_id_t)
  *
  * Outputs:			NULL
  *
  * Return:			NULL
  *******************************************************************************/
-void Timer1_enable(void)
+void Timer_enable(EnumTimer_id_t a_timer_id)
 {
-    SET_BIT(TIMER_1_CONTROL_REG , TIMER_1_ON_OFF_BIT);
+    SET_BIT(REGISTER_8BIT(g_timers_arr[a_timer_id].u16control_address) , g_timers_arr[a_timer_id].u8on_bit);
 }
 
 /********************************************************************************
- * Function Name:	Timer1_disable
+ * Function Name:	Timer_disable
  *
- * Description: 	disable timer 1 to stop counting. 
+ * Description: 	disable timer to stop counting. 
  *
- * Inputs:			NULL
+ * Inputs:			a_timer_id        (EnumTimer_id_t)
  *
  * Outputs:			NULL
  *
  * Return:			NULL
  *******************************************************************************/
-void Timer1_disable(void)
+void Timer_disable(EnumTimer_id_t a_timer_id)
 {
-    CLEAR_BIT(TIMER_1_CONTROL_REG , TIMER_1_ON_OFF_BIT);
+    CLEAR_BIT(REGISTER_8BIT(g_timers_arr[a_timer_id].u16control_address) , g_timers_arr[a_timer_id].u8on_bit);
 }
 
 /********************************************************************************
- * Function Name:	Timer1_read_counter
+ * Function Name:	Timer_read_counter
  *
- * Description: 	read the number has been counted from zero by timer 1. 
+ * Description: 	read the number has been counted from zero by timer, the
+ *                  two bytes of 16 bits counter are from the same count. 
  *
- * Inputs:			NULL
+ * Inputs:			a_timer_id        (EnumTimer_id_t)
  *
  * Outputs:			NULL
  *
  * Return:			uint16       number of counts
  *******************************************************************************/
-uint16 Timer1_read_counter(void)
+uint16 Timer_read_counter(EnumTimer_id_t a_timer_id)
 {
-    uint16 retVal;
-    /* check if timer counter size 8 bits or 16 bits */
-    if(Timer1_config_t.timer_size_t == TIMER_8BIT_SIZE)
+    const StrTimer_descriptor_t * timer_ptr = &g_timers_arr[a_timer_id];
+    /* low byte of the count which is read with the high byte */
+    uint8 u8low_byte = 0;
+    uint16 retVal = 0;
+    if(timer_ptr->u16high_address == 0u)
     {
-        retVal = TIMER_1_LOW_REG;
+        retVal = REGISTER_8BIT(timer_ptr->u16low_address);
     }
     else
     {
-        retVal = TIMER_1_LOW_REG;
-        retVal |= ((uint16)TIMER_1_HIGH_REG) << 8;
+        /* the low byte is read first because it latches the high byte in the
+         * buffered modes, the read is repeated if the low byte overflowed
+         * to the high byte before reading it in the other modes */
+        do
+        {
+            u8low_byte = REGISTER_8BIT(timer_ptr->u16low_address);
+            retVal = ((uint16)REGISTER_8BIT(timer_ptr->u16high_address) << 8) | u8low_byte;
+        }while(REGISTER_8BIT(timer_ptr->u16low_address) < u8low_byte);
     }
     return retVal;
 }
 
 /********************************************************************************
- * Function Name:	Timer1_write_counter
+ * Function Name:	Timer_write_counter
  *
- * Description: 	write user value in timer 1 counter to start count from this
+ * Description: 	write user value in timer counter to start count from this
  *                  number. 
  *
- * Inputs:			uint16       user number to put in timer counter
+ * Inputs:			a_timer_id        (EnumTimer_id_t)
+ *                  uint16       user number to put in timer counter
  *
  * Outputs:			NULL
  *
  * Return:			NULL
  *******************************************************************************/
-void Timer1_write_counter(uint16 a_u16init_value_for_timer)
+void Timer_write_counter(EnumTimer_id_t a_timer_id , uint16 a_u16init_value_for_timer)
 {
-    /* check if timer counter size 8 bits or 16 bits */
-    if(Timer1_config_t.timer_size_t == TIMER_8BIT_SIZE)
+    const StrTimer_descriptor_t * timer_ptr = &g_timers_arr[a_timer_id];
+    /* high byte is written first, it is written to the counter with the low byte */
+    if(timer_ptr->u16high_address != 0u)
     {
-        TIMER_1_LOW_REG = (uint8)a_u16init_value_for_timer;
+        REGISTER_8BIT(timer_ptr->u16high_address) = a_u16init_value_for_timer >> 8;
     }
     else
     {
-        TIMER_1_HIGH_REG = a_u16init_value_for_timer >> 8;
-        TIMER_1_LOW_REG = (uint8)a_u16init_value_for_timer;
+        /* Do nothing */
     }
+    REGISTER_8BIT(timer_ptr->u16low_address) = (uint8)a_u16init_value_for_timer;
 }
 
+/* check if timer 1 will used */
+#if TIMER1 == TIMER_ENABLE
+
 /********************************************************************************
  * Function Name:	Timer1_used_for_both_CCP_modules
  *
@@ -442,71 +344,6 @@ void Timer2_Initialization(void)
     TIMER_2_CONTROL_REG |= Timer2_config_t.timer_prescaler_t;
 }
 
-/********************************************************************************
- * Function Name:	Timer2_enable
- *
- * Description: 	enable timer 2 to start counting. 
- *
- * Inputs:			NULL
- *
- * Outputs:			NULL
- *
- * Return:			NULL
- *******************************************************************************/
-void Timer2_enable(void)
-{
-    SET_BIT(TIMER_2_CONTROL_REG , TIMER_2_ON_OFF_BIT);
-}
-
-/********************************************************************************
- * Function Name:	Timer2_disable
- *
- * Description: 	disable timer 2 to stop counting. 
- *
- * Inputs:			NULL
- *
- * Outputs:			NULL
- *
- * Return:			NULL
- *******************************************************************************/
-void Timer2_disable(void)
-{
-    CLEAR_BIT(TIMER_2_CONTROL_REG , TIMER_2_ON_OFF_BIT);
-}
-
-/********************************************************************************
- * Function Name:	Timer2_read_counter
- *
- * Description: 	read the number has been counted from zero by timer 2. 
- *
- * Inputs:			NULL
- *
- * Outputs:			NULL
- *
- * Return:			uint8       number of counts
- *******************************************************************************/
-uint8 Timer2_read_counter(void)
-{
-    return TIMER_2_REG;
-}
-
-/********************************************************************************
- * Function Name:	Timer2_write_counter
- *
- * Description: 	write user value in timer 2 counter to start count from this
- *                  number. 
- *
- * Inputs:			uint8       user number to put in timer counter
- *
- * Outputs:			NULL
- *
- * Return:			NULL
- *******************************************************************************/
-void Timer2_write_counter(uint8 a_u8init_value_for_timer)
-{
-    TIMER_2_REG = a_u8init_value_for_timer;
-}
-
 /********************************************************************************
  * Function Name:	Timer2_read_period_register
  *
@@ -545,158 +382,6 @@ void Timer2_write_period_register(uint8 a_u8init_value_for_period_register)
 /* check if timer 3 will used */
 #if TIMER3 == TIMER_ENABLE
 
-/********************************************************************************
- * Function Name:	Timer3_Initialization
- *
- * Description: 	Initialize timer 3 with specified configuration in 
- *                  configuration structure. 
- *
- * Inputs:			NULL
- *
- * Outputs:			NULL
- *
- * Return:			NULL
- *******************************************************************************/
-void Timer3_Initialization(void)
-{
-    /* select the timer counter will be 8 bits or 16 bits */
-    if(Timer3_config_t.timer_size_t == TIMER_8BIT_SIZE)
-    {
-        SET_BIT(TIMER_3_CONTROL_REG , TIMER_3_8BIT_16BIT_SELECT);
-    }
-    else
-    {
-        CLEAR_BIT(TIMER_3_CONTROL_REG , TIMER_3_8BIT_16BIT_SELECT);
-    }
-    /* select the timer clock source will be internal from micro_controller or input to T13CKI pin */
-    if(Timer3_config_t.timer_clock_source_t == TIMER_INTERNAL_CLOCK)
-    {
-        CLEAR_BIT(TIMER_3_CONTROL_REG , TIMER_3_CLOCK_SOURCE_SELECT);
-    }
-    else
-    {
-        SET_BIT(TIMER_3_CONTROL_REG , TIMER_3_CLOCK_SOURCE_SELECT);
-    }
-    /* choose if the clock will Synchronize or not when the timer clock is input pulses on T13CKI */
-    if(Timer3_config_t.timer_clock_source_t != TIMER_INTERNAL_CLOCK)
-    {
-        TIMER_3_CONTROL_REG &= 0xFB;
-        TIMER_3_CONTROL_REG |= Timer3_config_t.timer_sync_with_external_clock << 2;
-    }
-    else
-    {
-        /*Do nothing*/;
-    }
-    /* select timer pre scaler */
-    switch(Timer3_config_t.timer_prescaler_t)
-    {
-        case TIMER3_NO_PRESCALER:
-            CLEAR_BIT(TIMER_3_CONTROL_REG , TIMER_3_PRESCALER_SELECT_BIT_1);
-            CLEAR_BIT(TIMER_3_CONTROL_REG , TIMER_3_PRESCALER_SELECT_BIT_0);
-            break;
-        case TIMER3_PRESCALER_2:
-            CLEAR_BIT(TIMER_3_CONTROL_REG , TIMER_3_PRESCALER_SELECT_BIT_1);
-            SET_BIT(TIMER_3_CONTROL_REG , TIMER_3_PRESCALER_SELECT_BIT_0);
-            break;
-        case TIMER3_PRESCALER_4:
-            SET_BIT(TIMER_3_CONTROL_REG , TIMER_3_PRESCALER_SELECT_BIT_1);
-            CLEAR_BIT(TIMER_3_CONTROL_REG , TIMER_3_PRESCALER_SELECT_BIT_0);
-            break;
-        case TIMER3_PRESCALER_8:
-            SET_BIT(TIMER_3_CONTROL_REG , TIMER_3_PRESCALER_SELECT_BIT_1);
-            SET_BIT(TIMER_3_CONTROL_REG , TIMER_3_PRESCALER_SELECT_BIT_0);
-            break;
-        default:
-            /*Do nothing*/
-            break;
-    }
-}
-
-/********************************************************************************
- * Function Name:	Timer3_enable
- *
- * Description: 	enable timer 3 to start counting. 
- *
- * Inputs:			NULL
- *
- * Outputs:			NULL
- *
- * Return:			NULL
- *******************************************************************************/
-void Timer3_enable(void)
-{
-    SET_BIT(TIMER_3_CONTROL_REG , TIMER_3_ON_OFF_BIT);
-}
-
-/********************************************************************************
- * Function Name:	Timer3_disable
- *
- * Description: 	disable timer 3 to stop counting. 
- *
- * Inputs:			NULL
- *
- * Outputs:			NULL
- *
- * Return:			NULL
- *******************************************************************************/
-void Timer3_disable(void)
-{
-    CLEAR_BIT(TIMER_3_CONTROL_REG , TIMER_3_ON_OFF_BIT);
-}
-
-/********************************************************************************
- * Function Name:	Timer3_read_counter
- *
- * Description: 	read the number has been counted from zero by timer 3. 
- *
- * Inputs:			NULL
- *
- * Outputs:			NULL
- *
- * Return:			uint16       number of counts
- *******************************************************************************/
-uint16 Timer3_read_counter(void)
-{
-    uint16 retVal;
-    /* check if timer counter size 8 bits or 16 bits */
-    if(Timer3_config_t.timer_size_t == TIMER_8BIT_SIZE)
-    {
-        retVal = TIMER_3_LOW_REG;
-    }
-    else
-    {
-        retVal = TIMER_3_LOW_REG;
-        retVal |= ((uint16)TIMER_3_HIGH_REG) << 8;
-    }
-    return retVal;
-}
-
-/********************************************************************************
- * Function Name:	Timer3_write_counter
- *
- * Description: 	write user value in timer 3 counter to start count from this
- *                  number. 
- *
- * Inputs:			uint16       user number to put in timer counter
- *
- * Outputs:			NULL
- *
- * Return:			NULL
- *******************************************************************************/
-void Timer3_write_counter(uint16 a_u16init_value_for_timer)
-{
-    /* check if timer counter size 8 bits or 16 bits */
-    if(Timer3_config_t.timer_size_t == TIMER_8BIT_SIZE)
-    {
-        TIMER_3_LOW_REG = (uint8)a_u16init_value_for_timer;
-    }
-    else
-    {
-        TIMER_3_HIGH_REG = a_u16init_value_for_timer >> 8;
-        TIMER_3_LOW_REG = (uint8)a_u16init_value_for_timer;
-    }
-}
-
 /********************************************************************************
  * Function Name:	Timer3_used_for_both_CCP_modules
  *
@@ -41,6 +41,91 @@ typedef enum{
 
 #endif
 
+/****************************** EnumTimer_id_t *********************************/
+/* index of timer in the descriptors table of timers.c */
+typedef enum{
+            TIMER_ID_0,
+            TIMER_ID_1,
+            TIMER_ID_2,
+            TIMER_ID_3
+}EnumTimer_id_t;
+
+/********************************************************************************
+ *                          Functions Prototypes							    *
+ *******************************************************************************/
+/* common functions of all timers, the functions of every timer below are
+ * macros which call them with the id of the timer */
+
+/********************************************************************************
+ * Function Name:	Timer_Initialization
+ *
+ * Description: 	Initialize timer with its configuration in timers_config.h,
+ *                  the other bits of its control register aren't changed.
+ *                  note: timer 2 is initialized by Timer2_Initialization.
+ *
+ * Inputs:			a_timer_id        (EnumTimer_id_t)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Timer_Initialization(EnumTimer_id_t a_timer_id);
+
+/********************************************************************************
+ * Function Name:	Timer_enable
+ *
+ * Description: 	enable timer to start counting. 
+ *
+ * Inputs:			a_timer_id        (EnumTimer_id_t)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Timer_enable(EnumTimer_id_t a_timer_id);
+
+/********************************************************************************
+ * Function Name:	Timer_disable
+ *
+ * Description: 	disable timer to stop counting. 
+ *
+ * Inputs:			a_timer_id        (EnumTimer_id_t)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Timer_disable(EnumTimer_id_t a_timer_id);
+
+/********************************************************************************
+ * Function Name:	Timer_read_counter
+ *
+ * Description: 	read the number has been counted from zero by timer, the
+ *                  two bytes of 16 bits counter are from the same count.
+ *
+ * Inputs:			a_timer_id        (EnumTimer_id_t)
+ *
+ * Outputs:			NULL
+ *
+ * Return:			uint16       number of counts
+ *******************************************************************************/
+extern uint16 Timer_read_counter(EnumTimer_id_t a_timer_id);
+
+/********************************************************************************
+ * Function Name:	Timer_write_counter
+ *
+ * Description: 	write user value in timer counter to start count from this
+ *                  number, the high byte is ignored by 8 bits counter. 
+ *
+ * Inputs:			a_timer_id        (EnumTimer_id_t)
+ *                  uint16       user number to put in timer counter
+ *
+ * Outputs:			NULL
+ *
+ * Return:			NULL
+ *******************************************************************************/
+extern void Timer_write_counter(EnumTimer_id_t a_timer_id , uint16 a_u16init_value_for_timer);
+
 /* check if timer 0 will used */
 #if TIMER0 == TIMER_ENABLE
 
@@ -64,20 +149,6 @@ typedef enum{
             TIMER0_NO_TRANSITION_ON_TCKI
 }EnumTimer0_edgeTypeOn_TCKI_t;
 
-/***************************** StrTimer0_config_t ******************************/
-typedef struct{
-            EnumTimer0_prescaler_t          timer_prescaler_t;
-            EnumTimer_regesterSize_t        timer_size_t;
-            EnumTimer_clockSource_t         timer_clock_source_t;
-            EnumTimer0_edgeTypeOn_TCKI_t    timer_edge_type_on_TCKI_t;
-}StrTimer0_config_t;
-
-/*******************************************************************************
- *                           extern Variables                                  *
- *******************************************************************************/
-/* structure of timer 0 configuration that the user will set */
-extern StrTimer0_config_t Timer0_config_t;
-
 /********************************************************************************
  *                          Functions implementation							*
  *******************************************************************************/
@@ -85,8 +156,8 @@ extern StrTimer0_config_t Timer0_config_t;
 /********************************************************************************
  * Function Name:	Timer0_Initialization
  *
- * Description: 	Initialize timer 0 with specified configuration in 
- *                  configuration structure.Initialize timer 0 with specified configuration in configuration structure. 
+ * Description: 	Initialize timer 0 with its configuration in
+ *                  timers_config.h. 
  *
  * Inputs:			NULL
  *
@@ -94,7 +165,7 @@ extern StrTimer0_config_t Timer0_config_t;
  *
  * Return:			NULL
  *******************************************************************************/
-extern void Timer0_Initialization(void);
+#define Timer0_Initialization()                    Timer_Initialization(TIMER_ID_0)
 
 /********************************************************************************
  * Function Name:	Timer0_enable
@@ -107,7 +178,7 @@ extern void Timer0_Initialization(void);
  *
  * Return:			NULL
  *******************************************************************************/
-extern void Timer0_enable(void);
+#define Timer0_enable()                            Timer_enable(TIMER_ID_0)
 
 /********************************************************************************
  * Function Name:	Timer0_disable
@@ -120,7 +191,7 @@ extern void Timer0_enable(void);
  *
  * Return:			NULL
  *******************************************************************************/
-extern void Timer0_disable(void);
+#define Timer0_disable()                           Timer_disable(TIMER_ID_0)
 
 /********************************************************************************
  * Function Name:	Timer0_read_counter
@@ -133,7 +204,7 @@ extern void Timer0_disable(void);
  *
  * Return:			uint16       number of counts
  *******************************************************************************/
-extern uint16 Timer0_read_counter(void);
+#define Timer0_read_counter()                      Timer_read_counter(TIMER_ID_0)
 
 /********************************************************************************
  * Function Name:	Timer0_write_counter
@@ -147,7 +218,8 @@ extern uint16 Timer0_read_counter(void);
  *
  * Return:			NULL
  *******************************************************************************/
-extern void Timer0_write_counter(uint16 a_u16init_value_for_timer);
+#define Timer0_write_counter(a_u16init_value_for_timer) \
+        Timer_write_counter(TIMER_ID_0 , (a_u16init_value_for_timer))
 #endif
 
 /* check if timer 1 will used */
@@ -172,20 +244,6 @@ typedef enum{
             TIMER1_NO_EXTERNAL_CLOCK
 }EnumTimer1_sync_with_external_clock_t;
 
-/***************************** StrTimer1_config_t ******************************/
-typedef struct{
-            EnumTimer1_prescaler_t                  timer_prescaler_t;
-            EnumTimer_regesterSize_t                timer_size_t;
-            EnumTimer_clockSource_t                 timer_clock_source_t;
-            EnumTimer1_sync_with_external_clock_t   timer_sync_with_external_clock;
-}StrTimer1_config_t;
-
-/*******************************************************************************
- *                           extern Variables                                  *
- *******************************************************************************/
-/* structure of timer 1 configuration that the user will set */
-extern StrTimer1_config_t Timer1_config_t;
-
 /********************************************************************************
  *                          Functions implementation							*
  *******************************************************************************/
@@ -193,8 +251,8 @@ extern StrTimer1_config_t Timer1_config_t;
 /********************************************************************************
  * Function Name:	Timer1_Initialization
  *
- * Description: 	Initialize timer 1 with specified configuration in 
- *                  configuration structure. 
+ * Description: 	Initialize timer 1 with its configuration in
+ *                  timers_config.h. 
  *
  * Inputs:			NULL
  *
@@ -202,7 +260,7 @@ extern StrTimer1_config_t Timer1_config_t;
  *
  * Return:			NULL
  *******************************************************************************/
-extern void Timer1_Initialization(void);
+#define Timer1_Initialization()                    Timer_Initialization(TIMER_ID_1)
 
 /********************************************************************************
  * Function Name:	Timer1_enable
@@ -215,7 +273,7 @@ extern void Timer1_Initialization(void);
  *
  * Return:			NULL
  *******************************************************************************/
-extern void Timer1_enable(void);
+#define Timer1_enable()                            Timer_enable(TIMER_ID_1)
 
 /********************************************************************************
  * Function Name:	Timer1_disable
@@ -228,7 +286,7 @@ extern void Timer1_enable(void);
  *
  * Return:			NULL
  *******************************************************************************/
-extern void Timer1_disable(void);
+#define Timer1_disable()                           Timer_disable(TIMER_ID_1)
 
 /********************************************************************************
  * Function Name:	Timer1_read_counter
@@ -241,7 +299,7 @@ extern void Timer1_disable(void);
  *
  * Return:			uint16       number of counts
  *******************************************************************************/
-extern uint16 Timer1_read_counter(void);
+#define Timer1_read_counter()                      Timer_read_counter(TIMER_ID_1)
 
 /********************************************************************************
  * Function Name:	Timer1_write_counter
@@ -255,7 +313,8 @@ extern uint16 Timer1_read_counter(void);
  *
  * Return:			NULL
  *******************************************************************************/
-extern void Timer1_write_counter(uint16 a_u16init_value_for_timer);
+#define Timer1_write_counter(a_u16init_value_for_timer) \
+        Timer_write_counter(TIMER_ID_1 , (a_u16init_value_for_timer))
 
 /********************************************************************************
  * Function Name:	Timer1_used_for_both_CCP_modules
@@ -413,7 +472,7 @@ extern void Timer2_Initialization(void);
  *
  * Return:			NULL
  *******************************************************************************/
-extern void Timer2_enable(void);
+#define Timer2_enable()                            Timer_enable(TIMER_ID_2)
 
 /********************************************************************************
  * Function Name:	Timer2_disable
@@ -426,7 +485,7 @@ extern void Timer2_enable(void);
  *
  * Return:			NULL
  *******************************************************************************/
-extern void Timer2_disable(void);
+#define Timer2_disable()                           Timer_disable(TIMER_ID_2)
 
 /********************************************************************************
  * Function Name:	Timer2_read_counter
@@ -439,7 +498,7 @@ extern void Timer2_disable(void);
  *
  * Return:			uint8       number of counts
  *******************************************************************************/
-extern uint8 Timer2_read_counter(void);
+#define Timer2_read_counter()                      ((uint8)Timer_read_counter(TIMER_ID_2))
 
 /********************************************************************************
  * Function Name:	Timer2_write_counter
@@ -453,7 +512,8 @@ extern uint8 Timer2_read_counter(void);
  *
  * Return:			NULL
  *******************************************************************************/
-extern void Timer2_write_counter(uint8 a_u8init_value_for_timer);
+#define Timer2_write_counter(a_u8init_value_for_timer) \
+        Timer_write_counter(TIMER_ID_2 , (uint8)(a_u8init_value_for_timer))
 
 /********************************************************************************
  * Function Name:	Timer2_read_period_register
@@ -505,20 +565,6 @@ typedef enum{
             TIMER3_NO_EXTERNAL_CLOCK
 }EnumTimer3_sync_with_external_clock_t;
 
-/***************************** StrTimer3_config_t ******************************/
-typedef struct{
-            EnumTimer3_prescaler_t                  timer_prescaler_t;
-            EnumTimer_regesterSize_t                timer_size_t;
-            EnumTimer_clockSource_t                 timer_clock_source_t;
-            EnumTimer3_sync_with_external_clock_t   timer_sync_with_external_clock;
-}StrTimer3_config_t;
-
-/*******************************************************************************
- *                           extern Variables                                  *
- *******************************************************************************/
-/* structure of timer 3 configuration that the user will set */
-extern StrTimer3_config_t Timer3_config_t;
-
 /********************************************************************************
  *                          Functions implementation							*
  *******************************************************************************/
@@ -526,8 +572,8 @@ extern StrTimer3_config_t Timer3_config_t;
 /********************************************************************************
  * Function Name:	Timer3_Initialization
  *
- * Description: 	Initialize timer 3 with specified configuration in 
- *                  configuration structure. 
+ * Description: 	Initialize timer 3 with its configuration in
+ *                  timers_config.h. 
  *
  * Inputs:			NULL
  *
@@ -535,7 +581,7 @@ extern StrTimer3_config_t Timer3_config_t;
  *
  * Return:			NULL
  *******************************************************************************/
-extern void Timer3_Initialization(void);
+#define Timer3_Initialization()                    Timer_Initialization(TIMER_ID_3)
 
 /********************************************************************************
  * Function Name:	Timer3_enable
@@ -548,7 +594,7 @@ extern void Timer3_Initialization(void);
  *
  * Return:			NULL
  *******************************************************************************/
-extern void Timer3_enable(void);
+#define Timer3_enable()                            Timer_enable(TIMER_ID_3)
 
 /********************************************************************************
  * Function Name:	Timer3_disable
@@ -561,12 +607,13 @@ extern void Timer3_enable(void);
  *
  * Return:			NULL
  *******************************************************************************/
-extern void Timer3_disable(void);
+#define Timer3_disable()                           Timer_disable(TIMER_ID_3)
 
 /********************************************************************************
  * Function Name:	Timer3_read_counter
  *
- * Description: 	read the number has been counted from zero by timer 3. 
+ * Description: 	read the number has been counted from zero by timer 3,
+ *                  the two bytes are from the same count.
  *
  * Inputs:			NULL
  *
@@ -574,7 +621,7 @@ extern void Timer3_disable(void);
  *
  * Return:			uint16       number of counts
  *******************************************************************************/
-extern uint16 Timer3_read_counter(void);
+#define Timer3_read_counter()                      Timer_read_counter(TIMER_ID_3)
 
 /********************************************************************************
  * Function Name:	Timer3_write_counter
@@ -588,7 +635,8 @@ extern uint16 Timer3_read_counter(void);
  *
  * Return:			NULL
  *******************************************************************************/
-extern void Timer3_write_counter(uint16 a_u16init_value_for_timer);
+#define Timer3_write_counter(a_u16init_value_for_timer) \
+        Timer_write_counter(TIMER_ID_3 , (a_u16init_value_for_timer))
 
 /********************************************************************************
  * Function Name:	Timer3_used_for_both_CCP_modules
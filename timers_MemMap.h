@@ -23,9 +23,13 @@
 /*******************************************************************************
  *                              Definitions                                    *
  *******************************************************************************/
-#define TIMER_0_HIGH_REG                            *(volatile uint8*)0xFD7
-#define TIMER_0_LOW_REG                             *(volatile uint8*)0xFD6
-#define TIMER_0_CONTROL_REG                         *(volatile uint8*)0xFD5
+/* addresses of the registers are used by the descriptors table of timers */
+#define TIMER_0_HIGH_ADDRESS                        0xFD7u
+#define TIMER_0_HIGH_REG                            REGISTER_8BIT(TIMER_0_HIGH_ADDRESS)
+#define TIMER_0_LOW_ADDRESS                         0xFD6u
+#define TIMER_0_LOW_REG                             REGISTER_8BIT(TIMER_0_LOW_ADDRESS)
+#define TIMER_0_CONTROL_ADDRESS                     0xFD5u
+#define TIMER_0_CONTROL_REG                         REGISTER_8BIT(TIMER_0_CONTROL_ADDRESS)
 #define TIMER_0_ON_OFF_BIT                          7u
 #define TIMER_0_8BIT_16BIT_SELECT                   6u
 #define TIMER_0_CLOCK_SOURCE_SELECT                 5u
@@ -35,9 +39,12 @@
 #define TIMER_0_PRESCALER_SELECT_BIT_1              1u
 #define TIMER_0_PRESCALER_SELECT_BIT_0              0u
 
-#define TIMER_1_HIGH_REG                            *(volatile uint8*)0xFCF
-#define TIMER_1_LOW_REG                             *(volatile uint8*)0xFCE
-#define TIMER_1_CONTROL_REG                         *(volatile uint8*)0xFCD
+#define TIMER_1_HIGH_ADDRESS                        0xFCFu
+#define TIMER_1_HIGH_REG                            REGISTER_8BIT(TIMER_1_HIGH_ADDRESS)
+#define TIMER_1_LOW_ADDRESS                         0xFCEu
+#define TIMER_1_LOW_REG                             REGISTER_8BIT(TIMER_1_LOW_ADDRESS)
+#define TIMER_1_CONTROL_ADDRESS                     0xFCDu
+#define TIMER_1_CONTROL_REG                         REGISTER_8BIT(TIMER_1_CONTROL_ADDRESS)
 #define TIMER_1_8BIT_16BIT_SELECT                   7u
 #define TIMER_1_SYSTEM_CLOCK_STATUS                 6u
 #define TIMER_1_PRESCALER_SELECT_BIT_1              5u
@@ -47,9 +54,12 @@
 #define TIMER_1_CLOCK_SOURCE_SELECT                 1u
 #define TIMER_1_ON_OFF_BIT                          0u
 
-#define TIMER_2_REG                                 *(volatile uint8*)0xFCC
-#define TIMER_2_PERIOD_REG                          *(volatile uint8*)0xFCB
-#define TIMER_2_CONTROL_REG                         *(volatile uint8*)0xFCA
+#define TIMER_2_COUNTER_ADDRESS                     0xFCCu
+#define TIMER_2_REG                                 REGISTER_8BIT(TIMER_2_COUNTER_ADDRESS)
+#define TIMER_2_PERIOD_ADDRESS                      0xFCBu
+#define TIMER_2_PERIOD_REG                          REGISTER_8BIT(TIMER_2_PERIOD_ADDRESS)
+#define TIMER_2_CONTROL_ADDRESS                     0xFCAu
+#define TIMER_2_CONTROL_REG                         REGISTER_8BIT(TIMER_2_CONTROL_ADDRESS)
 #define TIMER_2_POSTSCALER_SELECT_BIT_3             6u
 #define TIMER_2_POSTSCALER_SELECT_BIT_2             5u
 #define TIMER_2_POSTSCALER_SELECT_BIT_1             4u
@@ -58,9 +68,12 @@
 #define TIMER_2_PRESCALER_SELECT_BIT_1              1u
 #define TIMER_2_PRESCALER_SELECT_BIT_0              0u
 
-#define TIMER_3_HIGH_REG                            *(volatile uint8*)0xFB3
-#define TIMER_3_LOW_REG                             *(volatile uint8*)0xFB2
-#define TIMER_3_CONTROL_REG                         *(volatile uint8*)0xFB1
+#define TIMER_3_HIGH_ADDRESS                        0xFB3u
+#define TIMER_3_HIGH_REG                            REGISTER_8BIT(TIMER_3_HIGH_ADDRESS)
+#define TIMER_3_LOW_ADDRESS                         0xFB2u
+#define TIMER_3_LOW_REG                             REGISTER_8BIT(TIMER_3_LOW_ADDRESS)
+#define TIMER_3_CONTROL_ADDRESS                     0xFB1u
+#define TIMER_3_CONTROL_REG                         REGISTER_8BIT(TIMER_3_CONTROL_ADDRESS)
 #define TIMER_3_8BIT_16BIT_SELECT                   7u
 #define TIMER_3_TIMER_1_CCP_ENABLE_BIT_2            6u
 #define TIMER_3_PRESCALER_SELECT_BIT_1              5u
@@ -5,7 +5,7 @@
  * Author:              Ahmed Eldakhly
  * 
  * Comments:            it contains configurations for all timer peripherals to 
- *                      enable or disable them.
+ *                      enable or disable them and their constant parameters.
  * 
  * Revision history:    25/2/2020
  * 
@@ -23,9 +23,26 @@
 #define TIMER_DISABLE                       1u
 /*-----------------------------------------------------------------------------*/
 #define TIMER0                      TIMER_ENABLE
-#define TIMER1                      TIMER_DISABLE
+#define TIMER1                      TIMER_ENABLE
 #define TIMER2                      TIMER_ENABLE
-#define TIMER3                      TIMER_DISABLE
+#define TIMER3                      TIMER_ENABLE
+/*-----------------------------------------------------------------------------*/
+/* configurations of timer 0, timer 1 and timer 3 are constant so their control
+ * register values are computed at build time in the descriptors table */
+#define TIMER0_PRESCALER            TIMER0_PRESCALER_32
+#define TIMER0_SIZE                 TIMER_16BIT_SIZE
+#define TIMER0_CLOCK_SOURCE         TIMER_INTERNAL_CLOCK
+#define TIMER0_EDGE_TYPE_ON_TCKI    TIMER0_NO_TRANSITION_ON_TCKI
+
+#define TIMER1_PRESCALER            TIMER1_NO_PRESCALER
+#define TIMER1_SIZE                 TIMER_16BIT_SIZE
+#define TIMER1_CLOCK_SOURCE         TIMER_INTERNAL_CLOCK
+#define TIMER1_EXTERNAL_CLOCK_SYNC     TIMER1_NO_EXTERNAL_CLOCK
+
+#define TIMER3_PRESCALER            TIMER3_NO_PRESCALER
+#define TIMER3_SIZE                 TIMER_16BIT_SIZE
+#define TIMER3_CLOCK_SOURCE         TIMER_INTERNAL_CLOCK
+#define TIMER3_EXTERNAL_CLOCK_SYNC     TIMER3_NO_EXTERNAL_CLOCK
 
 #endif	/* TIMERS_CONFIG_H */
 